@@ -43,6 +43,16 @@ V8_PLATFORM_EXPORT std::unique_ptr<v8::Platform> NewDefaultPlatform(
         InProcessStackDumping::kDisabled,
     std::unique_ptr<v8::TracingController> tracing_controller = {});
 
+/**
+ * Returns a new v8::JobHandle that runs |job_task| on worker threads of
+ * |platform|, using at most |num_worker_threads| of them at a time in addition
+ * to the thread joining the job. Embedders can use this to implement
+ * v8::Platform::PostJob() on top of their CallOnWorkerThread() and friends.
+ */
+V8_PLATFORM_EXPORT std::unique_ptr<v8::JobHandle> NewDefaultJobHandle(
+    v8::Platform* platform, v8::TaskPriority priority,
+    std::unique_ptr<v8::JobTask> job_task, size_t num_worker_threads);
+
 /**
  * Pumps the message loop for the given isolate.
  *
@@ -8,7 +8,10 @@
 #include <stddef.h>
 #include <stdint.h>
 #include <stdlib.h>  // For abort.
+#include <atomic>
+#include <condition_variable>  // NOLINT(build/c++11)
 #include <memory>
+#include <mutex>  // NOLINT(build/c++11)
 #include <string>
 
 #include "v8config.h"  // NOLINT(build/include)
@@ -113,6 +116,127 @@ class TaskRunner {
   TaskRunner& operator=(const TaskRunner&) = delete;
 };
 
+/**
+ * Priority of a task posted to a worker thread, see Platform::PostJob().
+ */
+enum class TaskPriority : uint8_t {
+  /**
+   * Best effort tasks are not critical for performance of the application. The
+   * platform implementation should preempt such tasks if higher priority tasks
+   * arrive.
+   */
+  kBestEffort,
+  /**
+   * User visible tasks are long running background tasks that will
+   * improve performance and memory usage of the application upon completion.
+   * Example: background compilation and garbage collection.
+   */
+  kUserVisible,
+  /**
+   * User blocking tasks are highest priority tasks that block the execution
+   * thread (e.g. major garbage collection). They must be finished as soon as
+   * possible.
+   */
+  kUserBlocking,
+};
+
+/**
+ * Delegate that's passed to a Job's worker task, providing an entry point to
+ * communicate with the scheduler.
+ */
+class JobDelegate {
+ public:
+  /**
+   * Returns true if this thread should return from the worker task on the
+   * current thread ASAP, e.g. because the job was cancelled. Workers should
+   * periodically invoke ShouldYield() as often as is reasonable.
+   */
+  virtual bool ShouldYield() = 0;
+
+  /**
+   * Notifies the scheduler that max concurrency was increased, and the number
+   * of workers should be adjusted accordingly. See Platform::PostJob() for
+   * more details.
+   */
+  virtual void NotifyConcurrencyIncrease() = 0;
+
+  /**
+   * Returns a task_id unique among threads currently running this job, such
+   * that GetTaskId() < worker count. To achieve this, the same task_id may be
+   * reused by a different thread after a worker_id returns from Run().
+   */
+  virtual uint8_t GetTaskId() = 0;
+
+  /**
+   * Returns true if the current task is called from the thread currently
+   * running JobHandle::Join().
+   */
+  virtual bool IsJoiningThread() const = 0;
+};
+
+/**
+ * Handle returned when posting a Job. Provides methods to control execution of
+ * the posted Job.
+ */
+class JobHandle {
+ public:
+  virtual ~JobHandle() = default;
+
+  /**
+   * Notifies the scheduler that max concurrency was increased, and the number
+   * of workers should be adjusted accordingly. See Platform::PostJob() for
+   * more details.
+   */
+  virtual void NotifyConcurrencyIncrease() = 0;
+
+  /**
+   * Contributes to the job on this thread. Doesn't return until all tasks have
+   * completed and max concurrency becomes 0. When Join() is called and max
+   * concurrency reaches 0, it should not increase again. This also promotes
+   * this Job's priority to be at least as high as the calling thread's
+   * priority.
+   */
+  virtual void Join() = 0;
+
+  /**
+   * Forces all existing workers to yield ASAP. Waits until they have all
+   * returned from the Job's callback before returning.
+   */
+  virtual void Cancel() = 0;
+
+  /**
+   * Forces all existing workers to yield ASAP but doesn't wait for them.
+   * Warning, this is dangerous if the Job's callback is bound to or has access
+   * to state which may be deleted after this call.
+   */
+  virtual void CancelAndDetach() = 0;
+
+  /**
+   * Returns true if associated with a Job and other methods may be called.
+   * Returns false after Join(), Cancel() or CancelAndDetach() was called.
+   */
+  virtual bool IsRunning() = 0;
+};
+
+/**
+ * A JobTask represents work to run in parallel from Platform::PostJob().
+ */
+class JobTask {
+ public:
+  virtual ~JobTask() = default;
+
+  virtual void Run(JobDelegate* delegate) = 0;
+
+  /**
+   * Controls the maximum number of threads calling Run() concurrently, given
+   * the number of threads currently assigned to this job and executing Run().
+   * Run() is only invoked if the number of threads previously running Run() was
+   * less than the value returned. Since GetMaxConcurrency() is a leaf function,
+   * it must not call back any JobHandle methods.
+   */
+  virtual size_t GetMaxConcurrency(size_t worker_count) const = 0;
+};
+
 /**
  * The interface represents complex arguments to trace events.
  */
@@ -274,6 +398,204 @@ class PageAllocator {
   virtual bool DiscardSystemPages(void* address, size_t size) { return true; }
 };
 
+class Platform;
+
+namespace internal {
+
+// The job behind the default implementation of Platform::PostJob(). At most
+// one worker task, posted through the CallOnWorkerThread() family, is pending
+// or running at a time, and it keeps calling JobTask::Run() while max
+// concurrency is above the number of threads running the job. The thread
+// calling JobHandle::Join() takes part as well.
+class SingleWorkerJobState
+    : public std::enable_shared_from_this<SingleWorkerJobState> {
+ public:
+  // The worker thread and the joining thread.
+  static constexpr uint8_t kMaxParticipants = 2;
+
+  class Delegate : public JobDelegate {
+   public:
+    Delegate(SingleWorkerJobState* outer, bool is_joining_thread)
+        : outer_(outer), is_joining_thread_(is_joining_thread) {}
+    ~Delegate() {
+      if (task_id_ != kMaxParticipants) outer_->ReleaseTaskId(task_id_);
+    }
+    Delegate(const Delegate&) = delete;
+    Delegate& operator=(const Delegate&) = delete;
+
+    bool ShouldYield() override { return outer_->is_canceled(); }
+    void NotifyConcurrencyIncrease() override {
+      outer_->NotifyConcurrencyIncrease();
+    }
+    uint8_t GetTaskId() override {
+      if (task_id_ == kMaxParticipants) task_id_ = outer_->AcquireTaskId();
+      return task_id_;
+    }
+    bool IsJoiningThread() const override { return is_joining_thread_; }
+
+   private:
+    SingleWorkerJobState* const outer_;
+    const bool is_joining_thread_;
+    uint8_t task_id_ = kMaxParticipants;
+  };
+
+  SingleWorkerJobState(Platform* platform, TaskPriority priority,
+                       std::unique_ptr<JobTask> job_task)
+      : platform_(platform),
+        priority_(priority),
+        job_task_(std::move(job_task)) {}
+
+  bool is_canceled() const {
+    return is_canceled_.load(std::memory_order_relaxed);
+  }
+
+  void NotifyConcurrencyIncrease() {
+    if (is_canceled()) return;
+    bool post_worker = false;
+    {
+      std::lock_guard<std::mutex> guard(mutex_);
+      if (!worker_posted_ && ShouldParticipateLocked()) {
+        worker_posted_ = true;
+        post_worker = true;
+      }
+      // A joining thread may take part in the new work.
+      state_changed_.notify_all();
+    }
+    if (post_worker) PostWorker();
+  }
+
+  void RunWorker() {
+    std::unique_lock<std::mutex> lock(mutex_);
+    while (ShouldParticipateLocked()) {
+      ++active_participants_;
+      lock.unlock();
+      {
+        Delegate delegate(this, false);
+        job_task_->Run(&delegate);
+      }
+      lock.lock();
+      --active_participants_;
+    }
+    worker_posted_ = false;
+    state_changed_.notify_all();
+  }
+
+  void Join() {
+    std::unique_lock<std::mutex> lock(mutex_);
+    while (true) {
+      while (!ShouldParticipateLocked()) {
+        if (active_participants_ == 0) return;
+        state_changed_.wait(lock);
+      }
+      ++active_participants_;
+      lock.unlock();
+      {
+        Delegate delegate(this, true);
+        job_task_->Run(&delegate);
+      }
+      lock.lock();
+      --active_participants_;
+    }
+  }
+
+  void CancelAndWait() {
+    is_canceled_.store(true, std::memory_order_relaxed);
+    std::unique_lock<std::mutex> lock(mutex_);
+    while (active_participants_ > 0) state_changed_.wait(lock);
+  }
+
+  void CancelAndDetach() {
+    is_canceled_.store(true, std::memory_order_relaxed);
+  }
+
+ private:
+  uint8_t AcquireTaskId() {
+    std::lock_guard<std::mutex> guard(mutex_);
+    uint8_t task_id = 0;
+    while (assigned_task_ids_ & (1 << task_id)) ++task_id;
+    assigned_task_ids_ |= 1 << task_id;
+    return task_id;
+  }
+
+  void ReleaseTaskId(uint8_t task_id) {
+    std::lock_guard<std::mutex> guard(mutex_);
+    assigned_task_ids_ &= ~(1 << task_id);
+  }
+
+  // Whether one more thread should call JobTask::Run().
+  bool ShouldParticipateLocked() const {
+    return !is_canceled() &&
+           job_task_->GetMaxConcurrency(active_participants_) >
+               active_participants_;
+  }
+
+  // Posts the worker task. Must be called without holding |mutex_|.
+  inline void PostWorker();
+
+  Platform* const platform_;
+  const TaskPriority priority_;
+  std::unique_ptr<JobTask> job_task_;
+
+  // All non-atomic members below are protected by |mutex_|.
+  std::mutex mutex_;
+  // Number of threads running |job_task_|.
+  size_t active_participants_ = 0;
+  // Whether the worker task is pending or running.
+  bool worker_posted_ = false;
+  // Bit i is set while task id i is in use.
+  unsigned assigned_task_ids_ = 0;
+  std::atomic<bool> is_canceled_{false};
+  // Signaled when a thread stops running |job_task_| or max concurrency may
+  // have increased.
+  std::condition_variable state_changed_;
+};
+
+class SingleWorkerJobTask : public Task {
+ public:
+  explicit SingleWorkerJobTask(std::weak_ptr<SingleWorkerJobState> state)
+      : state_(std::move(state)) {}
+
+  void Run() override {
+    std::shared_ptr<SingleWorkerJobState> shared_state = state_.lock();
+    if (shared_state) shared_state->RunWorker();
+  }
+
+ private:
+  std::weak_ptr<SingleWorkerJobState> state_;
+};
+
+class SingleWorkerJobHandle final : public JobHandle {
+ public:
+  explicit SingleWorkerJobHandle(std::shared_ptr<SingleWorkerJobState> state)
+      : state_(std::move(state)) {
+    state_->NotifyConcurrencyIncrease();
+  }
+  SingleWorkerJobHandle(const SingleWorkerJobHandle&) = delete;
+  SingleWorkerJobHandle& operator=(const SingleWorkerJobHandle&) = delete;
+
+  void NotifyConcurrencyIncrease() override {
+    state_->NotifyConcurrencyIncrease();
+  }
+  void Join() override {
+    state_->Join();
+    state_ = nullptr;
+  }
+  void Cancel() override {
+    state_->CancelAndWait();
+    state_ = nullptr;
+  }
+  void CancelAndDetach() override {
+    state_->CancelAndDetach();
+    state_ = nullptr;
+  }
+  bool IsRunning() override { return state_ != nullptr; }
+
+ private:
+  std::shared_ptr<SingleWorkerJobState> state_;
+};
+
+}  // namespace internal
+
 /**
  * V8 Platform abstraction layer.
  *
@@ -363,6 +685,69 @@ class Platform {
   virtual void CallDelayedOnWorkerThread(std::unique_ptr<Task> task,
                                          double delay_in_seconds) = 0;
 
+  /**
+   * Posts |job_task| to run in parallel. Returns a JobHandle associated with
+   * the Job, which can be joined or canceled.
+   * This avoids degenerate cases:
+   * - Calling CallOnWorkerThread() for each work item, causing significant
+   *   overhead.
+   * - Fixed number of CallOnWorkerThread() calls that split the work and might
+   *   run for a long time. This is problematic when many components post
+   *   "num cores" tasks and all expect to use all the cores. In these cases,
+   *   the scheduler lacks context to be fair to multiple same-priority requests
+   *   and/or ability to request lower priority work to yield when high priority
+   *   work comes in.
+   * A canonical implementation of |job_task| looks like:
+   * class MyJobTask : public JobTask {
+   *  public:
+   *   MyJobTask(...) : worker_queue_(...) {}
+   *   // JobTask:
+   *   void Run(JobDelegate* delegate) override {
+   *     while (!delegate->ShouldYield()) {
+   *       // Smallest unit of work.
+   *       auto work_item = worker_queue_.TakeWorkItem(); // Thread safe.
+   *       if (!work_item) return;
+   *       ProcessWork(work_item);
+   *     }
+   *   }
+   *
+   *   size_t GetMaxConcurrency(size_t worker_count) const override {
+   *     return worker_queue_.GetSize(); // Thread safe.
+   *   }
+   * };
+   * auto handle = PostJob(TaskPriority::kUserVisible,
+   *                       std::make_unique<MyJobTask>(...));
+   * handle->Join();
+   *
+   * PostJob() and methods of the returned JobHandle/JobDelegate, must never be
+   * called while holding a lock that could be acquired by JobTask::Run or
+   * JobTask::GetMaxConcurrency -- that could result in a deadlock. This is
+   * because [1] JobTask::GetMaxConcurrency may be invoked while holding
+   * internal lock (A), hence JobTask::GetMaxConcurrency can only use a lock (B)
+   * if that lock is *never* held while calling back into JobHandle from any
+   * thread (A=>B/B=>A deadlock) and [2] JobTask::Run or
+   * JobTask::GetMaxConcurrency may be invoked synchronously from JobHandle
+   * (B=>JobHandle::foo=>B deadlock).
+   *
+   * A sufficient PostJob() implementation that uses the default Job provided
+   * in libplatform looks like:
+   *  std::unique_ptr<JobHandle> PostJob(
+   *      TaskPriority priority, std::unique_ptr<JobTask> job_task) override {
+   *    return v8::platform::NewDefaultJobHandle(
+   *        this, priority, std::move(job_task), NumberOfWorkerThreads());
+   * }
+   *
+   * The default implementation runs the job on at most one worker thread at a
+   * time, posted through CallOnWorkerThread() and friends, plus the thread
+   * calling JobHandle::Join().
+   */
+  virtual std::unique_ptr<JobHandle> PostJob(
+      TaskPriority priority, std::unique_ptr<JobTask> job_task) {
+    return std::unique_ptr<JobHandle>(new internal::SingleWorkerJobHandle(
+        std::make_shared<internal::SingleWorkerJobState>(this, priority,
+                                                         std::move(job_task))));
+  }
+
   /**
    * Returns true if idle tasks are enabled for the given |isolate|.
    */
@@ -411,6 +796,21 @@ class Platform {
   V8_EXPORT static double SystemClockTimeMillis();
 };
 
+void internal::SingleWorkerJobState::PostWorker() {
+  std::unique_ptr<Task> worker(new SingleWorkerJobTask(shared_from_this()));
+  switch (priority_) {
+    case TaskPriority::kBestEffort:
+      platform_->CallLowPriorityTaskOnWorkerThread(std::move(worker));
+      break;
+    case TaskPriority::kUserVisible:
+      platform_->CallOnWorkerThread(std::move(worker));
+      break;
+    case TaskPriority::kUserBlocking:
+      platform_->CallBlockingTaskOnWorkerThread(std::move(worker));
+      break;
+  }
+}
+
 }  // namespace v8
 
 #endif  // V8_V8_PLATFORM_H_
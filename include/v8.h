@@ -39,6 +39,7 @@ namespace v8 {
 class AccessorSignature;
 class Array;
 class ArrayBuffer;
+class BackingStore;
 class BigInt;
 class BigIntObject;
 class Boolean;
@@ -2250,6 +2251,45 @@ class V8_EXPORT JSON {
   static V8_WARN_UNUSED_RESULT MaybeLocal<String> Stringify(
       Local<Context> context, Local<Value> json_object,
       Local<String> gap = Local<String>());
+
+  /**
+   * Receives the UTF-8 encoded output of StringifyToStream in chunks.
+   */
+  class V8_EXPORT OutputStream {  // NOLINT
+   public:
+    enum WriteResult { kContinue = 0, kAbort = 1 };
+    virtual ~OutputStream() = default;
+    /** Get preferred output chunk size in bytes. Called only once. */
+    virtual int GetChunkSize() { return 16 * 1024; }
+    /**
+     * Writes the next chunk of output into the stream. Writing can be stopped
+     * by returning kAbort as function result. Chunks never end in the middle
+     * of a UTF-8 sequence.
+     */
+    virtual WriteResult WriteUtf8Chunk(const char* data, int size) = 0;
+    /**
+     * Notify about the end of stream. Not called if writing was aborted or
+     * stringification threw an exception.
+     */
+    virtual void EndOfStream() = 0;
+  };
+
+  /**
+   * Like Stringify, but writes the result as UTF-8 to |stream| instead of
+   * creating a string on the JavaScript heap. Chunks are written while the
+   * object graph is being traversed, so the output may be incomplete if an
+   * exception is thrown.
+   *
+   * \param json_object The JSON-serializable object to stringify.
+   * \param stream The stream to which the output is written.
+   * \return Just(true) if the whole output has been written, Just(false) if
+   *   writing was aborted by the stream or |json_object| does not have a JSON
+   *   representation (e.g. it is undefined or a function), and Nothing if an
+   *   exception was thrown.
+   */
+  static V8_WARN_UNUSED_RESULT Maybe<bool> StringifyToStream(
+      Local<Context> context, Local<Value> json_object, OutputStream* stream,
+      Local<String> gap = Local<String>());
 };
 
 /**
@@ -2291,6 +2331,24 @@ class V8_EXPORT ValueSerializer {
 
     virtual Maybe<uint32_t> GetWasmModuleTransferId(
         Isolate* isolate, Local<WasmModuleObject> module);
+
+    /**
+     * Called when the ValueSerializer is going to serialize the contents of an
+     * ArrayBuffer or a string of at least the size set with
+     * ValueSerializer::SetOutOfBandThreshold. |backing_store| holds a copy of
+     * the contents that nothing else refers to. If the embedder keeps it and
+     * returns an ID, only the ID is written to the buffer. When deserializing,
+     * this ID will be passed to
+     * ValueDeserializer::Delegate::GetOutOfBandBackingStoreFromId, and the
+     * deserialized value refers to the backing store instead of copying the
+     * contents out of the buffer.
+     *
+     * If Nothing<uint32_t>() is returned, the contents are written to the
+     * buffer as usual. The default implementation always does so.
+     */
+    virtual Maybe<uint32_t> GetOutOfBandBackingStoreId(
+        Isolate* isolate, std::shared_ptr<BackingStore> backing_store);
+
     /**
      * Allocates memory for the buffer of at least the size provided. The actual
      * size (which may be greater or equal) is written to |actual_size|. If no
@@ -2354,6 +2412,20 @@ class V8_EXPORT ValueSerializer {
    */
   void SetTreatArrayBufferViewsAsHostObjects(bool mode);
 
+  /**
+   * Sets the minimum size in bytes of ArrayBuffer contents and strings that
+   * are offered to Delegate::GetOutOfBandBackingStoreId instead of being
+   * copied to the buffer. This should not be called when no Delegate was
+   * passed.
+   *
+   * Data written this way can only be deserialized together with the backing
+   * stores kept by the delegate, so it is suitable for passing values between
+   * isolates but must not be persisted.
+   *
+   * The default of 0 writes all contents to the buffer.
+   */
+  void SetOutOfBandThreshold(size_t threshold_in_bytes);
+
   /**
    * Write raw data in various common formats to the buffer.
    * Note that integer types are written in base-128 varint format, not with a
@@ -2402,6 +2474,19 @@ class V8_EXPORT ValueDeserializer {
      */
     virtual MaybeLocal<SharedArrayBuffer> GetSharedArrayBufferFromId(
         Isolate* isolate, uint32_t clone_id);
+
+    /**
+     * Get a backing store given an ID previously provided by
+     * ValueSerializer::Delegate::GetOutOfBandBackingStoreId. A deserialized
+     * ArrayBuffer takes ownership of the contents, so the backing store must
+     * not be passed to any other ArrayBuffer afterwards. Deserialized strings
+     * only read from it.
+     *
+     * If the backing store is not available, an exception should be thrown and
+     * nullptr returned.
+     */
+    virtual std::shared_ptr<BackingStore> GetOutOfBandBackingStoreFromId(
+        Isolate* isolate, uint32_t id);
   };
 
   ValueDeserializer(Isolate* isolate, const uint8_t* data, size_t size);
@@ -7608,6 +7693,37 @@ class V8_EXPORT SharedMemoryStatistics {
   friend class V8;
 };
 
+/**
+ * Statistics about the heap budget shared by all isolates of the process.
+ *
+ * Instances of this class can be passed to
+ * v8::V8::GetProcessHeapBudgetStatistics.
+ */
+class V8_EXPORT ProcessHeapBudgetStatistics {
+ public:
+  ProcessHeapBudgetStatistics();
+  size_t budget() { return budget_; }
+  /**
+   * The combined old generation size of all isolates, as of the last full
+   * garbage collection of each.
+   */
+  size_t total_heap_size() { return total_heap_size_; }
+  size_t number_of_isolates() { return number_of_isolates_; }
+  /**
+   * The number of times an isolate was asked to reduce memory because the
+   * process was over budget.
+   */
+  size_t reductions_requested() { return reductions_requested_; }
+
+ private:
+  size_t budget_;
+  size_t total_heap_size_;
+  size_t number_of_isolates_;
+  size_t reductions_requested_;
+
+  friend class V8;
+};
+
 /**
  * Collection of V8 heap information.
  *
@@ -7710,6 +7826,33 @@ class V8_EXPORT HeapCodeStatistics {
   friend class Isolate;
 };
 
+/**
+ * Counters of the microtasks run on the microtask queues of an isolate, see
+ * Isolate::GetMicrotaskStatistics().
+ */
+class V8_EXPORT MicrotaskStatistics {
+ public:
+  MicrotaskStatistics();
+  /** Number of microtask checkpoints that ran at least one microtask. */
+  size_t checkpoint_count() { return checkpoint_count_; }
+  /** Number of microtasks run, including promise reaction jobs. */
+  size_t microtask_count() { return microtask_count_; }
+  size_t promise_reaction_job_count() { return promise_reaction_job_count_; }
+  /**
+   * Number of times a context was entered to run microtasks. Consecutive
+   * promise reaction jobs of the same context enter it only once.
+   */
+  size_t context_enter_count() { return context_enter_count_; }
+
+ private:
+  size_t checkpoint_count_;
+  size_t microtask_count_;
+  size_t promise_reaction_job_count_;
+  size_t context_enter_count_;
+
+  friend class Isolate;
+};
+
 /**
  * A JIT code event is issued each time code is added, moved or removed.
  *
@@ -8716,6 +8859,12 @@ class V8_EXPORT Isolate {
    */
   bool GetHeapCodeAndMetadataStatistics(HeapCodeStatistics* object_statistics);
 
+  /**
+   * Get counters of the microtasks run by this isolate, summed over all of its
+   * microtask queues that are still alive.
+   */
+  void GetMicrotaskStatistics(MicrotaskStatistics* microtask_statistics);
+
   /**
    * This API is experimental and may change significantly.
    *
@@ -9741,6 +9890,22 @@ class V8_EXPORT V8 {
    */
   static void GetSharedMemoryStatistics(SharedMemoryStatistics* statistics);
 
+  /**
+   * Sets a budget in bytes for the combined old generation size of all
+   * isolates in the process. When the isolates together exceed it, V8 asks
+   * idle isolates first, and then the largest ones, to perform
+   * memory-reducing garbage collections. The heap limits of all isolates
+   * only grow into their share of the headroom left in the budget. A budget
+   * of 0, the default, turns this off.
+   */
+  static void SetProcessHeapBudget(size_t budget_in_bytes);
+
+  /**
+   * Get statistics about the heap budget shared by all isolates.
+   */
+  static void GetProcessHeapBudgetStatistics(
+      ProcessHeapBudgetStatistics* statistics);
+
  private:
   V8();
 
@@ -50,6 +50,7 @@
 #include "src/handles/global-handles.h"
 #include "src/heap/embedder-tracing.h"
 #include "src/heap/heap-inl.h"
+#include "src/heap/process-heap-budget.h"
 #include "src/init/bootstrapper.h"
 #include "src/init/icu_util.h"
 #include "src/init/startup-data-util.h"
@@ -3166,6 +3167,23 @@ MaybeLocal<String> JSON::Stringify(Local<Context> context,
   RETURN_ESCAPED(result);
 }
 
+Maybe<bool> JSON::StringifyToStream(Local<Context> context,
+                                    Local<Value> json_object,
+                                    OutputStream* stream, Local<String> gap) {
+  auto isolate = reinterpret_cast<i::Isolate*>(context->GetIsolate());
+  ENTER_V8(isolate, context, JSON, StringifyToStream, Nothing<bool>(),
+           i::HandleScope);
+  i::Handle<i::Object> object = Utils::OpenHandle(*json_object);
+  i::Handle<i::String> gap_string = gap.IsEmpty()
+                                        ? isolate->factory()->empty_string()
+                                        : Utils::OpenHandle(*gap);
+  Maybe<bool> result =
+      i::JsonStringifyToStream(isolate, object, gap_string, stream);
+  has_pending_exception = result.IsNothing();
+  RETURN_ON_FAILED_EXECUTION_PRIMITIVE(bool);
+  return result;
+}
+
 // --- V a l u e   S e r i a l i z a t i o n ---
 
 Maybe<bool> ValueSerializer::Delegate::WriteHostObject(Isolate* v8_isolate,
@@ -3191,6 +3209,11 @@ Maybe<uint32_t> ValueSerializer::Delegate::GetWasmModuleTransferId(
   return Nothing<uint32_t>();
 }
 
+Maybe<uint32_t> ValueSerializer::Delegate::GetOutOfBandBackingStoreId(
+    Isolate* v8_isolate, std::shared_ptr<BackingStore> backing_store) {
+  return Nothing<uint32_t>();
+}
+
 void* ValueSerializer::Delegate::ReallocateBufferMemory(void* old_buffer,
                                                         size_t size,
                                                         size_t* actual_size) {
@@ -3224,6 +3247,10 @@ void ValueSerializer::SetTreatArrayBufferViewsAsHostObjects(bool mode) {
   private_->serializer.SetTreatArrayBufferViewsAsHostObjects(mode);
 }
 
+void ValueSerializer::SetOutOfBandThreshold(size_t threshold_in_bytes) {
+  private_->serializer.SetOutOfBandThreshold(threshold_in_bytes);
+}
+
 Maybe<bool> ValueSerializer::WriteValue(Local<Context> context,
                                         Local<Value> value) {
   auto isolate = reinterpret_cast<i::Isolate*>(context->GetIsolate());
@@ -3290,6 +3317,16 @@ ValueDeserializer::Delegate::GetSharedArrayBufferFromId(Isolate* v8_isolate,
   return MaybeLocal<SharedArrayBuffer>();
 }
 
+std::shared_ptr<BackingStore>
+ValueDeserializer::Delegate::GetOutOfBandBackingStoreFromId(
+    Isolate* v8_isolate, uint32_t id) {
+  i::Isolate* isolate = reinterpret_cast<i::Isolate*>(v8_isolate);
+  isolate->ScheduleThrow(*isolate->factory()->NewError(
+      isolate->error_function(),
+      i::MessageTemplate::kDataCloneDeserializationError));
+  return nullptr;
+}
+
 struct ValueDeserializer::PrivateData {
   PrivateData(i::Isolate* i, i::Vector<const uint8_t> data, Delegate* delegate)
       : isolate(i), deserializer(i, data, delegate) {}
@@ -5787,6 +5824,12 @@ SharedMemoryStatistics::SharedMemoryStatistics()
       read_only_space_used_size_(0),
       read_only_space_physical_size_(0) {}
 
+ProcessHeapBudgetStatistics::ProcessHeapBudgetStatistics()
+    : budget_(0),
+      total_heap_size_(0),
+      number_of_isolates_(0),
+      reductions_requested_(0) {}
+
 HeapStatistics::HeapStatistics()
     : total_heap_size_(0),
       total_heap_size_executable_(0),
@@ -5819,6 +5862,12 @@ HeapCodeStatistics::HeapCodeStatistics()
       bytecode_and_metadata_size_(0),
       external_script_source_size_(0) {}
 
+MicrotaskStatistics::MicrotaskStatistics()
+    : checkpoint_count_(0),
+      microtask_count_(0),
+      promise_reaction_job_count_(0),
+      context_enter_count_(0) {}
+
 bool v8::V8::InitializeICU(const char* icu_data_file) {
   return i::InitializeICU(icu_data_file);
 }
@@ -5853,6 +5902,20 @@ void V8::GetSharedMemoryStatistics(SharedMemoryStatistics* statistics) {
 #endif  // V8_SHARED_RO_HEAP
 }
 
+void V8::SetProcessHeapBudget(size_t budget_in_bytes) {
+  i::ProcessHeapBudget::Get()->SetBudget(budget_in_bytes);
+}
+
+void V8::GetProcessHeapBudgetStatistics(
+    ProcessHeapBudgetStatistics* statistics) {
+  i::ProcessHeapBudget::Statistics budget_statistics;
+  i::ProcessHeapBudget::Get()->GetStatistics(&budget_statistics);
+  statistics->budget_ = budget_statistics.budget;
+  statistics->total_heap_size_ = budget_statistics.total_size;
+  statistics->number_of_isolates_ = budget_statistics.number_of_heaps;
+  statistics->reductions_requested_ = budget_statistics.reductions_requested;
+}
+
 template <typename ObjectType>
 struct InvokeBootstrapper;
 
@@ -8635,6 +8698,24 @@ bool Isolate::GetHeapCodeAndMetadataStatistics(
   return true;
 }
 
+void Isolate::GetMicrotaskStatistics(
+    MicrotaskStatistics* microtask_statistics) {
+  i::Isolate* isolate = reinterpret_cast<i::Isolate*>(this);
+  *microtask_statistics = MicrotaskStatistics();
+  i::MicrotaskQueue* default_queue = isolate->default_microtask_queue();
+  i::MicrotaskQueue* queue = default_queue;
+  do {
+    microtask_statistics->checkpoint_count_ += queue->checkpoint_count();
+    microtask_statistics->microtask_count_ +=
+        queue->finished_microtask_count();
+    microtask_statistics->promise_reaction_job_count_ +=
+        queue->promise_reaction_job_count();
+    microtask_statistics->context_enter_count_ +=
+        queue->context_enter_count();
+    queue = queue->next();
+  } while (queue != default_queue);
+}
+
 v8::MaybeLocal<v8::Promise> Isolate::MeasureMemory(
     v8::Local<v8::Context> context, MeasureMemoryMode mode) {
   return v8::MaybeLocal<v8::Promise>();
@@ -29,7 +29,9 @@
 
 #include "src/common/globals.h"
 #include "src/execution/off-thread-isolate.h"
+#include "src/handles/local-handles-inl.h"
 #include "src/heap/factory-inl.h"
+#include "src/heap/local-heap-inl.h"
 #include "src/heap/off-thread-factory-inl.h"
 #include "src/objects/objects-inl.h"
 #include "src/objects/objects.h"
@@ -344,16 +346,112 @@ AstConsString* AstValueFactory::NewConsString(const AstRawString* str1,
   return NewConsString()->AddString(zone_, str1)->AddString(zone_, str2);
 }
 
+namespace {
+
+// Allocates an uninitialized copy of {string} in the old generation from a
+// background thread. Returns an empty handle if {local_heap} has run out of
+// space; the main thread then creates the string itself.
+Handle<String> AllocateStringBackground(Isolate* isolate, LocalHeap* local_heap,
+                                        const AstRawString* string,
+                                        Vector<const byte> literal_bytes) {
+  int length = string->length();
+  int size = string->is_one_byte() ? SeqOneByteString::SizeFor(length)
+                                   : SeqTwoByteString::SizeFor(length);
+  HeapObject result;
+  if (!local_heap->AllocateRaw(size, AllocationType::kOld).To(&result)) {
+    return Handle<String>();
+  }
+  // Only the map is a tagged field, and it is an immortal immovable root, so
+  // no write barriers are needed.
+  ReadOnlyRoots roots(isolate);
+  DisallowHeapAllocation no_gc;
+  if (string->is_one_byte()) {
+    result.set_map_after_allocation(roots.one_byte_string_map(),
+                                    SKIP_WRITE_BARRIER);
+    SeqOneByteString seq_string = SeqOneByteString::cast(result);
+    seq_string.set_length(length);
+    seq_string.set_hash_field(string->hash_field());
+    CopyChars(seq_string.GetChars(no_gc), literal_bytes.begin(), length);
+  } else {
+    result.set_map_after_allocation(roots.string_map(), SKIP_WRITE_BARRIER);
+    SeqTwoByteString seq_string = SeqTwoByteString::cast(result);
+    seq_string.set_length(length);
+    seq_string.set_hash_field(string->hash_field());
+    CopyChars(seq_string.GetChars(no_gc),
+              reinterpret_cast<const uint16_t*>(literal_bytes.begin()),
+              length);
+  }
+  return Handle<String>::cast(local_heap->NewPersistentHandle(result.ptr()));
+}
+
+// Strings allocated by LookupOrAllocateStrings() are internalized in place,
+// unless an equal string was internalized after the lookup.
+Handle<String> InternalizeBackgroundString(Isolate* isolate,
+                                           Handle<String> string) {
+  return isolate->factory()->InternalizeString(string);
+}
+
+Handle<String> InternalizeBackgroundString(OffThreadIsolate* isolate,
+                                           Handle<String> string) {
+  // Strings are only looked up in the background when finalizing on the main
+  // thread.
+  UNREACHABLE();
+}
+
+}  // namespace
+
+void AstValueFactory::LookupOrAllocateStrings(Isolate* isolate,
+                                              LocalHeap* local_heap) {
+  DCHECK(background_strings_.empty());
+  for (AstRawString* current = strings_; current != nullptr;
+       current = current->next()) {
+    Handle<String> background_string;
+    if (!current->IsEmpty()) {
+      LocalHandleScope scope(local_heap);
+      MaybeHandle<String> maybe_existing;
+      if (current->is_one_byte()) {
+        OneByteStringKey key(current->hash_field(), current->literal_bytes_);
+        maybe_existing =
+            StringTable::LookupKeyIfExists(isolate, local_heap, &key);
+      } else {
+        TwoByteStringKey key(
+            current->hash_field(),
+            Vector<const uint16_t>::cast(current->literal_bytes_));
+        maybe_existing =
+            StringTable::LookupKeyIfExists(isolate, local_heap, &key);
+      }
+      Handle<String> existing;
+      if (maybe_existing.ToHandle(&existing)) {
+        background_string = Handle<String>::cast(
+            local_heap->NewPersistentHandle(existing->ptr()));
+      } else if (FLAG_concurrent_allocation) {
+        background_string = AllocateStringBackground(
+            isolate, local_heap, current, current->literal_bytes_);
+      }
+    }
+    background_strings_.push_back(background_string);
+    local_heap->Safepoint();
+  }
+}
+
 template <typename LocalIsolate>
 void AstValueFactory::Internalize(LocalIsolate* isolate) {
   // Strings need to be internalized before values, because values refer to
   // strings.
-  for (AstRawString* current = strings_; current != nullptr;) {
+  size_t index = 0;
+  for (AstRawString* current = strings_; current != nullptr; index++) {
     AstRawString* next = current->next();
-    current->Internalize(isolate);
+    if (index < background_strings_.size() &&
+        !background_strings_[index].is_null()) {
+      current->set_string(
+          InternalizeBackgroundString(isolate, background_strings_[index]));
+    } else {
+      current->Internalize(isolate);
+    }
     current = next;
   }
 
+  background_strings_.clear();
   ResetStrings();
 }
 template EXPORT_TEMPLATE_DEFINE(
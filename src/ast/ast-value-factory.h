@@ -29,6 +29,7 @@
 #define V8_AST_AST_VALUE_FACTORY_H_
 
 #include <forward_list>
+#include <vector>
 
 #include "src/base/hashmap.h"
 #include "src/common/globals.h"
@@ -44,6 +45,7 @@ namespace v8 {
 namespace internal {
 
 class Isolate;
+class LocalHeap;
 class OffThreadIsolate;
 
 class AstRawString final : public ZoneObject {
@@ -317,6 +319,14 @@ class AstValueFactory {
   V8_EXPORT_PRIVATE AstConsString* NewConsString(const AstRawString* str1,
                                                  const AstRawString* str2);
 
+  // Looks up the strings created so far in the string table of {isolate} from
+  // a background thread which owns {local_heap}. Strings that already exist
+  // are kept in persistent handles of {local_heap}, and Internalize() uses
+  // them instead of looking them up again on the main thread. With
+  // --concurrent-allocation, missing strings are allocated in the old
+  // generation, and Internalize() internalizes them in place.
+  void LookupOrAllocateStrings(Isolate* isolate, LocalHeap* local_heap);
+
   template <typename LocalIsolate>
   void Internalize(LocalIsolate* isolate);
 
@@ -340,7 +350,8 @@ class AstValueFactory {
   }
   V8_EXPORT_PRIVATE AstRawString* GetOneByteStringInternal(
       Vector<const uint8_t> literal);
-  AstRawString* GetTwoByteStringInternal(Vector<const uint16_t> literal);
+  V8_EXPORT_PRIVATE AstRawString* GetTwoByteStringInternal(
+      Vector<const uint16_t> literal);
   AstRawString* GetString(uint32_t hash, bool is_one_byte,
                           Vector<const byte> literal_bytes);
 
@@ -350,6 +361,10 @@ class AstValueFactory {
   AstRawString* strings_;
   AstRawString** strings_end_;
 
+  // The results of LookupOrAllocateStrings(), in the order of {strings_}.
+  // Holds a null handle for strings that were neither found nor allocated.
+  std::vector<Handle<String>> background_strings_;
+
   // Holds constant string values which are shared across the isolate.
   const AstStringConstants* string_constants_;
 
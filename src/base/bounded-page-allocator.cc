@@ -25,6 +25,11 @@ BoundedPageAllocator::Address BoundedPageAllocator::begin() const {
 
 size_t BoundedPageAllocator::size() const { return region_allocator_.size(); }
 
+size_t BoundedPageAllocator::free_size() {
+  MutexGuard guard(&mutex_);
+  return region_allocator_.free_size();
+}
+
 void* BoundedPageAllocator::AllocatePages(void* hint, size_t size,
                                           size_t alignment,
                                           PageAllocator::Permission access) {
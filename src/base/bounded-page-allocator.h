@@ -35,6 +35,9 @@ class V8_BASE_EXPORT BoundedPageAllocator : public v8::PageAllocator {
   Address begin() const;
   size_t size() const;
 
+  // Returns the number of bytes that are not allocated.
+  size_t free_size();
+
   // Returns true if given address is in the range controlled by the bounded
   // page allocator instance.
   bool contains(Address address) const {
@@ -0,0 +1,108 @@
+// Copyright 2020 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "src/baseline/baseline-compiler.h"
+
+#include "src/base/platform/elapsed-timer.h"
+#include "src/debug/debug.h"
+#include "src/diagnostics/code-tracer.h"
+#include "src/execution/isolate.h"
+#include "src/logging/counters.h"
+#include "src/logging/log-inl.h"
+#include "src/objects/code-inl.h"
+#include "src/objects/script-inl.h"
+#include "src/objects/shared-function-info-inl.h"
+#include "src/tracing/trace-event.h"
+
+namespace v8 {
+namespace internal {
+namespace baseline {
+
+#ifdef V8_ENABLE_BASELINE
+namespace {
+
+void LogBaselineCode(Isolate* isolate, Handle<SharedFunctionInfo> shared,
+                     Handle<Code> code) {
+  if (!isolate->logger()->is_listening_to_code_events() &&
+      !isolate->is_profiling() &&
+      !isolate->code_event_dispatcher()->IsListeningToCodeEvents()) {
+    return;
+  }
+  Handle<Script> script(Script::cast(shared->script()), isolate);
+  int line_num = Script::GetLineNumber(script, shared->StartPosition()) + 1;
+  int column_num = Script::GetColumnNumber(script, shared->StartPosition()) + 1;
+  Handle<String> script_name(script->name().IsString()
+                                 ? String::cast(script->name())
+                                 : ReadOnlyRoots(isolate).empty_string(),
+                             isolate);
+  CodeEventListener::LogEventsAndTags log_tag =
+      Logger::ToNativeByScript(CodeEventListener::FUNCTION_TAG, *script);
+  PROFILE(isolate,
+          CodeCreateEvent(log_tag, Handle<AbstractCode>::cast(code), shared,
+                          script_name, line_num, column_num));
+}
+
+}  // namespace
+#endif  // V8_ENABLE_BASELINE
+
+// static
+bool BaselineCompiler::IsSupported() {
+#if V8_TARGET_ARCH_X64 && defined(V8_ENABLE_BASELINE)
+  return true;
+#else
+  return false;
+#endif
+}
+
+// static
+bool BaselineCompiler::Compile(Isolate* isolate,
+                               Handle<SharedFunctionInfo> shared) {
+#ifdef V8_ENABLE_BASELINE
+  if (!IsSupported()) return false;
+  DCHECK(shared->HasBytecodeArray());
+  // The debugger relies on the interpreter for breakpoints and stepping, and
+  // baseline code is not serializable.
+  if (shared->HasDebugInfo() || isolate->debug()->is_active()) return false;
+  if (isolate->serializer_enabled()) return false;
+
+  Handle<BytecodeArray> bytecode(shared->GetBytecodeArray(), isolate);
+  if (bytecode->HasBaselineCode()) return true;
+  if (bytecode->length() > FLAG_max_baseline_bytecode_size) return false;
+
+  TRACE_EVENT0(TRACE_DISABLED_BY_DEFAULT("v8.compile"), "V8.CompileBaseline");
+  base::ElapsedTimer timer;
+  if (FLAG_trace_baseline) timer.Start();
+
+  Handle<Code> code = GenerateCode(isolate, bytecode);
+  bytecode->set_baseline_code(*code);
+  isolate->counters()->total_baseline_compile_count()->Increment();
+  isolate->counters()->total_baseline_code_size()->Increment(code->body_size());
+  LogBaselineCode(isolate, shared, code);
+
+  if (FLAG_trace_baseline) {
+    CodeTracer::Scope scope(isolate->GetCodeTracer());
+    PrintF(scope.file(), "[compiled baseline code for ");
+    shared->ShortPrint(scope.file());
+    PrintF(scope.file(),
+           " - bytecode size: %d, code size: %d, took %0.3f ms]\n",
+           bytecode->length(), code->body_size(),
+           timer.Elapsed().InMillisecondsF());
+  }
+  return true;
+#else
+  return false;
+#endif  // V8_ENABLE_BASELINE
+}
+
+#if !V8_TARGET_ARCH_X64 || !defined(V8_ENABLE_BASELINE)
+// static
+Handle<Code> BaselineCompiler::GenerateCode(Isolate* isolate,
+                                            Handle<BytecodeArray> bytecode) {
+  UNREACHABLE();
+}
+#endif  // !V8_TARGET_ARCH_X64 || !defined(V8_ENABLE_BASELINE)
+
+}  // namespace baseline
+}  // namespace internal
+}  // namespace v8
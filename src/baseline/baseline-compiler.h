@@ -0,0 +1,57 @@
+// Copyright 2020 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#ifndef V8_BASELINE_BASELINE_COMPILER_H_
+#define V8_BASELINE_BASELINE_COMPILER_H_
+
+#include "src/common/globals.h"
+#include "src/handles/handles.h"
+
+namespace v8 {
+namespace internal {
+
+class BytecodeArray;
+class Code;
+class SharedFunctionInfo;
+
+namespace baseline {
+
+// The baseline compiler is a non-optimizing tier between Ignition and
+// TurboFan. It walks a BytecodeArray once and emits straight-line
+// ("call-threaded") machine code which calls the existing bytecode handlers
+// in order, instead of dispatching between them through the interpreter's
+// dispatch table. A few trivial bytecodes (register moves, constant loads and
+// unconditional jumps) are emitted inline.
+//
+// Baseline code runs on the interpreter frame set up by the
+// InterpreterEntryTrampoline, so stack walking, deoptimization, OSR and
+// exception handling see an ordinary interpreted frame. Whenever a handler
+// continues at a bytecode offset that the baseline code did not anticipate,
+// or the debugger has replaced the bytecode array of the frame, the running
+// activation continues in the interpreter.
+//
+// The tier is only available in builds with v8_enable_baseline.
+class BaselineCompiler final : public AllStatic {
+ public:
+  // Returns true if the baseline tier is available on this platform.
+  static bool IsSupported();
+
+  // Compiles the bytecode of {shared} and attaches the resulting code to the
+  // bytecode array, where the InterpreterEntryTrampoline picks it up on the
+  // next invocation. Returns false if the function is not eligible for
+  // baseline compilation.
+  V8_EXPORT_PRIVATE static bool Compile(Isolate* isolate,
+                                        Handle<SharedFunctionInfo> shared);
+
+ private:
+  // Platform-specific code generation, see baseline-compiler-<arch>.cc.
+  static Handle<Code> GenerateCode(Isolate* isolate,
+                                   Handle<BytecodeArray> bytecode);
+};
+
+}  // namespace baseline
+}  // namespace internal
+}  // namespace v8
+
+#endif  // V8_BASELINE_BASELINE_COMPILER_H_
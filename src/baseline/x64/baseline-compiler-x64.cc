@@ -0,0 +1,368 @@
+// Copyright 2020 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#if V8_TARGET_ARCH_X64 && defined(V8_ENABLE_BASELINE)
+
+#include <memory>
+#include <set>
+
+#include "src/baseline/baseline-compiler.h"
+#include "src/builtins/builtins.h"
+#include "src/codegen/macro-assembler.h"
+#include "src/execution/frame-constants.h"
+#include "src/heap/factory.h"
+#include "src/interpreter/bytecode-array-iterator.h"
+#include "src/interpreter/bytecode-register.h"
+#include "src/interpreter/interpreter.h"
+#include "src/objects/code-inl.h"
+#include "src/objects/objects-inl.h"
+
+namespace v8 {
+namespace internal {
+namespace baseline {
+
+using interpreter::Bytecode;
+using interpreter::BytecodeArrayIterator;
+using interpreter::Bytecodes;
+using interpreter::OperandScale;
+
+#define __ masm_.
+
+namespace {
+
+// Generates baseline code for a single BytecodeArray. The generated code keeps
+// the interpreter's register assignment (accumulator, bytecode offset,
+// bytecode array and dispatch table registers) so that it can call the
+// bytecode handlers directly:
+//
+//  - Handlers that end in a dispatch are called with the baseline dispatch
+//    table, in which every entry points to the BaselineDispatchReturn builtin.
+//    Control therefore comes back to the baseline code with the offset of the
+//    next bytecode to execute in the bytecode offset register, which is
+//    checked against the successors known at compile time.
+//  - Call bytecodes tail-call a builtin which returns straight to the baseline
+//    code, after which execution falls through to the next bytecode.
+//  - Return bytecodes return to the baseline code, which then tears down the
+//    interpreter frame.
+//
+// After every handler call, the bytecode array in the frame is compared with
+// the one the code was generated for. The debugger replaces it with a copy
+// when breakpoints are set in an active function, in which case the
+// activation continues in the interpreter and hits them.
+class BaselineCodeGenerator {
+ public:
+  BaselineCodeGenerator(Isolate* isolate, Handle<BytecodeArray> bytecode)
+      : isolate_(isolate),
+        bytecode_(bytecode),
+        masm_(isolate, CodeObjectRequired::kYes,
+              NewAssemblerBuffer(kInitialBufferSize)),
+        labels_(new Label[bytecode->length()]) {}
+
+  Handle<Code> Generate();
+
+ private:
+  static const int kInitialBufferSize = 4 * KB;
+
+  void VisitBytecode(const BytecodeArrayIterator& iterator);
+  bool TryEmitInline(const BytecodeArrayIterator& iterator);
+  void EmitHandlerCall(const BytecodeArrayIterator& iterator);
+  void EmitDispatchChecks(const BytecodeArrayIterator& iterator);
+  void EmitBytecodeArrayCheck();
+  void EmitInterruptBudgetUpdate(int weight);
+  void EmitReturn();
+  void EmitResumeInInterpreter();
+  void LoadDispatchTable();
+
+  // Returns true if the handler for the current bytecode tail-calls a builtin
+  // which returns directly to the caller of the handler, rather than
+  // dispatching to the next bytecode.
+  static bool ReturnsToCaller(const BytecodeArrayIterator& iterator);
+
+  static Operand RegisterOperand(interpreter::Register reg) {
+    return Operand(rbp, reg.ToOperand() * kSystemPointerSize);
+  }
+
+  // The bytecode offset register holds offsets relative to the tagged
+  // BytecodeArray pointer.
+  static int32_t OffsetRegisterValue(int offset) {
+    return BytecodeArray::kHeaderSize - kHeapObjectTag + offset;
+  }
+
+  Isolate* const isolate_;
+  Handle<BytecodeArray> bytecode_;
+  MacroAssembler masm_;
+  std::unique_ptr<Label[]> labels_;
+  Label return_;
+  Label resume_in_interpreter_;
+
+  DISALLOW_COPY_AND_ASSIGN(BaselineCodeGenerator);
+};
+
+Handle<Code> BaselineCodeGenerator::Generate() {
+  // Baseline code is entered with a jump from the InterpreterEntryTrampoline
+  // after it has set up the interpreter frame; the accumulator holds
+  // undefined.
+  LoadDispatchTable();
+
+  for (BytecodeArrayIterator iterator(bytecode_); !iterator.done();
+       iterator.Advance()) {
+    VisitBytecode(iterator);
+  }
+
+  EmitReturn();
+  EmitResumeInInterpreter();
+
+  CodeDesc desc;
+  masm_.GetCode(isolate_, &desc);
+  return Factory::CodeBuilder(isolate_, desc, Code::BASELINE)
+      .set_self_reference(masm_.CodeObject())
+      .Build();
+}
+
+void BaselineCodeGenerator::VisitBytecode(
+    const BytecodeArrayIterator& iterator) {
+  __ bind(&labels_[iterator.current_offset()]);
+  if (TryEmitInline(iterator)) return;
+
+  Bytecode bytecode = iterator.current_bytecode();
+  EmitHandlerCall(iterator);
+  if (Bytecodes::Returns(bytecode)) {
+    __ jmp(&return_);
+  } else if (ReturnsToCaller(iterator)) {
+    // Only the accumulator survives the call, the rest of the interpreter
+    // state has to be restored from the frame.
+    __ movq(kInterpreterBytecodeArrayRegister,
+            Operand(rbp, InterpreterFrameConstants::kBytecodeArrayFromFp));
+    __ movq(kInterpreterBytecodeOffsetRegister,
+            Immediate(OffsetRegisterValue(iterator.current_offset() +
+                                          iterator.current_bytecode_size())));
+    EmitBytecodeArrayCheck();
+    LoadDispatchTable();
+  } else {
+    EmitDispatchChecks(iterator);
+  }
+}
+
+bool BaselineCodeGenerator::TryEmitInline(
+    const BytecodeArrayIterator& iterator) {
+  switch (iterator.current_bytecode()) {
+    case Bytecode::kLdar:
+      __ movq(kInterpreterAccumulatorRegister,
+              RegisterOperand(iterator.GetRegisterOperand(0)));
+      return true;
+    case Bytecode::kStar:
+      __ movq(RegisterOperand(iterator.GetRegisterOperand(0)),
+              kInterpreterAccumulatorRegister);
+      return true;
+    case Bytecode::kMov:
+      __ movq(kScratchRegister,
+              RegisterOperand(iterator.GetRegisterOperand(0)));
+      __ movq(RegisterOperand(iterator.GetRegisterOperand(1)),
+              kScratchRegister);
+      return true;
+    case Bytecode::kLdaZero:
+      __ Move(kInterpreterAccumulatorRegister, Smi::zero());
+      return true;
+    case Bytecode::kLdaSmi:
+      __ Move(kInterpreterAccumulatorRegister,
+              Smi::FromInt(iterator.GetImmediateOperand(0)));
+      return true;
+    case Bytecode::kLdaUndefined:
+      __ LoadRoot(kInterpreterAccumulatorRegister, RootIndex::kUndefinedValue);
+      return true;
+    case Bytecode::kLdaNull:
+      __ LoadRoot(kInterpreterAccumulatorRegister, RootIndex::kNullValue);
+      return true;
+    case Bytecode::kLdaTheHole:
+      __ LoadRoot(kInterpreterAccumulatorRegister, RootIndex::kTheHoleValue);
+      return true;
+    case Bytecode::kLdaTrue:
+      __ LoadRoot(kInterpreterAccumulatorRegister, RootIndex::kTrueValue);
+      return true;
+    case Bytecode::kLdaFalse:
+      __ LoadRoot(kInterpreterAccumulatorRegister, RootIndex::kFalseValue);
+      return true;
+    case Bytecode::kLdaConstant: {
+      Handle<Object> constant =
+          iterator.GetConstantForIndexOperand(0, isolate_);
+      if (constant->IsSmi()) {
+        __ Move(kInterpreterAccumulatorRegister, Smi::cast(*constant));
+      } else {
+        __ Move(kInterpreterAccumulatorRegister,
+                Handle<HeapObject>::cast(constant));
+      }
+      return true;
+    }
+    case Bytecode::kJump:
+    case Bytecode::kJumpConstant: {
+      // Forward jumps give back the budget of the bytecodes they skip, see
+      // InterpreterAssembler::UpdateInterruptBudget.
+      int target = iterator.GetJumpTargetOffset();
+      int relative_jump = target - iterator.current_offset() -
+                          iterator.current_prefix_offset();
+      EmitInterruptBudgetUpdate(
+          relative_jump - Bytecodes::Size(iterator.current_bytecode(),
+                                          iterator.current_operand_scale()));
+      __ jmp(&labels_[target]);
+      return true;
+    }
+    default:
+      return false;
+  }
+}
+
+void BaselineCodeGenerator::EmitHandlerCall(
+    const BytecodeArrayIterator& iterator) {
+  Code handler = isolate_->interpreter()->GetBytecodeHandler(
+      iterator.current_bytecode(), iterator.current_operand_scale());
+  // Bytecode handlers are immovable, so their entry can be embedded directly.
+  RelocInfo::Mode rmode = handler.is_off_heap_trampoline()
+                              ? RelocInfo::OFF_HEAP_TARGET
+                              : RelocInfo::NONE;
+  // For wide bytecodes the handler expects the offset of the bytecode after
+  // the prefix.
+  __ movq(kInterpreterBytecodeOffsetRegister,
+          Immediate(OffsetRegisterValue(iterator.current_offset() +
+                                        iterator.current_prefix_offset())));
+  __ Move(kJavaScriptCallCodeStartRegister, handler.InstructionStart(), rmode);
+  __ call(kJavaScriptCallCodeStartRegister);
+}
+
+void BaselineCodeGenerator::EmitDispatchChecks(
+    const BytecodeArrayIterator& iterator) {
+  Bytecode bytecode = iterator.current_bytecode();
+  int next_offset = iterator.current_offset() + iterator.current_bytecode_size();
+  bool has_next = next_offset < bytecode_->length();
+
+  EmitBytecodeArrayCheck();
+
+  std::set<int> targets;
+  if (has_next &&
+      Bytecodes::IsStarLookahead(bytecode, iterator.current_operand_scale()) &&
+      Bytecodes::FromByte(bytecode_->get(next_offset)) == Bytecode::kStar) {
+    // The handler has executed the following Star itself.
+    targets.insert(next_offset +
+                   Bytecodes::Size(Bytecode::kStar, OperandScale::kSingle));
+  }
+  if (Bytecodes::IsJump(bytecode)) {
+    targets.insert(iterator.GetJumpTargetOffset());
+  }
+  if (Bytecodes::IsSwitch(bytecode)) {
+    for (interpreter::JumpTableTargetOffset entry :
+         iterator.GetJumpTableTargetOffsets()) {
+      targets.insert(entry.target_offset);
+    }
+  }
+
+  bool falls_through = has_next && !Bytecodes::IsUnconditionalJump(bytecode);
+  if (falls_through) targets.erase(next_offset);
+  for (int target : targets) {
+    __ cmpq(kInterpreterBytecodeOffsetRegister,
+            Immediate(OffsetRegisterValue(target)));
+    __ j(equal, &labels_[target]);
+  }
+  if (falls_through) {
+    __ cmpq(kInterpreterBytecodeOffsetRegister,
+            Immediate(OffsetRegisterValue(next_offset)));
+    __ j(not_equal, &resume_in_interpreter_);
+  } else {
+    __ jmp(&resume_in_interpreter_);
+  }
+}
+
+void BaselineCodeGenerator::EmitBytecodeArrayCheck() {
+  // Expects the offset to continue at in the bytecode offset register.
+  __ Cmp(Operand(rbp, InterpreterFrameConstants::kBytecodeArrayFromFp),
+         bytecode_);
+  __ j(not_equal, &resume_in_interpreter_);
+}
+
+void BaselineCodeGenerator::EmitInterruptBudgetUpdate(int weight) {
+  DCHECK_GE(weight, 0);
+  if (weight == 0) return;
+  __ movq(kScratchRegister,
+          Operand(rbp, StandardFrameConstants::kFunctionOffset));
+  __ LoadTaggedPointerField(
+      kScratchRegister,
+      FieldOperand(kScratchRegister, JSFunction::kFeedbackCellOffset));
+  __ addl(FieldOperand(kScratchRegister, FeedbackCell::kInterruptBudgetOffset),
+          Immediate(weight));
+}
+
+void BaselineCodeGenerator::EmitReturn() {
+  // The return handler has already updated the interrupt budget, all that is
+  // left to do is to leave the interpreter frame like the
+  // InterpreterEntryTrampoline does.
+  __ bind(&return_);
+  Register args_count = rbx;
+  Register return_pc = rcx;
+  __ movq(args_count,
+          Operand(rbp, InterpreterFrameConstants::kBytecodeArrayFromFp));
+  __ movl(args_count,
+          FieldOperand(args_count, BytecodeArray::kParameterSizeOffset));
+  __ leave();
+  __ PopReturnAddressTo(return_pc);
+  __ addq(rsp, args_count);
+  __ PushReturnAddressFrom(return_pc);
+  __ ret(0);
+}
+
+void BaselineCodeGenerator::EmitResumeInInterpreter() {
+  // A handler continued at an offset we did not anticipate (e.g. after an
+  // exception was caught), or the debugger replaced the bytecode array. Write
+  // the offset back to the frame and let the interpreter finish this
+  // activation.
+  __ bind(&resume_in_interpreter_);
+  __ SmiTag(kScratchRegister, kInterpreterBytecodeOffsetRegister);
+  __ movq(Operand(rbp, InterpreterFrameConstants::kBytecodeOffsetFromFp),
+          kScratchRegister);
+  __ Jump(BUILTIN_CODE(isolate_, InterpreterEnterBytecodeDispatch),
+          RelocInfo::CODE_TARGET);
+}
+
+void BaselineCodeGenerator::LoadDispatchTable() {
+  __ Move(kInterpreterDispatchTableRegister,
+          ExternalReference::Create(
+              isolate_->interpreter()->baseline_dispatch_table_address()));
+}
+
+// static
+bool BaselineCodeGenerator::ReturnsToCaller(
+    const BytecodeArrayIterator& iterator) {
+  switch (iterator.current_bytecode()) {
+    case Bytecode::kCallAnyReceiver:
+    case Bytecode::kCallProperty:
+    case Bytecode::kCallProperty0:
+    case Bytecode::kCallProperty1:
+    case Bytecode::kCallProperty2:
+    case Bytecode::kCallUndefinedReceiver:
+    case Bytecode::kCallUndefinedReceiver0:
+    case Bytecode::kCallUndefinedReceiver1:
+    case Bytecode::kCallUndefinedReceiver2:
+    case Bytecode::kCallNoFeedback:
+    case Bytecode::kCallWithSpread:
+    case Bytecode::kCallJSRuntime:
+      return true;
+    case Bytecode::kInvokeIntrinsic:
+      return iterator.GetIntrinsicIdOperand(0) == Runtime::kInlineCall;
+    default:
+      return false;
+  }
+}
+
+}  // namespace
+
+// static
+Handle<Code> BaselineCompiler::GenerateCode(Isolate* isolate,
+                                            Handle<BytecodeArray> bytecode) {
+  return BaselineCodeGenerator(isolate, bytecode).Generate();
+}
+
+#undef __
+
+}  // namespace baseline
+}  // namespace internal
+}  // namespace v8
+
+#endif  // V8_TARGET_ARCH_X64 && defined(V8_ENABLE_BASELINE)
@@ -128,6 +128,7 @@ namespace internal {
   ASM(InterpreterEnterBytecodeAdvance, Dummy)                                  \
   ASM(InterpreterEnterBytecodeDispatch, Dummy)                                 \
   ASM(InterpreterOnStackReplacement, ContextOnly)                              \
+  ASM(BaselineDispatchReturn, Dummy)                                           \
                                                                                \
   /* Code life-cycle */                                                        \
   TFC(CompileLazy, JSTrampoline)                                               \
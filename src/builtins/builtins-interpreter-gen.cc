@@ -45,5 +45,14 @@ void Builtins::Generate_InterpreterPushArgsThenConstructArrayFunction(
       masm, InterpreterPushArgsMode::kArrayFunction);
 }
 
+// Every entry of the dispatch table installed by baseline code points here.
+// Bytecode handlers called from baseline code tail-call into this builtin
+// instead of the next bytecode handler, which returns control to the baseline
+// code with the interpreter registers (accumulator, bytecode offset, bytecode
+// array and dispatch table) still live.
+void Builtins::Generate_BaselineDispatchReturn(MacroAssembler* masm) {
+  masm->Ret();
+}
+
 }  // namespace internal
 }  // namespace v8
@@ -36,8 +36,25 @@ class MicrotaskQueueBuiltinsAssembler : public CodeStubAssembler {
 
   void PrepareForContext(TNode<Context> microtask_context, Label* bailout);
   void RunSingleMicrotask(TNode<Context> current_context,
-                          TNode<Microtask> microtask);
-  void IncrementFinishedMicrotaskCount(TNode<RawPtrT> microtask_queue);
+                          TNode<RawPtrT> microtask_queue,
+                          TNode<Microtask> microtask,
+                          TNode<IntPtrT> saved_entered_context_count,
+                          TVariable<Object>* var_batched_context);
+  void IncrementMicrotaskQueueCounter(TNode<RawPtrT> microtask_queue,
+                                      size_t counter_offset);
+
+  // Promise reaction jobs leave their native context entered, so that the
+  // next job can skip entering it again if it runs in the same context.
+  // |var_batched_context| holds that context, or Smi zero if none is entered.
+  void EnterBatchedContext(TNode<Context> current_context,
+                           TNode<RawPtrT> microtask_queue,
+                           TNode<NativeContext> native_context,
+                           TNode<IntPtrT> saved_entered_context_count,
+                           TVariable<Object>* var_batched_context,
+                           Label* bailout);
+  void LeaveBatchedContext(TNode<Context> current_context,
+                           TNode<IntPtrT> saved_entered_context_count,
+                           TVariable<Object>* var_batched_context);
 
   TNode<Context> GetCurrentContext();
   void SetCurrentContext(TNode<Context> context);
@@ -111,12 +128,55 @@ void MicrotaskQueueBuiltinsAssembler::PrepareForContext(
   SetCurrentContext(native_context);
 }
 
+void MicrotaskQueueBuiltinsAssembler::EnterBatchedContext(
+    TNode<Context> current_context, TNode<RawPtrT> microtask_queue,
+    TNode<NativeContext> native_context,
+    TNode<IntPtrT> saved_entered_context_count,
+    TVariable<Object>* var_batched_context, Label* bailout) {
+  Label if_entered(this), done(this);
+  GotoIf(TaggedEqual(var_batched_context->value(), native_context),
+         &if_entered);
+
+  LeaveBatchedContext(current_context, saved_entered_context_count,
+                      var_batched_context);
+  PrepareForContext(native_context, bailout);
+  *var_batched_context = native_context;
+  IncrementMicrotaskQueueCounter(microtask_queue,
+                                 MicrotaskQueue::kContextEnterCountOffset);
+  Goto(&done);
+
+  BIND(&if_entered);
+  {
+    // The previous microtask may have shut the context down.
+    GotoIf(WordEqual(GetMicrotaskQueue(native_context), IntPtrConstant(0)),
+           bailout);
+    SetCurrentContext(native_context);
+    Goto(&done);
+  }
+
+  BIND(&done);
+}
+
+void MicrotaskQueueBuiltinsAssembler::LeaveBatchedContext(
+    TNode<Context> current_context, TNode<IntPtrT> saved_entered_context_count,
+    TVariable<Object>* var_batched_context) {
+  Label done(this);
+  GotoIf(TaggedEqual(var_batched_context->value(), SmiConstant(0)), &done);
+  RewindEnteredContext(saved_entered_context_count);
+  SetCurrentContext(current_context);
+  *var_batched_context = SmiConstant(0);
+  Goto(&done);
+
+  BIND(&done);
+}
+
 void MicrotaskQueueBuiltinsAssembler::RunSingleMicrotask(
-    TNode<Context> current_context, TNode<Microtask> microtask) {
+    TNode<Context> current_context, TNode<RawPtrT> microtask_queue,
+    TNode<Microtask> microtask, TNode<IntPtrT> saved_entered_context_count,
+    TVariable<Object>* var_batched_context) {
   CSA_ASSERT(this, TaggedIsNotSmi(microtask));
 
   StoreRoot(RootIndex::kCurrentMicrotask, microtask);
-  TNode<IntPtrT> saved_entered_context_count = GetEnteredContextCount();
   TNode<Map> microtask_map = LoadMap(microtask);
   TNode<Uint16T> microtask_type = LoadMapInstanceType(microtask_map);
 
@@ -141,11 +201,16 @@ void MicrotaskQueueBuiltinsAssembler::RunSingleMicrotask(
 
   BIND(&is_callable);
   {
+    LeaveBatchedContext(current_context, saved_entered_context_count,
+                        var_batched_context);
+
     // Enter the context of the {microtask}.
     TNode<Context> microtask_context =
         LoadObjectField<Context>(microtask, CallableTask::kContextOffset);
     TNode<NativeContext> native_context = LoadNativeContext(microtask_context);
     PrepareForContext(native_context, &done);
+    IncrementMicrotaskQueueCounter(microtask_queue,
+                                   MicrotaskQueue::kContextEnterCountOffset);
 
     TNode<JSReceiver> callable =
         LoadObjectField<JSReceiver>(microtask, CallableTask::kCallableOffset);
@@ -160,6 +225,9 @@ void MicrotaskQueueBuiltinsAssembler::RunSingleMicrotask(
 
   BIND(&is_callback);
   {
+    LeaveBatchedContext(current_context, saved_entered_context_count,
+                        var_batched_context);
+
     const TNode<Object> microtask_callback =
         LoadObjectField(microtask, CallbackTask::kCallbackOffset);
     const TNode<Object> microtask_data =
@@ -185,11 +253,16 @@ void MicrotaskQueueBuiltinsAssembler::RunSingleMicrotask(
 
   BIND(&is_promise_resolve_thenable_job);
   {
+    LeaveBatchedContext(current_context, saved_entered_context_count,
+                        var_batched_context);
+
     // Enter the context of the {microtask}.
     TNode<Context> microtask_context = LoadObjectField<Context>(
         microtask, PromiseResolveThenableJobTask::kContextOffset);
     TNode<NativeContext> native_context = LoadNativeContext(microtask_context);
     PrepareForContext(native_context, &done);
+    IncrementMicrotaskQueueCounter(microtask_queue,
+                                   MicrotaskQueue::kContextEnterCountOffset);
 
     const TNode<Object> promise_to_resolve = LoadObjectField(
         microtask, PromiseResolveThenableJobTask::kPromiseToResolveOffset);
@@ -210,11 +283,16 @@ void MicrotaskQueueBuiltinsAssembler::RunSingleMicrotask(
 
   BIND(&is_promise_fulfill_reaction_job);
   {
-    // Enter the context of the {microtask}.
+    // Enter the context of the {microtask}, unless the previous promise
+    // reaction job left it entered.
     TNode<Context> microtask_context = LoadObjectField<Context>(
         microtask, PromiseReactionJobTask::kContextOffset);
     TNode<NativeContext> native_context = LoadNativeContext(microtask_context);
-    PrepareForContext(native_context, &done);
+    EnterBatchedContext(current_context, microtask_queue, native_context,
+                        saved_entered_context_count, var_batched_context,
+                        &done);
+    IncrementMicrotaskQueueCounter(
+        microtask_queue, MicrotaskQueue::kPromiseReactionJobCountOffset);
 
     const TNode<Object> argument =
         LoadObjectField(microtask, PromiseReactionJobTask::kArgumentOffset);
@@ -256,18 +334,22 @@ void MicrotaskQueueBuiltinsAssembler::RunSingleMicrotask(
     Goto(&preserved_data_reset_done);
     BIND(&preserved_data_reset_done);
 
-    RewindEnteredContext(saved_entered_context_count);
-    SetCurrentContext(current_context);
+    // Stay in the context; the next microtask leaves it if necessary.
     Goto(&done);
   }
 
   BIND(&is_promise_reject_reaction_job);
   {
-    // Enter the context of the {microtask}.
+    // Enter the context of the {microtask}, unless the previous promise
+    // reaction job left it entered.
     TNode<Context> microtask_context = LoadObjectField<Context>(
         microtask, PromiseReactionJobTask::kContextOffset);
     TNode<NativeContext> native_context = LoadNativeContext(microtask_context);
-    PrepareForContext(native_context, &done);
+    EnterBatchedContext(current_context, microtask_queue, native_context,
+                        saved_entered_context_count, var_batched_context,
+                        &done);
+    IncrementMicrotaskQueueCounter(
+        microtask_queue, MicrotaskQueue::kPromiseReactionJobCountOffset);
 
     const TNode<Object> argument =
         LoadObjectField(microtask, PromiseReactionJobTask::kArgumentOffset);
@@ -309,8 +391,7 @@ void MicrotaskQueueBuiltinsAssembler::RunSingleMicrotask(
     Goto(&preserved_data_reset_done);
     BIND(&preserved_data_reset_done);
 
-    RewindEnteredContext(saved_entered_context_count);
-    SetCurrentContext(current_context);
+    // Stay in the context; the next microtask leaves it if necessary.
     Goto(&done);
   }
 
@@ -324,21 +405,20 @@ void MicrotaskQueueBuiltinsAssembler::RunSingleMicrotask(
                 var_exception.value());
     RewindEnteredContext(saved_entered_context_count);
     SetCurrentContext(current_context);
+    *var_batched_context = SmiConstant(0);
     Goto(&done);
   }
 
   BIND(&done);
 }
 
-void MicrotaskQueueBuiltinsAssembler::IncrementFinishedMicrotaskCount(
-    TNode<RawPtrT> microtask_queue) {
-  TNode<IntPtrT> count = Load<IntPtrT>(
-      microtask_queue,
-      IntPtrConstant(MicrotaskQueue::kFinishedMicrotaskCountOffset));
+void MicrotaskQueueBuiltinsAssembler::IncrementMicrotaskQueueCounter(
+    TNode<RawPtrT> microtask_queue, size_t counter_offset) {
+  TNode<IntPtrT> count =
+      Load<IntPtrT>(microtask_queue, IntPtrConstant(counter_offset));
   TNode<IntPtrT> new_count = IntPtrAdd(count, IntPtrConstant(1));
-  StoreNoWriteBarrier(
-      MachineType::PointerRepresentation(), microtask_queue,
-      IntPtrConstant(MicrotaskQueue::kFinishedMicrotaskCountOffset), new_count);
+  StoreNoWriteBarrier(MachineType::PointerRepresentation(), microtask_queue,
+                      IntPtrConstant(counter_offset), new_count);
 }
 
 TNode<Context> MicrotaskQueueBuiltinsAssembler::GetCurrentContext() {
@@ -536,8 +616,10 @@ TF_BUILTIN(RunMicrotasks, MicrotaskQueueBuiltinsAssembler) {
 
   TNode<RawPtrT> microtask_queue =
       UncheckedCast<RawPtrT>(Parameter(Descriptor::kMicrotaskQueue));
+  TNode<IntPtrT> saved_entered_context_count = GetEnteredContextCount();
+  TVARIABLE(Object, var_batched_context, SmiConstant(0));
 
-  Label loop(this), done(this);
+  Label loop(this, &var_batched_context), done(this);
   Goto(&loop);
   BIND(&loop);
 
@@ -564,12 +646,17 @@ TF_BUILTIN(RunMicrotasks, MicrotaskQueueBuiltinsAssembler) {
   SetMicrotaskQueueSize(microtask_queue, new_size);
   SetMicrotaskQueueStart(microtask_queue, new_start);
 
-  RunSingleMicrotask(current_context, microtask);
-  IncrementFinishedMicrotaskCount(microtask_queue);
+  RunSingleMicrotask(current_context, microtask_queue, microtask,
+                     saved_entered_context_count, &var_batched_context);
+  IncrementMicrotaskQueueCounter(
+      microtask_queue, MicrotaskQueue::kFinishedMicrotaskCountOffset);
   Goto(&loop);
 
   BIND(&done);
   {
+    LeaveBatchedContext(current_context, saved_entered_context_count,
+                        &var_batched_context);
+
     // Reset the "current microtask" on the isolate.
     StoreRoot(RootIndex::kCurrentMicrotask, UndefinedConstant());
     Return(UndefinedConstant());
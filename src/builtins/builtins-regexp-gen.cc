@@ -250,10 +250,14 @@ TNode<JSRegExpResult> RegExpBuiltinsAssembler::ConstructNewResultFromMatchInfo(
         CAST(LoadObjectField(regexp, JSRegExp::kDataOffset));
 
     // We reach this point only if captures exist, implying that this is an
-    // IRREGEXP JSRegExp.
-    CSA_ASSERT(this,
-               SmiEqual(CAST(LoadFixedArrayElement(data, JSRegExp::kTagIndex)),
-                        SmiConstant(JSRegExp::IRREGEXP)));
+    // IRREGEXP or LINEAR JSRegExp.
+    CSA_ASSERT(
+        this,
+        Word32Or(
+            SmiEqual(CAST(LoadFixedArrayElement(data, JSRegExp::kTagIndex)),
+                     SmiConstant(JSRegExp::IRREGEXP)),
+            SmiEqual(CAST(LoadFixedArrayElement(data, JSRegExp::kTagIndex)),
+                     SmiConstant(JSRegExp::LINEAR))));
 
     // The names fixed array associates names at even indices with a capture
     // index at odd indices.
@@ -396,12 +400,14 @@ TNode<HeapObject> RegExpBuiltinsAssembler::RegExpExecInternal(
       TNode<Int32T> tag = LoadAndUntagToWord32FixedArrayElement(
           data, IntPtrConstant(JSRegExp::kTagIndex));
 
+      // The linear-time engine is only called from the runtime.
       int32_t values[] = {
           JSRegExp::IRREGEXP,
           JSRegExp::ATOM,
           JSRegExp::NOT_COMPILED,
+          JSRegExp::LINEAR,
       };
-      Label* labels[] = {&next, &atom, &runtime};
+      Label* labels[] = {&next, &atom, &runtime, &runtime};
 
       STATIC_ASSERT(arraysize(values) == arraysize(labels));
       Switch(tag, &unreachable, values, labels, arraysize(values));
@@ -585,8 +591,14 @@ TNode<HeapObject> RegExpBuiltinsAssembler::RegExpExecInternal(
                        IntPtrConstant(RegExp::kInternalRegExpException)),
            &if_exception);
 
-    CSA_ASSERT(this, IntPtrEqual(int_result,
-                                 IntPtrConstant(RegExp::kInternalRegExpRetry)));
+    // Retries and fallbacks to the linear-time engine go through the runtime.
+    CSA_ASSERT(
+        this,
+        Word32Or(IntPtrEqual(int_result,
+                             IntPtrConstant(RegExp::kInternalRegExpRetry)),
+                 IntPtrEqual(int_result,
+                             IntPtrConstant(
+                                 RegExp::kInternalRegExpFallbackToLinear))));
     Goto(&runtime);
   }
 
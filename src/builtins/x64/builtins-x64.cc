@@ -1230,9 +1230,19 @@ void Builtins::Generate_InterpreterEntryTrampoline(MacroAssembler* masm) {
 
   // The accumulator is already loaded with undefined.
 
+  Label do_dispatch;
+#ifdef V8_ENABLE_BASELINE
+  // If the bytecode array has baseline code attached, continue in there. It
+  // runs on the interpreter frame set up above.
+  __ LoadTaggedPointerField(
+      rcx, FieldOperand(kInterpreterBytecodeArrayRegister,
+                        BytecodeArray::kBaselineCodeOffset));
+  __ JumpIfRoot(rcx, RootIndex::kUndefinedValue, &do_dispatch, Label::kNear);
+  __ JumpCodeObject(rcx);
+#endif  // V8_ENABLE_BASELINE
+
   // Load the dispatch table into a register and dispatch to the bytecode
   // handler at the current bytecode offset.
-  Label do_dispatch;
   __ bind(&do_dispatch);
   __ Move(
       kInterpreterDispatchTableRegister,
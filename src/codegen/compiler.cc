@@ -33,7 +33,9 @@
 #include "src/execution/runtime-profiler.h"
 #include "src/execution/vm-state-inl.h"
 #include "src/handles/maybe-handles.h"
+#include "src/handles/persistent-handles.h"
 #include "src/heap/heap-inl.h"
+#include "src/heap/local-heap.h"
 #include "src/heap/off-thread-factory-inl.h"
 #include "src/init/bootstrapper.h"
 #include "src/interpreter/interpreter.h"
@@ -1169,12 +1171,18 @@ BackgroundCompileTask::BackgroundCompileTask(ScriptStreamingData* streamed_data,
                                     construct_language_mode(FLAG_use_strict),
                                     REPLMode::kNo);
   language_mode_ = info_->language_mode();
+  // Compile likely-needed top-level functions together with the script, so
+  // that they don't have to be compiled lazily on the main thread later.
+  info_->set_eager_compile_budget(FLAG_streaming_eager_compile_budget);
 
   std::unique_ptr<Utf16CharacterStream> stream(ScannerStream::For(
       streamed_data->source_stream.get(), streamed_data->encoding));
   info_->set_character_stream(std::move(stream));
 
   finalize_on_background_thread_ = FLAG_finalize_streaming_on_background;
+  if (FLAG_local_heaps && !finalize_on_background_thread_) {
+    isolate_for_string_lookup_ = isolate;
+  }
 }
 
 BackgroundCompileTask::BackgroundCompileTask(
@@ -1279,6 +1287,21 @@ void BackgroundCompileTask::Run() {
     language_mode_ = info_->language_mode();
     collected_source_positions_ = info_->collect_source_positions();
 
+    if (isolate_for_string_lookup_ != nullptr) {
+      // Strings which the main thread has internalized already don't have to
+      // be looked up again during finalization, and with
+      // --concurrent-allocation the missing ones are allocated here.
+      TRACE_EVENT0(TRACE_DISABLED_BY_DEFAULT("v8.compile"),
+                   "V8.LookupStringsBackground");
+      AllowHeapAllocation allow_allocation;
+      AllowHandleAllocation allow_handles;
+      AllowHandleDereference allow_handle_dereference;
+      LocalHeap local_heap(isolate_for_string_lookup_->heap());
+      info_->ast_value_factory()->LookupOrAllocateStrings(
+          isolate_for_string_lookup_, &local_heap);
+      persistent_handles_ = local_heap.DetachPersistentHandles();
+    }
+
     if (finalize_on_background_thread_) {
       DCHECK(info_->is_toplevel());
 
@@ -29,6 +29,7 @@ class OptimizedCompilationInfo;
 class OptimizedCompilationJob;
 class ParseInfo;
 class Parser;
+class PersistentHandles;
 class RuntimeCallStats;
 class ScriptData;
 struct ScriptStreamingData;
@@ -414,6 +415,12 @@ class V8_EXPORT_PRIVATE BackgroundCompileTask {
   // This is a raw pointer to the off-thread allocated SharedFunctionInfo.
   SharedFunctionInfo outer_function_sfi_;
 
+  // With --local-heaps, the task looks up the script's strings in the string
+  // table of {isolate_for_string_lookup_} after parsing. The strings it finds
+  // are kept alive by {persistent_handles_} until the task is finalized.
+  Isolate* isolate_for_string_lookup_ = nullptr;
+  std::unique_ptr<PersistentHandles> persistent_handles_;
+
   int stack_size_;
   WorkerThreadRuntimeCallStats* worker_thread_runtime_call_stats_;
   AccountingAllocator* allocator_;
@@ -115,6 +115,12 @@ STATIC_ASSERT(V8_DEFAULT_STACK_SIZE_KB* KB +
 #define V8_SFI_HAS_UNIQUE_ID false
 #endif
 
+#ifdef V8_ENABLE_BASELINE
+#define V8_ENABLE_BASELINE_BOOL true
+#else
+#define V8_ENABLE_BASELINE_BOOL false
+#endif
+
 #if defined(V8_OS_WIN) && defined(V8_TARGET_ARCH_X64)
 #define V8_OS_WIN_X64 true
 #endif
@@ -26,6 +26,37 @@ bool IsSmall(BytecodeArrayRef const& bytecode) {
   return bytecode.length() <= FLAG_max_inlined_bytecode_size_small;
 }
 
+// Returns true if the value produced by the call {node} is only read from,
+// i.e. it is destructured right away as for iterator results or tuples
+// returned from helpers, and otherwise only captured in frame states. If the
+// callee allocates the result, it becomes a temporary that escape analysis
+// can remove once the call is inlined.
+bool IsTemporaryResult(Node* node) {
+  bool has_value_use = false;
+  for (Edge edge : node->use_edges()) {
+    if (!NodeProperties::IsValueEdge(edge)) continue;
+    Node* const user = edge.from();
+    switch (user->opcode()) {
+      case IrOpcode::kFrameState:
+      case IrOpcode::kStateValues:
+      case IrOpcode::kTypedStateValues:
+        continue;
+      case IrOpcode::kJSLoadNamed:
+      case IrOpcode::kJSLoadProperty:
+      case IrOpcode::kCheckHeapObject:
+      case IrOpcode::kCheckMaps:
+      case IrOpcode::kLoadField:
+        // Only reads from the result, not of it being stored or passed on.
+        if (edge.index() != 0) return false;
+        has_value_use = true;
+        continue;
+      default:
+        return false;
+    }
+  }
+  return has_value_use;
+}
+
 bool CanConsiderForInlining(JSHeapBroker* broker,
                             SharedFunctionInfoRef const& shared,
                             FeedbackVectorRef const& feedback_vector) {
@@ -165,6 +196,7 @@ Reduction JSInliningHeuristic::Reduce(Node* node) {
   }
 
   bool can_inline_candidate = false, candidate_is_small = true;
+  bool candidate_fits_temporary_result = true;
   candidate.total_size = 0;
   Node* frame_state = NodeProperties::GetFrameStateInput(node);
   FrameStateInfo const& frame_info = FrameStateInfoOf(frame_state->op());
@@ -201,6 +233,9 @@ Reduction JSInliningHeuristic::Reduce(Node* node) {
       BytecodeArrayRef bytecode = candidate.bytecode[i].value();
       candidate.total_size += bytecode.length();
       candidate_is_small = candidate_is_small && IsSmall(bytecode);
+      candidate_fits_temporary_result =
+          candidate_fits_temporary_result &&
+          bytecode.length() <= FLAG_max_inlined_bytecode_size_temporary_result;
     }
   }
   if (!can_inline_candidate) return NoChange();
@@ -230,6 +265,12 @@ Reduction JSInliningHeuristic::Reduce(Node* node) {
     return InlineCandidate(candidate, true);
   }
 
+  // Monomorphic call sites whose result is only read from are preferred, so
+  // that escape analysis gets a chance to replace the result by its fields.
+  candidate.temporary_result = candidate.num_functions == 1 &&
+                               candidate_fits_temporary_result &&
+                               IsTemporaryResult(node);
+
   // In the general case we remember the candidate for later.
   candidates_.insert(candidate);
   return NoChange();
@@ -740,6 +781,16 @@ Reduction JSInliningHeuristic::InlineCandidate(Candidate const& candidate,
   return Replace(value);
 }
 
+// static
+double JSInliningHeuristic::Candidate::Priority(const Candidate& candidate) {
+  // Inlining a call with a temporary result can also remove the allocation of
+  // the result, so such call sites count as if they were called more often.
+  const double kTemporaryResultFrequencyFactor = 2;
+  return candidate.temporary_result
+             ? candidate.frequency.value() * kTemporaryResultFrequencyFactor
+             : candidate.frequency.value();
+}
+
 bool JSInliningHeuristic::CandidateCompare::operator()(
     const Candidate& left, const Candidate& right) const {
   if (right.frequency.IsUnknown()) {
@@ -752,9 +803,9 @@ bool JSInliningHeuristic::CandidateCompare::operator()(
     return true;
   } else if (left.frequency.IsUnknown()) {
     return false;
-  } else if (left.frequency.value() > right.frequency.value()) {
+  } else if (Candidate::Priority(left) > Candidate::Priority(right)) {
     return true;
-  } else if (left.frequency.value() < right.frequency.value()) {
+  } else if (Candidate::Priority(left) < Candidate::Priority(right)) {
     return false;
   } else {
     return left.node->id() > right.node->id();
@@ -767,7 +818,8 @@ void JSInliningHeuristic::PrintCandidates() {
   for (const Candidate& candidate : candidates_) {
     os << "- candidate: " << candidate.node->op()->mnemonic() << " node #"
        << candidate.node->id() << " with frequency " << candidate.frequency
-       << ", " << candidate.num_functions << " target(s):" << std::endl;
+       << (candidate.temporary_result ? " (temporary result)" : "") << ", "
+       << candidate.num_functions << " target(s):" << std::endl;
     for (int i = 0; i < candidate.num_functions; ++i) {
       SharedFunctionInfoRef shared = candidate.functions[i].has_value()
                                          ? candidate.functions[i]->shared()
@@ -55,6 +55,13 @@ class JSInliningHeuristic final : public AdvancedReducer {
     Node* node = nullptr;     // The call site at which to inline.
     CallFrequency frequency;  // Relative frequency of this call site.
     int total_size = 0;
+    // Whether the result of the call is only read from, see
+    // --max-inlined-bytecode-size-temporary-result.
+    bool temporary_result = false;
+
+    // The known frequency of the call site, weighted by how much inlining it
+    // is expected to save.
+    static double Priority(const Candidate& candidate);
   };
 
   // Comparator for candidates.
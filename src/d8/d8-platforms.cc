@@ -5,6 +5,7 @@
 #include <memory>
 #include <unordered_map>
 
+#include "include/libplatform/libplatform.h"
 #include "include/v8-platform.h"
 #include "src/base/logging.h"
 #include "src/base/macros.h"
@@ -53,6 +54,15 @@ class PredictablePlatform : public Platform {
     // Never run delayed tasks.
   }
 
+  std::unique_ptr<JobHandle> PostJob(
+      TaskPriority priority, std::unique_ptr<JobTask> job_task) override {
+    // Don't forward to {platform_}, whose workers would run the job on real
+    // threads. Worker tasks posted through CallOnWorkerThread() run right away,
+    // so one worker is enough to make progress without a joining thread.
+    return platform::NewDefaultJobHandle(this, priority, std::move(job_task),
+                                         1);
+  }
+
   bool IdleTasksEnabled(Isolate* isolate) override { return false; }
 
   double MonotonicallyIncreasingTime() override {
@@ -147,6 +157,14 @@ class DelayedTasksPlatform : public Platform {
                                          delay_in_seconds);
   }
 
+  std::unique_ptr<JobHandle> PostJob(
+      TaskPriority priority, std::unique_ptr<JobTask> job_task) override {
+    // Post the job's worker tasks through CallOnWorkerThread() so that they
+    // are delayed as well.
+    return platform::NewDefaultJobHandle(this, priority, std::move(job_task),
+                                         NumberOfWorkerThreads());
+  }
+
   bool IdleTasksEnabled(Isolate* isolate) override {
     return platform_->IdleTasksEnabled(isolate);
   }
@@ -94,6 +94,10 @@ const int kMB = 1024 * 1024;
 const int kMaxSerializerMemoryUsage =
     1 * kMB;  // Arbitrary maximum for testing.
 
+// ArrayBuffer contents and strings of at least this size are passed between
+// workers by reference instead of being copied into the message.
+const size_t kSerializerOutOfBandThreshold = 64 * 1024;
+
 // Base class for shell ArrayBuffer allocators. It forwards all opertions to
 // the default v8 allocator.
 class ArrayBufferAllocatorBase : public v8::ArrayBuffer::Allocator {
@@ -3215,7 +3219,9 @@ class Serializer : public ValueSerializer::Delegate {
   explicit Serializer(Isolate* isolate)
       : isolate_(isolate),
         serializer_(isolate, this),
-        current_memory_usage_(0) {}
+        current_memory_usage_(0) {
+    serializer_.SetOutOfBandThreshold(kSerializerOutOfBandThreshold);
+  }
 
   Maybe<bool> WriteValue(Local<Context> context, Local<Value> value,
                          Local<Value> transfer) {
@@ -3287,6 +3293,22 @@ class Serializer : public ValueSerializer::Delegate {
     return Just<uint32_t>(static_cast<uint32_t>(index));
   }
 
+  Maybe<uint32_t> GetOutOfBandBackingStoreId(
+      Isolate* isolate, std::shared_ptr<BackingStore> backing_store) override {
+    DCHECK_NOT_NULL(data_);
+    // Count the contents like the buffer memory they would otherwise use,
+    // but only once they are taken. If they are not, the serializer writes
+    // them in band, which counts them through ReallocateBufferMemory().
+    size_t byte_length = backing_store->ByteLength();
+    if (current_memory_usage_ + byte_length > kMaxSerializerMemoryUsage) {
+      return Nothing<uint32_t>();
+    }
+    current_memory_usage_ += byte_length;
+    size_t index = data_->out_of_band_backing_stores_.size();
+    data_->out_of_band_backing_stores_.push_back(std::move(backing_store));
+    return Just<uint32_t>(static_cast<uint32_t>(index));
+  }
+
   void* ReallocateBufferMemory(void* old_buffer, size_t size,
                                size_t* actual_size) override {
     // Not accurate, because we don't take into account reallocated buffers,
@@ -3411,6 +3433,13 @@ class Deserializer : public ValueDeserializer::Delegate {
         isolate_, data_->compiled_wasm_modules().at(transfer_id));
   }
 
+  std::shared_ptr<BackingStore> GetOutOfBandBackingStoreFromId(
+      Isolate* isolate, uint32_t id) override {
+    DCHECK_NOT_NULL(data_);
+    if (id >= data_->out_of_band_backing_stores().size()) return nullptr;
+    return data_->out_of_band_backing_stores().at(id);
+  }
+
  private:
   Isolate* isolate_;
   ValueDeserializer deserializer_;
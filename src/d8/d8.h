@@ -128,6 +128,10 @@ class SerializationData {
   const std::vector<CompiledWasmModule>& compiled_wasm_modules() {
     return compiled_wasm_modules_;
   }
+  const std::vector<std::shared_ptr<v8::BackingStore>>&
+  out_of_band_backing_stores() {
+    return out_of_band_backing_stores_;
+  }
 
  private:
   struct DataDeleter {
@@ -139,6 +143,7 @@ class SerializationData {
   std::vector<std::shared_ptr<v8::BackingStore>> backing_stores_;
   std::vector<std::shared_ptr<v8::BackingStore>> sab_backing_stores_;
   std::vector<CompiledWasmModule> compiled_wasm_modules_;
+  std::vector<std::shared_ptr<v8::BackingStore>> out_of_band_backing_stores_;
 
  private:
   friend class Serializer;
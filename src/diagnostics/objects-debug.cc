@@ -294,6 +294,9 @@ void BytecodeArray::BytecodeArrayVerify(Isolate* isolate) {
         source_position_table().IsException() ||
         source_position_table().IsByteArray());
   CHECK(handler_table().IsByteArray());
+#ifdef V8_ENABLE_BASELINE
+  CHECK(baseline_code().IsUndefined() || baseline_code().IsCode());
+#endif  // V8_ENABLE_BASELINE
 }
 
 USE_TORQUE_VERIFIER(FreeSpace)
@@ -1261,6 +1264,23 @@ void JSRegExp::JSRegExpVerify(Isolate* isolate) {
       CHECK(arr.get(JSRegExp::kIrregexpBacktrackLimit).IsSmi());
       break;
     }
+    case JSRegExp::LINEAR: {
+      FixedArray arr = FixedArray::cast(data());
+      Smi uninitialized = Smi::FromInt(JSRegExp::kUninitializedValue);
+      CHECK_EQ(uninitialized, arr.get(JSRegExp::kIrregexpLatin1CodeIndex));
+      CHECK_EQ(uninitialized, arr.get(JSRegExp::kIrregexpUC16CodeIndex));
+      // ByteArray: The program of the linear engine, shared by both
+      // representations of the subject.
+      Object program = arr.get(JSRegExp::kIrregexpLatin1BytecodeIndex);
+      CHECK(program.IsByteArray());
+      CHECK_EQ(program, arr.get(JSRegExp::kIrregexpUC16BytecodeIndex));
+
+      CHECK(arr.get(JSRegExp::kIrregexpCaptureCountIndex).IsSmi());
+      CHECK(arr.get(JSRegExp::kIrregexpMaxRegisterCountIndex).IsSmi());
+      CHECK(arr.get(JSRegExp::kIrregexpTicksUntilTierUpIndex).IsSmi());
+      CHECK(arr.get(JSRegExp::kIrregexpBacktrackLimit).IsSmi());
+      break;
+    }
     default:
       CHECK_EQ(JSRegExp::NOT_COMPILED, TypeTag());
       CHECK(data().IsUndefined(isolate));
@@ -208,7 +208,7 @@ bool IsInterpreterFramePc(Isolate* isolate, Address pc,
       interpreter_bytecode_advance.contains(pc) ||
       interpreter_bytecode_dispatch.contains(pc)) {
     return true;
-  } else if (FLAG_interpreted_frames_native_stack) {
+  } else if (FLAG_interpreted_frames_native_stack || FLAG_baseline) {
     intptr_t marker = Memory<intptr_t>(
         state->fp + CommonFrameConstants::kContextOrFrameTypeOffset);
     MSAN_MEMORY_IS_INITIALIZED(
@@ -223,9 +223,9 @@ bool IsInterpreterFramePc(Isolate* isolate, Address pc,
     } else if (!isolate->heap()->InSpaceSlow(pc, CODE_SPACE)) {
       return false;
     }
-    interpreter_entry_trampoline =
-        isolate->heap()->GcSafeFindCodeForInnerPointer(pc);
-    return interpreter_entry_trampoline.is_interpreter_trampoline_builtin();
+    Code code = isolate->heap()->GcSafeFindCodeForInnerPointer(pc);
+    return code.is_interpreter_trampoline_builtin() ||
+           code.kind() == Code::BASELINE;
   } else {
     return false;
   }
@@ -583,6 +583,9 @@ StackFrame::Type StackFrame::ComputeType(const StackFrameIteratorBase* iterator,
             return BUILTIN;
           case Code::OPTIMIZED_FUNCTION:
             return OPTIMIZED;
+          case Code::BASELINE:
+            // Baseline code shares the interpreter frame layout.
+            return INTERPRETED;
           case Code::JS_TO_WASM_FUNCTION:
             return JS_TO_WASM;
           case Code::JS_TO_JS_FUNCTION:
@@ -89,6 +89,7 @@ class PersistentHandles;
 class PersistentHandlesList;
 class ReadOnlyDeserializer;
 class RegExpStack;
+struct RegExpLinearBuffers;
 class RootVisitor;
 class RuntimeProfiler;
 class SetupIsolateDelegate;
@@ -420,6 +421,8 @@ using DebugObjectCache = std::vector<Handle<HeapObject>>;
   V(uint32_t, per_isolate_assert_data, 0xFFFFFFFFu)                            \
   V(PromiseRejectCallback, promise_reject_callback, nullptr)                   \
   V(const v8::StartupData*, snapshot_blob, nullptr)                            \
+  /* true if decompressed snapshot sections are shared with other isolates. */ \
+  V(bool, shares_decompressed_snapshot, false)                                 \
   V(int, code_and_metadata_size, 0)                                            \
   V(int, bytecode_and_metadata_size, 0)                                        \
   V(int, external_script_source_size, 0)                                       \
@@ -1042,6 +1045,10 @@ class V8_EXPORT_PRIVATE Isolate final : private HiddenFactory {
 
   RegExpStack* regexp_stack() { return regexp_stack_; }
 
+  RegExpLinearBuffers* regexp_linear_buffers() {
+    return regexp_linear_buffers_;
+  }
+
   size_t total_regexp_code_generated() { return total_regexp_code_generated_; }
   void IncreaseTotalRegexpCodeGenerated(Handle<HeapObject> code);
 
@@ -1396,6 +1403,13 @@ class V8_EXPORT_PRIVATE Isolate final : private HiddenFactory {
     return ast_string_constants_;
   }
 
+  // Guards the layout of internalized strings, which background threads read
+  // when looking up the string table. Taken exclusively by the main thread
+  // when it changes the representation of an internalized string.
+  base::SharedMutex* internalized_string_access() {
+    return &internalized_string_access_;
+  }
+
   interpreter::Interpreter* interpreter() const { return interpreter_; }
 
   compiler::PerIsolateCompilerCache* compiler_cache() const {
@@ -1671,6 +1685,7 @@ class V8_EXPORT_PRIVATE Isolate final : private HiddenFactory {
       regexp_macro_assembler_canonicalize_;
 #endif  // !V8_INTL_SUPPORT
   RegExpStack* regexp_stack_ = nullptr;
+  RegExpLinearBuffers* regexp_linear_buffers_ = nullptr;
   std::vector<int> regexp_indices_;
   DateCache* date_cache_ = nullptr;
   base::RandomNumberGenerator* random_number_generator_ = nullptr;
@@ -1833,6 +1848,8 @@ class V8_EXPORT_PRIVATE Isolate final : private HiddenFactory {
   base::Mutex managed_ptr_destructors_mutex_;
   ManagedPtrDestructor* managed_ptr_destructors_head_ = nullptr;
 
+  base::SharedMutex internalized_string_access_;
+
   size_t total_regexp_code_generated_ = 0;
 
   size_t elements_deletion_counter_ = 0;
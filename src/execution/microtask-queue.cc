@@ -27,6 +27,10 @@ const size_t MicrotaskQueue::kSizeOffset = OFFSET_OF(MicrotaskQueue, size_);
 const size_t MicrotaskQueue::kStartOffset = OFFSET_OF(MicrotaskQueue, start_);
 const size_t MicrotaskQueue::kFinishedMicrotaskCountOffset =
     OFFSET_OF(MicrotaskQueue, finished_microtask_count_);
+const size_t MicrotaskQueue::kPromiseReactionJobCountOffset =
+    OFFSET_OF(MicrotaskQueue, promise_reaction_job_count_);
+const size_t MicrotaskQueue::kContextEnterCountOffset =
+    OFFSET_OF(MicrotaskQueue, context_enter_count_);
 
 const intptr_t MicrotaskQueue::kMinimumCapacity = 8;
 
@@ -146,6 +150,7 @@ int MicrotaskQueue::RunMicrotasks(Isolate* isolate) {
   }
 
   intptr_t base_count = finished_microtask_count_;
+  ++checkpoint_count_;
 
   HandleScope handle_scope(isolate);
   MaybeHandle<Object> maybe_exception;
@@ -95,6 +95,15 @@ class V8_EXPORT_PRIVATE MicrotaskQueue final : public v8::MicrotaskQueue {
 
   Microtask get(intptr_t index) const;
 
+  intptr_t finished_microtask_count() const {
+    return finished_microtask_count_;
+  }
+  intptr_t promise_reaction_job_count() const {
+    return promise_reaction_job_count_;
+  }
+  intptr_t context_enter_count() const { return context_enter_count_; }
+  intptr_t checkpoint_count() const { return checkpoint_count_; }
+
   MicrotaskQueue* next() const { return next_; }
   MicrotaskQueue* prev() const { return prev_; }
 
@@ -103,6 +112,8 @@ class V8_EXPORT_PRIVATE MicrotaskQueue final : public v8::MicrotaskQueue {
   static const size_t kSizeOffset;
   static const size_t kStartOffset;
   static const size_t kFinishedMicrotaskCountOffset;
+  static const size_t kPromiseReactionJobCountOffset;
+  static const size_t kContextEnterCountOffset;
 
   static const intptr_t kMinimumCapacity;
 
@@ -122,6 +133,15 @@ class V8_EXPORT_PRIVATE MicrotaskQueue final : public v8::MicrotaskQueue {
 
   // The number of finished microtask.
   intptr_t finished_microtask_count_ = 0;
+  // The number of finished promise reaction jobs, which are included in
+  // |finished_microtask_count_|.
+  intptr_t promise_reaction_job_count_ = 0;
+  // The number of times a native context was entered to run microtasks. The
+  // RunMicrotasks builtin enters it only once for a run of promise reaction
+  // jobs of the same native context.
+  intptr_t context_enter_count_ = 0;
+  // The number of checkpoints that ran at least one microtask.
+  intptr_t checkpoint_count_ = 0;
 
   // MicrotaskQueue instances form a doubly linked list loop, so that all
   // instances are reachable through |next_|.
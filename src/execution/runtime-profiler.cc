@@ -5,6 +5,7 @@
 #include "src/execution/runtime-profiler.h"
 
 #include "src/base/platform/platform.h"
+#include "src/baseline/baseline-compiler.h"
 #include "src/codegen/assembler.h"
 #include "src/codegen/compilation-cache.h"
 #include "src/codegen/compiler.h"
@@ -203,6 +204,18 @@ OptimizationReason RuntimeProfiler::ShouldOptimize(JSFunction function,
   return OptimizationReason::kDoNotOptimize;
 }
 
+void RuntimeProfiler::MaybeCompileBaseline(Handle<JSFunction> function) {
+  if (!FLAG_baseline) return;
+  DCHECK(function->has_feedback_vector());
+
+  // Functions which already run optimized code stay in that tier.
+  Handle<SharedFunctionInfo> shared(function->shared(), isolate_);
+  if (!shared->IsInterpreted() || function->HasOptimizedCode()) return;
+  if (shared->GetBytecodeArray().HasBaselineCode()) return;
+
+  baseline::BaselineCompiler::Compile(isolate_, shared);
+}
+
 void RuntimeProfiler::MarkCandidatesForOptimization() {
   HandleScope scope(isolate_);
 
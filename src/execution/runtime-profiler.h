@@ -5,6 +5,7 @@
 #ifndef V8_EXECUTION_RUNTIME_PROFILER_H_
 #define V8_EXECUTION_RUNTIME_PROFILER_H_
 
+#include "src/handles/handles.h"
 #include "src/utils/allocation.h"
 
 namespace v8 {
@@ -22,6 +23,11 @@ class RuntimeProfiler {
 
   void MarkCandidatesForOptimization();
 
+  // Compiles |function| with the baseline compiler if it is eligible. Called
+  // from the bytecode budget interrupt once the function has a feedback
+  // vector, i.e. after it has spent one interrupt budget in the interpreter.
+  void MaybeCompileBaseline(Handle<JSFunction> function);
+
   void NotifyICChanged() { any_ic_changed_ = true; }
 
   void AttemptOnStackReplacement(InterpretedFrame* frame,
@@ -379,6 +379,10 @@ DEFINE_BOOL(assert_types, false,
 // Flags for experimental implementation features.
 DEFINE_BOOL(allocation_site_pretenuring, true,
             "pretenure with allocation sites")
+DEFINE_BOOL(survival_based_pretenuring, false,
+            "pretenure allocation sites whose objects survived most recent "
+            "scavenges and promote their objects on the first scavenge")
+DEFINE_IMPLICATION(survival_based_pretenuring, allocation_site_pretenuring)
 DEFINE_BOOL(page_promotion, true, "promote pages based on utilization")
 DEFINE_BOOL(always_promote_young_mc, true,
             "always promote young objects during mark-compact")
@@ -487,6 +491,21 @@ DEFINE_STRING(trace_ignition_dispatches_output_file, nullptr,
               "the file to which the bytecode handler dispatch table is "
               "written (by default, the table is not written to a file)")
 
+// Flags for the baseline tier.
+#ifdef V8_ENABLE_BASELINE
+DEFINE_BOOL(baseline, false,
+            "enable the experimental baseline compiler for warm functions")
+DEFINE_NEG_IMPLICATION(jitless, baseline)
+#else
+DEFINE_BOOL_READONLY(baseline, false,
+                     "enable the experimental baseline compiler for warm "
+                     "functions (requires v8_enable_baseline)")
+#endif  // V8_ENABLE_BASELINE
+DEFINE_BOOL(trace_baseline, false, "trace baseline compilation")
+DEFINE_INT(max_baseline_bytecode_size, 32 * KB,
+           "maximum bytecode size of functions compiled by the baseline "
+           "compiler")
+
 DEFINE_BOOL(fast_math, true, "faster (but maybe less accurate) math functions")
 DEFINE_BOOL(trace_track_allocation_sites, false,
             "trace the tracking of allocation sites")
@@ -596,6 +615,10 @@ DEFINE_FLOAT(reserve_inline_budget_scale_factor, 1.2,
              "maximum cumulative size of bytecode considered for inlining")
 DEFINE_INT(max_inlined_bytecode_size_small, 30,
            "maximum size of bytecode considered for small function inlining")
+DEFINE_INT(max_inlined_bytecode_size_temporary_result, 90,
+           "maximum size of bytecode for which a call whose result is only "
+           "read from is inlined before more frequent calls, so that escape "
+           "analysis can remove the allocation of the result")
 DEFINE_INT(max_optimized_bytecode_size, 60 * KB,
            "maximum bytecode size to "
            "be considered for optimization; too high values may cause "
@@ -919,6 +942,7 @@ DEFINE_BOOL(concurrent_array_buffer_sweeping, true,
             "concurrently sweep array buffers")
 DEFINE_BOOL(concurrent_allocation, false, "concurrently allocate in old space")
 DEFINE_BOOL(local_heaps, false, "allow heap access from background tasks")
+DEFINE_IMPLICATION(concurrent_allocation, local_heaps)
 DEFINE_BOOL(parallel_marking, true, "use parallel marking in atomic pause")
 DEFINE_INT(ephemeron_fixpoint_iterations, 10,
            "number of fixpoint iterations it takes to switch to linear "
@@ -928,6 +952,10 @@ DEFINE_BOOL(concurrent_store_buffer, true,
             "use concurrent store buffer processing")
 DEFINE_BOOL(concurrent_sweeping, true, "use concurrent sweeping")
 DEFINE_BOOL(parallel_compaction, true, "use parallel compaction")
+DEFINE_FLOAT(compaction_pause_target_ms, 0,
+             "select only as many evacuation candidates for a full GC as the "
+             "traced compaction speed allows to evacuate within this time (0 = "
+             "no limit); the remaining pages are compacted by later GCs")
 DEFINE_BOOL(parallel_pointer_update, true,
             "use parallel pointer update during compaction")
 DEFINE_BOOL(detect_ineffective_gcs_near_heap_limit, true,
@@ -946,6 +974,13 @@ DEFINE_BOOL(track_retaining_path, false,
 DEFINE_DEBUG_BOOL(trace_backing_store, false, "trace backing store events")
 DEFINE_BOOL(concurrent_array_buffer_freeing, true,
             "free array buffer allocations on a background thread")
+DEFINE_BOOL(backing_store_pool, true,
+            "recycle the memory of small, short-lived array buffers")
+DEFINE_SIZE_T(backing_store_pool_max_size, 8 * MB,
+              "maximum number of bytes the backing store pool may cache")
+DEFINE_SIZE_T(process_heap_budget, 0,
+              "budget in MB for the combined old generation size of all "
+              "isolates in the process (0 means no budget)")
 DEFINE_INT(gc_stats, 0, "Used by tracing internally to enable gc statistics")
 DEFINE_IMPLICATION(trace_gc_object_stats, track_gc_object_stats)
 DEFINE_GENERIC_IMPLICATION(
@@ -977,6 +1012,9 @@ DEFINE_BOOL(memory_reducer_for_small_heaps, true,
 DEFINE_INT(heap_growing_percent, 0,
            "specifies heap growing factor as (1 + heap_growing_percent/100)")
 DEFINE_INT(v8_os_page_size, 0, "override OS page size (in KBytes)")
+DEFINE_INT(cached_isolate_reservations, 0,
+           "number of pointer compression cages of disposed isolates kept "
+           "reserved for new isolates")
 DEFINE_BOOL(always_compact, false, "Perform compaction on every full GC")
 DEFINE_BOOL(never_compact, false,
             "Never perform compaction on full GC - testing only")
@@ -1089,6 +1127,9 @@ DEFINE_BOOL(script_streaming, true, "enable parsing on background")
 DEFINE_BOOL(
     finalize_streaming_on_background, false,
     "perform the script streaming finalization on the background thread")
+DEFINE_INT(streaming_eager_compile_budget, 0,
+           "number of source characters of lazy top-level functions to "
+           "compile eagerly on the background thread when streaming scripts")
 DEFINE_BOOL(disable_old_api_accessors, false,
             "Disable old-style API accessors whose setters trigger through the "
             "prototype chain")
@@ -1220,6 +1261,10 @@ DEFINE_BOOL(modify_field_representation_inplace, true,
             "enable in-place field representation updates")
 DEFINE_INT(max_polymorphic_map_count, 4,
            "maximum number of maps to track in POLYMORPHIC state")
+DEFINE_INT(stub_cache_max_primary_table_bits, 15,
+           "log2 of the maximum number of entries in the primary table of "
+           "the megamorphic stub caches, which grow when they miss often "
+           "(11 disables growing)")
 
 DEFINE_BOOL(native_code_counters, DEBUG_BOOL,
             "generate extra code for manipulating stats counters")
@@ -1323,6 +1368,16 @@ DEFINE_BOOL(profile_deserialization, false,
             "Print the time it takes to deserialize the snapshot.")
 DEFINE_BOOL(serialization_statistics, false,
             "Collect statistics on serialized objects.")
+DEFINE_BOOL(share_decompressed_snapshot, true,
+            "Decompress each section of a compressed default snapshot only "
+            "once while several isolates use it and share the result "
+            "between them.")
+DEFINE_BOOL(parallel_value_deserialization, true,
+            "index large structured clone payloads on a background thread "
+            "while deserializing them on the main thread")
+DEFINE_SIZE_T(parallel_value_deserialization_min_size, 64 * KB,
+              "minimum payload size (in bytes) for parallel value "
+              "deserialization")
 #ifdef V8_ENABLE_THIRD_PARTY_HEAP
 DEFINE_UINT_READONLY(serialization_chunk_size, 1,
                      "Custom size for serialization chunks")
@@ -1354,6 +1409,23 @@ DEFINE_BOOL(trace_regexp_assembler, false,
             "trace regexp macro assembler calls.")
 DEFINE_BOOL(trace_regexp_parser, false, "trace regexp parsing")
 DEFINE_BOOL(trace_regexp_tier_up, false, "trace regexp tiering up execution")
+DEFINE_BOOL(linear_regexp_engine, false,
+            "use the linear-time (non-backtracking) regexp engine for all "
+            "patterns it supports")
+DEFINE_BOOL(linear_regexp_engine_on_excessive_backtracks, false,
+            "fall back to the linear-time regexp engine when irregexp "
+            "exceeds the backtrack threshold on a pattern it supports")
+DEFINE_UINT(regexp_backtracks_before_fallback, 50000,
+            "number of backtracks in irregexp before falling back to the "
+            "linear-time regexp engine")
+DEFINE_BOOL(trace_linear_regexp_engine, false,
+            "trace compilation for and fallbacks to the linear-time regexp "
+            "engine")
+DEFINE_BOOL(regexp_shared_bytecode_cache, true,
+            "share compiled regexp bytecode between isolates through a "
+            "process-wide cache")
+DEFINE_SIZE_T(regexp_shared_bytecode_cache_size, 1024,
+              "maximal size of the shared regexp bytecode cache (in KB)")
 
 // Testing flags test/cctest/test-{flags,api,serialization}.cc
 DEFINE_BOOL(testing_bool_flag, true, "testing_bool_flag")
@@ -1401,6 +1473,10 @@ DEFINE_BOOL(minor_mc_parallel_marking, true,
 DEFINE_BOOL(trace_minor_mc_parallel_marking, false,
             "trace parallel marking for the young generation")
 DEFINE_BOOL(minor_mc, false, "perform young generation mark compact GCs")
+DEFINE_SIZE_T(minor_mc_min_semi_space_size, 0,
+              "with --minor-mc, perform young generation mark compact GCs "
+              "only while a semi-space is at least this large (in MBytes), "
+              "and scavenges otherwise")
 #else
 DEFINE_BOOL_READONLY(minor_mc, false,
                      "perform young generation mark compact GCs")
@@ -1724,6 +1800,7 @@ DEFINE_BOOL(single_threaded, false, "disable the use of background tasks")
 DEFINE_IMPLICATION(single_threaded, single_threaded_gc)
 DEFINE_NEG_IMPLICATION(single_threaded, concurrent_recompilation)
 DEFINE_NEG_IMPLICATION(single_threaded, compiler_dispatcher)
+DEFINE_NEG_IMPLICATION(single_threaded, parallel_value_deserialization)
 
 //
 // Parallel and concurrent GC (Orinoco) related flags.
@@ -40,6 +40,16 @@ void PersistentHandles::Detach() {
   DCHECK_NOT_NULL(owner_);
   owner_ = nullptr;
 }
+
+bool PersistentHandles::Contains(Address* location) {
+  for (Address* block_start : blocks_) {
+    Address* block_end = block_start == blocks_.back()
+                             ? block_next_
+                             : block_start + block_size_;
+    if (block_start <= location && location < block_end) return true;
+  }
+  return false;
+}
 #endif
 
 void PersistentHandles::AddBlock() {
@@ -30,6 +30,10 @@ class PersistentHandles {
 
   V8_EXPORT_PRIVATE Handle<Object> NewHandle(Address value);
 
+#ifdef DEBUG
+  V8_EXPORT_PRIVATE bool Contains(Address* location);
+#endif
+
  private:
   void AddBlock();
   Address* GetHandle(Address value);
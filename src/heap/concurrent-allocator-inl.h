@@ -0,0 +1,44 @@
+// Copyright 2020 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#ifndef V8_HEAP_CONCURRENT_ALLOCATOR_INL_H_
+#define V8_HEAP_CONCURRENT_ALLOCATOR_INL_H_
+
+#include "src/heap/concurrent-allocator.h"
+
+#include "src/common/globals.h"
+#include "src/heap/heap.h"
+#include "src/heap/spaces-inl.h"
+#include "src/heap/spaces.h"
+#include "src/objects/heap-object.h"
+
+namespace v8 {
+namespace internal {
+
+AllocationResult ConcurrentAllocator::AllocateRaw(int object_size,
+                                                  AllocationAlignment alignment,
+                                                  AllocationOrigin origin) {
+  // Allocation observers are not notified of background allocations.
+  DCHECK(FLAG_concurrent_allocation);
+  if (object_size > kMaxLabObjectSize) {
+    return AllocateOutsideLab(object_size, alignment, origin);
+  }
+
+  return AllocateInLab(object_size, alignment, origin);
+}
+
+AllocationResult ConcurrentAllocator::AllocateInLab(
+    int object_size, AllocationAlignment alignment, AllocationOrigin origin) {
+  AllocationResult allocation = lab_.AllocateRawAligned(object_size, alignment);
+  if (allocation.IsRetry()) {
+    return AllocateInLabSlow(object_size, alignment, origin);
+  } else {
+    return allocation;
+  }
+}
+
+}  // namespace internal
+}  // namespace v8
+
+#endif  // V8_HEAP_CONCURRENT_ALLOCATOR_INL_H_
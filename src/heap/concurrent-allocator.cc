@@ -0,0 +1,98 @@
+// Copyright 2020 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "src/heap/concurrent-allocator.h"
+
+#include "src/heap/concurrent-allocator-inl.h"
+#include "src/heap/incremental-marking.h"
+#include "src/heap/local-heap.h"
+
+namespace v8 {
+namespace internal {
+
+void ConcurrentAllocator::FreeLinearAllocationArea() {
+  if (!lab_.IsValid()) return;
+  Address top = lab_.top();
+  Address limit = lab_.limit();
+  // Black allocation may have been finished in the meantime, in which case
+  // the mark bits are stale anyway and are left alone like for the main
+  // thread's linear allocation area.
+  if (lab_is_black_ && top != limit &&
+      local_heap_->heap()->incremental_marking()->black_allocation()) {
+    Page::FromAllocationAreaAddress(top)->DestroyBlackAreaBackground(top,
+                                                                     limit);
+  }
+  lab_.Close();
+  lab_is_black_ = false;
+}
+
+void ConcurrentAllocator::MakeLinearAllocationAreaIterable() {
+  lab_.MakeIterable();
+}
+
+AllocationResult ConcurrentAllocator::AllocateInLabSlow(
+    int object_size, AllocationAlignment alignment, AllocationOrigin origin) {
+  if (!EnsureLab(origin)) {
+    return AllocationResult::Retry(space_->identity());
+  }
+
+  AllocationResult allocation = lab_.AllocateRawAligned(object_size, alignment);
+  DCHECK(!allocation.IsRetry());
+
+  return allocation;
+}
+
+bool ConcurrentAllocator::EnsureLab(AllocationOrigin origin) {
+  auto result = space_->SlowGetLinearAllocationAreaBackground(
+      local_heap_, kLabSize, kMaxLabSize, kWordAligned, origin);
+  if (!result) return false;
+
+  FreeLinearAllocationArea();
+
+  Heap* heap = local_heap_->heap();
+  Address start = result->first;
+  size_t size = result->second;
+
+  // Black allocation only starts in a safepoint, so it cannot start while
+  // this thread is running.
+  lab_is_black_ = heap->incremental_marking()->black_allocation();
+  if (lab_is_black_) {
+    Page::FromAllocationAreaAddress(start)->CreateBlackAreaBackground(
+        start, start + size);
+  }
+
+  HeapObject object = HeapObject::FromAddress(start);
+  lab_ = LocalAllocationBuffer::FromResult(heap, AllocationResult(object),
+                                           static_cast<intptr_t>(size));
+  DCHECK(lab_.IsValid());
+  return true;
+}
+
+AllocationResult ConcurrentAllocator::AllocateOutsideLab(
+    int object_size, AllocationAlignment alignment, AllocationOrigin origin) {
+  const int allocation_size =
+      object_size + Heap::GetMaximumFillToAlign(alignment);
+  auto result = space_->SlowGetLinearAllocationAreaBackground(
+      local_heap_, allocation_size, allocation_size, alignment, origin);
+  if (!result) return AllocationResult::Retry(space_->identity());
+  DCHECK_EQ(static_cast<size_t>(allocation_size), result->second);
+
+  Heap* heap = local_heap_->heap();
+  Address start = result->first;
+
+  if (heap->incremental_marking()->black_allocation()) {
+    Page::FromAllocationAreaAddress(start)->CreateBlackAreaBackground(
+        start, start + allocation_size);
+  }
+
+  HeapObject object = HeapObject::FromAddress(start);
+  if (allocation_size > object_size) {
+    object =
+        heap->AlignWithFiller(object, object_size, allocation_size, alignment);
+  }
+  return AllocationResult(object);
+}
+
+}  // namespace internal
+}  // namespace v8
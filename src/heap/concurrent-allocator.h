@@ -0,0 +1,73 @@
+// Copyright 2020 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#ifndef V8_HEAP_CONCURRENT_ALLOCATOR_H_
+#define V8_HEAP_CONCURRENT_ALLOCATOR_H_
+
+#include "src/common/globals.h"
+#include "src/heap/heap.h"
+#include "src/heap/spaces.h"
+
+namespace v8 {
+namespace internal {
+
+class LocalHeap;
+
+// Allocator for background threads that allocate in a paged space
+// concurrently with the main thread. Small objects are bump-pointer
+// allocated in a thread-local linear allocation buffer (LAB); larger ones
+// get their own area from the free list. Refilling the LAB takes the space's
+// allocation mutex. The main thread frees all LABs in a safepoint before
+// garbage collections and when incremental marking starts.
+//
+// Objects are allocated black while black allocation is active, so they have
+// to be fully initialized before they become reachable and must not need
+// write barriers for that initialization.
+class ConcurrentAllocator {
+ public:
+  static const int kLabSize = 4 * KB;
+  static const int kMaxLabSize = 32 * KB;
+  static const int kMaxLabObjectSize = 2 * KB;
+
+  ConcurrentAllocator(LocalHeap* local_heap, PagedSpace* space)
+      : local_heap_(local_heap),
+        space_(space),
+        lab_(LocalAllocationBuffer::InvalidBuffer()) {}
+
+  // Returns a failed AllocationResult if the space is exhausted and the
+  // caller has to request a garbage collection.
+  inline AllocationResult AllocateRaw(int object_size,
+                                      AllocationAlignment alignment,
+                                      AllocationOrigin origin);
+
+  // Gives up the LAB. The unused part is turned into a filler object.
+  void FreeLinearAllocationArea();
+
+  // Writes a filler object into the unused part of the LAB so that the heap
+  // can be iterated, but keeps using the LAB.
+  void MakeLinearAllocationAreaIterable();
+
+ private:
+  inline AllocationResult AllocateInLab(int object_size,
+                                        AllocationAlignment alignment,
+                                        AllocationOrigin origin);
+
+  V8_EXPORT_PRIVATE AllocationResult AllocateInLabSlow(
+      int object_size, AllocationAlignment alignment, AllocationOrigin origin);
+  bool EnsureLab(AllocationOrigin origin);
+
+  V8_EXPORT_PRIVATE AllocationResult AllocateOutsideLab(
+      int object_size, AllocationAlignment alignment, AllocationOrigin origin);
+
+  LocalHeap* const local_heap_;
+  PagedSpace* const space_;
+  LocalAllocationBuffer lab_;
+  // Whether |lab_| was marked black when it was created.
+  bool lab_is_black_ = false;
+};
+
+}  // namespace internal
+}  // namespace v8
+
+#endif  // V8_HEAP_CONCURRENT_ALLOCATOR_H_
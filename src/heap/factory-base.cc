@@ -194,6 +194,9 @@ Handle<BytecodeArray> FactoryBase<Impl>::NewBytecodeArray(
   instance->set_constant_pool(*constant_pool);
   instance->set_handler_table(read_only_roots().empty_byte_array());
   instance->set_source_position_table(read_only_roots().undefined_value());
+#ifdef V8_ENABLE_BASELINE
+  instance->set_baseline_code(read_only_roots().undefined_value());
+#endif  // V8_ENABLE_BASELINE
   CopyBytes(reinterpret_cast<byte*>(instance->GetFirstBytecodeAddress()),
             raw_bytecodes, length);
   instance->clear_padding();
@@ -2133,6 +2133,11 @@ Handle<BytecodeArray> Factory::CopyBytecodeArray(
   copy->set_constant_pool(bytecode_array->constant_pool());
   copy->set_handler_table(bytecode_array->handler_table());
   copy->set_source_position_table(bytecode_array->source_position_table());
+#ifdef V8_ENABLE_BASELINE
+  // Baseline code is specific to the original bytecode and is not shared
+  // with the copy (e.g. the copy used for debugging).
+  copy->set_baseline_code(read_only_roots().undefined_value());
+#endif  // V8_ENABLE_BASELINE
   copy->set_osr_loop_nesting_level(bytecode_array->osr_loop_nesting_level());
   copy->set_bytecode_age(bytecode_array->bytecode_age());
   bytecode_array->CopyBytecodesTo(*copy);
@@ -164,6 +164,9 @@ GCTracer::GCTracer(Heap* heap)
       old_generation_allocation_in_bytes_since_gc_(0),
       embedder_allocation_in_bytes_since_gc_(0),
       combined_mark_compact_speed_cache_(0.0),
+      scavenge_copied_bytes_(0),
+      scavenge_promoted_bytes_(0),
+      scavenge_early_promoted_bytes_(0),
       start_counter_(0),
       average_mutator_duration_(0),
       average_mark_compact_duration_(0),
@@ -193,8 +196,13 @@ void GCTracer::ResetForTesting() {
   new_space_allocation_in_bytes_since_gc_ = 0.0;
   old_generation_allocation_in_bytes_since_gc_ = 0.0;
   combined_mark_compact_speed_cache_ = 0.0;
+  scavenge_copied_bytes_ = 0;
+  scavenge_promoted_bytes_ = 0;
+  scavenge_early_promoted_bytes_ = 0;
   recorded_minor_gcs_total_.Reset();
   recorded_minor_gcs_survived_.Reset();
+  recorded_scavenges_.Reset();
+  recorded_minor_mark_compacts_.Reset();
   recorded_compactions_.Reset();
   recorded_mark_compacts_.Reset();
   recorded_incremental_mark_compacts_.Reset();
@@ -320,7 +328,20 @@ void GCTracer::Stop(GarbageCollector collector) {
 
   switch (current_.type) {
     case Event::SCAVENGER:
+      scavenge_copied_bytes_ += heap_->semi_space_copied_object_size();
+      scavenge_promoted_bytes_ += heap_->promoted_objects_size();
+      scavenge_early_promoted_bytes_ += heap_->early_promoted_objects_size();
+      recorded_scavenges_.Push(
+          MakeBytesAndDuration(current_.young_object_size, duration));
+      recorded_minor_gcs_total_.Push(
+          MakeBytesAndDuration(current_.young_object_size, duration));
+      recorded_minor_gcs_survived_.Push(
+          MakeBytesAndDuration(current_.survived_young_object_size, duration));
+      FetchBackgroundMinorGCCounters();
+      break;
     case Event::MINOR_MARK_COMPACTOR:
+      recorded_minor_mark_compacts_.Push(
+          MakeBytesAndDuration(current_.young_object_size, duration));
       recorded_minor_gcs_total_.Push(
           MakeBytesAndDuration(current_.young_object_size, duration));
       recorded_minor_gcs_survived_.Push(
@@ -587,6 +608,7 @@ void GCTracer::PrintNVP() const {
           "holes_size_after=%zu "
           "allocated=%zu "
           "promoted=%zu "
+          "promoted_early=%zu "
           "semi_space_copied=%zu "
           "nodes_died_in_new=%d "
           "nodes_copied_in_new=%d "
@@ -597,7 +619,11 @@ void GCTracer::PrintNVP() const {
           "semi_space_copy_rate=%.1f%% "
           "new_space_allocation_throughput=%.1f "
           "unmapper_chunks=%d "
-          "context_disposal_rate=%.1f\n",
+          "context_disposal_rate=%.1f "
+          "young_gc_throughput.scavenger=%.f "
+          "young_gc_throughput.minor_mc=%.f "
+          "young_gc_average_pause.scavenger=%.2f "
+          "young_gc_average_pause.minor_mc=%.2f\n",
           duration, spent_in_mutator, current_.TypeName(true),
           current_.reduce_memory, current_.scopes[Scope::HEAP_PROLOGUE],
           current_.scopes[Scope::HEAP_EPILOGUE],
@@ -630,6 +656,7 @@ void GCTracer::PrintNVP() const {
           current_.end_object_size, current_.start_holes_size,
           current_.end_holes_size, allocated_since_last_gc,
           heap_->promoted_objects_size(),
+          heap_->early_promoted_objects_size(),
           heap_->semi_space_copied_object_size(),
           heap_->nodes_died_in_new_space_, heap_->nodes_copied_in_new_space_,
           heap_->nodes_promoted_, heap_->promotion_ratio_,
@@ -637,7 +664,11 @@ void GCTracer::PrintNVP() const {
           heap_->semi_space_copied_rate_,
           NewSpaceAllocationThroughputInBytesPerMillisecond(),
           heap_->memory_allocator()->unmapper()->NumberOfChunks(),
-          ContextDisposalRateInMilliseconds());
+          ContextDisposalRateInMilliseconds(),
+          YoungGenerationSpeedInBytesPerMillisecond(SCAVENGER),
+          YoungGenerationSpeedInBytesPerMillisecond(MINOR_MARK_COMPACTOR),
+          AverageYoungGenerationPauseInMilliseconds(SCAVENGER),
+          AverageYoungGenerationPauseInMilliseconds(MINOR_MARK_COMPACTOR));
       break;
     case Event::MINOR_MARK_COMPACTOR:
       heap_->isolate()->PrintWithTimestamp(
@@ -667,7 +698,11 @@ void GCTracer::PrintNVP() const {
           "background.store_buffer=%.2f "
           "background.unmapper=%.2f "
           "update_marking_deque=%.2f "
-          "reset_liveness=%.2f\n",
+          "reset_liveness=%.2f "
+          "young_gc_throughput.scavenger=%.f "
+          "young_gc_throughput.minor_mc=%.f "
+          "young_gc_average_pause.scavenger=%.2f "
+          "young_gc_average_pause.minor_mc=%.2f\n",
           duration, spent_in_mutator, "mmc", current_.reduce_memory,
           current_.scopes[Scope::MINOR_MC],
           current_.scopes[Scope::MINOR_MC_SWEEPING],
@@ -692,7 +727,11 @@ void GCTracer::PrintNVP() const {
           current_.scopes[Scope::BACKGROUND_STORE_BUFFER],
           current_.scopes[Scope::BACKGROUND_UNMAPPER],
           current_.scopes[Scope::MINOR_MC_MARKING_DEQUE],
-          current_.scopes[Scope::MINOR_MC_RESET_LIVENESS]);
+          current_.scopes[Scope::MINOR_MC_RESET_LIVENESS],
+          YoungGenerationSpeedInBytesPerMillisecond(SCAVENGER),
+          YoungGenerationSpeedInBytesPerMillisecond(MINOR_MARK_COMPACTOR),
+          AverageYoungGenerationPauseInMilliseconds(SCAVENGER),
+          AverageYoungGenerationPauseInMilliseconds(MINOR_MARK_COMPACTOR));
       break;
     case Event::MARK_COMPACTOR:
     case Event::INCREMENTAL_MARK_COMPACTOR:
@@ -1017,6 +1056,28 @@ double GCTracer::ScavengeSpeedInBytesPerMillisecond(
   }
 }
 
+double GCTracer::YoungGenerationSpeedInBytesPerMillisecond(
+    GarbageCollector collector) const {
+  DCHECK(Heap::IsYoungGenerationCollector(collector));
+  return AverageSpeed(collector == SCAVENGER ? recorded_scavenges_
+                                             : recorded_minor_mark_compacts_);
+}
+
+double GCTracer::AverageYoungGenerationPauseInMilliseconds(
+    GarbageCollector collector) const {
+  DCHECK(Heap::IsYoungGenerationCollector(collector));
+  const base::RingBuffer<BytesAndDuration>& buffer =
+      collector == SCAVENGER ? recorded_scavenges_
+                             : recorded_minor_mark_compacts_;
+  if (buffer.Count() == 0) return 0;
+  BytesAndDuration sum = buffer.Sum(
+      [](BytesAndDuration a, BytesAndDuration b) {
+        return std::make_pair(a.first + b.first, a.second + b.second);
+      },
+      MakeBytesAndDuration(0, 0));
+  return sum.second / buffer.Count();
+}
+
 double GCTracer::CompactionSpeedInBytesPerMillisecond() const {
   return AverageSpeed(recorded_compactions_);
 }
@@ -257,6 +257,15 @@ class V8_EXPORT_PRIVATE GCTracer {
   double ScavengeSpeedInBytesPerMillisecond(
       ScavengeSpeedMode mode = kForAllObjects) const;
 
+  // Compute the average speed in bytes/millisecond and the average pause in
+  // milliseconds of the given young generation collector only, so that
+  // scavenges and minor mark-compacts can be compared.
+  // Return 0 if no events have been recorded for the collector.
+  double YoungGenerationSpeedInBytesPerMillisecond(
+      GarbageCollector collector) const;
+  double AverageYoungGenerationPauseInMilliseconds(
+      GarbageCollector collector) const;
+
   // Compute the average compaction speed in bytes/millisecond.
   // Returns 0 if not enough events have been recorded.
   double CompactionSpeedInBytesPerMillisecond() const;
@@ -328,6 +337,16 @@ class V8_EXPORT_PRIVATE GCTracer {
   // Discard all recorded survival events.
   void ResetSurvivalEvents();
 
+  // Bytes that scavenges copied within the young generation, promoted to the
+  // old generation, and promoted on their first scavenge because of their
+  // allocation site's survival history (a subset of the promoted bytes).
+  // Accumulated over the lifetime of the heap.
+  size_t scavenge_copied_bytes() const { return scavenge_copied_bytes_; }
+  size_t scavenge_promoted_bytes() const { return scavenge_promoted_bytes_; }
+  size_t scavenge_early_promoted_bytes() const {
+    return scavenge_early_promoted_bytes_;
+  }
+
   void NotifyIncrementalMarkingStart();
 
   // Returns average mutator utilization with respect to mark-compact
@@ -372,6 +391,7 @@ class V8_EXPORT_PRIVATE GCTracer {
   FRIEND_TEST(GCTracerTest, PerGenerationAllocationThroughput);
   FRIEND_TEST(GCTracerTest, PerGenerationAllocationThroughputWithProvidedTime);
   FRIEND_TEST(GCTracerTest, RegularScope);
+  FRIEND_TEST(GCTracerTest, YoungGenerationCollectorComparison);
   FRIEND_TEST(GCTracerTest, IncrementalMarkingDetails);
   FRIEND_TEST(GCTracerTest, IncrementalScope);
   FRIEND_TEST(GCTracerTest, IncrementalMarkingSpeed);
@@ -475,6 +495,10 @@ class V8_EXPORT_PRIVATE GCTracer {
 
   double combined_mark_compact_speed_cache_;
 
+  size_t scavenge_copied_bytes_;
+  size_t scavenge_promoted_bytes_;
+  size_t scavenge_early_promoted_bytes_;
+
   // Counts how many tracers were started without stopping.
   int start_counter_;
 
@@ -486,6 +510,8 @@ class V8_EXPORT_PRIVATE GCTracer {
 
   base::RingBuffer<BytesAndDuration> recorded_minor_gcs_total_;
   base::RingBuffer<BytesAndDuration> recorded_minor_gcs_survived_;
+  base::RingBuffer<BytesAndDuration> recorded_scavenges_;
+  base::RingBuffer<BytesAndDuration> recorded_minor_mark_compacts_;
   base::RingBuffer<BytesAndDuration> recorded_compactions_;
   base::RingBuffer<BytesAndDuration> recorded_incremental_mark_compacts_;
   base::RingBuffer<BytesAndDuration> recorded_mark_compacts_;
@@ -117,7 +117,15 @@ void Heap::SetRootScriptList(Object value) {
 }
 
 void Heap::SetRootStringTable(StringTable value) {
-  roots_table()[RootIndex::kStringTable] = value.ptr();
+  // Background threads may look up strings concurrently, so the new table has
+  // to be fully populated before it becomes visible to them.
+  base::AsAtomicWord::Release_Store(&roots_table()[RootIndex::kStringTable],
+                                    value.ptr());
+}
+
+StringTable Heap::synchronized_string_table() {
+  return StringTable::unchecked_cast(Object(base::AsAtomicWord::Acquire_Load(
+      &roots_table()[RootIndex::kStringTable])));
 }
 
 void Heap::SetMessageListeners(TemplateList value) {
@@ -6,6 +6,7 @@
 
 #include <cinttypes>
 #include <iomanip>
+#include <sstream>
 #include <unordered_map>
 #include <unordered_set>
 
@@ -13,6 +14,7 @@
 #include "src/base/bits.h"
 #include "src/base/flags.h"
 #include "src/base/once.h"
+#include "src/base/optional.h"
 #include "src/base/utils/random-number-generator.h"
 #include "src/builtins/accessors.h"
 #include "src/codegen/assembler-inl.h"
@@ -48,6 +50,7 @@
 #include "src/heap/object-stats.h"
 #include "src/heap/objects-visiting-inl.h"
 #include "src/heap/objects-visiting.h"
+#include "src/heap/process-heap-budget.h"
 #include "src/heap/read-only-heap.h"
 #include "src/heap/remembered-set.h"
 #include "src/heap/safepoint.h"
@@ -61,6 +64,7 @@
 #include "src/interpreter/interpreter.h"
 #include "src/logging/log.h"
 #include "src/numbers/conversions.h"
+#include "src/objects/backing-store.h"
 #include "src/objects/data-handler.h"
 #include "src/objects/feedback-vector.h"
 #include "src/objects/free-space-inl.h"
@@ -203,6 +207,7 @@ Heap::Heap()
       memory_pressure_level_(MemoryPressureLevel::kNone),
       global_pretenuring_feedback_(kInitialFeedbackCapacity),
       safepoint_(new GlobalSafepoint(this)),
+      collection_barrier_(this),
       external_string_table_(this) {
   // Ensure old_generation_size_ is a multiple of kPageSize.
   DCHECK_EQ(0, max_old_generation_size_ & (Page::kPageSize - 1));
@@ -411,6 +416,15 @@ bool Heap::CanExpandOldGeneration(size_t size) {
   return memory_allocator()->Size() + size <= MaxReserved();
 }
 
+bool Heap::CanExpandOldGenerationBackground(size_t size) {
+  if (force_oom_) return false;
+  // When the heap is tearing down, then GC requests from background threads
+  // are not served and the threads are allowed to expand the heap to avoid OOM.
+  return gc_state() == TEAR_DOWN ||
+         (OldGenerationCapacity() + size <= max_old_generation_size_ &&
+          memory_allocator()->Size() + size <= MaxReserved());
+}
+
 bool Heap::HasBeenSetUp() {
   // We will always have a new space when the heap is set up.
   return new_space_ != nullptr;
@@ -451,6 +465,16 @@ GarbageCollector Heap::SelectGarbageCollector(AllocationSpace space,
   return YoungGenerationCollector();
 }
 
+GarbageCollector Heap::YoungGenerationCollector() {
+#ifdef ENABLE_MINOR_MC
+  if (FLAG_minor_mc && (new_space()->TotalCapacity() >=
+                        FLAG_minor_mc_min_semi_space_size * MB)) {
+    return MINOR_MARK_COMPACTOR;
+  }
+#endif  // ENABLE_MINOR_MC
+  return SCAVENGER;
+}
+
 void Heap::SetGCState(HeapState state) {
   gc_state_ = state;
 }
@@ -826,6 +850,7 @@ void Heap::GarbageCollectionPrologue() {
 
   // Reset GC statistics.
   promoted_objects_size_ = 0;
+  early_promoted_objects_size_ = 0;
   previous_semi_space_copied_object_size_ = semi_space_copied_object_size_;
   semi_space_copied_object_size_ = 0;
   nodes_died_in_new_space_ = 0;
@@ -957,8 +982,13 @@ inline bool MakePretenureDecision(
        current_decision == AllocationSite::kMaybeTenure)) {
     if (ratio >= AllocationSite::kPretenureRatio) {
       // We just transition into tenure state when the semi-space was at
-      // maximum capacity.
-      if (maximum_size_scavenge) {
+      // maximum capacity, or when objects from this site kept surviving over
+      // the last scavenges.
+      bool survived_consistently =
+          FLAG_survival_based_pretenuring &&
+          site.HighSurvivalCount() >=
+              AllocationSite::kSurvivalHistoryTenureThreshold;
+      if (maximum_size_scavenge || survived_consistently) {
         site.set_deopt_dependent_code(true);
         site.set_pretenure_decision(AllocationSite::kTenure);
         // Currently we just need to deopt when we make a state transition to
@@ -987,6 +1017,7 @@ inline bool DigestPretenuringFeedback(Isolate* isolate, AllocationSite site,
       site.pretenure_decision();
 
   if (minimum_mementos_created) {
+    site.RecordSurvival(ratio >= AllocationSite::kPretenureRatio);
     deopt = MakePretenureDecision(site, current_decision, ratio,
                                   maximum_size_scavenge);
   }
@@ -994,9 +1025,10 @@ inline bool DigestPretenuringFeedback(Isolate* isolate, AllocationSite site,
   if (FLAG_trace_pretenuring_statistics) {
     PrintIsolate(isolate,
                  "pretenuring: AllocationSite(%p): (created, found, ratio) "
-                 "(%d, %d, %f) %s => %s\n",
+                 "(%d, %d, %f) history %x %s => %s\n",
                  reinterpret_cast<void*>(site.ptr()), create_count, found_count,
-                 ratio, site.PretenureDecisionName(current_decision),
+                 ratio, site.survival_history(),
+                 site.PretenureDecisionName(current_decision),
                  site.PretenureDecisionName(site.pretenure_decision()));
   }
 
@@ -1007,6 +1039,14 @@ inline bool DigestPretenuringFeedback(Isolate* isolate, AllocationSite site,
 }
 }  // namespace
 
+void Heap::RecordSurvivalRatio(AllocationSite site) {
+  int create_count = site.memento_create_count();
+  if (create_count < AllocationSite::kPretenureMinimumCreated) return;
+  double ratio = static_cast<double>(site.memento_found_count()) / create_count;
+  int bucket = static_cast<int>(ratio * kSurvivalHistogramBuckets);
+  survival_histogram_[std::min(bucket, kSurvivalHistogramBuckets - 1)]++;
+}
+
 void Heap::RemoveAllocationSitePretenuringFeedback(AllocationSite site) {
   global_pretenuring_feedback_.erase(site);
 }
@@ -1026,6 +1066,11 @@ void Heap::ProcessPretenuringFeedback() {
 
     AllocationSite site;
 
+    // Allocation site addresses are only stable until the next full GC, so
+    // the early promotion candidates are recomputed after every GC.
+    early_promotion_sites_.clear();
+    survival_histogram_.fill(0);
+
     // Step 1: Digest feedback for recorded allocation sites.
     bool maximum_size_scavenge = MaximumSizeScavenge();
     for (auto& site_and_count : global_pretenuring_feedback_) {
@@ -1041,9 +1086,17 @@ void Heap::ProcessPretenuringFeedback() {
         DCHECK(site.IsAllocationSite());
         active_allocation_sites++;
         allocation_mementos_found += found_count;
+        RecordSurvivalRatio(site);
         if (DigestPretenuringFeedback(isolate_, site, maximum_size_scavenge)) {
           trigger_deoptimization = true;
         }
+        if (FLAG_survival_based_pretenuring && site.SurvivedRecently() &&
+            (site.IsMaybeTenure() ||
+             site.pretenure_decision() == AllocationSite::kTenure)) {
+          // Objects from this site are promoted on their first scavenge
+          // instead of being copied within the young generation first.
+          early_promotion_sites_.insert(site.ptr());
+        }
         if (site.GetAllocationType() == AllocationType::kOld) {
           tenure_decisions++;
         } else {
@@ -1083,6 +1136,16 @@ void Heap::ProcessPretenuringFeedback() {
                    tenure_decisions, dont_tenure_decisions);
     }
 
+    if (FLAG_trace_pretenuring_statistics && active_allocation_sites > 0) {
+      std::ostringstream histogram;
+      for (size_t count : survival_histogram_) histogram << " " << count;
+      PrintIsolate(isolate(),
+                   "pretenuring: survival histogram (%d%% buckets):%s "
+                   "early_promotion_sites=%zu\n",
+                   100 / kSurvivalHistogramBuckets, histogram.str().c_str(),
+                   early_promotion_sites_.size());
+    }
+
     global_pretenuring_feedback_.clear();
     global_pretenuring_feedback_.reserve(kInitialFeedbackCapacity);
   }
@@ -1224,7 +1287,10 @@ class GCCallbacksScope {
 
 
 void Heap::HandleGCRequest() {
-  if (FLAG_stress_scavenge > 0 && stress_scavenge_observer_->HasRequestedGC()) {
+  if (collection_barrier_.CollectionRequested()) {
+    CheckCollectionRequested();
+  } else if (FLAG_stress_scavenge > 0 &&
+             stress_scavenge_observer_->HasRequestedGC()) {
     CollectAllGarbage(NEW_SPACE, GarbageCollectionReason::kTesting);
     stress_scavenge_observer_->RequestedGCDone();
   } else if (HighMemoryPressure()) {
@@ -1246,6 +1312,92 @@ void Heap::HandleGCRequest() {
   }
 }
 
+void Heap::CheckCollectionRequested() {
+  if (!collection_barrier_.CollectionRequested()) return;
+
+  CollectAllGarbage(current_gc_flags_,
+                    GarbageCollectionReason::kBackgroundAllocationFailure,
+                    current_gc_callback_flags_);
+}
+
+void Heap::RequestCollectionBackground() {
+  collection_barrier_.AwaitCollectionBackground();
+}
+
+void Heap::CollectionBarrier::CollectionPerformed() {
+  base::MutexGuard guard(&mutex_);
+  requested_.store(false, std::memory_order_relaxed);
+  cond_.NotifyAll();
+}
+
+void Heap::CollectionBarrier::ShutdownRequested() {
+  base::MutexGuard guard(&mutex_);
+  shutdown_requested_ = true;
+  requested_.store(false, std::memory_order_relaxed);
+  cond_.NotifyAll();
+}
+
+void Heap::CollectionBarrier::AwaitCollectionBackground() {
+  bool first = false;
+  {
+    base::MutexGuard guard(&mutex_);
+    if (shutdown_requested_) return;
+    first = !requested_.exchange(true, std::memory_order_relaxed);
+  }
+
+  // Only the first background thread that requests a collection needs to
+  // notify the main thread.
+  if (first) ActivateStackGuardAndPostTask();
+
+  base::MutexGuard guard(&mutex_);
+  while (requested_.load(std::memory_order_relaxed) && !shutdown_requested_) {
+    cond_.Wait(&mutex_);
+  }
+}
+
+namespace {
+
+class BackgroundCollectionInterruptTask : public CancelableTask {
+ public:
+  explicit BackgroundCollectionInterruptTask(Heap* heap)
+      : CancelableTask(heap->isolate()), heap_(heap) {}
+
+  ~BackgroundCollectionInterruptTask() override = default;
+
+ private:
+  // v8::internal::CancelableTask overrides.
+  void RunInternal() override { heap_->CheckCollectionRequested(); }
+
+  Heap* heap_;
+  DISALLOW_COPY_AND_ASSIGN(BackgroundCollectionInterruptTask);
+};
+
+}  // namespace
+
+void Heap::CollectionBarrier::ActivateStackGuardAndPostTask() {
+  Isolate* isolate = heap_->isolate();
+  // The interrupt is handled as soon as the main thread runs JavaScript or
+  // checks interrupts, the task while it is idle.
+  isolate->stack_guard()->RequestGC();
+  auto taskrunner = V8::GetCurrentPlatform()->GetForegroundTaskRunner(
+      reinterpret_cast<v8::Isolate*>(isolate));
+  taskrunner->PostTask(
+      std::make_unique<BackgroundCollectionInterruptTask>(heap_));
+}
+
+void Heap::FreeLinearAllocationAreasOfLocalHeaps() {
+  DCHECK(safepoint()->IsActive());
+  safepoint()->IterateLocalHeaps(
+      [](LocalHeap* local_heap) { local_heap->FreeLinearAllocationArea(); });
+}
+
+void Heap::MakeLinearAllocationAreasOfLocalHeapsIterable() {
+  DCHECK(safepoint()->IsActive());
+  safepoint()->IterateLocalHeaps([](LocalHeap* local_heap) {
+    local_heap->MakeLinearAllocationAreaIterable();
+  });
+}
+
 void Heap::ScheduleScavengeTaskIfNeeded() {
   DCHECK_NOT_NULL(scavenge_job_);
   scavenge_job_->ScheduleTaskIfNeeded(this);
@@ -1628,6 +1780,11 @@ bool Heap::CollectGarbage(AllocationSpace space,
     tracer()->Stop(collector);
   }
 
+  if (collector == MARK_COMPACTOR) {
+    // Background threads whose allocation failed can retry now.
+    collection_barrier_.CollectionPerformed();
+  }
+
   if (collector == MARK_COMPACTOR &&
       (gc_callback_flags & (kGCCallbackFlagForced |
                             kGCCallbackFlagCollectAllAvailableGarbage)) != 0) {
@@ -1692,6 +1849,19 @@ void Heap::StartIncrementalMarkingIfAllocationLimitIsReached(
   }
 }
 
+void Heap::StartIncrementalMarkingIfAllocationLimitIsReachedBackground() {
+  if (!incremental_marking()->IsStopped() ||
+      !incremental_marking()->CanBeActivated()) {
+    return;
+  }
+
+  const size_t old_generation_space_available = OldGenerationSpaceAvailable();
+
+  if (old_generation_space_available < new_space_->Capacity()) {
+    incremental_marking()->incremental_marking_job()->ScheduleTask(this);
+  }
+}
+
 void Heap::StartIdleIncrementalMarking(
     GarbageCollectionReason gc_reason,
     const GCCallbackFlags gc_callback_flags) {
@@ -2010,7 +2180,10 @@ bool Heap::PerformGarbageCollection(
     }
   }
 
-  if (FLAG_local_heaps) safepoint()->Start();
+  if (FLAG_local_heaps) {
+    safepoint()->Start();
+    FreeLinearAllocationAreasOfLocalHeaps();
+  }
 #ifdef VERIFY_HEAP
   if (FLAG_verify_heap) {
     Verify();
@@ -2193,6 +2366,32 @@ void Heap::RecomputeLimits(GarbageCollector collector) {
     }
     CheckIneffectiveMarkCompact(
         old_gen_size, tracer()->AverageMarkCompactMutatorUtilization());
+    // Heaps of other isolates may have used up the process-wide budget.
+    size_t budgeted_limit = ProcessHeapBudget::Get()->UpdateHeap(
+        this, old_gen_size, old_generation_allocation_limit_,
+        MemoryController<V8HeapTrait>::MinimumAllocationLimitGrowingStep(mode),
+        isolate()->IsIsolateInBackground() || HasLowAllocationRate(),
+        MonotonicallyIncreasingTimeInMs());
+    if (budgeted_limit < old_generation_allocation_limit_) {
+      old_generation_allocation_limit_ = budgeted_limit;
+      if (UseGlobalMemoryScheduling()) {
+        // The global limit must not leave more headroom than the budget.
+        global_allocation_limit_ =
+            Min(global_allocation_limit_,
+                GlobalSizeOfObjects() + (budgeted_limit - old_gen_size));
+      }
+    }
+    if (backing_store_pool_) {
+      // Let the pool cache a fraction of the old generation's headroom, and
+      // nothing while the heap tries to save memory.
+      size_t pool_size = 0;
+      if (!ShouldReduceMemory() && mode != HeapGrowingMode::kMinimal &&
+          old_generation_allocation_limit_ > old_gen_size) {
+        pool_size = Min(FLAG_backing_store_pool_max_size,
+                        (old_generation_allocation_limit_ - old_gen_size) / 4);
+      }
+      backing_store_pool_->SetMaxSize(pool_size);
+    }
   } else if (HasLowYoungGenerationAllocationRate() &&
              old_generation_size_configured_) {
     size_t new_old_generation_limit =
@@ -2291,6 +2490,18 @@ void Heap::MinorMarkCompact() {
 #endif  // ENABLE_MINOR_MC
 }
 
+void Heap::CleanupMinorMarkCompactPages() {
+#ifdef ENABLE_MINOR_MC
+  // With --minor-mc-min-semi-space-size scavenges and minor mark-compacts
+  // alternate. Pages promoted in place by the last minor mark-compact are
+  // only swept lazily, using its mark bits, which must not be seen by the
+  // next one after the scavenge has moved or released the pages.
+  if (FLAG_minor_mc) {
+    minor_mark_compact_collector()->MakeSweepToIteratePagesIterable();
+  }
+#endif  // ENABLE_MINOR_MC
+}
+
 void Heap::MarkCompactEpilogue() {
   TRACE_GC(tracer(), GCTracer::Scope::MC_EPILOGUE);
   SetGCState(NOT_IN_GC);
@@ -2337,6 +2548,7 @@ void Heap::EvacuateYoungGeneration() {
   }
 
   mark_compact_collector()->sweeper()->EnsureIterabilityCompleted();
+  CleanupMinorMarkCompactPages();
 
   SetGCState(SCAVENGE);
   LOG(isolate_, ResourceEvent("scavenge", "begin"));
@@ -2396,6 +2608,7 @@ void Heap::Scavenge() {
 
 
   mark_compact_collector()->sweeper()->EnsureIterabilityCompleted();
+  CleanupMinorMarkCompactPages();
 
   SetGCState(SCAVENGE);
 
@@ -3266,6 +3479,14 @@ void Heap::CreateFillerForArray(T object, int elements_to_trim,
 
 void Heap::MakeHeapIterable() {
   mark_compact_collector()->EnsureSweepingCompleted();
+#ifdef ENABLE_MINOR_MC
+  if (FLAG_minor_mc) {
+    minor_mark_compact_collector()->MakeSweepToIteratePagesIterable();
+  }
+#endif  // ENABLE_MINOR_MC
+  if (FLAG_local_heaps && safepoint()->IsActive()) {
+    MakeLinearAllocationAreasOfLocalHeapsIterable();
+  }
 }
 
 namespace {
@@ -3996,6 +4217,8 @@ const char* Heap::GarbageCollectionReasonToString(
       return "global allocation limit";
     case GarbageCollectionReason::kMeasureMemory:
       return "measure memory";
+    case GarbageCollectionReason::kBackgroundAllocationFailure:
+      return "background allocation failure";
     case GarbageCollectionReason::kUnknown:
       return "unknown";
   }
@@ -4471,6 +4694,10 @@ void Heap::IterateStrongRoots(RootVisitor* v, VisitMode mode) {
   isolate_->handle_scope_implementer()->Iterate(v);
 
   if (FLAG_local_heaps) {
+    // Garbage collections already stopped background threads, other callers
+    // like the serializer or heap snapshots stop them just for the iteration.
+    base::Optional<SafepointScope> safepoint_scope;
+    if (!safepoint_->IsActive()) safepoint_scope.emplace(this);
     safepoint_->Iterate(&left_trim_visitor);
     safepoint_->Iterate(v);
     isolate_->persistent_handles_list()->Iterate(&left_trim_visitor);
@@ -4888,6 +5115,15 @@ bool Heap::ShouldExpandOldGenerationOnSlowAllocation() {
   return true;
 }
 
+bool Heap::ShouldExpandOldGenerationOnSlowAllocationBackground() {
+  if (OldGenerationSpaceAvailable() > 0) return true;
+  // We reached the old generation allocation limit. Background threads can
+  // neither start nor finalize incremental marking themselves, so they keep
+  // expanding the heap until the limit is overshot by a large margin and
+  // request a full garbage collection only then.
+  return !AllocationLimitOvershotByLargeMargin();
+}
+
 Heap::HeapGrowingMode Heap::CurrentHeapGrowingMode() {
   if (ShouldReduceMemory() || FLAG_stress_compaction) {
     return Heap::HeapGrowingMode::kMinimal;
@@ -5202,9 +5438,13 @@ void Heap::SetUpSpaces() {
 #endif  // ENABLE_MINOR_MC
   array_buffer_collector_.reset(new ArrayBufferCollector(this));
   array_buffer_sweeper_.reset(new ArrayBufferSweeper(this));
+  if (FLAG_backing_store_pool) {
+    backing_store_pool_ = std::make_shared<BackingStorePool>(isolate());
+  }
   gc_idle_time_handler_.reset(new GCIdleTimeHandler());
   memory_measurement_.reset(new MemoryMeasurement(isolate()));
   memory_reducer_.reset(new MemoryReducer(this));
+  ProcessHeapBudget::Get()->Register(this);
   if (V8_UNLIKELY(TracingFlags::is_gc_stats_enabled())) {
     live_object_stats_.reset(new ObjectStats(this));
     dead_object_stats_.reset(new ObjectStats(this));
@@ -5373,6 +5613,14 @@ void Heap::RegisterExternallyReferencedObject(Address* location) {
 
 void Heap::StartTearDown() {
   SetGCState(TEAR_DOWN);
+
+  // Other isolates must not ask this heap to reduce memory anymore once its
+  // tasks are about to be canceled.
+  ProcessHeapBudget::Get()->Unregister(this);
+
+  // Background threads may still wait for a garbage collection. GC requests
+  // are not served anymore at this point, so let them expand the heap instead.
+  collection_barrier_.ShutdownRequested();
 #ifdef VERIFY_HEAP
   // {StartTearDown} is called fairly early during Isolate teardown, so it's
   // a good time to run heap verification (if requested), before starting to
@@ -5380,6 +5628,7 @@ void Heap::StartTearDown() {
   if (FLAG_verify_heap) {
     if (FLAG_local_heaps) {
       SafepointScope scope(this);
+      FreeLinearAllocationAreasOfLocalHeaps();
       Verify();
     } else {
       Verify();
@@ -5441,6 +5690,11 @@ void Heap::TearDown() {
   scavenger_collector_.reset();
   array_buffer_collector_.reset();
   array_buffer_sweeper_.reset();
+  if (backing_store_pool_) {
+    // Backing stores that outlive the isolate free their memory themselves.
+    backing_store_pool_->TearDown();
+    backing_store_pool_.reset();
+  }
   incremental_marking_.reset();
   concurrent_marking_.reset();
 
@@ -5900,6 +6154,9 @@ HeapObjectIterator::HeapObjectIterator(
       filter_(nullptr),
       space_iterator_(nullptr),
       object_iterator_(nullptr) {
+  if (FLAG_local_heaps && !heap_->safepoint()->IsActive()) {
+    safepoint_scope_ = std::make_unique<SafepointScope>(heap_);
+  }
   heap_->MakeHeapIterable();
   // Start the iteration.
   space_iterator_ = new SpaceIterator(heap_);
@@ -5,6 +5,7 @@
 #ifndef V8_HEAP_HEAP_H_
 #define V8_HEAP_HEAP_H_
 
+#include <array>
 #include <cmath>
 #include <map>
 #include <memory>
@@ -17,6 +18,8 @@
 #include "include/v8-internal.h"
 #include "include/v8.h"
 #include "src/base/atomic-utils.h"
+#include "src/base/platform/condition-variable.h"
+#include "src/base/platform/mutex.h"
 #include "src/builtins/accessors.h"
 #include "src/common/assert-scope.h"
 #include "src/common/globals.h"
@@ -52,6 +55,7 @@ class Heap;
 
 class IncrementalMarking;
 class BackingStore;
+class BackingStorePool;
 class JSArrayBuffer;
 class JSPromise;
 class NativeContext;
@@ -84,6 +88,7 @@ class Page;
 class PagedSpace;
 class ReadOnlyHeap;
 class RootVisitor;
+class SafepointScope;
 class ScavengeJob;
 class Scavenger;
 class ScavengerCollector;
@@ -141,7 +146,8 @@ enum class GarbageCollectionReason {
   kTesting = 21,
   kExternalFinalize = 22,
   kGlobalAllocationLimit = 23,
-  kMeasureMemory = 24
+  kMeasureMemory = 24,
+  kBackgroundAllocationFailure = 25
   // If you add new items here, then update the incremental_marking_reason,
   // mark_compact_reason, and scavenge_reason counters in counters.h.
   // Also update src/tools/metrics/histograms/histograms.xml in chromium.
@@ -367,13 +373,11 @@ class Heap {
     return collector == SCAVENGER || collector == MINOR_MARK_COMPACTOR;
   }
 
-  static inline GarbageCollector YoungGenerationCollector() {
-#if ENABLE_MINOR_MC
-    return (FLAG_minor_mc) ? MINOR_MARK_COMPACTOR : SCAVENGER;
-#else
-    return SCAVENGER;
-#endif  // ENABLE_MINOR_MC
-  }
+  // Returns the collector to use for the young generation. With --minor-mc,
+  // scavenges are still used while the semi-spaces are smaller than
+  // --minor-mc-min-semi-space-size: copying a small young generation is
+  // cheaper than marking it, promoting pages in place and sweeping them.
+  GarbageCollector YoungGenerationCollector();
 
   static inline const char* CollectorName(GarbageCollector collector) {
     switch (collector) {
@@ -622,6 +626,11 @@ class Heap {
 
   GlobalSafepoint* safepoint() { return safepoint_.get(); }
 
+  // Helpers for the linear allocation areas of background threads. Must be
+  // called while the safepoint is active.
+  void FreeLinearAllocationAreasOfLocalHeaps();
+  void MakeLinearAllocationAreasOfLocalHeapsIterable();
+
   V8_EXPORT_PRIVATE double MonotonicallyIncreasingTimeInMs();
 
   void RecordStats(HeapStats* stats, bool take_snapshot = false);
@@ -783,6 +792,11 @@ class Heap {
     return array_buffer_sweeper_.get();
   }
 
+  // Null if --backing-store-pool is off.
+  const std::shared_ptr<BackingStorePool>& backing_store_pool() {
+    return backing_store_pool_;
+  }
+
   const base::AddressRegion& code_range();
 
   // ===========================================================================
@@ -800,6 +814,9 @@ class Heap {
   V8_INLINE void SetRootMaterializedObjects(FixedArray objects);
   V8_INLINE void SetRootScriptList(Object value);
   V8_INLINE void SetRootStringTable(StringTable value);
+  // Loads the string table with acquire semantics, for lookups from
+  // background threads.
+  V8_INLINE StringTable synchronized_string_table();
   V8_INLINE void SetRootNoScriptSharedFunctionInfos(Object value);
   V8_INLINE void SetMessageListeners(TemplateList value);
   V8_INLINE void SetPendingOptimizeForTestBytecode(Object bytecode);
@@ -898,6 +915,16 @@ class Heap {
   // Invoked when GC was requested via the stack guard.
   void HandleGCRequest();
 
+  // Performs a full garbage collection if a background thread requested one
+  // because its allocation failed. Must be called on the main thread.
+  void CheckCollectionRequested();
+
+  // Called on a background thread whose allocation failed. Requests a full
+  // garbage collection from the main thread and blocks until it was performed
+  // or the heap started tearing down. The calling thread's LocalHeap has to
+  // be parked.
+  void RequestCollectionBackground();
+
   // ===========================================================================
   // Builtins. =================================================================
   // ===========================================================================
@@ -976,6 +1003,9 @@ class Heap {
   void StartIncrementalMarkingIfAllocationLimitIsReached(
       int gc_flags,
       GCCallbackFlags gc_callback_flags = GCCallbackFlags::kNoGCCallbackFlags);
+  // Variant of the above for background threads. It only schedules a task that
+  // starts incremental marking on the main thread.
+  void StartIncrementalMarkingIfAllocationLimitIsReachedBackground();
 
   void FinalizeIncrementalMarkingIfComplete(GarbageCollectionReason gc_reason);
   // Synchronously finalizes incremental marking.
@@ -1215,6 +1245,13 @@ class Heap {
   }
   inline size_t promoted_objects_size() { return promoted_objects_size_; }
 
+  inline void IncrementEarlyPromotedObjectsSize(size_t object_size) {
+    early_promoted_objects_size_ += object_size;
+  }
+  inline size_t early_promoted_objects_size() {
+    return early_promoted_objects_size_;
+  }
+
   inline void IncrementSemiSpaceCopiedObjectSize(size_t object_size) {
     semi_space_copied_object_size_ += object_size;
   }
@@ -1367,6 +1404,17 @@ class Heap {
   void MergeAllocationSitePretenuringFeedback(
       const PretenuringFeedbackMap& local_pretenuring_feedback);
 
+  // Returns true if objects allocated from the site at {site_address} should
+  // skip the semi-space copy and be promoted on their first scavenge. Safe to
+  // call from parallel scavenger tasks; the site is not dereferenced.
+  bool IsEarlyPromotionSite(Address site_address) const {
+    return !early_promotion_sites_.empty() &&
+           early_promotion_sites_.count(site_address) > 0;
+  }
+  bool HasEarlyPromotionSites() const {
+    return !early_promotion_sites_.empty();
+  }
+
   // ===========================================================================
   // Allocation tracking. ======================================================
   // ===========================================================================
@@ -1478,6 +1526,37 @@ class Heap {
   using ExternalStringTableUpdaterCallback = String (*)(Heap* heap,
                                                         FullObjectSlot pointer);
 
+  // Lets background threads whose allocation failed wait for a full garbage
+  // collection on the main thread.
+  class CollectionBarrier {
+   public:
+    explicit CollectionBarrier(Heap* heap) : heap_(heap) {}
+
+    bool CollectionRequested() {
+      return requested_.load(std::memory_order_relaxed);
+    }
+
+    // Releases all waiting background threads. Called on the main thread
+    // after a full garbage collection.
+    void CollectionPerformed();
+
+    // Releases all waiting background threads and makes future requests
+    // return immediately.
+    void ShutdownRequested();
+
+    // Requests a collection and blocks until it was performed.
+    void AwaitCollectionBackground();
+
+   private:
+    void ActivateStackGuardAndPostTask();
+
+    Heap* heap_;
+    base::Mutex mutex_;
+    base::ConditionVariable cond_;
+    std::atomic<bool> requested_{false};
+    bool shutdown_requested_ = false;
+  };
+
   // External strings table is a place where all external strings are
   // registered.  We need to keep track of such strings to properly
   // finalize them.
@@ -1570,6 +1649,8 @@ class Heap {
 
   static const int kInitialFeedbackCapacity = 256;
 
+  static const int kSurvivalHistogramBuckets = 10;
+
   Heap();
   ~Heap();
 
@@ -1725,6 +1806,10 @@ class Heap {
   // Removes an entry from the global pretenuring storage.
   void RemoveAllocationSitePretenuringFeedback(AllocationSite site);
 
+  // Adds the survival ratio of {site} in the current GC to the survival
+  // histogram.
+  void RecordSurvivalRatio(AllocationSite site);
+
   // ===========================================================================
   // Actual GC. ================================================================
   // ===========================================================================
@@ -1738,6 +1823,9 @@ class Heap {
   void MarkCompact();
   // Performs a minor collection of just the young generation.
   void MinorMarkCompact();
+  // Sweeps the pages promoted in place by the last minor mark-compact before
+  // a scavenge.
+  void CleanupMinorMarkCompactPages();
 
   // Code to be run before and after mark-compact.
   void MarkCompactPrologue();
@@ -1814,6 +1902,10 @@ class Heap {
 
   bool ShouldExpandOldGenerationOnSlowAllocation();
 
+  // Variants of the above for background threads allocating concurrently.
+  bool CanExpandOldGenerationBackground(size_t size);
+  bool ShouldExpandOldGenerationOnSlowAllocationBackground();
+
   HeapGrowingMode CurrentHeapGrowingMode();
 
   enum class IncrementalMarkingLimit { kNoLimit, kSoftLimit, kHardLimit };
@@ -2079,6 +2171,7 @@ class Heap {
   int deferred_counters_[v8::Isolate::kUseCounterFeatureCount];
 
   size_t promoted_objects_size_ = 0;
+  size_t early_promoted_objects_size_ = 0;
   double promotion_ratio_ = 0.0;
   double promotion_rate_ = 0.0;
   size_t semi_space_copied_object_size_ = 0;
@@ -2109,6 +2202,7 @@ class Heap {
   std::unique_ptr<ScavengerCollector> scavenger_collector_;
   std::unique_ptr<ArrayBufferCollector> array_buffer_collector_;
   std::unique_ptr<ArrayBufferSweeper> array_buffer_sweeper_;
+  std::shared_ptr<BackingStorePool> backing_store_pool_;
 
   std::unique_ptr<MemoryAllocator> memory_allocator_;
   std::unique_ptr<IncrementalMarking> incremental_marking_;
@@ -2143,6 +2237,13 @@ class Heap {
   // forwarding pointers.
   PretenuringFeedbackMap global_pretenuring_feedback_;
 
+  // Allocation sites whose objects kept surviving scavenges, see
+  // IsEarlyPromotionSite(). Recomputed by ProcessPretenuringFeedback().
+  std::unordered_set<Address> early_promotion_sites_;
+
+  // Number of allocation sites per survival ratio bucket in the last GC.
+  std::array<size_t, kSurvivalHistogramBuckets> survival_histogram_ = {};
+
   char trace_ring_buffer_[kTraceRingBufferSize];
 
   // Used as boolean.
@@ -2168,6 +2269,8 @@ class Heap {
 
   std::unique_ptr<GlobalSafepoint> safepoint_;
 
+  CollectionBarrier collection_barrier_;
+
   bool is_current_gc_forced_ = false;
 
   ExternalStringTable external_string_table_;
@@ -2450,6 +2553,8 @@ class V8_EXPORT_PRIVATE HeapObjectIterator {
   DISALLOW_HEAP_ALLOCATION(no_heap_allocation_)
 
   Heap* heap_;
+  // Stops background threads from allocating during the iteration.
+  std::unique_ptr<SafepointScope> safepoint_scope_;
   HeapObjectsFiltering filtering_;
   HeapObjectsFilter* filter_;
   // Space iterator for iterating all the spaces.
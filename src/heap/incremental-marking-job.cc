@@ -47,6 +47,8 @@ void IncrementalMarkingJob::Start(Heap* heap) {
 }
 
 void IncrementalMarkingJob::ScheduleTask(Heap* heap, TaskType task_type) {
+  base::MutexGuard guard(&mutex_);
+
   if (!IsTaskPending(task_type) && !heap->IsTearingDown() &&
       FLAG_incremental_marking_task) {
     v8::Isolate* isolate = reinterpret_cast<v8::Isolate*>(heap->isolate());
@@ -97,6 +99,7 @@ void IncrementalMarkingJob::Task::RunInternal() {
   EmbedderStackStateScope scope(heap->local_embedder_heap_tracer(),
                                 stack_state_);
   if (task_type_ == TaskType::kNormal) {
+    base::MutexGuard guard(&job_->mutex_);
     heap->tracer()->RecordTimeToIncrementalMarkingTask(
         heap->MonotonicallyIncreasingTimeInMs() - job_->scheduled_time_);
     job_->scheduled_time_ = 0.0;
@@ -113,7 +116,10 @@ void IncrementalMarkingJob::Task::RunInternal() {
 
   // Clear this flag after StartIncrementalMarking call to avoid
   // scheduling a new task when startining incremental marking.
-  job_->SetTaskPending(task_type_, false);
+  {
+    base::MutexGuard guard(&job_->mutex_);
+    job_->SetTaskPending(task_type_, false);
+  }
 
   if (!incremental_marking->IsStopped()) {
     StepResult step_result = Step(heap);
@@ -129,6 +135,7 @@ void IncrementalMarkingJob::Task::RunInternal() {
 }
 
 double IncrementalMarkingJob::CurrentTimeToTask(Heap* heap) const {
+  base::MutexGuard guard(&mutex_);
   if (scheduled_time_ == 0.0) return 0.0;
 
   return heap->MonotonicallyIncreasingTimeInMs() - scheduled_time_;
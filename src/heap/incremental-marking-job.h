@@ -5,6 +5,7 @@
 #ifndef V8_HEAP_INCREMENTAL_MARKING_JOB_H_
 #define V8_HEAP_INCREMENTAL_MARKING_JOB_H_
 
+#include "src/base/platform/mutex.h"
 #include "src/tasks/cancelable-task.h"
 
 namespace v8 {
@@ -24,6 +25,8 @@ class IncrementalMarkingJob final {
 
   void Start(Heap* heap);
 
+  // Thread-safe, so that background threads allocating concurrently can
+  // request the start of incremental marking.
   void ScheduleTask(Heap* heap, TaskType task_type = TaskType::kNormal);
 
   double CurrentTimeToTask(Heap* heap) const;
@@ -45,6 +48,8 @@ class IncrementalMarkingJob final {
     }
   }
 
+  // Guards the fields below.
+  mutable base::Mutex mutex_;
   double scheduled_time_ = 0.0;
   bool normal_task_pending_ = false;
   bool delayed_task_pending_ = false;
@@ -322,6 +322,16 @@ void IncrementalMarking::StartMarking() {
     heap()->isolate()->PrintWithTimestamp(
         "[IncrementalMarking] Start marking\n");
   }
+  // Background threads must not allocate while evacuation candidates are
+  // selected and black allocation starts, and they give up their linear
+  // allocation areas so that all later ones are allocated black.
+  if (FLAG_local_heaps) {
+    heap_->safepoint()->Start();
+    heap_->FreeLinearAllocationAreasOfLocalHeaps();
+    base::MutexGuard guard(&background_live_bytes_mutex_);
+    background_live_bytes_.clear();
+  }
+
   is_compacting_ = !FLAG_never_compact && collector_->StartCompaction();
   collector_->StartMarking();
 
@@ -335,6 +345,8 @@ void IncrementalMarking::StartMarking() {
 
   MarkRoots();
 
+  if (FLAG_local_heaps) heap_->safepoint()->End();
+
   if (FLAG_concurrent_marking && !heap_->IsTearingDown()) {
     heap_->concurrent_marking()->ScheduleTasks();
   }
@@ -389,6 +401,20 @@ void IncrementalMarking::FinishBlackAllocation() {
   }
 }
 
+void IncrementalMarking::IncrementLiveBytesBackground(MemoryChunk* chunk,
+                                                      intptr_t by) {
+  base::MutexGuard guard(&background_live_bytes_mutex_);
+  background_live_bytes_[chunk] += by;
+}
+
+void IncrementalMarking::FlushLiveBytesBackground() {
+  base::MutexGuard guard(&background_live_bytes_mutex_);
+  for (auto& pair : background_live_bytes_) {
+    marking_state()->IncrementLiveBytes(pair.first, pair.second);
+  }
+  background_live_bytes_.clear();
+}
+
 void IncrementalMarking::EnsureBlackAllocated(Address allocated, size_t size) {
   if (black_allocation() && allocated != kNullAddress) {
     HeapObject object = HeapObject::FromAddress(allocated);
@@ -407,10 +433,13 @@ void IncrementalMarking::MarkRoots() {
   DCHECK(!finalize_marking_completed_);
   DCHECK(IsMarking());
 
-  if (FLAG_local_heaps) heap_->safepoint()->Start();
+  // StartMarking() already stopped background threads.
+  const bool enter_safepoint =
+      FLAG_local_heaps && !heap_->safepoint()->IsActive();
+  if (enter_safepoint) heap_->safepoint()->Start();
   IncrementalMarkingRootMarkingVisitor visitor(this);
   heap_->IterateStrongRoots(&visitor, VISIT_ONLY_STRONG_IGNORE_STACK);
-  if (FLAG_local_heaps) heap_->safepoint()->End();
+  if (enter_safepoint) heap_->safepoint()->End();
 }
 
 bool IncrementalMarking::ShouldRetainMap(Map map, int age) {
@@ -766,6 +795,7 @@ void IncrementalMarking::Stop() {
   SetState(STOPPED);
   is_compacting_ = false;
   FinishBlackAllocation();
+  FlushLiveBytesBackground();
 }
 
 
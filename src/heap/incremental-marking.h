@@ -5,6 +5,10 @@
 #ifndef V8_HEAP_INCREMENTAL_MARKING_H_
 #define V8_HEAP_INCREMENTAL_MARKING_H_
 
+#include <atomic>
+#include <unordered_map>
+
+#include "src/base/platform/mutex.h"
 #include "src/heap/heap.h"
 #include "src/heap/incremental-marking-job.h"
 #include "src/heap/mark-compact.h"
@@ -217,6 +221,11 @@ class V8_EXPORT_PRIVATE IncrementalMarking final {
 
   bool black_allocation() { return black_allocation_; }
 
+  // Records live bytes of black areas that background threads create or
+  // destroy in their linear allocation areas. They are added to the pages on
+  // the main thread when marking stops.
+  void IncrementLiveBytesBackground(MemoryChunk* chunk, intptr_t by);
+
   void StartBlackAllocationForTesting() {
     if (!black_allocation_) {
       StartBlackAllocation();
@@ -254,6 +263,10 @@ class V8_EXPORT_PRIVATE IncrementalMarking final {
   void PauseBlackAllocation();
   void FinishBlackAllocation();
 
+  // Adds the live bytes recorded by IncrementLiveBytesBackground() to the
+  // pages.
+  void FlushLiveBytesBackground();
+
   void MarkRoots();
   bool ShouldRetainMap(Map map, int age);
   // Retain dying maps for <FLAG_retain_maps_for_n_gc> garbage collections to
@@ -317,11 +330,11 @@ class V8_EXPORT_PRIVATE IncrementalMarking final {
   size_t bytes_marked_concurrently_ = 0;
 
   // Must use SetState() above to update state_
-  State state_;
+  std::atomic<State> state_;
 
   bool is_compacting_ = false;
   bool was_activated_ = false;
-  bool black_allocation_ = false;
+  std::atomic<bool> black_allocation_{false};
   bool finalize_marking_completed_ = false;
   IncrementalMarkingJob incremental_marking_job_;
 
@@ -334,6 +347,9 @@ class V8_EXPORT_PRIVATE IncrementalMarking final {
   AtomicMarkingState atomic_marking_state_;
   NonAtomicMarkingState non_atomic_marking_state_;
 
+  base::Mutex background_live_bytes_mutex_;
+  std::unordered_map<MemoryChunk*, intptr_t> background_live_bytes_;
+
   DISALLOW_IMPLICIT_CONSTRUCTORS(IncrementalMarking);
 };
 }  // namespace internal
@@ -0,0 +1,40 @@
+// Copyright 2020 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#ifndef V8_HEAP_LOCAL_HEAP_INL_H_
+#define V8_HEAP_LOCAL_HEAP_INL_H_
+
+#include "src/common/globals.h"
+#include "src/heap/concurrent-allocator-inl.h"
+#include "src/heap/local-heap.h"
+
+namespace v8 {
+namespace internal {
+
+AllocationResult LocalHeap::AllocateRaw(int size_in_bytes,
+                                        AllocationType allocation,
+                                        AllocationOrigin origin,
+                                        AllocationAlignment alignment) {
+  DCHECK_EQ(allocation, AllocationType::kOld);
+  if (size_in_bytes > kMaxRegularHeapObjectSize) {
+    return heap()->lo_space()->AllocateRawBackground(this, size_in_bytes);
+  }
+  return old_space_allocator()->AllocateRaw(size_in_bytes, alignment, origin);
+}
+
+Address LocalHeap::AllocateRawOrFail(int size_in_bytes,
+                                     AllocationType allocation,
+                                     AllocationOrigin origin,
+                                     AllocationAlignment alignment) {
+  AllocationResult result =
+      AllocateRaw(size_in_bytes, allocation, origin, alignment);
+  if (!result.IsRetry()) return result.ToObjectChecked().address();
+  return PerformCollectionAndAllocateAgain(size_in_bytes, allocation, origin,
+                                           alignment);
+}
+
+}  // namespace internal
+}  // namespace v8
+
+#endif  // V8_HEAP_LOCAL_HEAP_INL_H_
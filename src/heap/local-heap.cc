@@ -8,7 +8,9 @@
 
 #include "src/base/platform/mutex.h"
 #include "src/handles/local-handles.h"
+#include "src/heap/concurrent-allocator.h"
 #include "src/heap/heap-inl.h"
+#include "src/heap/local-heap-inl.h"
 #include "src/heap/safepoint.h"
 
 namespace v8 {
@@ -22,7 +24,8 @@ LocalHeap::LocalHeap(Heap* heap,
       prev_(nullptr),
       next_(nullptr),
       handles_(new LocalHandles),
-      persistent_handles_(std::move(persistent_handles)) {
+      persistent_handles_(std::move(persistent_handles)),
+      old_space_allocator_(new ConcurrentAllocator(this, heap->old_space())) {
   heap_->safepoint()->AddLocalHeap(this);
   if (persistent_handles_) {
     persistent_handles_->Attach(this);
@@ -69,6 +72,9 @@ void LocalHeap::Unpark() {
 
 void LocalHeap::EnsureParkedBeforeDestruction() {
   base::MutexGuard guard(&state_mutex_);
+  // Holding |state_mutex_| prevents safepoints, so the linear allocation area
+  // can be given up even if this thread was not running.
+  FreeLinearAllocationArea();
   state_ = ThreadState::Parked;
   state_change_.NotifyAll();
 }
@@ -94,5 +100,36 @@ void LocalHeap::ClearSafepointRequested() {
 
 void LocalHeap::EnterSafepoint() { heap_->safepoint()->EnterFromThread(this); }
 
+void LocalHeap::FreeLinearAllocationArea() {
+  old_space_allocator_->FreeLinearAllocationArea();
+}
+
+void LocalHeap::MakeLinearAllocationAreaIterable() {
+  old_space_allocator_->MakeLinearAllocationAreaIterable();
+}
+
+Address LocalHeap::PerformCollectionAndAllocateAgain(
+    int size_in_bytes, AllocationType allocation, AllocationOrigin origin,
+    AllocationAlignment alignment) {
+  static const int kMaxNumberOfRetries = 3;
+
+  for (int i = 0; i < kMaxNumberOfRetries; i++) {
+    {
+      // The main thread can only perform the garbage collection once this
+      // thread is parked.
+      ParkedScope scope(this);
+      heap_->RequestCollectionBackground();
+    }
+
+    AllocationResult result =
+        AllocateRaw(size_in_bytes, allocation, origin, alignment);
+    if (!result.IsRetry()) {
+      return result.ToObjectChecked().address();
+    }
+  }
+
+  heap_->FatalProcessOutOfMemory("LocalHeap: allocation failed");
+}
+
 }  // namespace internal
 }  // namespace v8
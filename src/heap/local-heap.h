@@ -16,11 +16,23 @@
 namespace v8 {
 namespace internal {
 
+class ConcurrentAllocator;
 class Heap;
 class Safepoint;
 class LocalHandles;
 class PersistentHandles;
 
+// LocalHeap is used by background threads to access the heap. Each thread
+// needs its own LocalHeap and has to call Safepoint() regularly so that the
+// main thread can perform garbage collections.
+//
+// Background threads can allocate objects in old space and old large object
+// space through AllocateRaw().
+// Such objects are not visible to the GC until they are referenced from a
+// handle or another object, and while incremental marking is active they are
+// allocated black. Their initialization therefore must not rely on write
+// barriers, e.g. by only storing Smis, immortal immovable roots or objects
+// that are already reachable from the main thread.
 class LocalHeap {
  public:
   V8_EXPORT_PRIVATE explicit LocalHeap(
@@ -44,6 +56,37 @@ class LocalHeap {
 
   bool IsParked();
 
+  Heap* heap() { return heap_; }
+
+  ConcurrentAllocator* old_space_allocator() {
+    return old_space_allocator_.get();
+  }
+
+  // Gives up the linear allocation areas of this thread. The main thread
+  // calls it in a safepoint before garbage collections.
+  void FreeLinearAllocationArea();
+
+  // Makes the linear allocation areas of this thread iterable without giving
+  // them up.
+  void MakeLinearAllocationAreaIterable();
+
+  // Allocates an uninitialized object. Only old generation allocations are
+  // supported; objects larger than kMaxRegularHeapObjectSize get their own
+  // page in old large object space. Returns a failed AllocationResult if the
+  // caller has to request a garbage collection.
+  V8_WARN_UNUSED_RESULT inline AllocationResult AllocateRaw(
+      int size_in_bytes, AllocationType allocation,
+      AllocationOrigin origin = AllocationOrigin::kRuntime,
+      AllocationAlignment alignment = kWordAligned);
+
+  // Allocates an uninitialized object. If the allocation fails, requests
+  // garbage collections from the main thread and retries, and crashes with an
+  // out-of-memory error when that does not help.
+  inline Address AllocateRawOrFail(
+      int size_in_bytes, AllocationType allocation,
+      AllocationOrigin origin = AllocationOrigin::kRuntime,
+      AllocationAlignment alignment = kWordAligned);
+
  private:
   enum class ThreadState {
     // Threads in this state need to be stopped in a safepoint.
@@ -64,6 +107,11 @@ class LocalHeap {
 
   void EnterSafepoint();
 
+  // Slow path of AllocateRawOrFail().
+  V8_EXPORT_PRIVATE Address PerformCollectionAndAllocateAgain(
+      int size_in_bytes, AllocationType allocation, AllocationOrigin origin,
+      AllocationAlignment alignment);
+
   Heap* heap_;
 
   base::Mutex state_mutex_;
@@ -78,6 +126,8 @@ class LocalHeap {
   std::unique_ptr<LocalHandles> handles_;
   std::unique_ptr<PersistentHandles> persistent_handles_;
 
+  std::unique_ptr<ConcurrentAllocator> old_space_allocator_;
+
   friend class Heap;
   friend class GlobalSafepoint;
   friend class ParkedScope;
@@ -29,6 +29,7 @@
 #include "src/heap/object-stats.h"
 #include "src/heap/objects-visiting-inl.h"
 #include "src/heap/read-only-heap.h"
+#include "src/heap/safepoint.h"
 #include "src/heap/spaces-inl.h"
 #include "src/heap/sweeper.h"
 #include "src/heap/worklist.h"
@@ -424,7 +425,6 @@ int MarkCompactCollectorBase::NumberOfParallelToSpacePointerUpdateTasks(
 
 MarkCompactCollector::MarkCompactCollector(Heap* heap)
     : MarkCompactCollectorBase(heap),
-      page_parallel_job_semaphore_(0),
 #ifdef DEBUG
       state_(IDLE),
 #endif
@@ -611,6 +611,11 @@ void MarkCompactCollector::EnsureSweepingCompleted() {
 
 #ifdef VERIFY_HEAP
   if (FLAG_verify_heap && !evacuation()) {
+    base::Optional<SafepointScope> safepoint_scope;
+    if (FLAG_local_heaps && !heap()->safepoint()->IsActive()) {
+      safepoint_scope.emplace(heap());
+      heap()->MakeLinearAllocationAreasOfLocalHeapsIterable();
+    }
     FullEvacuationVerifier verifier(heap());
     verifier.Run();
   }
@@ -662,6 +667,21 @@ void MarkCompactCollector::ComputeEvacuationHeuristics(
       *target_fragmentation_percent = kTargetFragmentationPercent;
     }
     *max_evacuated_bytes = kMaxEvacuatedBytes;
+    if (estimated_compaction_speed != 0 &&
+        FLAG_compaction_pause_target_ms > 0) {
+      // Only select as many bytes as the evacuation tasks can copy within the
+      // pause target. The speed is traced per task; assume as many tasks as
+      // the quota would get. The remaining fragmented pages are selected by
+      // later GCs.
+      const int tasks = NumberOfParallelCompactionTasks(
+          static_cast<int>(kMaxEvacuatedBytes / area_size) + 1);
+      const double bytes_in_pause_target = estimated_compaction_speed *
+                                           FLAG_compaction_pause_target_ms *
+                                           tasks;
+      if (bytes_in_pause_target < kMaxEvacuatedBytes) {
+        *max_evacuated_bytes = static_cast<size_t>(bytes_in_pause_target);
+      }
+    }
   }
 }
 
@@ -3068,48 +3088,87 @@ void FullEvacuator::RawEvacuatePage(MemoryChunk* chunk, intptr_t* live_bytes) {
   }
 }
 
-class EvacuationItem : public ItemParallelJob::Item {
- public:
-  explicit EvacuationItem(MemoryChunk* chunk) : chunk_(chunk) {}
-  ~EvacuationItem() override = default;
-  MemoryChunk* chunk() const { return chunk_; }
+namespace {
 
- private:
-  MemoryChunk* chunk_;
+// Stands in for the platform's delegate when a job runs on the main thread
+// alone.
+class MainThreadJobDelegate final : public JobDelegate {
+ public:
+  bool ShouldYield() override { return false; }
+  void NotifyConcurrencyIncrease() override {}
+  uint8_t GetTaskId() override { return 0; }
+  bool IsJoiningThread() const override { return true; }
 };
 
-class PageEvacuationTask : public ItemParallelJob::Task {
+// Runs {job} to completion. If {parallel}, the job is posted to the platform
+// and joined. Otherwise no worker is posted and the main thread runs the job
+// alone, e.g. with --single-threaded-gc.
+void RunGCJob(std::unique_ptr<JobTask> job, bool parallel) {
+  if (parallel) {
+    V8::GetCurrentPlatform()
+        ->PostJob(v8::TaskPriority::kUserBlocking, std::move(job))
+        ->Join();
+    return;
+  }
+  MainThreadJobDelegate delegate;
+  while (job->GetMaxConcurrency(0) > 0) job->Run(&delegate);
+}
+
+}  // namespace
+
+class PageEvacuationJob : public v8::JobTask {
  public:
-  PageEvacuationTask(Isolate* isolate, Evacuator* evacuator)
-      : ItemParallelJob::Task(isolate),
-        evacuator_(evacuator),
+  PageEvacuationJob(Isolate* isolate, std::vector<Evacuator*> evacuators,
+                    std::vector<MemoryChunk*> evacuation_items)
+      : evacuators_(std::move(evacuators)),
+        evacuation_items_(std::move(evacuation_items)),
         tracer_(isolate->heap()->tracer()) {}
 
-  void RunInParallel(Runner runner) override {
-    if (runner == Runner::kForeground) {
-      TRACE_GC(tracer_, evacuator_->GetTracingScope());
-      ProcessItems();
+  void Run(JobDelegate* delegate) override {
+    uint8_t task_id = delegate->GetTaskId();
+    DCHECK_LT(task_id, evacuators_.size());
+    Evacuator* evacuator = evacuators_[task_id];
+    if (delegate->IsJoiningThread()) {
+      TRACE_GC(tracer_, evacuator->GetTracingScope());
+      ProcessItems(evacuator);
     } else {
-      TRACE_BACKGROUND_GC(tracer_, evacuator_->GetBackgroundTracingScope());
-      ProcessItems();
+      TRACE_BACKGROUND_GC(tracer_, evacuator->GetBackgroundTracingScope());
+      ProcessItems(evacuator);
     }
   }
 
+  size_t GetMaxConcurrency(size_t worker_count) const override {
+    const size_t kItemsPerWorker = MB / Page::kPageSize;
+    // Ceiling division to ensure enough workers for all remaining items.
+    const size_t wanted_num_workers =
+        (RemainingItems() + kItemsPerWorker - 1) / kItemsPerWorker;
+    return std::min(wanted_num_workers, evacuators_.size());
+  }
+
  private:
-  void ProcessItems() {
-    EvacuationItem* item = nullptr;
-    while ((item = GetItem<EvacuationItem>()) != nullptr) {
-      evacuator_->EvacuatePage(item->chunk());
-      item->MarkFinished();
+  void ProcessItems(Evacuator* evacuator) {
+    size_t index;
+    while ((index = next_item_.fetch_add(1, std::memory_order_relaxed)) <
+           evacuation_items_.size()) {
+      evacuator->EvacuatePage(evacuation_items_[index]);
     }
   }
-  Evacuator* evacuator_;
+
+  size_t RemainingItems() const {
+    size_t next_item = next_item_.load(std::memory_order_relaxed);
+    return evacuation_items_.size() -
+           std::min(next_item, evacuation_items_.size());
+  }
+
+  std::vector<Evacuator*> evacuators_;
+  std::vector<MemoryChunk*> evacuation_items_;
+  std::atomic<size_t> next_item_{0};
   GCTracer* tracer_;
 };
 
-template <class Evacuator, class Collector>
+template <class EvacuatorType, class Collector>
 void MarkCompactCollectorBase::CreateAndExecuteEvacuationTasks(
-    Collector* collector, ItemParallelJob* job,
+    Collector* collector, std::vector<MemoryChunk*> evacuation_items,
     MigrationObserver* migration_observer, const intptr_t live_bytes) {
   // Used for trace summary.
   double compaction_speed = 0;
@@ -3120,31 +3179,34 @@ void MarkCompactCollectorBase::CreateAndExecuteEvacuationTasks(
   const bool profiling = isolate()->LogObjectRelocation();
   ProfilingMigrationObserver profiling_observer(heap());
 
-  const int wanted_num_tasks =
-      NumberOfParallelCompactionTasks(job->NumberOfItems());
-  Evacuator** evacuators = new Evacuator*[wanted_num_tasks];
+  const int num_pages = static_cast<int>(evacuation_items.size());
+  const int wanted_num_tasks = NumberOfParallelCompactionTasks(num_pages);
+  std::vector<std::unique_ptr<EvacuatorType>> evacuators;
+  std::vector<Evacuator*> job_evacuators;
   for (int i = 0; i < wanted_num_tasks; i++) {
-    evacuators[i] = new Evacuator(collector);
+    evacuators.push_back(std::make_unique<EvacuatorType>(collector));
     if (profiling) evacuators[i]->AddObserver(&profiling_observer);
     if (migration_observer != nullptr)
       evacuators[i]->AddObserver(migration_observer);
-    job->AddTask(new PageEvacuationTask(heap()->isolate(), evacuators[i]));
-  }
-  job->Run();
-  for (int i = 0; i < wanted_num_tasks; i++) {
-    evacuators[i]->Finalize();
-    delete evacuators[i];
+    job_evacuators.push_back(evacuators[i].get());
   }
-  delete[] evacuators;
+  // The job spins up workers as long as there are enough pages left for them,
+  // and every worker evacuates with its own evacuator.
+  RunGCJob(std::make_unique<PageEvacuationJob>(isolate(),
+                                               std::move(job_evacuators),
+                                               std::move(evacuation_items)),
+           FLAG_parallel_compaction);
+  for (auto& evacuator : evacuators) evacuator->Finalize();
+  evacuators.clear();
 
   if (FLAG_trace_evacuation) {
     PrintIsolate(isolate(),
                  "%8.0f ms: evacuation-summary: parallel=%s pages=%d "
-                 "wanted_tasks=%d tasks=%d cores=%d live_bytes=%" V8PRIdPTR
+                 "wanted_tasks=%d cores=%d live_bytes=%" V8PRIdPTR
                  " compaction_speed=%.f\n",
                  isolate()->time_millis_since_init(),
-                 FLAG_parallel_compaction ? "yes" : "no", job->NumberOfItems(),
-                 wanted_num_tasks, job->NumberOfTasks(),
+                 FLAG_parallel_compaction ? "yes" : "no", num_pages,
+                 wanted_num_tasks,
                  V8::GetCurrentPlatform()->NumberOfWorkerThreads() + 1,
                  live_bytes, compaction_speed);
   }
@@ -3161,13 +3223,12 @@ bool MarkCompactCollectorBase::ShouldMovePage(Page* p, intptr_t live_bytes,
 }
 
 void MarkCompactCollector::EvacuatePagesInParallel() {
-  ItemParallelJob evacuation_job(isolate()->cancelable_task_manager(),
-                                 &page_parallel_job_semaphore_);
+  std::vector<MemoryChunk*> evacuation_items;
   intptr_t live_bytes = 0;
 
   for (Page* page : old_space_evacuation_pages_) {
     live_bytes += non_atomic_marking_state()->live_bytes(page);
-    evacuation_job.AddItem(new EvacuationItem(page));
+    evacuation_items.push_back(page);
   }
 
   for (Page* page : new_space_evacuation_pages_) {
@@ -3188,7 +3249,7 @@ void MarkCompactCollector::EvacuatePagesInParallel() {
         EvacuateNewSpacePageVisitor<NEW_TO_NEW>::Move(page);
       }
     }
-    evacuation_job.AddItem(new EvacuationItem(page));
+    evacuation_items.push_back(page);
   }
 
   // Promote young generation large objects.
@@ -3204,14 +3265,14 @@ void MarkCompactCollector::EvacuatePagesInParallel() {
     if (marking_state->IsBlack(object)) {
       heap_->lo_space()->PromoteNewLargeObject(current);
       current->SetFlag(Page::PAGE_NEW_OLD_PROMOTION);
-      evacuation_job.AddItem(new EvacuationItem(current));
+      evacuation_items.push_back(current);
     }
   }
 
-  if (evacuation_job.NumberOfItems() == 0) return;
+  if (evacuation_items.empty()) return;
 
-  CreateAndExecuteEvacuationTasks<FullEvacuator>(this, &evacuation_job, nullptr,
-                                                 live_bytes);
+  CreateAndExecuteEvacuationTasks<FullEvacuator>(
+      this, std::move(evacuation_items), nullptr, live_bytes);
 
   // After evacuation there might still be swept pages that weren't
   // added to one of the compaction space but still reside in the
@@ -3406,24 +3467,26 @@ void MarkCompactCollector::Evacuate() {
 #endif
 }
 
-class UpdatingItem : public ItemParallelJob::Item {
+class UpdatingItem : public Malloced {
  public:
-  ~UpdatingItem() override = default;
+  virtual ~UpdatingItem() = default;
   virtual void Process() = 0;
 };
 
-class PointersUpdatingTask : public ItemParallelJob::Task {
+class PointersUpdatingJob : public v8::JobTask {
  public:
-  explicit PointersUpdatingTask(
-      Isolate* isolate, GCTracer::Scope::ScopeId scope,
-      GCTracer::BackgroundScope::ScopeId background_scope)
-      : ItemParallelJob::Task(isolate),
+  PointersUpdatingJob(Isolate* isolate,
+                      std::vector<std::unique_ptr<UpdatingItem>> updating_items,
+                      size_t max_tasks, GCTracer::Scope::ScopeId scope,
+                      GCTracer::BackgroundScope::ScopeId background_scope)
+      : updating_items_(std::move(updating_items)),
+        max_tasks_(max_tasks),
         tracer_(isolate->heap()->tracer()),
         scope_(scope),
         background_scope_(background_scope) {}
 
-  void RunInParallel(Runner runner) override {
-    if (runner == Runner::kForeground) {
+  void Run(JobDelegate* delegate) override {
+    if (delegate->IsJoiningThread()) {
       TRACE_GC(tracer_, scope_);
       UpdatePointers();
     } else {
@@ -3432,14 +3495,26 @@ class PointersUpdatingTask : public ItemParallelJob::Task {
     }
   }
 
+  size_t GetMaxConcurrency(size_t worker_count) const override {
+    size_t next_item = next_item_.load(std::memory_order_relaxed);
+    size_t remaining_items =
+        updating_items_.size() - std::min(next_item, updating_items_.size());
+    return std::min(remaining_items, max_tasks_);
+  }
+
  private:
   void UpdatePointers() {
-    UpdatingItem* item = nullptr;
-    while ((item = GetItem<UpdatingItem>()) != nullptr) {
-      item->Process();
-      item->MarkFinished();
+    size_t index;
+    while ((index = next_item_.fetch_add(1, std::memory_order_relaxed)) <
+           updating_items_.size()) {
+      updating_items_[index]->Process();
     }
   }
+
+  std::vector<std::unique_ptr<UpdatingItem>> updating_items_;
+  std::atomic<size_t> next_item_{0};
+  // Upper bound on the number of threads updating pointers at the same time.
+  const size_t max_tasks_;
   GCTracer* tracer_;
   GCTracer::Scope::ScopeId scope_;
   GCTracer::BackgroundScope::ScopeId background_scope_;
@@ -3730,7 +3805,7 @@ class ArrayBufferTrackerUpdatingItem : public UpdatingItem {
 };
 
 int MarkCompactCollectorBase::CollectToSpaceUpdatingItems(
-    ItemParallelJob* job) {
+    std::vector<std::unique_ptr<UpdatingItem>>* items) {
   // Seed to space pages.
   const Address space_start = heap()->new_space()->first_allocatable_address();
   const Address space_end = heap()->new_space()->top();
@@ -3739,7 +3814,7 @@ int MarkCompactCollectorBase::CollectToSpaceUpdatingItems(
     Address start =
         page->Contains(space_start) ? space_start : page->area_start();
     Address end = page->Contains(space_end) ? space_end : page->area_end();
-    job->AddItem(CreateToSpaceUpdatingItem(page, start, end));
+    items->emplace_back(CreateToSpaceUpdatingItem(page, start, end));
     pages++;
   }
   if (pages == 0) return 0;
@@ -3748,8 +3823,8 @@ int MarkCompactCollectorBase::CollectToSpaceUpdatingItems(
 
 template <typename IterateableSpace>
 int MarkCompactCollectorBase::CollectRememberedSetUpdatingItems(
-    ItemParallelJob* job, IterateableSpace* space,
-    RememberedSetUpdatingMode mode) {
+    std::vector<std::unique_ptr<UpdatingItem>>* items,
+    IterateableSpace* space, RememberedSetUpdatingMode mode) {
   int pages = 0;
   for (MemoryChunk* chunk : *space) {
     const bool contains_old_to_old_slots =
@@ -3772,7 +3847,7 @@ int MarkCompactCollectorBase::CollectRememberedSetUpdatingItems(
         contains_old_to_new_sweeping_slots ||
         contains_old_to_old_invalidated_slots ||
         contains_old_to_new_invalidated_slots) {
-      job->AddItem(CreateRememberedSetUpdatingItem(chunk, mode));
+      items->emplace_back(CreateRememberedSetUpdatingItem(chunk, mode));
       pages++;
     }
   }
@@ -3780,14 +3855,14 @@ int MarkCompactCollectorBase::CollectRememberedSetUpdatingItems(
 }
 
 int MarkCompactCollector::CollectNewSpaceArrayBufferTrackerItems(
-    ItemParallelJob* job) {
+    std::vector<std::unique_ptr<UpdatingItem>>* items) {
   int pages = 0;
   for (Page* p : new_space_evacuation_pages_) {
     if (Evacuator::ComputeEvacuationMode(p) == Evacuator::kObjectsNewToOld) {
       if (p->local_tracker() == nullptr) continue;
 
       pages++;
-      job->AddItem(new ArrayBufferTrackerUpdatingItem(
+      items->emplace_back(new ArrayBufferTrackerUpdatingItem(
           p, ArrayBufferTrackerUpdatingItem::kRegular));
     }
   }
@@ -3795,7 +3870,7 @@ int MarkCompactCollector::CollectNewSpaceArrayBufferTrackerItems(
 }
 
 int MarkCompactCollector::CollectOldSpaceArrayBufferTrackerItems(
-    ItemParallelJob* job) {
+    std::vector<std::unique_ptr<UpdatingItem>>* items) {
   int pages = 0;
   for (Page* p : old_space_evacuation_pages_) {
     if (Evacuator::ComputeEvacuationMode(p) == Evacuator::kObjectsOldToOld &&
@@ -3803,7 +3878,7 @@ int MarkCompactCollector::CollectOldSpaceArrayBufferTrackerItems(
       if (p->local_tracker() == nullptr) continue;
 
       pages++;
-      job->AddItem(new ArrayBufferTrackerUpdatingItem(
+      items->emplace_back(new ArrayBufferTrackerUpdatingItem(
           p, ArrayBufferTrackerUpdatingItem::kRegular));
     }
   }
@@ -3812,7 +3887,7 @@ int MarkCompactCollector::CollectOldSpaceArrayBufferTrackerItems(
     if (p->local_tracker() == nullptr) continue;
 
     pages++;
-    job->AddItem(new ArrayBufferTrackerUpdatingItem(
+    items->emplace_back(new ArrayBufferTrackerUpdatingItem(
         p, ArrayBufferTrackerUpdatingItem::kAborted));
   }
   return pages;
@@ -3883,35 +3958,37 @@ void MarkCompactCollector::UpdatePointersAfterEvacuation() {
   {
     TRACE_GC(heap()->tracer(),
              GCTracer::Scope::MC_EVACUATE_UPDATE_POINTERS_SLOTS_MAIN);
-    ItemParallelJob updating_job(isolate()->cancelable_task_manager(),
-                                 &page_parallel_job_semaphore_);
+    std::vector<std::unique_ptr<UpdatingItem>> updating_items;
 
     int remembered_set_pages = 0;
     remembered_set_pages += CollectRememberedSetUpdatingItems(
-        &updating_job, heap()->old_space(), RememberedSetUpdatingMode::ALL);
+        &updating_items, heap()->old_space(), RememberedSetUpdatingMode::ALL);
     remembered_set_pages += CollectRememberedSetUpdatingItems(
-        &updating_job, heap()->code_space(), RememberedSetUpdatingMode::ALL);
+        &updating_items, heap()->code_space(), RememberedSetUpdatingMode::ALL);
     remembered_set_pages += CollectRememberedSetUpdatingItems(
-        &updating_job, heap()->lo_space(), RememberedSetUpdatingMode::ALL);
+        &updating_items, heap()->lo_space(), RememberedSetUpdatingMode::ALL);
     remembered_set_pages += CollectRememberedSetUpdatingItems(
-        &updating_job, heap()->code_lo_space(), RememberedSetUpdatingMode::ALL);
+        &updating_items, heap()->code_lo_space(),
+        RememberedSetUpdatingMode::ALL);
     const int remembered_set_tasks =
         remembered_set_pages == 0
             ? 0
             : NumberOfParallelPointerUpdateTasks(remembered_set_pages,
                                                  old_to_new_slots_);
-    const int to_space_tasks = CollectToSpaceUpdatingItems(&updating_job);
+    const int to_space_tasks = CollectToSpaceUpdatingItems(&updating_items);
     const int num_ephemeron_table_updating_tasks = 1;
     const int num_tasks =
         Max(to_space_tasks,
             remembered_set_tasks + num_ephemeron_table_updating_tasks);
-    for (int i = 0; i < num_tasks; i++) {
-      updating_job.AddTask(new PointersUpdatingTask(
-          isolate(), GCTracer::Scope::MC_EVACUATE_UPDATE_POINTERS_PARALLEL,
-          GCTracer::BackgroundScope::MC_BACKGROUND_EVACUATE_UPDATE_POINTERS));
-    }
-    updating_job.AddItem(new EphemeronTableUpdatingItem(heap()));
-    updating_job.Run();
+    updating_items.push_back(
+        std::make_unique<EphemeronTableUpdatingItem>(heap()));
+
+    RunGCJob(std::make_unique<PointersUpdatingJob>(
+                 isolate(), std::move(updating_items), num_tasks,
+                 GCTracer::Scope::MC_EVACUATE_UPDATE_POINTERS_PARALLEL,
+                 GCTracer::BackgroundScope::
+                     MC_BACKGROUND_EVACUATE_UPDATE_POINTERS),
+             FLAG_parallel_pointer_update);
   }
 
   {
@@ -3921,16 +3998,17 @@ void MarkCompactCollector::UpdatePointersAfterEvacuation() {
     //   byte length which is potentially a HeapNumber.
     TRACE_GC(heap()->tracer(),
              GCTracer::Scope::MC_EVACUATE_UPDATE_POINTERS_SLOTS_MAP_SPACE);
-    ItemParallelJob updating_job(isolate()->cancelable_task_manager(),
-                                 &page_parallel_job_semaphore_);
+    std::vector<std::unique_ptr<UpdatingItem>> updating_items;
 
     int array_buffer_pages = 0;
-    array_buffer_pages += CollectNewSpaceArrayBufferTrackerItems(&updating_job);
-    array_buffer_pages += CollectOldSpaceArrayBufferTrackerItems(&updating_job);
+    array_buffer_pages +=
+        CollectNewSpaceArrayBufferTrackerItems(&updating_items);
+    array_buffer_pages +=
+        CollectOldSpaceArrayBufferTrackerItems(&updating_items);
 
     int remembered_set_pages = 0;
     remembered_set_pages += CollectRememberedSetUpdatingItems(
-        &updating_job, heap()->map_space(), RememberedSetUpdatingMode::ALL);
+        &updating_items, heap()->map_space(), RememberedSetUpdatingMode::ALL);
     const int remembered_set_tasks =
         remembered_set_pages == 0
             ? 0
@@ -3938,12 +4016,12 @@ void MarkCompactCollector::UpdatePointersAfterEvacuation() {
                                                  old_to_new_slots_);
     const int num_tasks = Max(array_buffer_pages, remembered_set_tasks);
     if (num_tasks > 0) {
-      for (int i = 0; i < num_tasks; i++) {
-        updating_job.AddTask(new PointersUpdatingTask(
-            isolate(), GCTracer::Scope::MC_EVACUATE_UPDATE_POINTERS_PARALLEL,
-            GCTracer::BackgroundScope::MC_BACKGROUND_EVACUATE_UPDATE_POINTERS));
-      }
-      updating_job.Run();
+      RunGCJob(std::make_unique<PointersUpdatingJob>(
+                   isolate(), std::move(updating_items), num_tasks,
+                   GCTracer::Scope::MC_EVACUATE_UPDATE_POINTERS_PARALLEL,
+                   GCTracer::BackgroundScope::
+                       MC_BACKGROUND_EVACUATE_UPDATE_POINTERS),
+               FLAG_parallel_pointer_update);
       heap()->array_buffer_collector()->FreeAllocations();
     }
   }
@@ -4349,6 +4427,17 @@ void MinorMarkCompactCollector::CleanupSweepToIteratePages() {
   sweep_to_iterate_pages_.clear();
 }
 
+void MinorMarkCompactCollector::MakeSweepToIteratePagesIterable() {
+  for (Page* p : sweep_to_iterate_pages_) {
+    if (p->IsFlagSet(Page::SWEEP_TO_ITERATE)) {
+      MakeIterable(p, MarkingTreatmentMode::CLEAR,
+                   heap()->ShouldZapGarbage() ? ZAP_FREE_SPACE
+                                              : IGNORE_FREE_SPACE);
+    }
+  }
+  sweep_to_iterate_pages_.clear();
+}
+
 void MinorMarkCompactCollector::SweepArrayBufferExtensions() {
   heap_->array_buffer_sweeper()->RequestSweepYoung();
 }
@@ -4424,39 +4513,32 @@ void MinorMarkCompactCollector::UpdatePointersAfterEvacuation() {
            GCTracer::Scope::MINOR_MC_EVACUATE_UPDATE_POINTERS);
 
   PointersUpdatingVisitor updating_visitor;
-  ItemParallelJob updating_job(isolate()->cancelable_task_manager(),
-                               &page_parallel_job_semaphore_);
+  std::vector<std::unique_ptr<UpdatingItem>> updating_items;
 
-  CollectNewSpaceArrayBufferTrackerItems(&updating_job);
+  CollectNewSpaceArrayBufferTrackerItems(&updating_items);
   // Create batches of global handles.
-  const int to_space_tasks = CollectToSpaceUpdatingItems(&updating_job);
+  const int to_space_tasks = CollectToSpaceUpdatingItems(&updating_items);
   int remembered_set_pages = 0;
   remembered_set_pages += CollectRememberedSetUpdatingItems(
-      &updating_job, heap()->old_space(),
+      &updating_items, heap()->old_space(),
       RememberedSetUpdatingMode::OLD_TO_NEW_ONLY);
   remembered_set_pages += CollectRememberedSetUpdatingItems(
-      &updating_job, heap()->code_space(),
+      &updating_items, heap()->code_space(),
       RememberedSetUpdatingMode::OLD_TO_NEW_ONLY);
   remembered_set_pages += CollectRememberedSetUpdatingItems(
-      &updating_job, heap()->map_space(),
+      &updating_items, heap()->map_space(),
       RememberedSetUpdatingMode::OLD_TO_NEW_ONLY);
   remembered_set_pages += CollectRememberedSetUpdatingItems(
-      &updating_job, heap()->lo_space(),
+      &updating_items, heap()->lo_space(),
       RememberedSetUpdatingMode::OLD_TO_NEW_ONLY);
   remembered_set_pages += CollectRememberedSetUpdatingItems(
-      &updating_job, heap()->code_lo_space(),
+      &updating_items, heap()->code_lo_space(),
       RememberedSetUpdatingMode::OLD_TO_NEW_ONLY);
   const int remembered_set_tasks =
       remembered_set_pages == 0 ? 0
                                 : NumberOfParallelPointerUpdateTasks(
                                       remembered_set_pages, old_to_new_slots_);
   const int num_tasks = Max(to_space_tasks, remembered_set_tasks);
-  for (int i = 0; i < num_tasks; i++) {
-    updating_job.AddTask(new PointersUpdatingTask(
-        isolate(), GCTracer::Scope::MINOR_MC_EVACUATE_UPDATE_POINTERS_PARALLEL,
-        GCTracer::BackgroundScope::
-            MINOR_MC_BACKGROUND_EVACUATE_UPDATE_POINTERS));
-  }
 
   {
     TRACE_GC(heap()->tracer(),
@@ -4466,7 +4548,12 @@ void MinorMarkCompactCollector::UpdatePointersAfterEvacuation() {
   {
     TRACE_GC(heap()->tracer(),
              GCTracer::Scope::MINOR_MC_EVACUATE_UPDATE_POINTERS_SLOTS);
-    updating_job.Run();
+    RunGCJob(std::make_unique<PointersUpdatingJob>(
+                 isolate(), std::move(updating_items), num_tasks,
+                 GCTracer::Scope::MINOR_MC_EVACUATE_UPDATE_POINTERS_PARALLEL,
+                 GCTracer::BackgroundScope::
+                     MINOR_MC_BACKGROUND_EVACUATE_UPDATE_POINTERS),
+             FLAG_parallel_pointer_update);
     heap()->array_buffer_collector()->FreeAllocations();
   }
 
@@ -5119,8 +5206,7 @@ void YoungGenerationEvacuator::RawEvacuatePage(MemoryChunk* chunk,
 }  // namespace
 
 void MinorMarkCompactCollector::EvacuatePagesInParallel() {
-  ItemParallelJob evacuation_job(isolate()->cancelable_task_manager(),
-                                 &page_parallel_job_semaphore_);
+  std::vector<MemoryChunk*> evacuation_items;
   intptr_t live_bytes = 0;
 
   for (Page* page : new_space_evacuation_pages_) {
@@ -5134,7 +5220,7 @@ void MinorMarkCompactCollector::EvacuatePagesInParallel() {
         EvacuateNewSpacePageVisitor<NEW_TO_NEW>::Move(page);
       }
     }
-    evacuation_job.AddItem(new EvacuationItem(page));
+    evacuation_items.push_back(page);
   }
 
   // Promote young generation large objects.
@@ -5147,26 +5233,26 @@ void MinorMarkCompactCollector::EvacuatePagesInParallel() {
     if (non_atomic_marking_state_.IsGrey(object)) {
       heap_->lo_space()->PromoteNewLargeObject(current);
       current->SetFlag(Page::PAGE_NEW_OLD_PROMOTION);
-      evacuation_job.AddItem(new EvacuationItem(current));
+      evacuation_items.push_back(current);
     }
   }
-  if (evacuation_job.NumberOfItems() == 0) return;
+  if (evacuation_items.empty()) return;
 
   YoungGenerationMigrationObserver observer(heap(),
                                             heap()->mark_compact_collector());
   CreateAndExecuteEvacuationTasks<YoungGenerationEvacuator>(
-      this, &evacuation_job, &observer, live_bytes);
+      this, std::move(evacuation_items), &observer, live_bytes);
 }
 
 int MinorMarkCompactCollector::CollectNewSpaceArrayBufferTrackerItems(
-    ItemParallelJob* job) {
+    std::vector<std::unique_ptr<UpdatingItem>>* items) {
   int pages = 0;
   for (Page* p : new_space_evacuation_pages_) {
     if (Evacuator::ComputeEvacuationMode(p) == Evacuator::kObjectsNewToOld) {
       if (p->local_tracker() == nullptr) continue;
 
       pages++;
-      job->AddItem(new ArrayBufferTrackerUpdatingItem(
+      items->emplace_back(new ArrayBufferTrackerUpdatingItem(
           p, ArrayBufferTrackerUpdatingItem::kRegular));
     }
   }
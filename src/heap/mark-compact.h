@@ -6,6 +6,7 @@
 #define V8_HEAP_MARK_COMPACT_H_
 
 #include <atomic>
+#include <memory>
 #include <vector>
 
 #include "src/heap/concurrent-marking.h"
@@ -22,7 +23,6 @@ namespace internal {
 // Forward declarations.
 class EvacuationJobTraits;
 class HeapObjectVisitor;
-class ItemParallelJob;
 class MigrationObserver;
 class RecordMigratedSlotVisitor;
 class UpdatingItem;
@@ -218,20 +218,20 @@ class MarkCompactCollectorBase {
   virtual UpdatingItem* CreateRememberedSetUpdatingItem(
       MemoryChunk* chunk, RememberedSetUpdatingMode updating_mode) = 0;
 
-  template <class Evacuator, class Collector>
-  void CreateAndExecuteEvacuationTasks(Collector* collector,
-                                       ItemParallelJob* job,
-                                       MigrationObserver* migration_observer,
-                                       const intptr_t live_bytes);
+  template <class EvacuatorType, class Collector>
+  void CreateAndExecuteEvacuationTasks(
+      Collector* collector, std::vector<MemoryChunk*> evacuation_items,
+      MigrationObserver* migration_observer, const intptr_t live_bytes);
 
   // Returns whether this page should be moved according to heuristics.
   bool ShouldMovePage(Page* p, intptr_t live_bytes, bool promote_young);
 
-  int CollectToSpaceUpdatingItems(ItemParallelJob* job);
+  int CollectToSpaceUpdatingItems(
+      std::vector<std::unique_ptr<UpdatingItem>>* items);
   template <typename IterateableSpace>
-  int CollectRememberedSetUpdatingItems(ItemParallelJob* job,
-                                        IterateableSpace* space,
-                                        RememberedSetUpdatingMode mode);
+  int CollectRememberedSetUpdatingItems(
+      std::vector<std::unique_ptr<UpdatingItem>>* items,
+      IterateableSpace* space, RememberedSetUpdatingMode mode);
 
   int NumberOfParallelCompactionTasks(int pages);
   int NumberOfParallelPointerUpdateTasks(int pages, int slots);
@@ -725,8 +725,10 @@ class MarkCompactCollector final : public MarkCompactCollectorBase {
   UpdatingItem* CreateRememberedSetUpdatingItem(
       MemoryChunk* chunk, RememberedSetUpdatingMode updating_mode) override;
 
-  int CollectNewSpaceArrayBufferTrackerItems(ItemParallelJob* job);
-  int CollectOldSpaceArrayBufferTrackerItems(ItemParallelJob* job);
+  int CollectNewSpaceArrayBufferTrackerItems(
+      std::vector<std::unique_ptr<UpdatingItem>>* items);
+  int CollectOldSpaceArrayBufferTrackerItems(
+      std::vector<std::unique_ptr<UpdatingItem>>* items);
 
   void ReleaseEvacuationCandidates();
   void PostProcessEvacuationCandidates();
@@ -740,7 +742,6 @@ class MarkCompactCollector final : public MarkCompactCollectorBase {
   void RightTrimDescriptorArray(DescriptorArray array, int descriptors_to_trim);
 
   base::Mutex mutex_;
-  base::Semaphore page_parallel_job_semaphore_;
 
 #ifdef DEBUG
   enum CollectorState{IDLE,
@@ -837,6 +838,9 @@ class MinorMarkCompactCollector final : public MarkCompactCollectorBase {
   void MakeIterable(Page* page, MarkingTreatmentMode marking_mode,
                     FreeSpaceTreatmentMode free_space_mode);
   void CleanupSweepToIteratePages();
+  // Sweeps the pages promoted in place by the last GC that were left to be
+  // swept lazily.
+  void MakeSweepToIteratePagesIterable();
 
  private:
   using MarkingWorklist = Worklist<HeapObject, 64 /* segment size */>;
@@ -868,7 +872,8 @@ class MinorMarkCompactCollector final : public MarkCompactCollectorBase {
   UpdatingItem* CreateRememberedSetUpdatingItem(
       MemoryChunk* chunk, RememberedSetUpdatingMode updating_mode) override;
 
-  int CollectNewSpaceArrayBufferTrackerItems(ItemParallelJob* job);
+  int CollectNewSpaceArrayBufferTrackerItems(
+      std::vector<std::unique_ptr<UpdatingItem>>* items);
 
   int NumberOfParallelMarkingTasks(int pages);
 
@@ -0,0 +1,149 @@
+// Copyright 2020 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "src/heap/process-heap-budget.h"
+
+#include <algorithm>
+
+#include "src/base/lazy-instance.h"
+#include "src/flags/flags.h"
+#include "src/heap/heap-controller.h"
+#include "src/heap/heap.h"
+
+namespace v8 {
+namespace internal {
+
+namespace {
+DEFINE_LAZY_LEAKY_OBJECT_GETTER(ProcessHeapBudget, GetProcessHeapBudget,
+                                FLAG_process_heap_budget * MB)
+}  // namespace
+
+// static
+ProcessHeapBudget* ProcessHeapBudget::Get() { return GetProcessHeapBudget(); }
+
+void ProcessHeapBudget::SetBudget(size_t budget) {
+  budget_.store(budget, std::memory_order_relaxed);
+}
+
+void ProcessHeapBudget::Register(Heap* heap) {
+  base::MutexGuard guard(&mutex_);
+  DCHECK_EQ(0, heaps_.count(heap));
+  heaps_.emplace(heap, Entry());
+}
+
+void ProcessHeapBudget::Unregister(Heap* heap) {
+  base::MutexGuard guard(&mutex_);
+  DCHECK_EQ(1, heaps_.count(heap));
+  // Other heaps may be about to notify this one.
+  while (notifications_in_flight_ > 0) notifications_done_.Wait(&mutex_);
+  heaps_.erase(heap);
+}
+
+size_t ProcessHeapBudget::UpdateHeap(Heap* heap, size_t size, size_t limit,
+                                     size_t min_growing_step, bool is_idle,
+                                     double time_ms) {
+  std::vector<Request> requests;
+  size_t capped_limit;
+  {
+    base::MutexGuard guard(&mutex_);
+    auto it = heaps_.find(heap);
+    DCHECK(it != heaps_.end());
+    Entry& entry = it->second;
+    entry.size = size;
+    entry.is_idle = is_idle;
+    entry.reduction_requested = false;
+
+    const size_t budget = this->budget();
+    if (budget == 0) {
+      over_budget_ = false;
+      return limit;
+    }
+
+    const size_t total_size = TotalSizeLocked();
+    const size_t low_watermark = static_cast<size_t>(budget * kLowWatermark);
+    if (total_size > budget) {
+      over_budget_ = true;
+    } else if (total_size <= low_watermark) {
+      over_budget_ = false;
+    }
+    if (over_budget_) {
+      RequestReductionsLocked(heap, total_size - low_watermark, time_ms,
+                              &requests);
+    }
+    const size_t headroom = budget > total_size ? budget - total_size : 0;
+    const size_t share = headroom / heaps_.size();
+    const size_t min_limit = std::max(
+        size + min_growing_step,
+        static_cast<size_t>(size * V8HeapTrait::kMinGrowingFactor));
+    capped_limit = std::min(limit, std::max(size + share, min_limit));
+    if (requests.empty()) return capped_limit;
+    notifications_in_flight_++;
+  }
+
+  // Notifying a heap takes locks of its isolate, which must not be taken
+  // while holding {mutex_}.
+  for (const Request& request : requests) {
+    request.heap->MemoryPressureNotification(request.level, false);
+  }
+  base::MutexGuard guard(&mutex_);
+  if (--notifications_in_flight_ == 0) notifications_done_.NotifyAll();
+  return capped_limit;
+}
+
+void ProcessHeapBudget::GetStatistics(Statistics* statistics) {
+  base::MutexGuard guard(&mutex_);
+  statistics->budget = budget();
+  statistics->total_size = TotalSizeLocked();
+  statistics->number_of_heaps = heaps_.size();
+  statistics->reductions_requested = reductions_requested_;
+}
+
+void ProcessHeapBudget::RequestReductionsLocked(
+    Heap* reporting_heap, size_t excess, double time_ms,
+    std::vector<Request>* requests) {
+  // Heaps that were already asked count against the excess until they report
+  // back. {reporting_heap} has just finished a mark-compact, so it is not
+  // asked again, and neither are heaps that were asked recently.
+  size_t covered = 0;
+  std::vector<std::pair<Heap*, Entry*>> candidates;
+  for (auto& it : heaps_) {
+    if (it.second.reduction_requested) {
+      covered += it.second.size;
+    } else if (it.first != reporting_heap && it.second.size > 0 &&
+               time_ms - it.second.last_request_ms >= kRequestCooldownMs) {
+      candidates.emplace_back(it.first, &it.second);
+    }
+  }
+  // Idle heaps first, since reducing them does not get in the way of a
+  // running application, then the largest ones.
+  std::sort(candidates.begin(), candidates.end(),
+            [](const std::pair<Heap*, Entry*>& a,
+               const std::pair<Heap*, Entry*>& b) {
+              if (a.second->is_idle != b.second->is_idle) {
+                return a.second->is_idle;
+              }
+              return a.second->size > b.second->size;
+            });
+  for (auto& candidate : candidates) {
+    if (covered >= excess) break;
+    Entry* entry = candidate.second;
+    entry->reduction_requested = true;
+    entry->last_request_ms = time_ms;
+    covered += entry->size;
+    reductions_requested_++;
+    // Idle heaps can afford a full, non-incremental GC right away.
+    requests->push_back({candidate.first,
+                         entry->is_idle ? MemoryPressureLevel::kCritical
+                                        : MemoryPressureLevel::kModerate});
+  }
+}
+
+size_t ProcessHeapBudget::TotalSizeLocked() const {
+  size_t total_size = 0;
+  for (auto& it : heaps_) total_size += it.second.size;
+  return total_size;
+}
+
+}  // namespace internal
+}  // namespace v8
@@ -0,0 +1,115 @@
+// Copyright 2020 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#ifndef V8_HEAP_PROCESS_HEAP_BUDGET_H_
+#define V8_HEAP_PROCESS_HEAP_BUDGET_H_
+
+#include <atomic>
+#include <limits>
+#include <unordered_map>
+#include <vector>
+
+#include "include/v8.h"
+#include "src/base/macros.h"
+#include "src/base/platform/condition-variable.h"
+#include "src/base/platform/mutex.h"
+#include "src/common/globals.h"
+
+namespace v8 {
+namespace internal {
+
+class Heap;
+
+// Coordinates the heaps of all isolates in the process against a shared
+// budget for their combined size. Every heap reports its size after each
+// mark-compact. Once the total exceeds the budget, the coordinator asks idle
+// heaps first and then the largest ones to perform a memory-reducing GC,
+// until the heaps asked cover the excess over a lower watermark. It keeps
+// doing so until the total drops below that watermark, but asks each heap at
+// most once per cooldown period. It also splits the headroom left in the
+// budget evenly among the heaps, so that their allocation limits do not grow
+// past the budget independently of each other.
+//
+// The process-wide instance is returned by {Get()}; its budget is zero, which
+// disables it, unless set with --process-heap-budget or
+// v8::V8::SetProcessHeapBudget().
+class V8_EXPORT_PRIVATE ProcessHeapBudget {
+ public:
+  struct Statistics {
+    size_t budget;
+    size_t total_size;
+    size_t number_of_heaps;
+    size_t reductions_requested;
+  };
+
+  // Once over budget, reductions are requested until the total size drops
+  // below this fraction of the budget.
+  static constexpr double kLowWatermark = 0.9;
+  // A heap is asked to reduce memory at most once in this period.
+  static constexpr double kRequestCooldownMs = 10000;
+
+  explicit ProcessHeapBudget(size_t budget = 0) : budget_(budget) {}
+
+  static ProcessHeapBudget* Get();
+
+  void SetBudget(size_t budget);
+  size_t budget() const { return budget_.load(std::memory_order_relaxed); }
+
+  void Register(Heap* heap);
+  void Unregister(Heap* heap);
+
+  // Called on the main thread of {heap} after a mark-compact that left
+  // {size} bytes in the old generation at {time_ms} and computed {limit} as
+  // the next old generation allocation limit. Requests memory-reducing GCs
+  // from other heaps if the process is over budget. Returns {limit} capped
+  // to {size} plus the share of {heap} in the headroom left in the budget.
+  // The cap still leaves the heap {min_growing_step} and the memory
+  // controller's minimum growing factor to grow.
+  size_t UpdateHeap(Heap* heap, size_t size, size_t limit,
+                    size_t min_growing_step, bool is_idle, double time_ms);
+
+  void GetStatistics(Statistics* statistics);
+
+ private:
+  struct Entry {
+    size_t size = 0;
+    bool is_idle = false;
+    // Set when the heap was asked to reduce memory and cleared by the next
+    // update of the heap, so that it is not asked twice for the same GC.
+    bool reduction_requested = false;
+    double last_request_ms = -std::numeric_limits<double>::infinity();
+  };
+
+  struct Request {
+    Heap* heap;
+    v8::MemoryPressureLevel level;
+  };
+
+  // Picks heaps other than {reporting_heap} to reduce memory until their
+  // combined size covers {excess}. The caller notifies them once {mutex_} is
+  // released.
+  void RequestReductionsLocked(Heap* reporting_heap, size_t excess,
+                               double time_ms, std::vector<Request>* requests);
+  size_t TotalSizeLocked() const;
+
+  std::atomic<size_t> budget_;
+
+  base::Mutex mutex_;
+  std::unordered_map<Heap*, Entry> heaps_;
+  size_t reductions_requested_ = 0;
+  // Whether the total size exceeded the budget and has not dropped below the
+  // low watermark since.
+  bool over_budget_ = false;
+  // Notifications are sent without holding {mutex_}. Heaps wait for them to
+  // finish before they unregister.
+  int notifications_in_flight_ = 0;
+  base::ConditionVariable notifications_done_;
+
+  DISALLOW_COPY_AND_ASSIGN(ProcessHeapBudget);
+};
+
+}  // namespace internal
+}  // namespace v8
+
+#endif  // V8_HEAP_PROCESS_HEAP_BUDGET_H_
@@ -137,5 +137,14 @@ void GlobalSafepoint::Iterate(RootVisitor* visitor) {
   }
 }
 
+void GlobalSafepoint::IterateLocalHeaps(
+    std::function<void(LocalHeap*)> callback) {
+  DCHECK(IsActive());
+  for (LocalHeap* current = local_heaps_head_; current;
+       current = current->next_) {
+    callback(current);
+  }
+}
+
 }  // namespace internal
 }  // namespace v8
@@ -5,6 +5,8 @@
 #ifndef V8_HEAP_SAFEPOINT_H_
 #define V8_HEAP_SAFEPOINT_H_
 
+#include <functional>
+
 #include "src/base/platform/condition-variable.h"
 #include "src/base/platform/mutex.h"
 #include "src/handles/persistent-handles.h"
@@ -32,6 +34,10 @@ class GlobalSafepoint {
   // Iterate handles in local heaps
   void Iterate(RootVisitor* visitor);
 
+  // Iterate local heaps while the safepoint is active
+  V8_EXPORT_PRIVATE void IterateLocalHeaps(
+      std::function<void(LocalHeap*)> callback);
+
   // Use these methods now instead of the more intrusive SafepointScope
   void Start();
   void End();
@@ -227,6 +227,18 @@ bool Scavenger::HandleLargeObject(Map map, HeapObject object, int object_size,
   return false;
 }
 
+bool Scavenger::ShouldPromoteEarly(Map map, HeapObject object) {
+  if (!heap()->HasEarlyPromotionSites() ||
+      !AllocationSite::CanTrack(map.instance_type())) {
+    return false;
+  }
+  AllocationMemento memento =
+      heap()->FindAllocationMemento<Heap::kForGC>(map, object);
+  if (memento.is_null()) return false;
+  // Like UpdateAllocationSite, do not dereference the site here.
+  return heap()->IsEarlyPromotionSite(memento.GetAllocationSiteUnchecked());
+}
+
 template <typename THeapObjectSlot>
 SlotCallbackResult Scavenger::EvacuateObjectDefault(
     Map map, THeapObjectSlot slot, HeapObject object, int object_size,
@@ -244,20 +256,26 @@ SlotCallbackResult Scavenger::EvacuateObjectDefault(
   SLOW_DCHECK(static_cast<size_t>(object_size) <=
               MemoryChunkLayout::AllocatableMemoryInDataPage());
 
+  bool promote_early = false;
   if (!heap()->ShouldBePromoted(object.address())) {
-    // A semi-space copy may fail due to fragmentation. In that case, we
-    // try to promote the object.
-    result = SemiSpaceCopyObject(map, slot, object, object_size, object_fields);
-    if (result != CopyAndForwardResult::FAILURE) {
-      return RememberedSetEntryNeeded(result);
+    promote_early = ShouldPromoteEarly(map, object);
+    if (!promote_early) {
+      // A semi-space copy may fail due to fragmentation. In that case, we
+      // try to promote the object.
+      result =
+          SemiSpaceCopyObject(map, slot, object, object_size, object_fields);
+      if (result != CopyAndForwardResult::FAILURE) {
+        return RememberedSetEntryNeeded(result);
+      }
     }
   }
 
   // We may want to promote this object if the object was already semi-space
-  // copied in a previes young generation GC or if the semi-space copy above
-  // failed.
+  // copied in a previes young generation GC, if its allocation site has high
+  // survival or if the semi-space copy above failed.
   result = PromoteObject(map, slot, object, object_size, object_fields);
   if (result != CopyAndForwardResult::FAILURE) {
+    if (promote_early) early_promoted_size_ += object_size;
     return RememberedSetEntryNeeded(result);
   }
 
@@ -138,6 +138,7 @@ class Scavenger {
 
   size_t bytes_copied() const { return copied_size_; }
   size_t bytes_promoted() const { return promoted_size_; }
+  size_t bytes_promoted_early() const { return early_promoted_size_; }
 
  private:
   // Number of objects to process before interrupting for potentially waking
@@ -187,6 +188,10 @@ class Scavenger {
   V8_INLINE bool HandleLargeObject(Map map, HeapObject object, int object_size,
                                    ObjectFields object_fields);
 
+  // Returns true if {object} should be promoted although it has not survived
+  // a scavenge yet, because its allocation site has high survival.
+  V8_INLINE bool ShouldPromoteEarly(Map map, HeapObject object);
+
   // Different cases for object evacuation.
   template <typename THeapObjectSlot>
   V8_INLINE SlotCallbackResult
@@ -216,6 +221,7 @@ class Scavenger {
   Heap::PretenuringFeedbackMap local_pretenuring_feedback_;
   size_t copied_size_;
   size_t promoted_size_;
+  size_t early_promoted_size_;
   EvacuationAllocator allocator_;
   SurvivingNewLargeObjectsMap surviving_new_large_objects_;
 
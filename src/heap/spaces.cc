@@ -22,6 +22,7 @@
 #include "src/heap/heap-controller.h"
 #include "src/heap/incremental-marking-inl.h"
 #include "src/heap/invalidated-slots-inl.h"
+#include "src/heap/local-heap.h"
 #include "src/heap/mark-compact.h"
 #include "src/heap/read-only-heap.h"
 #include "src/heap/remembered-set.h"
@@ -1141,6 +1142,30 @@ void Page::DestroyBlackArea(Address start, Address end) {
   marking_state->IncrementLiveBytes(this, -static_cast<intptr_t>(end - start));
 }
 
+void Page::CreateBlackAreaBackground(Address start, Address end) {
+  DCHECK_EQ(Page::FromAddress(start), this);
+  DCHECK_LT(start, end);
+  DCHECK_EQ(Page::FromAddress(end - 1), this);
+  IncrementalMarking::AtomicMarkingState* marking_state =
+      heap()->incremental_marking()->atomic_marking_state();
+  marking_state->bitmap(this)->SetRange(AddressToMarkbitIndex(start),
+                                        AddressToMarkbitIndex(end));
+  heap()->incremental_marking()->IncrementLiveBytesBackground(
+      this, static_cast<intptr_t>(end - start));
+}
+
+void Page::DestroyBlackAreaBackground(Address start, Address end) {
+  DCHECK_EQ(Page::FromAddress(start), this);
+  DCHECK_LT(start, end);
+  DCHECK_EQ(Page::FromAddress(end - 1), this);
+  IncrementalMarking::AtomicMarkingState* marking_state =
+      heap()->incremental_marking()->atomic_marking_state();
+  marking_state->bitmap(this)->ClearRange(AddressToMarkbitIndex(start),
+                                          AddressToMarkbitIndex(end));
+  heap()->incremental_marking()->IncrementLiveBytesBackground(
+      this, -static_cast<intptr_t>(end - start));
+}
+
 void MemoryAllocator::PartialFreeMemory(MemoryChunk* chunk, Address start_free,
                                         size_t bytes_to_free,
                                         Address new_area_end) {
@@ -1673,6 +1698,12 @@ void PagedSpace::RefillFreeList() {
   MarkCompactCollector* collector = heap()->mark_compact_collector();
   size_t added = 0;
 
+  // Background threads may be allocating from the free list concurrently.
+  base::Optional<base::RecursiveMutexGuard> optional_mutex;
+  if (SupportsConcurrentAllocation()) {
+    optional_mutex.emplace(&allocation_mutex_);
+  }
+
   {
     Page* p = nullptr;
     while ((p = collector->sweeper()->GetSweptPageSafe(this)) != nullptr) {
@@ -1720,6 +1751,10 @@ void OffThreadSpace::RefillFreeList() {
 }
 
 void PagedSpace::MergeLocalSpace(LocalSpace* other) {
+  base::Optional<base::RecursiveMutexGuard> optional_mutex;
+  if (SupportsConcurrentAllocation()) {
+    optional_mutex.emplace(&allocation_mutex_);
+  }
   base::MutexGuard guard(mutex());
 
   DCHECK(identity() == other->identity());
@@ -1876,6 +1911,10 @@ void PagedSpace::ShrinkImmortalImmovablePages() {
 }
 
 bool PagedSpace::Expand() {
+  base::Optional<base::RecursiveMutexGuard> optional_mutex;
+  if (SupportsConcurrentAllocation()) {
+    optional_mutex.emplace(&allocation_mutex_);
+  }
   // Always lock against the main space as we can only adjust capacity and
   // pages concurrently for the main paged space.
   base::MutexGuard guard(heap()->paged_space(identity())->mutex());
@@ -1900,6 +1939,23 @@ bool PagedSpace::Expand() {
   return true;
 }
 
+bool PagedSpace::ExpandBackground(LocalHeap* local_heap) {
+  DCHECK(SupportsConcurrentAllocation());
+  base::MutexGuard guard(mutex());
+
+  const int size = AreaSize();
+
+  if (!heap()->CanExpandOldGenerationBackground(size)) return false;
+
+  Page* page =
+      heap()->memory_allocator()->AllocatePage(size, this, executable());
+  if (page == nullptr) return false;
+  AddPage(page);
+  Free(page->area_start(), page->area_size(),
+       SpaceAccountingMode::kSpaceAccounted);
+  return true;
+}
+
 
 int PagedSpace::CountTotalPages() {
   int count = 0;
@@ -1919,6 +1975,10 @@ void PagedSpace::SetLinearAllocationArea(Address top, Address limit) {
 }
 
 void PagedSpace::DecreaseLimit(Address new_limit) {
+  base::Optional<base::RecursiveMutexGuard> optional_mutex;
+  if (SupportsConcurrentAllocation()) {
+    optional_mutex.emplace(&allocation_mutex_);
+  }
   Address old_limit = limit();
   DCHECK_LE(top(), new_limit);
   DCHECK_GE(old_limit, new_limit);
@@ -1996,6 +2056,11 @@ void PagedSpace::FreeLinearAllocationArea() {
     return;
   }
 
+  base::Optional<base::RecursiveMutexGuard> optional_mutex;
+  if (SupportsConcurrentAllocation()) {
+    optional_mutex.emplace(&allocation_mutex_);
+  }
+
   if (!is_off_thread_space() &&
       heap()->incremental_marking()->black_allocation()) {
     Page* page = Page::FromAllocationAreaAddress(current_top);
@@ -2441,6 +2506,15 @@ LinearAllocationArea LocalAllocationBuffer::Close() {
   return LinearAllocationArea(kNullAddress, kNullAddress);
 }
 
+void LocalAllocationBuffer::MakeIterable() {
+  if (IsValid()) {
+    heap_->CreateFillerObjectAt(
+        allocation_info_.top(),
+        static_cast<int>(allocation_info_.limit() - allocation_info_.top()),
+        ClearRecordedSlots::kNo);
+  }
+}
+
 LocalAllocationBuffer::LocalAllocationBuffer(
     Heap* heap, LinearAllocationArea allocation_info) V8_NOEXCEPT
     : heap_(heap),
@@ -3785,10 +3859,9 @@ bool PagedSpace::SlowRefillLinearAllocationArea(int size_in_bytes,
   VMState<GC> state(heap()->isolate());
   RuntimeCallTimerScope runtime_timer(
       heap()->isolate(), RuntimeCallCounterId::kGC_Custom_SlowAllocateRaw);
-  base::Optional<base::MutexGuard> optional_mutex;
+  base::Optional<base::RecursiveMutexGuard> optional_mutex;
 
-  if (FLAG_concurrent_allocation && origin != AllocationOrigin::kGC &&
-      identity() == OLD_SPACE) {
+  if (SupportsConcurrentAllocation() && origin != AllocationOrigin::kGC) {
     optional_mutex.emplace(&allocation_mutex_);
   }
 
@@ -3901,6 +3974,97 @@ bool PagedSpace::SweepAndRetryAllocation(int required_freed_bytes,
   return false;
 }
 
+base::Optional<std::pair<Address, size_t>>
+PagedSpace::SlowGetLinearAllocationAreaBackground(LocalHeap* local_heap,
+                                                  size_t min_size_in_bytes,
+                                                  size_t max_size_in_bytes,
+                                                  AllocationAlignment alignment,
+                                                  AllocationOrigin origin) {
+  DCHECK(SupportsConcurrentAllocation());
+  DCHECK_EQ(origin, AllocationOrigin::kRuntime);
+  DCHECK_LE(min_size_in_bytes, max_size_in_bytes);
+
+  // The main thread may hold the mutex while it waits for a safepoint, e.g.
+  // when it starts incremental marking during its own slow path allocation.
+  // So this thread only blocks on the mutex while it is parked.
+  while (!allocation_mutex_.TryLock()) {
+    ParkedScope scope(local_heap);
+    base::RecursiveMutexGuard guard(&allocation_mutex_);
+  }
+
+  auto result = RawSlowGetLinearAllocationAreaBackground(
+      local_heap, min_size_in_bytes, max_size_in_bytes, alignment, origin);
+  allocation_mutex_.Unlock();
+  return result;
+}
+
+base::Optional<std::pair<Address, size_t>>
+PagedSpace::RawSlowGetLinearAllocationAreaBackground(
+    LocalHeap* local_heap, size_t min_size_in_bytes, size_t max_size_in_bytes,
+    AllocationAlignment alignment, AllocationOrigin origin) {
+  auto result = TryAllocationFromFreeListBackground(
+      min_size_in_bytes, max_size_in_bytes, alignment, origin);
+  if (result) return result;
+
+  // Unlike the main thread, background threads neither sweep pages nor
+  // refill the free list with swept pages: the main thread only waits for the
+  // sweeper tasks when it completes sweeping, and taking over a swept page
+  // merges its old-to-new remembered sets, which races with the main thread's
+  // write barrier. The main thread refills the free list on its own slow path
+  // and during garbage collections.
+  if (heap()->ShouldExpandOldGenerationOnSlowAllocationBackground() &&
+      ExpandBackground(local_heap)) {
+    result = TryAllocationFromFreeListBackground(
+        min_size_in_bytes, max_size_in_bytes, alignment, origin);
+    DCHECK(result);
+    return result;
+  }
+
+  // The caller has to request a garbage collection, which also completes
+  // sweeping.
+  return {};
+}
+
+base::Optional<std::pair<Address, size_t>>
+PagedSpace::TryAllocationFromFreeListBackground(size_t min_size_in_bytes,
+                                                size_t max_size_in_bytes,
+                                                AllocationAlignment alignment,
+                                                AllocationOrigin origin) {
+  DCHECK_LE(min_size_in_bytes, max_size_in_bytes);
+  DCHECK_EQ(identity(), OLD_SPACE);
+
+  size_t new_node_size = 0;
+  FreeSpace new_node =
+      free_list_->Allocate(min_size_in_bytes, &new_node_size, origin);
+  if (new_node.is_null()) return {};
+  DCHECK_GE(new_node_size, min_size_in_bytes);
+
+  // The old-space-step might have finished sweeping and restarted marking.
+  // Verify that it did not turn the page of the new node into an evacuation
+  // candidate.
+  DCHECK(!MarkCompactCollector::IsOnEvacuationCandidate(new_node));
+
+  // Memory in the linear allocation area is counted as allocated.  We may free
+  // a little of this again immediately - see below.
+  Page* page = Page::FromHeapObject(new_node);
+  IncreaseAllocatedBytes(new_node_size, page);
+
+  heap()->StartIncrementalMarkingIfAllocationLimitIsReachedBackground();
+
+  size_t used_size_in_bytes = Min(new_node_size, max_size_in_bytes);
+
+  Address start = new_node.address();
+  Address end = new_node.address() + new_node_size;
+  Address limit = new_node.address() + used_size_in_bytes;
+  DCHECK_LE(limit, end);
+  DCHECK_LE(min_size_in_bytes, limit - start);
+  if (limit != end) {
+    Free(limit, end - limit, SpaceAccountingMode::kSpaceAccounted);
+  }
+
+  return std::make_pair(start, used_size_in_bytes);
+}
+
 // -----------------------------------------------------------------------------
 // MapSpace implementation
 
@@ -4133,6 +4297,33 @@ AllocationResult OldLargeObjectSpace::AllocateRaw(int object_size,
   return object;
 }
 
+AllocationResult OldLargeObjectSpace::AllocateRawBackground(
+    LocalHeap* local_heap, int object_size) {
+  DCHECK(FLAG_concurrent_allocation);
+  // Check if we want to force a GC before growing the old space further.
+  // If so, fail the allocation.
+  if (!heap()->CanExpandOldGenerationBackground(object_size) ||
+      !heap()->ShouldExpandOldGenerationOnSlowAllocationBackground()) {
+    return AllocationResult::Retry(identity());
+  }
+
+  LargePage* page = AllocateLargePage(object_size, NOT_EXECUTABLE);
+  if (page == nullptr) return AllocationResult::Retry(identity());
+  // Marking only starts and stops in a safepoint, so it cannot change while
+  // this thread is running.
+  page->SetOldGenerationPageFlags(heap()->incremental_marking()->IsMarking());
+  HeapObject object = page->GetObject();
+  heap()->StartIncrementalMarkingIfAllocationLimitIsReachedBackground();
+  if (heap()->incremental_marking()->black_allocation()) {
+    heap()->incremental_marking()->marking_state()->WhiteToBlack(object);
+  }
+  DCHECK_IMPLIES(
+      heap()->incremental_marking()->black_allocation(),
+      heap()->incremental_marking()->marking_state()->IsBlack(object));
+  page->InitializationMemoryFence();
+  return object;
+}
+
 LargePage* LargeObjectSpace::AllocateLargePage(int object_size,
                                                Executability executable) {
   LargePage* page = heap()->memory_allocator()->AllocateLargePage(
@@ -4140,7 +4331,10 @@ LargePage* LargeObjectSpace::AllocateLargePage(int object_size,
   if (page == nullptr) return nullptr;
   DCHECK_GE(page->area_size(), static_cast<size_t>(object_size));
 
-  AddPage(page, object_size);
+  {
+    base::MutexGuard guard(&allocation_mutex_);
+    AddPage(page, object_size);
+  }
 
   HeapObject object = page->GetObject();
 
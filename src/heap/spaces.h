@@ -19,6 +19,7 @@
 #include "src/base/iterator.h"
 #include "src/base/list.h"
 #include "src/base/macros.h"
+#include "src/base/optional.h"
 #include "src/base/platform/mutex.h"
 #include "src/common/globals.h"
 #include "src/flags/flags.h"
@@ -52,6 +53,7 @@ class Isolate;
 class LargeObjectSpace;
 class LinearAllocationArea;
 class LocalArrayBufferTracker;
+class LocalHeap;
 class LocalSpace;
 class MemoryAllocator;
 class MemoryChunk;
@@ -1104,6 +1106,12 @@ class Page : public MemoryChunk {
   V8_EXPORT_PRIVATE void CreateBlackArea(Address start, Address end);
   void DestroyBlackArea(Address start, Address end);
 
+  // Variants of the above that may be called from background threads
+  // allocating concurrently with the main thread. Live bytes are recorded
+  // separately and added to the page in the atomic pause.
+  void CreateBlackAreaBackground(Address start, Address end);
+  void DestroyBlackAreaBackground(Address start, Address end);
+
   void InitializeFreeListCategories();
   void AllocateFreeListCategories();
   void ReleaseFreeListCategories();
@@ -1767,8 +1775,9 @@ class AllocationStats {
   // |max_capacity_|: The maximum capacity ever observed.
   size_t max_capacity_;
 
-  // |size_|: The number of allocated bytes.
-  size_t size_;
+  // |size_|: The number of allocated bytes. Background threads allocating
+  // concurrently update it while the main thread reads it.
+  std::atomic<size_t> size_;
 
 #ifdef DEBUG
   std::unordered_map<Page*, size_t, Page::Hasher> allocated_on_page_;
@@ -2206,6 +2215,13 @@ class LocalAllocationBuffer {
   // Close a LAB, effectively invalidating it. Returns the unused area.
   V8_EXPORT_PRIVATE LinearAllocationArea Close();
 
+  // Writes a filler object into the unused area, so that the heap can be
+  // iterated, but keeps the LAB valid.
+  V8_EXPORT_PRIVATE void MakeIterable();
+
+  Address top() const { return allocation_info_.top(); }
+  Address limit() const { return allocation_info_.limit(); }
+
  private:
   V8_EXPORT_PRIVATE LocalAllocationBuffer(
       Heap* heap, LinearAllocationArea allocation_info) V8_NOEXCEPT;
@@ -2505,6 +2521,25 @@ class V8_EXPORT_PRIVATE PagedSpace
 
   void SetLinearAllocationArea(Address top, Address limit);
 
+  // Whether background threads may allocate in this space through a
+  // ConcurrentAllocator.
+  bool SupportsConcurrentAllocation() {
+    return FLAG_concurrent_allocation && identity() == OLD_SPACE &&
+           !is_local_space();
+  }
+
+  // Allocates a linear allocation area for a background thread that is at
+  // least |min_size_in_bytes| and at most |max_size_in_bytes| large. Returns
+  // the start and size of the area, or nothing if the background thread has
+  // to request a garbage collection before retrying. The area is not marked
+  // black. Thread-safe.
+  V8_EXPORT_PRIVATE base::Optional<std::pair<Address, size_t>>
+  SlowGetLinearAllocationAreaBackground(LocalHeap* local_heap,
+                                        size_t min_size_in_bytes,
+                                        size_t max_size_in_bytes,
+                                        AllocationAlignment alignment,
+                                        AllocationOrigin origin);
+
  private:
   // Set space linear allocation area.
   void SetTopAndLimit(Address top, Address limit) {
@@ -2535,6 +2570,27 @@ class V8_EXPORT_PRIVATE PagedSpace
   // size limit has been hit.
   bool Expand();
 
+  // Implementation of SlowGetLinearAllocationAreaBackground(). Must be called
+  // with |allocation_mutex_| held.
+  base::Optional<std::pair<Address, size_t>>
+  RawSlowGetLinearAllocationAreaBackground(LocalHeap* local_heap,
+                                           size_t min_size_in_bytes,
+                                           size_t max_size_in_bytes,
+                                           AllocationAlignment alignment,
+                                           AllocationOrigin origin);
+
+  // Background thread variant of Expand() that does not notify the memory
+  // reducer. Must be called with |allocation_mutex_| held.
+  bool ExpandBackground(LocalHeap* local_heap);
+
+  // Allocates a linear allocation area for a background thread from the free
+  // list. Must be called with |allocation_mutex_| held.
+  base::Optional<std::pair<Address, size_t>>
+  TryAllocationFromFreeListBackground(size_t min_size_in_bytes,
+                                      size_t max_size_in_bytes,
+                                      AllocationAlignment alignment,
+                                      AllocationOrigin origin);
+
   // Sets up a linear allocation area that fits the given number of bytes.
   // Returns false if there is not enough space and the caller has to retry
   // after collecting garbage.
@@ -2588,8 +2644,11 @@ class V8_EXPORT_PRIVATE PagedSpace
   // Mutex guarding any concurrent access to the space.
   base::Mutex space_mutex_;
 
-  // Mutex guarding concurrent allocation.
-  base::Mutex allocation_mutex_;
+  // Mutex guarding the free list and allocation statistics while background
+  // threads allocate concurrently, see SupportsConcurrentAllocation(). It is
+  // recursive since the main thread may refill the free list while holding
+  // it, and it is always acquired before |space_mutex_|.
+  base::RecursiveMutex allocation_mutex_;
 
   friend class IncrementalMarking;
   friend class MarkCompactCollector;
@@ -3318,9 +3377,13 @@ class V8_EXPORT_PRIVATE LargeObjectSpace : public Space {
 
   LargePage* AllocateLargePage(int object_size, Executability executable);
 
-  size_t size_;          // allocated bytes
-  int page_count_;       // number of chunks
-  size_t objects_size_;  // size of objects
+  std::atomic<size_t> size_;          // allocated bytes
+  int page_count_;                    // number of chunks
+  std::atomic<size_t> objects_size_;  // size of objects
+
+  // Protects the page list and the counters above while background threads
+  // add pages, see OldLargeObjectSpace::AllocateRawBackground().
+  base::Mutex allocation_mutex_;
 
  private:
   friend class LargeObjectSpaceObjectIterator;
@@ -3335,6 +3398,13 @@ class OldLargeObjectSpace : public LargeObjectSpace {
   V8_EXPORT_PRIVATE V8_WARN_UNUSED_RESULT AllocationResult
   AllocateRaw(int object_size);
 
+  // Allocates a large object from a background thread. Unlike AllocateRaw(),
+  // neither starts incremental marking nor notifies allocation observers.
+  // Returns a failed AllocationResult if the caller has to request a garbage
+  // collection.
+  V8_EXPORT_PRIVATE V8_WARN_UNUSED_RESULT AllocationResult
+  AllocateRawBackground(LocalHeap* local_heap, int object_size);
+
   // Clears the marking state of live objects.
   void ClearMarkingStateOfLiveObjects();
 
@@ -685,6 +685,10 @@ void IC::SetCache(Handle<Name> name, const MaybeObjectHandle& handler) {
       ConfigureVectorState(MEGAMORPHIC, name);
       V8_FALLTHROUGH;
     case MEGAMORPHIC:
+      // state() is still the state before this miss: only ICs that were
+      // megamorphic already have missed in the stub cache. The entries
+      // copied into it above are not misses.
+      if (state() == MEGAMORPHIC && !IsAnyHas()) stub_cache()->RecordMiss();
       UpdateMegamorphicCache(receiver_map(), name, handler);
       // Indicate that we've handled this case.
       vector_set_ = true;
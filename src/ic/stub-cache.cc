@@ -4,6 +4,8 @@
 
 #include "src/ic/stub-cache.h"
 
+#include <algorithm>
+
 #include "src/ast/ast.h"
 #include "src/base/bits.h"
 #include "src/heap/heap-inl.h"  // For InYoungGeneration().
@@ -18,6 +20,12 @@ StubCache::StubCache(Isolate* isolate) : isolate_(isolate) {
   // Ensure the nullptr (aka Smi::zero()) which StubCache::Get() returns
   // when the entry is not found is not considered as a handler.
   DCHECK(!IC::IsHandler(MaybeObject()));
+  AllocateTables();
+}
+
+StubCache::~StubCache() {
+  DeleteArray(primary_);
+  DeleteArray(secondary_);
 }
 
 void StubCache::Initialize() {
@@ -26,6 +34,51 @@ void StubCache::Initialize() {
   Clear();
 }
 
+void StubCache::AllocateTables() {
+  DeleteArray(primary_);
+  DeleteArray(secondary_);
+  primary_ = NewArray<Entry>(primary_table_size());
+  secondary_ = NewArray<Entry>(secondary_table_size());
+  primary_mask_ = (primary_table_size() - 1) << kCacheIndexShift;
+  secondary_mask_ = (secondary_table_size() - 1) << kCacheIndexShift;
+}
+
+void StubCache::Grow() {
+  RuntimeCallTimerScope runtime_timer(isolate(),
+                                      RuntimeCallCounterId::kStubCacheGrow);
+  primary_table_bits_++;
+  AllocateTables();
+  ClearTables();
+  // The misses that caused growing count as the previous window, so that the
+  // next Clear does not shrink the tables right away.
+  miss_window_start_ms_ = MonotonicallyIncreasingTimeInMs();
+  misses_in_previous_window_ = misses_in_window_;
+  misses_in_window_ = 0;
+  isolate()->counters()->megamorphic_stub_cache_grows()->Increment();
+}
+
+void StubCache::Shrink() {
+  primary_table_bits_--;
+  AllocateTables();
+  ClearTables();
+}
+
+double StubCache::MonotonicallyIncreasingTimeInMs() {
+  if (time_function_for_testing_) return time_function_for_testing_();
+  return isolate()->heap()->MonotonicallyIncreasingTimeInMs();
+}
+
+void StubCache::UpdateMissWindow() {
+  double now = MonotonicallyIncreasingTimeInMs();
+  double elapsed = now - miss_window_start_ms_;
+  if (elapsed < kMissWindowMs) return;
+  // A window without any misses may have passed in the meantime.
+  misses_in_previous_window_ =
+      elapsed < 2 * kMissWindowMs ? misses_in_window_ : 0;
+  misses_in_window_ = 0;
+  miss_window_start_ms_ = now;
+}
+
 // Hash algorithm for the primary table. This algorithm is replicated in
 // the AccessorAssembler.  Returns an index into the table that
 // is scaled by 1 << kCacheIndexShift.
@@ -40,7 +93,7 @@ int StubCache::PrimaryOffset(Name name, Map map) {
       static_cast<uint32_t>(map.ptr() ^ (map.ptr() >> kMapKeyShift));
   // Base the offset on a simple combination of name and map.
   uint32_t key = map_low32bits + field;
-  return key & ((kPrimaryTableSize - 1) << kCacheIndexShift);
+  return key & primary_mask_;
 }
 
 // Hash algorithm for the secondary table.  This algorithm is replicated in
@@ -50,7 +103,7 @@ int StubCache::SecondaryOffset(Name name, int seed) {
   // Use the seed from the primary cache in the secondary cache.
   uint32_t name_low32bits = static_cast<uint32_t>(name.ptr());
   uint32_t key = (seed - name_low32bits) + kSecondaryMagic;
-  return key & ((kSecondaryTableSize - 1) << kCacheIndexShift);
+  return key & secondary_mask_;
 }
 
 int StubCache::PrimaryOffsetForTesting(Name name, Map map) {
@@ -110,6 +163,21 @@ void StubCache::Set(Name name, Map map, MaybeObject handler) {
   isolate()->counters()->megamorphic_stub_cache_updates()->Increment();
 }
 
+void StubCache::RecordMiss() {
+  RuntimeCallTimerScope runtime_timer(isolate(),
+                                      RuntimeCallCounterId::kStubCacheMiss);
+  // If the tables keep missing at a rate at which they could have been filled
+  // several times over, they are too small for the working set of (map, name)
+  // pairs.
+  UpdateMissWindow();
+  if (++misses_in_window_ >
+          kMissesPerEntryBeforeGrowing * primary_table_size() &&
+      primary_table_bits_ < std::min(FLAG_stub_cache_max_primary_table_bits,
+                                     kMaxPrimaryTableBits)) {
+    Grow();
+  }
+}
+
 MaybeObject StubCache::Get(Name name, Map map) {
   DCHECK(CommonStubCacheChecks(this, name, map, MaybeObject()));
   int primary_offset = PrimaryOffset(name, map);
@@ -126,15 +194,29 @@ MaybeObject StubCache::Get(Name name, Map map) {
 }
 
 void StubCache::Clear() {
+  if (primary_table_bits_ > kPrimaryTableBits) {
+    UpdateMissWindow();
+    int recent_misses =
+        std::max(misses_in_window_, misses_in_previous_window_);
+    if (recent_misses <=
+        primary_table_size() / kEntriesPerMissBeforeShrinking) {
+      Shrink();
+      return;
+    }
+  }
+  ClearTables();
+}
+
+void StubCache::ClearTables() {
   MaybeObject empty = MaybeObject::FromObject(
       isolate_->builtins()->builtin(Builtins::kIllegal));
   Name empty_string = ReadOnlyRoots(isolate()).empty_string();
-  for (int i = 0; i < kPrimaryTableSize; i++) {
+  for (int i = 0; i < primary_table_size(); i++) {
     primary_[i].key = StrongTaggedValue(empty_string);
     primary_[i].map = StrongTaggedValue(Smi::zero());
     primary_[i].value = TaggedValue(empty);
   }
-  for (int j = 0; j < kSecondaryTableSize; j++) {
+  for (int j = 0; j < secondary_table_size(); j++) {
     secondary_[j].key = StrongTaggedValue(empty_string);
     secondary_[j].map = StrongTaggedValue(Smi::zero());
     secondary_[j].value = TaggedValue(empty);
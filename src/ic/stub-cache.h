@@ -15,6 +15,9 @@ namespace internal {
 // It maps (map, name, type) to property access handlers. The cache does not
 // need explicit invalidation when a prototype chain is modified, since the
 // handlers verify the chain.
+// The tables start out small and grow (up to a limit) when the cache misses
+// too often, see StubCache::RecordMiss. Generated code therefore loads the
+// current table addresses and index masks from the StubCache on every probe.
 
 
 class SCTableReference {
@@ -46,38 +49,44 @@ class V8_EXPORT_PRIVATE StubCache {
   // Access cache for entry hash(name, map).
   void Set(Name name, Map map, MaybeObject handler);
   MaybeObject Get(Name name, Map map);
-  // Clear the lookup table (@ mark compact collection).
+  // Counts a miss in generated code, which is followed by a Set for the
+  // missing entry. Grows the tables if they miss too often.
+  void RecordMiss();
+  // Clear the lookup table (@ mark compact collection). Shrinks the tables
+  // again if they grew but have hardly missed recently.
   void Clear();
 
   enum Table { kPrimary, kSecondary };
 
-  SCTableReference key_reference(StubCache::Table table) {
-    return SCTableReference(
-        reinterpret_cast<Address>(&first_entry(table)->key));
-  }
-
-  SCTableReference map_reference(StubCache::Table table) {
-    return SCTableReference(
-        reinterpret_cast<Address>(&first_entry(table)->map));
-  }
-
-  SCTableReference value_reference(StubCache::Table table) {
-    return SCTableReference(
-        reinterpret_cast<Address>(&first_entry(table)->value));
+  // The address of the field holding the address of the first entry of
+  // {table}. The field changes when the tables grow.
+  SCTableReference table_reference(StubCache::Table table) {
+    switch (table) {
+      case StubCache::kPrimary:
+        return SCTableReference(reinterpret_cast<Address>(&primary_));
+      case StubCache::kSecondary:
+        return SCTableReference(reinterpret_cast<Address>(&secondary_));
+    }
+    UNREACHABLE();
   }
 
-  StubCache::Entry* first_entry(StubCache::Table table) {
+  // The address of the field holding the uint32_t mask which turns a hash
+  // into an offset into {table}, see {PrimaryOffset}.
+  SCTableReference mask_reference(StubCache::Table table) {
     switch (table) {
       case StubCache::kPrimary:
-        return StubCache::primary_;
+        return SCTableReference(reinterpret_cast<Address>(&primary_mask_));
       case StubCache::kSecondary:
-        return StubCache::secondary_;
+        return SCTableReference(reinterpret_cast<Address>(&secondary_mask_));
     }
     UNREACHABLE();
   }
 
   Isolate* isolate() { return isolate_; }
 
+  int primary_table_size() const { return 1 << primary_table_bits_; }
+  int secondary_table_size() const { return 1 << secondary_table_bits(); }
+
   // Setting kCacheIndexShift to Name::kHashShift is convenient because it
   // causes the bit field inside the hash field to get shifted out implicitly.
   // Note that kCacheIndexShift must not get too large, because
@@ -85,10 +94,28 @@ class V8_EXPORT_PRIVATE StubCache {
   // the STATIC_ASSERT below, in {entry(...)}).
   static const int kCacheIndexShift = Name::kHashShift;
 
+  // Initial table sizes. The secondary table is always a quarter of the size
+  // of the primary table.
   static const int kPrimaryTableBits = 11;
   static const int kPrimaryTableSize = (1 << kPrimaryTableBits);
   static const int kSecondaryTableBits = 9;
   static const int kSecondaryTableSize = (1 << kSecondaryTableBits);
+  static const int kSecondaryTableBitsDelta =
+      kPrimaryTableBits - kSecondaryTableBits;
+  // Upper bound for --stub-cache-max-primary-table-bits, which keeps the
+  // shifted index masks well within 32 bits.
+  static const int kMaxPrimaryTableBits = 20;
+
+  // Misses are counted per window of this many milliseconds, so that a low
+  // miss rate does not add up to growing over a long time.
+  static const int kMissWindowMs = 1000;
+  // The tables grow once the misses within a window exceed this multiple of
+  // the primary table size: at that point, entries are evicted faster than
+  // the cache can be filled.
+  static const int kMissesPerEntryBeforeGrowing = 4;
+  // Grown tables shrink on Clear if neither the current nor the previous
+  // window had more misses than the primary table size divided by this.
+  static const int kEntriesPerMissBeforeShrinking = 2;
 
   // We compute the hash code for a map as follows:
   //   <code> = <address> ^ (<address> >> kMapKeyShift)
@@ -97,11 +124,19 @@ class V8_EXPORT_PRIVATE StubCache {
   // Some magic number used in the secondary hash computation.
   static const int kSecondaryMagic = 0xb16ca6e5;
 
-  static int PrimaryOffsetForTesting(Name name, Map map);
-  static int SecondaryOffsetForTesting(Name name, int seed);
+  int PrimaryOffsetForTesting(Name name, Map map);
+  int SecondaryOffsetForTesting(Name name, int seed);
+  void GrowForTesting() { Grow(); }
+
+  // Replaces the clock for the windows in which misses are counted.
+  using TimeFunction = double (*)();
+  void SetTimeFunctionForTesting(TimeFunction time_function) {
+    time_function_for_testing_ = time_function;
+  }
 
   // The constructor is made public only for the purposes of testing.
   explicit StubCache(Isolate* isolate);
+  ~StubCache();
 
  private:
   // The stub cache has a primary and secondary level.  The two levels have
@@ -114,12 +149,27 @@ class V8_EXPORT_PRIVATE StubCache {
   // Hash algorithm for the primary table.  This algorithm is replicated in
   // assembler for every architecture.  Returns an index into the table that
   // is scaled by 1 << kCacheIndexShift.
-  static int PrimaryOffset(Name name, Map map);
+  int PrimaryOffset(Name name, Map map);
 
   // Hash algorithm for the secondary table.  This algorithm is replicated in
   // assembler for every architecture.  Returns an index into the table that
   // is scaled by 1 << kCacheIndexShift.
-  static int SecondaryOffset(Name name, int seed);
+  int SecondaryOffset(Name name, int seed);
+
+  int secondary_table_bits() const {
+    return primary_table_bits_ - kSecondaryTableBitsDelta;
+  }
+
+  // (Re)allocates both tables for the current {primary_table_bits_}.
+  void AllocateTables();
+  // Doubles the size of both tables, dropping their contents.
+  void Grow();
+  // Halves the size of both tables, dropping their contents.
+  void Shrink();
+  void ClearTables();
+  double MonotonicallyIncreasingTimeInMs();
+  // Starts a new window for counting misses if the current one is over.
+  void UpdateMissWindow();
 
   // Compute the entry for a given offset in exactly the same way as
   // we do in generated code.  We generate an hash code that already
@@ -136,8 +186,18 @@ class V8_EXPORT_PRIVATE StubCache {
   }
 
  private:
-  Entry primary_[kPrimaryTableSize];
-  Entry secondary_[kSecondaryTableSize];
+  // Generated code reads these four fields, see {table_reference} and
+  // {mask_reference}.
+  Entry* primary_ = nullptr;
+  Entry* secondary_ = nullptr;
+  uint32_t primary_mask_ = 0;
+  uint32_t secondary_mask_ = 0;
+
+  int primary_table_bits_ = kPrimaryTableBits;
+  double miss_window_start_ms_ = 0;
+  int misses_in_window_ = 0;
+  int misses_in_previous_window_ = 0;
+  TimeFunction time_function_for_testing_ = nullptr;
   Isolate* isolate_;
 
   friend class Isolate;
@@ -3,9 +3,16 @@
 // found in the LICENSE file.
 
 #include "src/init/isolate-allocator.h"
+
+#include <algorithm>
+#include <vector>
+
 #include "src/base/bounded-page-allocator.h"
+#include "src/base/lazy-instance.h"
+#include "src/base/platform/mutex.h"
 #include "src/common/ptr-compr.h"
 #include "src/execution/isolate.h"
+#include "src/flags/flags.h"
 #include "src/utils/memcopy.h"
 #include "src/utils/utils.h"
 
@@ -30,7 +37,9 @@ IsolateAllocator::IsolateAllocator(IsolateAllocationMode mode) {
 
 IsolateAllocator::~IsolateAllocator() {
   if (reservation_.IsReserved()) {
-    // The actual memory will be freed when the |reservation_| will die.
+#if V8_TARGET_ARCH_64_BIT
+    ReleaseReservation();
+#endif  // V8_TARGET_ARCH_64_BIT
     return;
   }
 
@@ -52,9 +61,53 @@ inline size_t GetIsolateRootBiasPageSize(
                  platform_page_allocator->AllocatePageSize());
 }
 
+// Process-wide list of the reservations of disposed isolates. All pages in
+// them are decommitted.
+class IsolateReservationCache {
+ public:
+  // Moves a cached reservation into |reservation| and returns the address of
+  // its 4Gb aligned region minus the bias page, or kNullAddress if the cache
+  // is empty.
+  Address Take(VirtualMemory* reservation) {
+    base::MutexGuard guard(&mutex_);
+    if (entries_.empty()) return kNullAddress;
+    Entry& entry = entries_.back();
+    Address address = entry.address;
+    *reservation = std::move(entry.reservation);
+    entries_.pop_back();
+    return address;
+  }
+
+  // Takes over |reservation| and returns true unless the cache is full.
+  bool Put(VirtualMemory* reservation, Address address) {
+    base::MutexGuard guard(&mutex_);
+    if (entries_.size() >=
+        static_cast<size_t>(std::max(0, FLAG_cached_isolate_reservations))) {
+      return false;
+    }
+    entries_.push_back({std::move(*reservation), address});
+    return true;
+  }
+
+ private:
+  struct Entry {
+    VirtualMemory reservation;
+    Address address;
+  };
+
+  base::Mutex mutex_;
+  std::vector<Entry> entries_;
+};
+
+DEFINE_LAZY_LEAKY_OBJECT_GETTER(IsolateReservationCache,
+                                GetIsolateReservationCache)
+
 }  // namespace
 
 Address IsolateAllocator::InitReservation() {
+  Address cached_address = GetIsolateReservationCache()->Take(&reservation_);
+  if (cached_address != kNullAddress) return cached_address;
+
   v8::PageAllocator* platform_page_allocator = GetPlatformPageAllocator();
 
   const size_t kIsolateRootBiasPageSize =
@@ -192,6 +245,48 @@ void IsolateAllocator::CommitPagesForIsolate(Address heap_reservation_address) {
   }
   isolate_memory_ = reinterpret_cast<void*>(isolate_address);
 }
+
+void IsolateAllocator::ReleaseReservation() {
+  v8::PageAllocator* platform_page_allocator = GetPlatformPageAllocator();
+
+  const size_t kIsolateRootBiasPageSize =
+      GetIsolateRootBiasPageSize(platform_page_allocator);
+
+  Address isolate_address = reinterpret_cast<Address>(isolate_memory_);
+  Address isolate_root = isolate_address + Isolate::isolate_root_bias();
+  Address isolate_end = isolate_address + sizeof(Isolate);
+
+  // Decommit the pages where the Isolate was stored and release them from
+  // the bounded page allocator. The heap has already freed all other pages.
+  {
+    size_t commit_page_size = platform_page_allocator->CommitPageSize();
+    Address committed_region_address =
+        RoundDown(isolate_address, commit_page_size);
+    size_t committed_region_size =
+        RoundUp(isolate_end, commit_page_size) - committed_region_address;
+    CHECK(reservation_.SetPermissions(committed_region_address,
+                                      committed_region_size,
+                                      PageAllocator::kNoAccess));
+  }
+  {
+    size_t page_size = page_allocator_instance_->AllocatePageSize();
+    Address reserved_region_address = isolate_root;
+    size_t reserved_region_size =
+        RoundUp(isolate_end, page_size) - reserved_region_address;
+    CHECK(page_allocator_instance_->FreePages(
+        reinterpret_cast<void*>(reserved_region_address),
+        reserved_region_size));
+  }
+
+  // Only reuse the reservation if nothing is left allocated in it.
+  if (page_allocator_instance_->free_size() !=
+      page_allocator_instance_->size()) {
+    return;
+  }
+  Address heap_reservation_address = isolate_root - kIsolateRootBiasPageSize;
+  GetIsolateReservationCache()->Put(&reservation_, heap_reservation_address);
+  // Otherwise the memory is freed when |reservation_| dies.
+}
 #endif  // V8_TARGET_ARCH_64_BIT
 
 }  // namespace internal
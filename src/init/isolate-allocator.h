@@ -32,6 +32,11 @@ namespace internal {
 // the Isolate object takes ownership of the IsolateAllocator object to keep
 // the memory alive.
 // Isolate::Delete() takes care of the proper order of the objects destruction.
+//
+// Reserving a pointer compression cage is expensive, so with
+// --cached-isolate-reservations the cage of a disposed isolate can be kept
+// reserved, with all pages decommitted, for the next isolates. Live isolates
+// never share a cage.
 class V8_EXPORT_PRIVATE IsolateAllocator final {
  public:
   explicit IsolateAllocator(IsolateAllocationMode mode);
@@ -49,6 +54,9 @@ class V8_EXPORT_PRIVATE IsolateAllocator final {
  private:
   Address InitReservation();
   void CommitPagesForIsolate(Address heap_reservation_address);
+  // Decommits the pages of the Isolate object and hands |reservation_| to the
+  // cache of reservations, or frees it if the cache is full.
+  void ReleaseReservation();
 
   // The allocated memory for Isolate instance.
   void* isolate_memory_ = nullptr;
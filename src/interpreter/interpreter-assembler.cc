@@ -138,12 +138,17 @@ TNode<BytecodeArray> InterpreterAssembler::BytecodeArrayTaggedPointer() {
 }
 
 TNode<ExternalReference> InterpreterAssembler::DispatchTablePointer() {
+#ifndef V8_ENABLE_BASELINE
+  // Baseline code passes its own dispatch table to the handlers it calls and
+  // relies on them dispatching through it, so only rematerialize the
+  // isolate's table after calls if there is no baseline tier.
   if (Bytecodes::MakesCallAlongCriticalPath(bytecode_) && made_call_ &&
       (dispatch_table_.value() ==
        Parameter(InterpreterDispatchDescriptor::kDispatchTable))) {
     dispatch_table_ = ExternalConstant(
         ExternalReference::interpreter_dispatch_table_address(isolate()));
   }
+#endif  // V8_ENABLE_BASELINE
   return dispatch_table_.value();
 }
 
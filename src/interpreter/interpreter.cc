@@ -4,6 +4,7 @@
 
 #include "src/interpreter/interpreter.h"
 
+#include <algorithm>
 #include <fstream>
 #include <memory>
 
@@ -336,6 +337,17 @@ void Interpreter::Initialize() {
   DCHECK(IsDispatchTableInitialized());
 }
 
+Address Interpreter::baseline_dispatch_table_address() {
+  if (!baseline_dispatch_table_) {
+    Address entry = isolate_->builtins()
+                        ->builtin(Builtins::kBaselineDispatchReturn)
+                        .InstructionStart();
+    baseline_dispatch_table_.reset(new Address[kDispatchTableSize]);
+    std::fill_n(baseline_dispatch_table_.get(), kDispatchTableSize, entry);
+  }
+  return reinterpret_cast<Address>(baseline_dispatch_table_.get());
+}
+
 bool Interpreter::IsDispatchTableInitialized() const {
   return dispatch_table_[0] != kNullAddress;
 }
@@ -82,6 +82,12 @@ class Interpreter {
     return reinterpret_cast<Address>(bytecode_dispatch_counters_table_.get());
   }
 
+  // Returns the address of the dispatch table passed to bytecode handlers
+  // called from baseline code. Every entry points to the
+  // BaselineDispatchReturn builtin, so that handlers return to the baseline
+  // code instead of dispatching to the next bytecode handler.
+  V8_EXPORT_PRIVATE Address baseline_dispatch_table_address();
+
   Address address_of_interpreter_entry_trampoline_instruction_start() const {
     return reinterpret_cast<Address>(
         &interpreter_entry_trampoline_instruction_start_);
@@ -104,6 +110,7 @@ class Interpreter {
   Isolate* isolate_;
   Address dispatch_table_[kDispatchTableSize];
   std::unique_ptr<uintptr_t[]> bytecode_dispatch_counters_table_;
+  std::unique_ptr<Address[]> baseline_dispatch_table_;
   Address interpreter_entry_trampoline_instruction_start_;
 
   DISALLOW_COPY_AND_ASSIGN(Interpreter);
@@ -4,6 +4,7 @@
 
 #include "src/json/json-parser.h"
 
+#include "src/base/bits.h"
 #include "src/common/message-template.h"
 #include "src/debug/debug.h"
 #include "src/numbers/conversions.h"
@@ -15,6 +16,16 @@
 #include "src/strings/char-predicates-inl.h"
 #include "src/strings/string-hasher.h"
 
+#if V8_HOST_ARCH_X64
+#include <emmintrin.h>
+#define V8_JSON_SCAN_BLOCKS 1
+#elif V8_HOST_ARCH_ARM64 && defined(__ARM_NEON)
+#include <arm_neon.h>
+#define V8_JSON_SCAN_BLOCKS 1
+#else
+#define V8_JSON_SCAN_BLOCKS 0
+#endif
+
 namespace v8 {
 namespace internal {
 
@@ -115,6 +126,184 @@ static const constexpr uint8_t character_json_scan_flags[256] = {
 #undef CALL_GET_SCAN_FLAGS
 };
 
+#if V8_JSON_SCAN_BLOCKS
+
+// Operations on 16-byte blocks of characters, used to skip over long runs of
+// whitespace, string characters and digits. Comparisons produce all-ones
+// lanes for matching characters, and Mask() turns the result into a bit mask
+// with kMaskBitsPerChar bits per character, lowest character first.
+template <typename Char>
+struct CharBlock;
+
+#if V8_HOST_ARCH_X64
+
+// SSE2 is part of the x64 baseline, so no feature detection is needed.
+template <typename Char>
+struct CharBlock {
+  using Vector = __m128i;
+  static constexpr int kLength = sizeof(Vector) / sizeof(Char);
+  static constexpr int kMaskBitsPerChar = sizeof(Char);
+  static constexpr uint64_t kAllMatch = 0xFFFF;
+
+  static Vector Load(const Char* chars) {
+    return _mm_loadu_si128(reinterpret_cast<const Vector*>(chars));
+  }
+  static Vector Splat(Char c) {
+    return sizeof(Char) == 1 ? _mm_set1_epi8(static_cast<char>(c))
+                             : _mm_set1_epi16(static_cast<int16_t>(c));
+  }
+  static Vector Equal(Vector a, Vector b) {
+    return sizeof(Char) == 1 ? _mm_cmpeq_epi8(a, b) : _mm_cmpeq_epi16(a, b);
+  }
+  // Unsigned a <= b.
+  static Vector LessEqual(Vector a, Vector b) {
+    Vector zero = _mm_setzero_si128();
+    return sizeof(Char) == 1 ? _mm_cmpeq_epi8(_mm_subs_epu8(a, b), zero)
+                             : _mm_cmpeq_epi16(_mm_subs_epu16(a, b), zero);
+  }
+  static Vector Subtract(Vector a, Vector b) {
+    return sizeof(Char) == 1 ? _mm_sub_epi8(a, b) : _mm_sub_epi16(a, b);
+  }
+  static Vector Or(Vector a, Vector b) { return _mm_or_si128(a, b); }
+  static uint64_t Mask(Vector v) {
+    return static_cast<uint32_t>(_mm_movemask_epi8(v));
+  }
+};
+
+#elif V8_HOST_ARCH_ARM64
+
+// NEON has no movemask, so narrow each lane to 4 (one-byte) or 8 (two-byte)
+// bits of a 64-bit mask instead.
+template <>
+struct CharBlock<uint8_t> {
+  using Vector = uint8x16_t;
+  static constexpr int kLength = 16;
+  static constexpr int kMaskBitsPerChar = 4;
+  static constexpr uint64_t kAllMatch = ~uint64_t{0};
+
+  static Vector Load(const uint8_t* chars) { return vld1q_u8(chars); }
+  static Vector Splat(uint8_t c) { return vdupq_n_u8(c); }
+  static Vector Equal(Vector a, Vector b) { return vceqq_u8(a, b); }
+  static Vector LessEqual(Vector a, Vector b) { return vcleq_u8(a, b); }
+  static Vector Subtract(Vector a, Vector b) { return vsubq_u8(a, b); }
+  static Vector Or(Vector a, Vector b) { return vorrq_u8(a, b); }
+  static uint64_t Mask(Vector v) {
+    return vget_lane_u64(
+        vreinterpret_u64_u8(vshrn_n_u16(vreinterpretq_u16_u8(v), 4)), 0);
+  }
+};
+
+template <>
+struct CharBlock<uint16_t> {
+  using Vector = uint16x8_t;
+  static constexpr int kLength = 8;
+  static constexpr int kMaskBitsPerChar = 8;
+  static constexpr uint64_t kAllMatch = ~uint64_t{0};
+
+  static Vector Load(const uint16_t* chars) { return vld1q_u16(chars); }
+  static Vector Splat(uint16_t c) { return vdupq_n_u16(c); }
+  static Vector Equal(Vector a, Vector b) { return vceqq_u16(a, b); }
+  static Vector LessEqual(Vector a, Vector b) { return vcleq_u16(a, b); }
+  static Vector Subtract(Vector a, Vector b) { return vsubq_u16(a, b); }
+  static Vector Or(Vector a, Vector b) { return vorrq_u16(a, b); }
+  static uint64_t Mask(Vector v) {
+    return vget_lane_u64(vreinterpret_u64_u8(vshrn_n_u16(v, 4)), 0);
+  }
+};
+
+#endif
+
+template <typename Char>
+const Char* FirstMatchInBlock(const Char* block, uint64_t mask) {
+  return block + base::bits::CountTrailingZeros(mask) /
+                     CharBlock<Char>::kMaskBitsPerChar;
+}
+
+#endif  // V8_JSON_SCAN_BLOCKS
+
+// The block scanners below skip whole blocks while the rest of the input is
+// at least a block long, and return where the scalar scanning loops in the
+// parser should continue.
+
+// Skips JSON whitespace.
+template <typename Char>
+const Char* SkipWhitespaceBlocks(const Char* cursor, const Char* end) {
+#if V8_JSON_SCAN_BLOCKS
+  using Block = CharBlock<Char>;
+  const typename Block::Vector space = Block::Splat(' ');
+  const typename Block::Vector tab = Block::Splat('\t');
+  const typename Block::Vector newline = Block::Splat('\n');
+  const typename Block::Vector carriage_return = Block::Splat('\r');
+  while (end - cursor >= Block::kLength) {
+    typename Block::Vector chars = Block::Load(cursor);
+    uint64_t whitespace = Block::Mask(Block::Or(
+        Block::Or(Block::Equal(chars, space), Block::Equal(chars, tab)),
+        Block::Or(Block::Equal(chars, newline),
+                  Block::Equal(chars, carriage_return))));
+    if (whitespace != Block::kAllMatch) {
+      return FirstMatchInBlock(cursor, whitespace ^ Block::kAllMatch);
+    }
+    cursor += Block::kLength;
+  }
+#endif
+  return cursor;
+}
+
+// Skips decimal digits.
+template <typename Char>
+const Char* SkipDecimalDigitBlocks(const Char* cursor, const Char* end) {
+#if V8_JSON_SCAN_BLOCKS
+  using Block = CharBlock<Char>;
+  const typename Block::Vector zero = Block::Splat('0');
+  const typename Block::Vector nine = Block::Splat(9);
+  while (end - cursor >= Block::kLength) {
+    typename Block::Vector chars = Block::Load(cursor);
+    uint64_t digits = Block::Mask(
+        Block::LessEqual(Block::Subtract(chars, zero), nine));
+    if (digits != Block::kAllMatch) {
+      return FirstMatchInBlock(cursor, digits ^ Block::kAllMatch);
+    }
+    cursor += Block::kLength;
+  }
+#endif
+  return cursor;
+}
+
+// Skips characters which can't terminate a JSON string, i.e. anything but
+// '"', '\\' and control characters. For two-byte input, characters outside
+// of Latin1 that were skipped are or'ed into {bits}, like the scalar loop
+// does.
+template <typename Char>
+const Char* SkipJsonStringBlocks(const Char* cursor, const Char* end,
+                                 uc32* bits) {
+#if V8_JSON_SCAN_BLOCKS
+  using Block = CharBlock<Char>;
+  const typename Block::Vector quote = Block::Splat('"');
+  const typename Block::Vector backslash = Block::Splat('\\');
+  const typename Block::Vector max_control = Block::Splat(0x1F);
+  const typename Block::Vector max_latin1 =
+      Block::Splat(static_cast<Char>(unibrow::Latin1::kMaxChar));
+  while (end - cursor >= Block::kLength) {
+    typename Block::Vector chars = Block::Load(cursor);
+    uint64_t terminators = Block::Mask(Block::Or(
+        Block::Or(Block::Equal(chars, quote), Block::Equal(chars, backslash)),
+        Block::LessEqual(chars, max_control)));
+    if (sizeof(Char) == 2) {
+      uint64_t non_latin1 =
+          Block::Mask(Block::LessEqual(chars, max_latin1)) ^ Block::kAllMatch;
+      // Only characters before the terminator belong to this string.
+      if (terminators != 0) {
+        non_latin1 &= (terminators & (~terminators + 1)) - 1;
+      }
+      if (non_latin1 != 0) *bits |= *FirstMatchInBlock(cursor, non_latin1);
+    }
+    if (terminators != 0) return FirstMatchInBlock(cursor, terminators);
+    cursor += Block::kLength;
+  }
+#endif
+  return cursor;
+}
+
 }  // namespace
 
 MaybeHandle<Object> JsonParseInternalizer::Internalize(Isolate* isolate,
@@ -320,6 +509,13 @@ template <typename Char>
 void JsonParser<Char>::SkipWhitespace() {
   next_ = JsonToken::EOS;
 
+  // Longer runs of whitespace, e.g. indentation in pretty-printed JSON, are
+  // skipped a block at a time.
+  if (cursor_ != end_ && *cursor_ <= unibrow::Latin1::kMaxChar &&
+      one_char_json_tokens[*cursor_] == JsonToken::WHITESPACE) {
+    cursor_ = SkipWhitespaceBlocks(cursor_ + 1, end_);
+  }
+
   cursor_ = std::find_if(cursor_, end_, [this](Char c) {
     JsonToken current = V8_LIKELY(c <= unibrow::Latin1::kMaxChar)
                             ? one_char_json_tokens[c]
@@ -886,6 +1082,7 @@ MaybeHandle<Object> JsonParser<Char>::ParseJsonValue() {
 
 template <typename Char>
 void JsonParser<Char>::AdvanceToNonDecimal() {
+  cursor_ = SkipDecimalDigitBlocks(cursor_, end_);
   cursor_ =
       std::find_if(cursor_, end_, [](Char c) { return !IsDecimalDigit(c); });
 }
@@ -1127,6 +1324,7 @@ JsonString JsonParser<Char>::ScanJsonString(bool needs_internalization) {
   uc32 bits = 0;
 
   while (true) {
+    cursor_ = SkipJsonStringBlocks(cursor_, end_, &bits);
     cursor_ = std::find_if(cursor_, end_, [&bits](Char c) {
       if (sizeof(Char) == 2 && V8_UNLIKELY(c > unibrow::Latin1::kMaxChar)) {
         bits |= c;
@@ -4,6 +4,8 @@
 
 #include "src/json/json-stringifier.h"
 
+#include <algorithm>
+
 #include "src/common/message-template.h"
 #include "src/numbers/conversions.h"
 #include "src/objects/heap-number-inl.h"
@@ -14,11 +16,111 @@
 #include "src/objects/ordered-hash-table.h"
 #include "src/objects/smi.h"
 #include "src/strings/string-builder-inl.h"
+#include "src/strings/unicode-inl.h"
 #include "src/utils/utils.h"
 
 namespace v8 {
 namespace internal {
 
+// Encodes the parts produced by the string builder as UTF-8 and writes them
+// to an embedder provided stream in chunks of the preferred size.
+class JsonStreamWriter final : public IncrementalStringBuilder::PartConsumer {
+ public:
+  explicit JsonStreamWriter(v8::JSON::OutputStream* stream)
+      : stream_(stream),
+        chunk_size_(std::max(stream->GetChunkSize(), int{kMinChunkSize})),
+        chunk_(NewArray<char>(chunk_size_)),
+        chunk_pos_(0),
+        lead_surrogate_(0),
+        aborted_(false) {}
+
+  ~JsonStreamWriter() override { DeleteArray(chunk_); }
+
+  void Consume(Handle<String> part) override {
+    if (aborted_) return;
+    DisallowHeapAllocation no_gc;
+    String::FlatContent content = part->GetFlatContent(no_gc);
+    DCHECK(content.IsFlat());
+    if (content.IsOneByte()) {
+      WriteChars(content.ToOneByteVector());
+    } else {
+      WriteChars(content.ToUC16Vector());
+    }
+  }
+
+  // Writes out the buffered output and ends the stream. Returns false if the
+  // stream has aborted writing.
+  bool Finish() {
+    if (lead_surrogate_ != 0) {
+      WriteCodePoint(lead_surrogate_);
+      lead_surrogate_ = 0;
+    }
+    if (!Flush()) return false;
+    stream_->EndOfStream();
+    return true;
+  }
+
+  bool aborted() const { return aborted_; }
+
+ private:
+  static const int kMinChunkSize = unibrow::Utf8::kMaxEncodedSize;
+
+  template <typename Char>
+  void WriteChars(Vector<const Char> chars) {
+    for (Char c : chars) {
+      if (aborted_) return;
+      if (c <= unibrow::Utf8::kMaxOneByteChar && lead_surrogate_ == 0) {
+        if (chunk_pos_ == chunk_size_ && !Flush()) return;
+        chunk_[chunk_pos_++] = static_cast<char>(c);
+        continue;
+      }
+      // Surrogate pairs can be split across parts, so hold on to a lead
+      // surrogate until the next character is known.
+      if (lead_surrogate_ != 0) {
+        uc16 lead = lead_surrogate_;
+        lead_surrogate_ = 0;
+        if (unibrow::Utf16::IsTrailSurrogate(c)) {
+          WriteCodePoint(unibrow::Utf16::CombineSurrogatePair(lead, c));
+          continue;
+        }
+        WriteCodePoint(lead);
+      }
+      if (unibrow::Utf16::IsLeadSurrogate(c)) {
+        lead_surrogate_ = c;
+      } else {
+        WriteCodePoint(c);
+      }
+    }
+  }
+
+  void WriteCodePoint(unibrow::uchar c) {
+    if (chunk_size_ - chunk_pos_ < kMinChunkSize && !Flush()) return;
+    chunk_pos_ += unibrow::Utf8::Encode(chunk_ + chunk_pos_, c,
+                                        unibrow::Utf16::kNoPreviousCharacter);
+  }
+
+  bool Flush() {
+    if (aborted_) return false;
+    if (chunk_pos_ == 0) return true;
+    int size = chunk_pos_;
+    chunk_pos_ = 0;
+    if (stream_->WriteUtf8Chunk(chunk_, size) ==
+        v8::JSON::OutputStream::kAbort) {
+      aborted_ = true;
+    }
+    return !aborted_;
+  }
+
+  v8::JSON::OutputStream* const stream_;
+  const int chunk_size_;
+  char* const chunk_;
+  int chunk_pos_;
+  uc16 lead_surrogate_;
+  bool aborted_;
+
+  DISALLOW_COPY_AND_ASSIGN(JsonStreamWriter);
+};
+
 class JsonStringifier {
  public:
   explicit JsonStringifier(Isolate* isolate);
@@ -29,6 +131,10 @@ class JsonStringifier {
                                                       Handle<Object> replacer,
                                                       Handle<Object> gap);
 
+  V8_WARN_UNUSED_RESULT Maybe<bool> StringifyToStream(
+      Handle<Object> object, Handle<Object> gap,
+      v8::JSON::OutputStream* stream);
+
  private:
   enum Result { UNCHANGED, SUCCESS, EXCEPTION };
 
@@ -124,6 +230,7 @@ class JsonStringifier {
 
   Isolate* isolate_;
   IncrementalStringBuilder builder_;
+  JsonStreamWriter* stream_writer_;
   Handle<String> tojson_string_;
   Handle<FixedArray> property_list_;
   Handle<JSReceiver> replacer_function_;
@@ -143,6 +250,13 @@ MaybeHandle<Object> JsonStringify(Isolate* isolate, Handle<Object> object,
   return stringifier.Stringify(object, replacer, gap);
 }
 
+Maybe<bool> JsonStringifyToStream(Isolate* isolate, Handle<Object> object,
+                                  Handle<Object> gap,
+                                  v8::JSON::OutputStream* stream) {
+  JsonStringifier stringifier(isolate);
+  return stringifier.StringifyToStream(object, gap, stream);
+}
+
 // Translation table to escape Latin1 characters.
 // Table entries start at a multiple of 8 and are null-terminated.
 const char* const JsonStringifier::JsonEscapeTable =
@@ -214,6 +328,7 @@ const char* const JsonStringifier::JsonEscapeTable =
 JsonStringifier::JsonStringifier(Isolate* isolate)
     : isolate_(isolate),
       builder_(isolate),
+      stream_writer_(nullptr),
       gap_(nullptr),
       indent_(0),
       stack_() {
@@ -234,6 +349,29 @@ MaybeHandle<Object> JsonStringifier::Stringify(Handle<Object> object,
   return MaybeHandle<Object>();
 }
 
+Maybe<bool> JsonStringifier::StringifyToStream(
+    Handle<Object> object, Handle<Object> gap,
+    v8::JSON::OutputStream* stream) {
+  if (!gap->IsUndefined(isolate_) && !InitializeGap(gap)) {
+    return Nothing<bool>();
+  }
+  JsonStreamWriter writer(stream);
+  stream_writer_ = &writer;
+  builder_.set_part_consumer(&writer);
+  Result result = SerializeObject(object);
+  if (result == UNCHANGED) return Just(false);
+  if (result == EXCEPTION) {
+    // An aborted stream unwinds the traversal without an exception.
+    if (writer.aborted() && !isolate_->has_pending_exception()) {
+      return Just(false);
+    }
+    return Nothing<bool>();
+  }
+  // The builder hands its last part to the writer and cannot overflow.
+  builder_.Finish().ToHandleChecked();
+  return Just(writer.Finish());
+}
+
 bool JsonStringifier::InitializeReplacer(Handle<Object> replacer) {
   DCHECK(property_list_.is_null());
   DCHECK(replacer_function_.is_null());
@@ -379,6 +517,8 @@ JsonStringifier::Result JsonStringifier::StackPush(Handle<Object> object,
     isolate_->StackOverflow();
     return EXCEPTION;
   }
+  // Stop traversing once the embedder no longer wants the output.
+  if (stream_writer_ != nullptr && stream_writer_->aborted()) return EXCEPTION;
 
   {
     DisallowHeapAllocation no_allocation;
@@ -5,6 +5,7 @@
 #ifndef V8_JSON_JSON_STRINGIFIER_H_
 #define V8_JSON_JSON_STRINGIFIER_H_
 
+#include "include/v8.h"
 #include "src/objects/objects.h"
 
 namespace v8 {
@@ -14,6 +15,12 @@ V8_WARN_UNUSED_RESULT MaybeHandle<Object> JsonStringify(Isolate* isolate,
                                                         Handle<Object> object,
                                                         Handle<Object> replacer,
                                                         Handle<Object> gap);
+
+// Serializes {object} like JsonStringify without a replacer, but writes the
+// result as UTF-8 to {stream} while the object graph is being traversed.
+V8_WARN_UNUSED_RESULT Maybe<bool> JsonStringifyToStream(
+    Isolate* isolate, Handle<Object> object, Handle<Object> gap,
+    v8::JSON::OutputStream* stream);
 }  // namespace internal
 }  // namespace v8
 
@@ -15,6 +15,7 @@
 #include "src/base/platform/time.h"
 #include "src/base/sys-info.h"
 #include "src/libplatform/default-foreground-task-runner.h"
+#include "src/libplatform/default-job.h"
 #include "src/libplatform/default-worker-threads-task-runner.h"
 
 namespace v8 {
@@ -64,6 +65,13 @@ void SetTracingController(
       std::unique_ptr<v8::TracingController>(tracing_controller));
 }
 
+std::unique_ptr<v8::JobHandle> NewDefaultJobHandle(
+    v8::Platform* platform, v8::TaskPriority priority,
+    std::unique_ptr<v8::JobTask> job_task, size_t num_worker_threads) {
+  return std::make_unique<DefaultJobHandle>(std::make_shared<DefaultJobState>(
+      platform, std::move(job_task), priority, num_worker_threads));
+}
+
 const int DefaultPlatform::kMaxThreadPoolSize = 8;
 
 DefaultPlatform::DefaultPlatform(
@@ -188,6 +196,31 @@ void DefaultPlatform::CallOnWorkerThread(std::unique_ptr<Task> task) {
   worker_threads_task_runner_->PostTask(std::move(task));
 }
 
+void DefaultPlatform::CallBlockingTaskOnWorkerThread(
+    std::unique_ptr<Task> task) {
+  EnsureBackgroundTaskRunnerInitialized();
+  worker_threads_task_runner_->PostTaskWithPriority(
+      std::move(task), DefaultWorkerThreadsTaskRunner::Priority::kUserBlocking);
+}
+
+void DefaultPlatform::CallLowPriorityTaskOnWorkerThread(
+    std::unique_ptr<Task> task) {
+  EnsureBackgroundTaskRunnerInitialized();
+  worker_threads_task_runner_->PostTaskWithPriority(
+      std::move(task), DefaultWorkerThreadsTaskRunner::Priority::kBestEffort);
+}
+
+std::unique_ptr<JobHandle> DefaultPlatform::PostJob(
+    TaskPriority priority, std::unique_ptr<JobTask> job_task) {
+  size_t num_worker_threads = NumberOfWorkerThreads();
+  // Best effort jobs must not take over the whole pool.
+  if (priority == TaskPriority::kBestEffort && num_worker_threads > 2) {
+    num_worker_threads = 2;
+  }
+  return NewDefaultJobHandle(this, priority, std::move(job_task),
+                             num_worker_threads);
+}
+
 void DefaultPlatform::CallDelayedOnWorkerThread(std::unique_ptr<Task> task,
                                                 double delay_in_seconds) {
   EnsureBackgroundTaskRunnerInitialized();
@@ -4,16 +4,24 @@
 
 #include "src/libplatform/default-worker-threads-task-runner.h"
 
-#include "src/libplatform/delayed-task-queue.h"
+#include <limits>
+
+#include "src/base/logging.h"
+#include "src/base/platform/time.h"
 
 namespace v8 {
 namespace platform {
 
 DefaultWorkerThreadsTaskRunner::DefaultWorkerThreadsTaskRunner(
     uint32_t thread_pool_size, TimeFunction time_function)
-    : queue_(time_function), time_function_(time_function) {
+    : time_function_(time_function) {
+  DCHECK_LT(0, thread_pool_size);
+  // The queues have to exist before the first worker starts looking for work.
+  for (uint32_t i = 0; i < thread_pool_size; ++i) {
+    queues_.push_back(std::make_unique<WorkerQueue>());
+  }
   for (uint32_t i = 0; i < thread_pool_size; ++i) {
-    thread_pool_.push_back(std::make_unique<WorkerThread>(this));
+    thread_pool_.push_back(std::make_unique<WorkerThread>(this, i));
   }
 }
 
@@ -25,23 +33,41 @@ double DefaultWorkerThreadsTaskRunner::MonotonicallyIncreasingTime() {
 
 void DefaultWorkerThreadsTaskRunner::Terminate() {
   base::MutexGuard guard(&lock_);
-  terminated_ = true;
-  queue_.Terminate();
+  {
+    base::MutexGuard idle_guard(&idle_lock_);
+    terminated_ = true;
+    idle_condition_var_.NotifyAll();
+  }
   // Clearing the thread pool lets all worker threads join.
   thread_pool_.clear();
 }
 
-void DefaultWorkerThreadsTaskRunner::PostTask(std::unique_ptr<Task> task) {
-  base::MutexGuard guard(&lock_);
+void DefaultWorkerThreadsTaskRunner::PostTaskWithPriority(
+    std::unique_ptr<Task> task, Priority priority) {
   if (terminated_) return;
-  queue_.Append(std::move(task));
+  size_t index = next_queue_.fetch_add(1, std::memory_order_relaxed) %
+                 queues_.size();
+  Enqueue(index, std::move(task), priority);
+  NotifyIdleWorker();
+}
+
+void DefaultWorkerThreadsTaskRunner::PostTask(std::unique_ptr<Task> task) {
+  PostTaskWithPriority(std::move(task), Priority::kUserVisible);
 }
 
 void DefaultWorkerThreadsTaskRunner::PostDelayedTask(std::unique_ptr<Task> task,
                                                      double delay_in_seconds) {
-  base::MutexGuard guard(&lock_);
+  DCHECK_GE(delay_in_seconds, 0.0);
   if (terminated_) return;
-  queue_.AppendDelayed(std::move(task), delay_in_seconds);
+  double deadline = MonotonicallyIncreasingTime() + delay_in_seconds;
+  {
+    base::MutexGuard guard(&delayed_lock_);
+    delayed_tasks_.emplace(deadline, std::move(task));
+    delayed_task_count_++;
+    delayed_task_epoch_++;
+  }
+  // An idle worker has to recompute how long to sleep.
+  NotifyIdleWorker();
 }
 
 void DefaultWorkerThreadsTaskRunner::PostIdleTask(
@@ -55,21 +81,124 @@ bool DefaultWorkerThreadsTaskRunner::IdleTasksEnabled() {
   return false;
 }
 
-std::unique_ptr<Task> DefaultWorkerThreadsTaskRunner::GetNext() {
-  return queue_.GetNext();
+void DefaultWorkerThreadsTaskRunner::Enqueue(size_t index,
+                                             std::unique_ptr<Task> task,
+                                             Priority priority) {
+  int lane = static_cast<int>(priority);
+  WorkerQueue* queue = queues_[index].get();
+  base::MutexGuard guard(&queue->lock);
+  queue->lanes[lane].push_back(std::move(task));
+  // The counters are updated while holding the lock so that they never drop
+  // below the number of tasks in the queues.
+  queue->size++;
+  lane_sizes_[lane]++;
+  pending_tasks_++;
+}
+
+void DefaultWorkerThreadsTaskRunner::NotifyIdleWorker() {
+  // Pairs with the checks of |pending_tasks_| and |delayed_task_epoch_| after
+  // incrementing |idle_workers_| in GetNext(). All are sequentially
+  // consistent, so either the worker sees the new task or we see the worker
+  // and wake it up.
+  if (idle_workers_ == 0) return;
+  base::MutexGuard guard(&idle_lock_);
+  idle_condition_var_.NotifyOne();
+}
+
+std::unique_ptr<Task> DefaultWorkerThreadsTaskRunner::TakeTask(size_t index) {
+  const size_t num_queues = queues_.size();
+  for (int lane = 0; lane < kNumberOfPriorities; ++lane) {
+    if (lane_sizes_[lane].load(std::memory_order_relaxed) == 0) continue;
+    // Start with the worker's own queue, then steal from the others.
+    for (size_t i = 0; i < num_queues; ++i) {
+      WorkerQueue* queue = queues_[(index + i) % num_queues].get();
+      if (queue->size.load(std::memory_order_relaxed) == 0) continue;
+      base::MutexGuard guard(&queue->lock);
+      std::deque<std::unique_ptr<Task>>& tasks = queue->lanes[lane];
+      if (tasks.empty()) continue;
+      std::unique_ptr<Task> task;
+      if (i == 0) {
+        // Run own tasks in the order in which they were posted.
+        task = std::move(tasks.front());
+        tasks.pop_front();
+      } else {
+        task = std::move(tasks.back());
+        tasks.pop_back();
+      }
+      queue->size--;
+      lane_sizes_[lane]--;
+      pending_tasks_--;
+      return task;
+    }
+  }
+  return nullptr;
+}
+
+double DefaultWorkerThreadsTaskRunner::PromoteDueDelayedTasks(size_t index) {
+  constexpr double kNoDeadline = std::numeric_limits<double>::infinity();
+  if (delayed_task_count_ == 0) return kNoDeadline;
+  double now = MonotonicallyIncreasingTime();
+  base::MutexGuard guard(&delayed_lock_);
+  for (auto it = delayed_tasks_.begin(); it != delayed_tasks_.end();) {
+    if (it->first > now) return it->first;
+    Enqueue(index, std::move(it->second), Priority::kUserVisible);
+    it = delayed_tasks_.erase(it);
+    delayed_task_count_--;
+  }
+  return kNoDeadline;
+}
+
+std::unique_ptr<Task> DefaultWorkerThreadsTaskRunner::GetNext(size_t index) {
+  for (;;) {
+    // Tasks that were posted before the runner was terminated still run, so
+    // only give up once the queues are drained. Delayed tasks are dropped.
+    bool terminated = terminated_;
+    size_t delayed_task_epoch = delayed_task_epoch_;
+    double next_deadline = terminated ? std::numeric_limits<double>::infinity()
+                                      : PromoteDueDelayedTasks(index);
+    if (std::unique_ptr<Task> task = TakeTask(index)) return task;
+    if (terminated) return nullptr;
+
+    base::MutexGuard guard(&idle_lock_);
+    idle_workers_++;
+    // Only sleep if no task was posted since we last looked. A newly posted
+    // delayed task might be due before |next_deadline|.
+    if (!terminated_ && pending_tasks_ == 0 &&
+        delayed_task_epoch == delayed_task_epoch_) {
+      if (next_deadline == std::numeric_limits<double>::infinity()) {
+        idle_condition_var_.Wait(&idle_lock_);
+      } else {
+        // Wait for the next delayed task or a newly posted task. WaitFor
+        // doesn't care about a fake time function and waits the 'real' amount
+        // of time.
+        double wait_in_seconds =
+            next_deadline - MonotonicallyIncreasingTime();
+        if (wait_in_seconds > 0) {
+          bool notified = idle_condition_var_.WaitFor(
+              &idle_lock_,
+              base::TimeDelta::FromMicroseconds(static_cast<int64_t>(
+                  base::TimeConstants::kMicrosecondsPerSecond *
+                  wait_in_seconds)));
+          USE(notified);
+        }
+      }
+    }
+    idle_workers_--;
+  }
 }
 
 DefaultWorkerThreadsTaskRunner::WorkerThread::WorkerThread(
-    DefaultWorkerThreadsTaskRunner* runner)
+    DefaultWorkerThreadsTaskRunner* runner, size_t index)
     : Thread(Options("V8 DefaultWorkerThreadsTaskRunner WorkerThread")),
-      runner_(runner) {
+      runner_(runner),
+      index_(index) {
   CHECK(Start());
 }
 
 DefaultWorkerThreadsTaskRunner::WorkerThread::~WorkerThread() { Join(); }
 
 void DefaultWorkerThreadsTaskRunner::WorkerThread::Run() {
-  while (std::unique_ptr<Task> task = runner_->GetNext()) {
+  while (std::unique_ptr<Task> task = runner_->GetNext(index_)) {
     task->Run();
   }
 }
@@ -5,32 +5,56 @@
 #ifndef V8_LIBPLATFORM_DEFAULT_WORKER_THREADS_TASK_RUNNER_H_
 #define V8_LIBPLATFORM_DEFAULT_WORKER_THREADS_TASK_RUNNER_H_
 
+#include <atomic>
+#include <deque>
+#include <map>
 #include <memory>
 #include <vector>
 
 #include "include/libplatform/libplatform-export.h"
 #include "include/v8-platform.h"
+#include "src/base/platform/condition-variable.h"
 #include "src/base/platform/mutex.h"
 #include "src/base/platform/platform.h"
-#include "src/libplatform/delayed-task-queue.h"
 
 namespace v8 {
 namespace platform {
 
+// A pool of worker threads which schedules tasks by work stealing. Every
+// worker owns a queue with one lane per priority. Posted tasks are spread
+// over the queues round-robin, so posting threads and workers contend on
+// different locks. A worker takes the oldest task of the highest non-empty
+// priority from its own queue and otherwise steals the newest task of that
+// priority from another worker. Idle workers sleep until a task is posted or
+// the next delayed task becomes due.
 class V8_PLATFORM_EXPORT DefaultWorkerThreadsTaskRunner
     : public NON_EXPORTED_BASE(TaskRunner) {
  public:
   using TimeFunction = double (*)();
 
+  // Priority lanes, in the order in which workers pick up tasks.
+  enum class Priority {
+    kUserBlocking,  // CallBlockingTaskOnWorkerThread().
+    kUserVisible,   // CallOnWorkerThread().
+    kBestEffort,    // CallLowPriorityTaskOnWorkerThread().
+  };
+  static constexpr int kNumberOfPriorities = 3;
+
   DefaultWorkerThreadsTaskRunner(uint32_t thread_pool_size,
                                  TimeFunction time_function);
 
   ~DefaultWorkerThreadsTaskRunner() override;
 
+  // Stops accepting tasks and joins the worker threads after they have run the
+  // immediate tasks that were already posted. Pending delayed tasks are
+  // dropped.
   void Terminate();
 
   double MonotonicallyIncreasingTime();
 
+  // Posts a task to the lane of the given priority. Thread-safe.
+  void PostTaskWithPriority(std::unique_ptr<Task> task, Priority priority);
+
   // v8::TaskRunner implementation.
   void PostTask(std::unique_ptr<Task> task) override;
 
@@ -44,7 +68,7 @@ class V8_PLATFORM_EXPORT DefaultWorkerThreadsTaskRunner
  private:
   class WorkerThread : public base::Thread {
    public:
-    explicit WorkerThread(DefaultWorkerThreadsTaskRunner* runner);
+    WorkerThread(DefaultWorkerThreadsTaskRunner* runner, size_t index);
     ~WorkerThread() override;
 
     // This thread attempts to get tasks in a loop from |runner_| and run them.
@@ -52,17 +76,57 @@ class V8_PLATFORM_EXPORT DefaultWorkerThreadsTaskRunner
 
    private:
     DefaultWorkerThreadsTaskRunner* runner_;
+    const size_t index_;
 
     DISALLOW_COPY_AND_ASSIGN(WorkerThread);
   };
 
-  // Called by the WorkerThread. Gets the next take (delayed or immediate) to be
-  // executed. Blocks if no task is available.
-  std::unique_ptr<Task> GetNext();
+  // The tasks owned by one worker thread.
+  struct WorkerQueue {
+    base::Mutex lock;
+    std::deque<std::unique_ptr<Task>> lanes[kNumberOfPriorities];
+    // Number of tasks in all lanes, readable without holding |lock|.
+    std::atomic<size_t> size{0};
+  };
+
+  // Called by the WorkerThread with the given |index|. Gets the next task
+  // (delayed or immediate) to be executed. Blocks if no task is available.
+  // Returns nullptr once the runner is terminated and no immediate tasks are
+  // left.
+  std::unique_ptr<Task> GetNext(size_t index);
+
+  // Takes a task from the queue of worker |index| or steals one from another
+  // worker. Returns nullptr if there are no immediate tasks.
+  std::unique_ptr<Task> TakeTask(size_t index);
+
+  void Enqueue(size_t index, std::unique_ptr<Task> task, Priority priority);
 
-  bool terminated_ = false;
+  // Moves delayed tasks whose deadline has passed into the queue of worker
+  // |index|. Returns the deadline of the next delayed task, or infinity.
+  double PromoteDueDelayedTasks(size_t index);
+
+  // Wakes up an idle worker, if any.
+  void NotifyIdleWorker();
+
+  std::atomic<bool> terminated_{false};
   base::Mutex lock_;
-  DelayedTaskQueue queue_;
+  std::vector<std::unique_ptr<WorkerQueue>> queues_;
+  std::atomic<size_t> next_queue_{0};
+
+  // Number of immediate tasks in all queues, per lane and in total.
+  std::atomic<size_t> lane_sizes_[kNumberOfPriorities] = {};
+  std::atomic<size_t> pending_tasks_{0};
+
+  base::Mutex delayed_lock_;
+  std::multimap<double, std::unique_ptr<Task>> delayed_tasks_;
+  std::atomic<size_t> delayed_task_count_{0};
+  // Incremented whenever a delayed task is posted.
+  std::atomic<size_t> delayed_task_epoch_{0};
+
+  base::Mutex idle_lock_;
+  base::ConditionVariable idle_condition_var_;
+  std::atomic<int> idle_workers_{0};
+
   std::vector<std::unique_ptr<WorkerThread>> thread_pool_;
   TimeFunction time_function_;
 };
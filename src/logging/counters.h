@@ -775,6 +775,7 @@ class RuntimeCallTimer final {
   V(FinalizationGroup_Cleanup)                             \
   V(JSON_Parse)                                            \
   V(JSON_Stringify)                                        \
+  V(JSON_StringifyToStream)                                \
   V(Map_AsArray)                                           \
   V(Map_Clear)                                             \
   V(Map_Delete)                                            \
@@ -1050,6 +1051,8 @@ class RuntimeCallTimer final {
   V(PrototypeObject_DeleteProperty)            \
   V(ReconfigureToDataProperty)                 \
   V(StringLengthGetter)                        \
+  V(StubCacheGrow)                             \
+  V(StubCacheMiss)                             \
   V(TestCounter1)                              \
   V(TestCounter2)                              \
   V(TestCounter3)
@@ -78,6 +78,8 @@ static const char* ComputeMarker(SharedFunctionInfo shared, AbstractCode code) {
       return shared.optimization_disabled() ? "" : "~";
     case AbstractCode::OPTIMIZED_FUNCTION:
       return "*";
+    case AbstractCode::BASELINE:
+      return "^";
     default:
       return "";
   }
@@ -2077,6 +2079,10 @@ void ExistingCodeLogger::LogCodeObject(Object object) {
       description = "A C to Wasm entry stub";
       tag = CodeEventListener::STUB_TAG;
       break;
+    case AbstractCode::BASELINE:
+      description = "Baseline code";
+      tag = CodeEventListener::FUNCTION_TAG;
+      break;
     case AbstractCode::NUMBER_OF_KINDS:
       UNIMPLEMENTED();
   }
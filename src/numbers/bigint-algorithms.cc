@@ -0,0 +1,867 @@
+// Copyright 2020 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "src/numbers/bigint-algorithms.h"
+
+#include <limits>
+
+#include "src/base/bits.h"
+#include "src/numbers/bigint-algorithms-inl.h"
+
+namespace v8 {
+namespace internal {
+namespace bigint {
+
+namespace {
+
+// Basic operations. Unless noted otherwise, they write all digits of their
+// result {Z}, reading operands as zero-extended, and {Z} may be the same as
+// an operand.
+
+void Copy(RWDigits Z, Digits X) {
+  for (int i = 0; i < Z.len(); i++) Z[i] = X[i];
+}
+
+// Z := X + Y. Returns the carry.
+digit_t AddAndReturnCarry(RWDigits Z, Digits X, Digits Y) {
+  digit_t carry = 0;
+  for (int i = 0; i < Z.len(); i++) {
+    digit_t new_carry = 0;
+    digit_t sum = digit_add(X[i], Y[i], &new_carry);
+    Z[i] = digit_add(sum, carry, &new_carry);
+    carry = new_carry;
+  }
+  return carry;
+}
+
+// Z := X - Y. Returns the borrow.
+digit_t SubtractAndReturnBorrow(RWDigits Z, Digits X, Digits Y) {
+  digit_t borrow = 0;
+  for (int i = 0; i < Z.len(); i++) {
+    digit_t new_borrow = 0;
+    digit_t difference = digit_sub(X[i], Y[i], &new_borrow);
+    Z[i] = digit_sub(difference, borrow, &new_borrow);
+    borrow = new_borrow;
+  }
+  return borrow;
+}
+
+// Z += X. Digits of {X} beyond {Z}'s length must be zero. Returns the carry.
+digit_t AddInPlace(RWDigits Z, Digits X) {
+  X.Normalize();
+  DCHECK_LE(X.len(), Z.len());
+  digit_t carry = 0;
+  int i = 0;
+  for (; i < X.len(); i++) {
+    digit_t new_carry = 0;
+    digit_t sum = digit_add(Z[i], X[i], &new_carry);
+    Z[i] = digit_add(sum, carry, &new_carry);
+    carry = new_carry;
+  }
+  for (; carry != 0 && i < Z.len(); i++) {
+    Z[i]++;
+    carry = Z[i] == 0 ? 1 : 0;
+  }
+  return carry;
+}
+
+// Z -= 1. Returns the borrow.
+digit_t DecrementInPlace(RWDigits Z) {
+  for (int i = 0; i < Z.len(); i++) {
+    if (Z[i]-- != 0) return 0;
+  }
+  return 1;
+}
+
+// Returns the sign of X - Y.
+int Compare(Digits X, Digits Y) {
+  X.Normalize();
+  Y.Normalize();
+  int diff = X.len() - Y.len();
+  if (diff != 0) return diff;
+  int i = X.len() - 1;
+  while (i >= 0 && X[i] == Y[i]) i--;
+  if (i < 0) return 0;
+  return X[i] > Y[i] ? 1 : -1;
+}
+
+// Z := |X - Y|. Returns whether X < Y.
+bool AbsoluteDifference(RWDigits Z, Digits X, Digits Y) {
+  if (Compare(X, Y) >= 0) {
+    SubtractAndReturnBorrow(Z, X, Y);
+    return false;
+  }
+  SubtractAndReturnBorrow(Z, Y, X);
+  return true;
+}
+
+// Z := X << shift, for 0 <= shift < kDigitBits.
+void LeftShift(RWDigits Z, Digits X, int shift) {
+  DCHECK(0 <= shift && shift < kDigitBits);
+  if (shift == 0) return Copy(Z, X);
+  digit_t carry = 0;
+  for (int i = 0; i < Z.len(); i++) {
+    digit_t d = X[i];
+    Z[i] = (d << shift) | carry;
+    carry = d >> (kDigitBits - shift);
+  }
+}
+
+// Z := X >> shift, for 0 <= shift < kDigitBits.
+void RightShift(RWDigits Z, Digits X, int shift) {
+  DCHECK(0 <= shift && shift < kDigitBits);
+  if (shift == 0) return Copy(Z, X);
+  for (int i = 0; i < Z.len(); i++) {
+    Z[i] = (X[i] >> shift) | (X[i + 1] << (kDigitBits - shift));
+  }
+}
+
+// Z := X * y. {Z} must have at least X.len() + 1 digits.
+void MultiplySingle(RWDigits Z, Digits X, digit_t y) {
+  DCHECK_GT(Z.len(), X.len());
+  digit_t carry = 0;
+  int i = 0;
+  for (; i < X.len(); i++) {
+    digit_t high;
+    digit_t low = digit_mul(X[i], y, &high);
+    digit_t new_carry = 0;
+    Z[i] = digit_add(low, carry, &new_carry);
+    carry = high + new_carry;
+  }
+  Z[i++] = carry;
+  for (; i < Z.len(); i++) Z[i] = 0;
+}
+
+// Q := A / b. Returns the remainder.
+digit_t DivideSingle(RWDigits Q, Digits A, digit_t b) {
+  DCHECK_NE(b, 0);
+  digit_t remainder = 0;
+  for (int i = A.len() - 1; i >= 0; i--) {
+    digit_t q = digit_div(remainder, A[i], b, &remainder);
+    if (i < Q.len()) {
+      Q[i] = q;
+    } else {
+      DCHECK_EQ(q, 0);
+    }
+  }
+  for (int i = A.len(); i < Q.len(); i++) Q[i] = 0;
+  return remainder;
+}
+
+// Returns whether (factor1 * factor2) > (high << kDigitBits) + low.
+bool ProductGreaterThan(digit_t factor1, digit_t factor2, digit_t high,
+                        digit_t low) {
+  digit_t result_high;
+  digit_t result_low = digit_mul(factor1, factor2, &result_high);
+  return result_high > high || (result_high == high && result_low > low);
+}
+
+// Multiplication.
+
+void MultiplySchoolbook(Processor* processor, RWDigits Z, Digits X, Digits Y) {
+  DCHECK_GE(Z.len(), X.len() + Y.len());
+  Z.Clear();
+  for (int i = 0; i < X.len(); i++) {
+    digit_t x = X[i];
+    if (x == 0) continue;
+    digit_t carry = 0;
+    for (int j = 0; j < Y.len(); j++) {
+      digit_t high;
+      digit_t low = digit_mul(x, Y[j], &high);
+      digit_t new_carry = 0;
+      digit_t sum = digit_add(Z[i + j], low, &new_carry);
+      Z[i + j] = digit_add(sum, carry, &new_carry);
+      // Cannot overflow: x * y + z + carry < kDigitBase ** 2.
+      carry = high + new_carry;
+    }
+    Z[i + Y.len()] = carry;
+  }
+  processor->AddWorkEstimate(static_cast<uintptr_t>(X.len()) * Y.len());
+}
+
+// Scratch space needed by {KaratsubaMain} for operands of length {n}.
+int KaratsubaScratchLength(int n) {
+  int result = 0;
+  while (n >= kKaratsubaThreshold) {
+    n = (n + 1) / 2;
+    result += 4 * n + 1;
+  }
+  return result;
+}
+
+// Z := X * Y, treating both {X} and {Y} as {n} digits long and writing the
+// first 2 * {n} digits of {Z}.
+void KaratsubaMain(Processor* processor, RWDigits Z, Digits X, Digits Y,
+                   RWDigits scratch, int n) {
+  if (processor->terminated()) return;
+  if (n < kKaratsubaThreshold) {
+    X.Normalize();
+    Y.Normalize();
+    RWDigits product(Z, 0, 2 * n);
+    if (X.len() >= Y.len()) {
+      MultiplySchoolbook(processor, product, X, Y);
+    } else {
+      MultiplySchoolbook(processor, product, Y, X);
+    }
+    return;
+  }
+  // With X = X1 * b^k + X0 and Y = Y1 * b^k + Y0 (b being the digit base):
+  // X * Y = X1 * Y1 * b^2k + (X0 * Y1 + X1 * Y0) * b^k + X0 * Y0, and
+  // X0 * Y1 + X1 * Y0 = X0 * Y0 + X1 * Y1 - (X0 - X1) * (Y0 - Y1).
+  int k = (n + 1) / 2;
+  Digits X0(X, 0, k);
+  Digits X1(X, k, n - k);
+  Digits Y0(Y, 0, k);
+  Digits Y1(Y, k, n - k);
+  RWDigits P0(Z, 0, 2 * k);
+  RWDigits P2(Z, 2 * k, 2 * (n - k));
+  KaratsubaMain(processor, P0, X0, Y0, scratch, k);
+  KaratsubaMain(processor, P2, X1, Y1, scratch, n - k);
+
+  RWDigits x_diff(scratch, 0, k);
+  RWDigits y_diff(scratch, k, k);
+  bool x_negative = AbsoluteDifference(x_diff, X0, X1);
+  bool y_negative = AbsoluteDifference(y_diff, Y0, Y1);
+  // One more digit than the product needs, to hold the middle term.
+  RWDigits P1(scratch, 2 * k, 2 * k + 1);
+  RWDigits rest(scratch, 4 * k + 1, scratch.len() - (4 * k + 1));
+  KaratsubaMain(processor, P1, x_diff, y_diff, rest, k);
+  if (processor->terminated()) return;
+  P1[2 * k] = 0;
+
+  // The middle term fits into {P1}, so intermediate over- and underflows
+  // cancel out.
+  if (x_negative == y_negative) {
+    SubtractAndReturnBorrow(P1, P0, P1);
+  } else {
+    AddAndReturnCarry(P1, P0, P1);
+  }
+  AddInPlace(P1, P2);
+  digit_t carry = AddInPlace(RWDigits(Z, k, 2 * n - k), P1);
+  USE(carry);
+  DCHECK_EQ(carry, 0);
+}
+
+// Z := X * Y for operands of equal length.
+void MultiplyKaratsuba(Processor* processor, RWDigits Z, Digits X, Digits Y) {
+  int n = X.len();
+  DCHECK_EQ(n, Y.len());
+  std::vector<digit_t> scratch(KaratsubaScratchLength(n));
+  KaratsubaMain(processor, Z, X, Y, RWDigits(&scratch), n);
+  RWDigits(Z, 2 * n, Z.len() - 2 * n).Clear();
+}
+
+// Signed intermediate values of Toom-Cook multiplication.
+struct Signed {
+  std::vector<digit_t> digits;  // The magnitude, without leading zeros.
+  bool negative = false;
+
+  Digits abs() const { return Digits(digits); }
+  void Trim() {
+    while (!digits.empty() && digits.back() == 0) digits.pop_back();
+    if (digits.empty()) negative = false;
+  }
+};
+
+Signed MakeSigned(Digits X) {
+  X.Normalize();
+  Signed result;
+  result.digits.assign(X.digits(), X.digits() + X.len());
+  return result;
+}
+
+// Returns X + Y, or X - Y if {subtract}.
+Signed SignedAdd(const Signed& X, const Signed& Y, bool subtract = false) {
+  bool y_negative = Y.negative != subtract;
+  Signed result;
+  result.digits.resize(std::max(X.digits.size(), Y.digits.size()) + 1);
+  RWDigits Z(&result.digits);
+  if (X.negative == y_negative) {
+    AddAndReturnCarry(Z, X.abs(), Y.abs());
+    result.negative = X.negative;
+  } else {
+    bool x_smaller = AbsoluteDifference(Z, X.abs(), Y.abs());
+    result.negative = x_smaller ? y_negative : X.negative;
+  }
+  result.Trim();
+  return result;
+}
+
+Signed SignedMultiply(Processor* processor, const Signed& X, const Signed& Y) {
+  Signed result;
+  result.digits.resize(X.digits.size() + Y.digits.size());
+  Multiply(processor, RWDigits(&result.digits), X.abs(), Y.abs());
+  result.negative = X.negative != Y.negative;
+  result.Trim();
+  return result;
+}
+
+Signed SignedTimesTwo(const Signed& X) {
+  Signed result;
+  result.digits.resize(X.digits.size() + 1);
+  LeftShift(RWDigits(&result.digits), X.abs(), 1);
+  result.negative = X.negative;
+  result.Trim();
+  return result;
+}
+
+// The divisions are exact.
+Signed SignedDivideByTwo(const Signed& X) {
+  DCHECK(X.digits.empty() || (X.digits[0] & 1) == 0);
+  Signed result;
+  result.digits.resize(X.digits.size());
+  RightShift(RWDigits(&result.digits), X.abs(), 1);
+  result.negative = X.negative;
+  result.Trim();
+  return result;
+}
+
+Signed SignedDivideByThree(const Signed& X) {
+  Signed result;
+  result.digits.resize(X.digits.size());
+  digit_t remainder = DivideSingle(RWDigits(&result.digits), X.abs(), 3);
+  USE(remainder);
+  DCHECK_EQ(remainder, 0);
+  result.negative = X.negative;
+  result.Trim();
+  return result;
+}
+
+// Z := X * Y for operands of equal length, using Toom-Cook-3 with Bodrato's
+// evaluation points 0, 1, -1, -2, infinity and interpolation sequence.
+void MultiplyToom3(Processor* processor, RWDigits Z, Digits X, Digits Y) {
+  int n = X.len();
+  DCHECK_EQ(n, Y.len());
+  int k = (n + 2) / 3;
+  Signed x0 = MakeSigned(Digits(X, 0, k));
+  Signed x1 = MakeSigned(Digits(X, k, k));
+  Signed x2 = MakeSigned(Digits(X, 2 * k, k));
+  Signed y0 = MakeSigned(Digits(Y, 0, k));
+  Signed y1 = MakeSigned(Digits(Y, k, k));
+  Signed y2 = MakeSigned(Digits(Y, 2 * k, k));
+
+  // Evaluate X(t) = x2 * t^2 + x1 * t + x0, and Y(t) likewise.
+  Signed x_sum = SignedAdd(x0, x2);
+  Signed x_1 = SignedAdd(x_sum, x1);
+  Signed x_minus_1 = SignedAdd(x_sum, x1, true);
+  Signed x_minus_2 =
+      SignedAdd(SignedTimesTwo(SignedAdd(x_minus_1, x2)), x0, true);
+  Signed y_sum = SignedAdd(y0, y2);
+  Signed y_1 = SignedAdd(y_sum, y1);
+  Signed y_minus_1 = SignedAdd(y_sum, y1, true);
+  Signed y_minus_2 =
+      SignedAdd(SignedTimesTwo(SignedAdd(y_minus_1, y2)), y0, true);
+
+  // Multiply pointwise to evaluate the product R(t) = X(t) * Y(t).
+  Signed r_0 = SignedMultiply(processor, x0, y0);
+  Signed r_1 = SignedMultiply(processor, x_1, y_1);
+  Signed r_minus_1 = SignedMultiply(processor, x_minus_1, y_minus_1);
+  Signed r_minus_2 = SignedMultiply(processor, x_minus_2, y_minus_2);
+  Signed r_inf = SignedMultiply(processor, x2, y2);
+  if (processor->terminated()) return;
+
+  // Interpolate the coefficients r4 * t^4 + ... + r1 * t + r0 of R(t).
+  Signed r3 = SignedDivideByThree(SignedAdd(r_minus_2, r_1, true));
+  Signed r1 = SignedDivideByTwo(SignedAdd(r_1, r_minus_1, true));
+  Signed r2 = SignedAdd(r_minus_1, r_0, true);
+  r3 = SignedAdd(SignedDivideByTwo(SignedAdd(r2, r3, true)),
+                 SignedTimesTwo(r_inf));
+  r2 = SignedAdd(SignedAdd(r2, r1), r_inf, true);
+  r1 = SignedAdd(r1, r3, true);
+  DCHECK(!r1.negative && !r2.negative && !r3.negative);
+
+  // Recompose Z = R(b^k).
+  Copy(Z, r_0.abs());
+  const Signed* coefficients[] = {&r1, &r2, &r3, &r_inf};
+  for (int i = 0; i < 4; i++) {
+    int offset = (i + 1) * k;
+    digit_t carry = AddInPlace(RWDigits(Z, offset, Z.len() - offset),
+                               coefficients[i]->abs());
+    USE(carry);
+    DCHECK_EQ(carry, 0);
+  }
+}
+
+// Z := X * Y, for {X} longer than {Y}: multiplies {Y} with {Y}-sized chunks
+// of {X}, so that the balanced algorithms can be used.
+void MultiplyChunked(Processor* processor, RWDigits Z, Digits X, Digits Y) {
+  DCHECK_GT(X.len(), Y.len());
+  int chunk_length = Y.len();
+  std::vector<digit_t> product(2 * chunk_length);
+  Z.Clear();
+  for (int i = 0; i < X.len(); i += chunk_length) {
+    Multiply(processor, RWDigits(&product), Digits(X, i, chunk_length), Y);
+    if (processor->terminated()) return;
+    digit_t carry = AddInPlace(RWDigits(Z, i, Z.len() - i), Digits(product));
+    USE(carry);
+    DCHECK_EQ(carry, 0);
+  }
+}
+
+// Division.
+
+// Q := A / B, R := A % B.
+// See Knuth, Volume 2, section 4.3.1, Algorithm D.
+void DivideSchoolbook(Processor* processor, RWDigits Q, RWDigits R, Digits A,
+                      Digits B) {
+  A.Normalize();
+  B.Normalize();
+  DCHECK_GE(B.len(), 2);
+  if (A.len() < B.len()) {
+    Q.Clear();
+    Copy(R, A);
+    return;
+  }
+  // The unusual variable names inside this function are consistent with
+  // Knuth's book, as well as with Go's implementation of this algorithm.
+  int n = B.len();
+  int m = A.len() - n;
+
+  // D1.
+  // Left-shift inputs so that the divisor's MSB is set.
+  int shift = base::bits::CountLeadingZeros(B[n - 1]);
+  std::vector<digit_t> v_storage(n);
+  RWDigits v(&v_storage);
+  LeftShift(v, B, shift);
+  // Holds the (continuously updated) remaining part of the dividend, which
+  // eventually becomes the remainder.
+  std::vector<digit_t> u_storage(A.len() + 1);
+  RWDigits u(&u_storage);
+  LeftShift(u, A, shift);
+  // In each iteration, {qhatv} holds {v} * {current quotient digit}.
+  std::vector<digit_t> qhatv_storage(n + 1);
+  RWDigits qhatv(&qhatv_storage);
+
+  // D2.
+  digit_t vn1 = v[n - 1];
+  digit_t vn2 = v[n - 2];
+  for (int j = m; j >= 0; j--) {
+    // D3.
+    // Estimate the current iteration's quotient digit (see Knuth for details).
+    digit_t qhat = std::numeric_limits<digit_t>::max();
+    digit_t ujn = u[j + n];
+    if (ujn != vn1) {
+      digit_t rhat = 0;
+      qhat = digit_div(ujn, u[j + n - 1], vn1, &rhat);
+      digit_t ujn2 = u[j + n - 2];
+      while (ProductGreaterThan(qhat, vn2, rhat, ujn2)) {
+        qhat--;
+        digit_t prev_rhat = rhat;
+        rhat += vn1;
+        // v[n-1] >= 0, so this tests for overflow.
+        if (rhat < prev_rhat) break;
+      }
+    }
+
+    // D4.
+    // Multiply the divisor with the current quotient digit, and subtract
+    // it from the dividend. If there was "borrow", then the quotient digit
+    // was one too high, so we must correct it and undo one subtraction of
+    // the (shifted) divisor.
+    MultiplySingle(qhatv, v, qhat);
+    RWDigits uj(u, j, n + 1);
+    if (SubtractAndReturnBorrow(uj, uj, qhatv) != 0) {
+      AddAndReturnCarry(uj, uj, v);
+      qhat--;
+    }
+
+    if (j < Q.len()) {
+      Q[j] = qhat;
+    } else {
+      DCHECK(Q.len() == 0 || qhat == 0);
+    }
+
+    processor->AddWorkEstimate(n);
+    if (processor->terminated()) return;
+  }
+  for (int i = m + 1; i < Q.len(); i++) Q[i] = 0;
+  RightShift(R, Digits(u, 0, n), shift);
+}
+
+// Implements the recursive steps of the Burnikel-Ziegler algorithm, see
+// Christoph Burnikel, Joachim Ziegler: "Fast Recursive Division",
+// Max-Planck-Institut für Informatik, 1998.
+class BurnikelZieglerDivider {
+ public:
+  explicit BurnikelZieglerDivider(Processor* processor)
+      : processor_(processor) {}
+
+  // Algorithm 1: Q := A / B, R := A % B, for {A} of 2n digits and {B} of
+  // n digits with its most significant bit set, where A < B * b^n.
+  void D2n1n(RWDigits Q, RWDigits R, Digits A, Digits B);
+
+ private:
+  // Algorithm 2: Q := A / B, R := A % B, for A = [A1, A2, A3] (each n
+  // digits, A1 and A2 given together) and B of 2n digits with its most
+  // significant bit set, where A < B * b^n.
+  void D3n2n(RWDigits Q, RWDigits R, Digits A1A2, Digits A3, Digits B);
+
+  Processor* processor_;
+};
+
+void BurnikelZieglerDivider::D2n1n(RWDigits Q, RWDigits R, Digits A,
+                                   Digits B) {
+  if (processor_->terminated()) return;
+  int n = B.len();
+  DCHECK_EQ(Q.len(), n);
+  DCHECK_EQ(R.len(), n);
+  if (n % 2 != 0 || n < kBurnikelThreshold) {
+    DivideSchoolbook(processor_, Q, R, A, B);
+    return;
+  }
+  int half = n / 2;
+  // [Q1, R1] := D3n2n([A1, A2, A3], B).
+  std::vector<digit_t> r1_storage(n);
+  RWDigits R1(&r1_storage);
+  D3n2n(RWDigits(Q, half, half), R1, Digits(A, n, n), Digits(A, half, half),
+        B);
+  // [Q2, R] := D3n2n([R1, A4], B).
+  D3n2n(RWDigits(Q, 0, half), R, R1, Digits(A, 0, half), B);
+}
+
+void BurnikelZieglerDivider::D3n2n(RWDigits Q, RWDigits R, Digits A1A2,
+                                   Digits A3, Digits B) {
+  if (processor_->terminated()) return;
+  int n = B.len() / 2;
+  DCHECK_EQ(B.len(), 2 * n);
+  DCHECK_EQ(Q.len(), n);
+  DCHECK_EQ(R.len(), 2 * n);
+  Digits A1(A1A2, n, n);
+  Digits B1(B, n, n);
+  Digits B2(B, 0, n);
+  // R1 is computed into the upper half of R.
+  RWDigits R1(R, n, n);
+  digit_t r1_carry = 0;
+  if (Compare(A1, B1) < 0) {
+    // Q^ := [A1, A2] / B1, R1 := [A1, A2] % B1.
+    D2n1n(Q, R1, A1A2, B1);
+    if (processor_->terminated()) return;
+  } else {
+    // Q^ := b^n - 1, R1 := [A1, A2] - [B1, 0] + [0, B1], which is A2 + B1
+    // because A1 == B1 here.
+    DCHECK_EQ(Compare(A1, B1), 0);
+    for (int i = 0; i < n; i++) Q[i] = std::numeric_limits<digit_t>::max();
+    r1_carry = AddAndReturnCarry(R1, Digits(A1A2, 0, n), B1);
+  }
+  // D := Q^ * B2.
+  std::vector<digit_t> d_storage(2 * n);
+  RWDigits D(&d_storage);
+  Multiply(processor_, D, Q, B2);
+  if (processor_->terminated()) return;
+  // R^ := [R1, A3] - D.
+  Copy(RWDigits(R, 0, n), A3);
+  digit_t borrow = SubtractAndReturnBorrow(R, R, D);
+  // R^ is negative if the subtraction borrowed without R1 having carried.
+  // Q^ is then too large, by at most two.
+  DCHECK_LE(r1_carry, borrow);
+  while (borrow > r1_carry) {
+    DecrementInPlace(Q);
+    r1_carry += AddAndReturnCarry(R, R, B);
+  }
+}
+
+// Q := A / B, R := A % B, with blocks of B's (normalized) length.
+void DivideBurnikelZiegler(Processor* processor, RWDigits Q, RWDigits R,
+                           Digits A, Digits B) {
+  int r = A.len();
+  int s = B.len();
+  // Choose the block size n = j * m with m a power of two, such that the
+  // recursion bottoms out below kBurnikelThreshold.
+  int m = static_cast<int>(
+      base::bits::RoundUpToPowerOfTwo32(s / kBurnikelThreshold + 1));
+  int j = (s + m - 1) / m;
+  int n = j * m;
+  // Normalize B to n digits with the most significant bit set, and shift A
+  // accordingly. Shifting A by one more digit than B guarantees that its
+  // highest block is smaller than B.
+  int sigma_digits = n - s;
+  int sigma_bits = base::bits::CountLeadingZeros(B[s - 1]);
+  std::vector<digit_t> b_storage(n);
+  RWDigits B_normalized(&b_storage);
+  LeftShift(RWDigits(B_normalized, sigma_digits, s), B, sigma_bits);
+  int a_normalized_length = r + sigma_digits + 1;
+  int t = std::max((a_normalized_length + n - 1) / n, 2);
+  std::vector<digit_t> a_storage(t * n);
+  RWDigits A_normalized(&a_storage);
+  LeftShift(RWDigits(A_normalized, sigma_digits, t * n - sigma_digits), A,
+            sigma_bits);
+
+  // Divide the two highest blocks of A by B, then repeatedly the remainder
+  // together with the next block.
+  std::vector<digit_t> z_storage(2 * n);
+  RWDigits Z(&z_storage);
+  Copy(Z, Digits(A_normalized, (t - 2) * n, 2 * n));
+  std::vector<digit_t> qi_storage(n);
+  RWDigits Qi(&qi_storage);
+  std::vector<digit_t> ri_storage(n);
+  RWDigits Ri(&ri_storage);
+  BurnikelZieglerDivider divider(processor);
+  Q.Clear();
+  for (int i = t - 2; i >= 0; i--) {
+    divider.D2n1n(Qi, Ri, Z, B_normalized);
+    if (processor->terminated()) return;
+    for (int k = 0; k < n; k++) {
+      if (i * n + k < Q.len()) {
+        Q[i * n + k] = Qi[k];
+      } else {
+        DCHECK(Q.len() == 0 || Qi[k] == 0);
+      }
+    }
+    if (i > 0) {
+      Copy(RWDigits(Z, n, n), Ri);
+      Copy(RWDigits(Z, 0, n), Digits(A_normalized, (i - 1) * n, n));
+    }
+  }
+  // Undo the normalization on the remainder.
+  RightShift(R, Digits(Ri, sigma_digits, s), sigma_bits);
+}
+
+// Radix conversion.
+
+constexpr char kConversionChars[] = "0123456789abcdefghijklmnopqrstuvwxyz";
+
+// Formats numbers by recursively splitting them at powers of the radix,
+// i.e. dividing them by (radix ** chunk_chars) ** (2 ** level) for suitable
+// levels. Digits of the result are written backwards, i.e. towards the
+// beginning of the output buffer.
+class ToStringFormatter {
+ public:
+  ToStringFormatter(Processor* processor, int radix)
+      : processor_(processor), radix_(radix) {
+    // The largest power of {radix} that fits into a digit.
+    digit_t chunk_divisor = 1;
+    while (chunk_divisor <= std::numeric_limits<digit_t>::max() / radix) {
+      chunk_divisor *= radix;
+      chunk_chars_++;
+    }
+    powers_.emplace_back(1, chunk_divisor);
+  }
+
+  // Writes {X} without leading zeros to the characters before {out}, and
+  // returns the position of the first character written.
+  char* Format(char* out, Digits X);
+
+ private:
+  // Writes exactly {chunk_chars_} << {level} characters for {X}, which must
+  // be smaller than {Power(level)}.
+  char* FormatPadded(char* out, Digits X, int level);
+
+  // Formats {X} by repeated single-digit division. If {pad_chars} is not
+  // zero, writes exactly that many characters, otherwise drops leading
+  // zeros.
+  char* FormatClassic(char* out, Digits X, int pad_chars);
+
+  // Returns (radix ** chunk_chars) ** (2 ** level).
+  Digits Power(int level);
+
+  Processor* processor_;
+  int radix_;
+  int chunk_chars_ = 0;
+  std::vector<std::vector<digit_t>> powers_;
+};
+
+char* ToStringFormatter::Format(char* out, Digits X) {
+  X.Normalize();
+  if (X.len() < kToStringFastThreshold) return FormatClassic(out, X, 0);
+  // Split {X} at the largest power that is at most about half as long.
+  int level = 0;
+  while (2 * Power(level + 1).len() - 1 <= X.len()) {
+    if (processor_->terminated()) return out;
+    level++;
+  }
+  Digits divisor = Power(level);
+  std::vector<digit_t> quotient(X.len() - divisor.len() + 1);
+  std::vector<digit_t> remainder(divisor.len());
+  Divide(processor_, RWDigits(&quotient), RWDigits(&remainder), X, divisor);
+  if (processor_->terminated()) return out;
+  out = FormatPadded(out, Digits(remainder), level);
+  if (processor_->terminated()) return out;
+  return Format(out, Digits(quotient));
+}
+
+char* ToStringFormatter::FormatPadded(char* out, Digits X, int level) {
+  X.Normalize();
+  if (level == 0 || X.len() < kToStringFastThreshold) {
+    return FormatClassic(out, X, chunk_chars_ << level);
+  }
+  Digits divisor = Power(level - 1);
+  if (processor_->terminated()) return out;
+  if (X.len() < divisor.len()) {
+    out = FormatPadded(out, X, level - 1);
+    return FormatClassic(out, Digits(nullptr, 0), chunk_chars_ << (level - 1));
+  }
+  std::vector<digit_t> quotient(X.len() - divisor.len() + 1);
+  std::vector<digit_t> remainder(divisor.len());
+  Divide(processor_, RWDigits(&quotient), RWDigits(&remainder), X, divisor);
+  if (processor_->terminated()) return out;
+  out = FormatPadded(out, Digits(remainder), level - 1);
+  if (processor_->terminated()) return out;
+  return FormatPadded(out, Digits(quotient), level - 1);
+}
+
+char* ToStringFormatter::FormatClassic(char* out, Digits X, int pad_chars) {
+  char* end = out;
+  X.Normalize();
+  if (X.len() > 0) {
+    digit_t chunk_divisor = powers_[0][0];
+    std::vector<digit_t> rest(X.digits(), X.digits() + X.len());
+    int length = X.len();
+    while (length > 0) {
+      RWDigits dividend(rest.data(), length);
+      digit_t chunk = DivideSingle(dividend, dividend, chunk_divisor);
+      while (length > 0 && rest[length - 1] == 0) length--;
+      if (length == 0 && pad_chars == 0) {
+        // The most significant chunk, which gets no leading zeros.
+        do {
+          *(--out) = kConversionChars[chunk % radix_];
+          chunk /= radix_;
+        } while (chunk != 0);
+        break;
+      }
+      for (int i = 0; i < chunk_chars_; i++) {
+        *(--out) = kConversionChars[chunk % radix_];
+        chunk /= radix_;
+      }
+      processor_->AddWorkEstimate(length);
+    }
+  }
+  DCHECK(pad_chars == 0 ? out < end : end - out <= pad_chars);
+  while (end - out < pad_chars) *(--out) = '0';
+  return out;
+}
+
+Digits ToStringFormatter::Power(int level) {
+  while (static_cast<int>(powers_.size()) <= level) {
+    Digits previous(powers_.back());
+    std::vector<digit_t> square(2 * previous.len());
+    Multiply(processor_, RWDigits(&square), previous, previous);
+    while (square.back() == 0) square.pop_back();
+    powers_.push_back(std::move(square));
+  }
+  return Digits(powers_[level]);
+}
+
+// Assembles {Z} from {count} {parts}, most significant first, each of which
+// stands for a factor of {powers}[0][0] = M:
+// Z = parts[0] * M^(count - 1) + ... + parts[count - 1].
+// {powers} caches M^(2^i).
+void CombineParts(Processor* processor, RWDigits Z, const digit_t* parts,
+                  int count, std::vector<std::vector<digit_t>>* powers) {
+  DCHECK_GE(Z.len(), count);
+  digit_t multiplier = (*powers)[0][0];
+  if (count <= kFromStringLargeThreshold) {
+    Z.Clear();
+    int length = 0;
+    for (int i = 0; i < count; i++) {
+      digit_t carry = parts[i];
+      for (int j = 0; j < length; j++) {
+        digit_t high;
+        digit_t low = digit_mul(Z[j], multiplier, &high);
+        digit_t new_carry = 0;
+        Z[j] = digit_add(low, carry, &new_carry);
+        carry = high + new_carry;
+      }
+      if (carry != 0) Z[length++] = carry;
+    }
+    processor->AddWorkEstimate(static_cast<uintptr_t>(count) * length);
+    return;
+  }
+  // Split off the largest power of two of the least significant parts, so
+  // that the recursion only needs M^(2^i).
+  int level = base::bits::WhichPowerOfTwo(
+                  base::bits::RoundUpToPowerOfTwo32(count)) -
+              1;
+  int low_count = 1 << level;
+  int high_count = count - low_count;
+  while (static_cast<int>(powers->size()) <= level) {
+    Digits previous(powers->back());
+    std::vector<digit_t> square(2 * previous.len());
+    Multiply(processor, RWDigits(&square), previous, previous);
+    while (square.back() == 0) square.pop_back();
+    powers->push_back(std::move(square));
+  }
+  std::vector<digit_t> high(high_count);
+  CombineParts(processor, RWDigits(&high), parts, high_count, powers);
+  std::vector<digit_t> low(low_count);
+  CombineParts(processor, RWDigits(&low), parts + high_count, low_count,
+               powers);
+  if (processor->terminated()) return;
+  // Z := high * M^low_count + low.
+  Multiply(processor, Z, Digits(high), Digits((*powers)[level]));
+  AddInPlace(Z, Digits(low));
+}
+
+}  // namespace
+
+void Multiply(Processor* processor, RWDigits Z, Digits X, Digits Y) {
+  X.Normalize();
+  Y.Normalize();
+  if (X.len() < Y.len()) std::swap(X, Y);
+  DCHECK_GE(Z.len(), X.len() + Y.len());
+  if (Y.len() < kKaratsubaThreshold) {
+    return MultiplySchoolbook(processor, Z, X, Y);
+  }
+  if (X.len() > Y.len()) return MultiplyChunked(processor, Z, X, Y);
+  if (Y.len() < kToomThreshold) return MultiplyKaratsuba(processor, Z, X, Y);
+  return MultiplyToom3(processor, Z, X, Y);
+}
+
+void Divide(Processor* processor, RWDigits Q, RWDigits R, Digits A, Digits B) {
+  A.Normalize();
+  B.Normalize();
+  DCHECK_GE(B.len(), 2);
+  DCHECK_GE(A.len(), B.len());
+  DCHECK(Q.len() == 0 || Q.len() >= A.len() - B.len() + 1);
+  DCHECK(R.len() == 0 || R.len() >= B.len());
+  if (B.len() < kBurnikelThreshold ||
+      A.len() - B.len() < kBurnikelThreshold) {
+    return DivideSchoolbook(processor, Q, R, A, B);
+  }
+  return DivideBurnikelZiegler(processor, Q, R, A, B);
+}
+
+int ToString(Processor* processor, char* chars, int chars_length, Digits X,
+             int radix) {
+  DCHECK(2 <= radix && radix <= 36);
+  ToStringFormatter formatter(processor, radix);
+  char* end = chars + chars_length;
+  char* start = formatter.Format(end, X);
+  DCHECK_GE(start, chars);
+  return static_cast<int>(end - start);
+}
+
+void FromStringAccumulator::Add(digit_t multiplier, digit_t part) {
+  DCHECK_LT(part, multiplier);
+  digit_t high;
+  digit_mul(current_multiplier_, multiplier, &high);
+  if (high != 0) {
+    // {current_} is full.
+    DCHECK(parts_multiplier_ == 0 || parts_multiplier_ == current_multiplier_);
+    parts_multiplier_ = current_multiplier_;
+    parts_.push_back(current_);
+    current_ = 0;
+    current_multiplier_ = 1;
+  }
+  current_ = current_ * multiplier + part;
+  current_multiplier_ *= multiplier;
+}
+
+void FromStringAccumulator::Finish(Processor* processor, RWDigits Z) {
+  DCHECK_GE(Z.len(), ResultLength());
+  int count = static_cast<int>(parts_.size());
+  std::vector<digit_t> combined(count);
+  if (count > 0) {
+    std::vector<std::vector<digit_t>> powers;
+    powers.emplace_back(1, parts_multiplier_);
+    CombineParts(processor, RWDigits(&combined), parts_.data(), count,
+                 &powers);
+  }
+  // Z := combined * current_multiplier_ + current_.
+  MultiplySingle(Z, Digits(combined), current_multiplier_);
+  AddInPlace(Z, Digits(&current_, 1));
+}
+
+}  // namespace bigint
+}  // namespace internal
+}  // namespace v8
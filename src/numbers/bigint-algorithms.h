@@ -0,0 +1,189 @@
+// Copyright 2020 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#ifndef V8_NUMBERS_BIGINT_ALGORITHMS_H_
+#define V8_NUMBERS_BIGINT_ALGORITHMS_H_
+
+#include <algorithm>
+#include <functional>
+#include <vector>
+
+#include "src/base/logging.h"
+#include "src/common/globals.h"
+
+namespace v8 {
+namespace internal {
+namespace bigint {
+
+// Subquadratic algorithms for BigInt multiplication, division and radix
+// conversion. They operate on plain little-endian digit arrays outside of
+// the heap, so they can recurse and allocate scratch space freely; callers
+// copy operands out of BigInts and results back into them. For small
+// operands the quadratic algorithms are faster, so callers only use these
+// above the respective thresholds below.
+
+using digit_t = uintptr_t;
+
+static constexpr int kDigitBits = kSystemPointerSize * kBitsPerByte;
+static constexpr int kHalfDigitBits = kDigitBits / 2;
+static constexpr digit_t kHalfDigitMask = (digit_t{1} << kHalfDigitBits) - 1;
+
+// Operand lengths (in digits) above which the respective algorithm beats
+// the next simpler one. Determined empirically on x64.
+static constexpr int kKaratsubaThreshold = 34;
+static constexpr int kToomThreshold = 193;
+static constexpr int kBurnikelThreshold = 57;
+static constexpr int kToStringFastThreshold = 43;
+// Number of parts (see FromStringAccumulator) above which a parsed number
+// is assembled by divide-and-conquer.
+static constexpr int kFromStringLargeThreshold = 50;
+
+// Digit arithmetic helpers, see bigint-algorithms-inl.h.
+inline digit_t digit_add(digit_t a, digit_t b, digit_t* carry);
+inline digit_t digit_sub(digit_t a, digit_t b, digit_t* borrow);
+inline digit_t digit_mul(digit_t a, digit_t b, digit_t* high);
+inline digit_t digit_div(digit_t high, digit_t low, digit_t divisor,
+                         digit_t* remainder);
+
+// A read-only view of a digit array. Reading beyond {len()} yields zero
+// digits, which lets the recursive algorithms treat their operands as
+// zero-extended to a common length.
+class Digits {
+ public:
+  Digits(const digit_t* mem, int len) : digits_(mem), len_(len) {
+    DCHECK_GE(len, 0);
+  }
+  // The (up to) {len} digits of {src} starting at {offset}.
+  Digits(Digits src, int offset, int len)
+      : digits_(src.digits_ + offset),
+        len_(std::max(0, std::min(len, src.len_ - offset))) {}
+  explicit Digits(const std::vector<digit_t>& vector)
+      : Digits(vector.data(), static_cast<int>(vector.size())) {}
+
+  digit_t operator[](int i) const {
+    DCHECK_GE(i, 0);
+    return i < len_ ? digits_[i] : 0;
+  }
+  const digit_t* digits() const { return digits_; }
+  int len() const { return len_; }
+
+  // Drops leading zero digits.
+  void Normalize() {
+    while (len_ > 0 && digits_[len_ - 1] == 0) len_--;
+  }
+
+ private:
+  const digit_t* digits_;
+  int len_;
+};
+
+// A writable view of a digit array. Unlike {Digits}, all accesses must be
+// in bounds.
+class RWDigits {
+ public:
+  RWDigits(digit_t* mem, int len) : digits_(mem), len_(len) {
+    DCHECK_GE(len, 0);
+  }
+  // The (up to) {len} digits of {src} starting at {offset}.
+  RWDigits(RWDigits src, int offset, int len)
+      : digits_(src.digits_ + offset),
+        len_(std::max(0, std::min(len, src.len_ - offset))) {}
+  explicit RWDigits(std::vector<digit_t>* vector)
+      : RWDigits(vector->data(), static_cast<int>(vector->size())) {}
+
+  digit_t& operator[](int i) {
+    DCHECK(0 <= i && i < len_);
+    return digits_[i];
+  }
+  operator Digits() const { return Digits(digits_, len_); }
+  digit_t* digits() { return digits_; }
+  int len() const { return len_; }
+
+  void Clear() { std::fill(digits_, digits_ + len_, 0); }
+
+ private:
+  digit_t* digits_;
+  int len_;
+};
+
+// Lets the algorithms below poll their caller for interrupts. The algorithms
+// report their approximate work, and every few million units ask
+// {should_terminate} whether to give up. Once that answered true, they
+// return as soon as possible, leaving their results unspecified.
+class V8_EXPORT_PRIVATE Processor {
+ public:
+  explicit Processor(std::function<bool()> should_terminate = nullptr)
+      : should_terminate_(std::move(should_terminate)) {}
+
+  void AddWorkEstimate(uintptr_t work) {
+    work_estimate_ += work;
+    if (work_estimate_ > kWorkEstimateLimit) {
+      work_estimate_ = 0;
+      if (should_terminate_ && should_terminate_()) terminated_ = true;
+    }
+  }
+
+  bool terminated() const { return terminated_; }
+
+ private:
+  // Roughly 10-20 milliseconds of work.
+  static constexpr uintptr_t kWorkEstimateLimit = 5000000;
+
+  std::function<bool()> should_terminate_;
+  uintptr_t work_estimate_ = 0;
+  bool terminated_ = false;
+};
+
+// Z := X * Y. {Z} must have at least X.len() + Y.len() digits.
+// Uses Karatsuba's algorithm, and Toom-Cook-3 for larger operands.
+V8_EXPORT_PRIVATE void Multiply(Processor* processor, RWDigits Z, Digits X,
+                                Digits Y);
+
+// Q := A / B, R := A % B. {B} must have at least two digits and no leading
+// zero digits, and {A} at least as many digits as {B}. {Q} must have at least
+// A.len() - B.len() + 1 digits and {R} at least B.len() digits; either may
+// have zero length if the caller is not interested in it.
+// Uses the Burnikel-Ziegler algorithm for large operands.
+V8_EXPORT_PRIVATE void Divide(Processor* processor, RWDigits Q, RWDigits R,
+                              Digits A, Digits B);
+
+// Writes the representation of the non-zero {X} in the given {radix}, without
+// leading zeros, to the end of the {chars_length} characters at {chars}.
+// Returns the number of characters written. Large numbers are recursively
+// split into halves by dividing by a power of {radix}.
+V8_EXPORT_PRIVATE int ToString(Processor* processor, char* chars,
+                               int chars_length, Digits X, int radix);
+
+// Collects the parts of a number being parsed, in order to assemble it by
+// divide-and-conquer rather than by one multiply-add pass over the whole
+// result per part.
+class V8_EXPORT_PRIVATE FromStringAccumulator {
+ public:
+  // Appends {part}: value := value * {multiplier} + {part}. {multiplier} must
+  // be the same for all calls but the last.
+  void Add(digit_t multiplier, digit_t part);
+
+  // Number of digits required to hold the result.
+  int ResultLength() const { return static_cast<int>(parts_.size()) + 1; }
+
+  // Writes the accumulated value to {Z}, which must have at least
+  // {ResultLength()} digits.
+  void Finish(Processor* processor, RWDigits Z);
+
+ private:
+  // Completed parts, most significant first. All of them were accumulated
+  // from the same number of input parts, so they share the multiplier
+  // {parts_multiplier_}.
+  std::vector<digit_t> parts_;
+  digit_t parts_multiplier_ = 0;
+  // The part being collected, and the multiplier it has accumulated so far.
+  digit_t current_ = 0;
+  digit_t current_multiplier_ = 1;
+};
+
+}  // namespace bigint
+}  // namespace internal
+}  // namespace v8
+
+#endif  // V8_NUMBERS_BIGINT_ALGORITHMS_H_
@@ -7,11 +7,13 @@
 #include <limits.h>
 #include <stdarg.h>
 #include <cmath>
+#include <memory>
 
 #include "src/common/assert-scope.h"
 #include "src/execution/off-thread-isolate.h"
 #include "src/handles/handles.h"
 #include "src/heap/factory.h"
+#include "src/numbers/bigint-algorithms.h"
 #include "src/numbers/dtoa.h"
 #include "src/numbers/strtod.h"
 #include "src/objects/bigint.h"
@@ -876,6 +878,9 @@ class StringToBigIntHelper : public StringToIntHelper<LocalIsolate> {
       case State::kZero:
         return BigInt::Zero(this->isolate(), allocation_type());
       case State::kDone:
+        if (accumulator_) {
+          BigInt::InplaceFromParts(*result_, accumulator_.get());
+        }
         return BigInt::Finalize<Isolate>(result_, this->negative());
       case State::kEmpty:
       case State::kRunning:
@@ -896,10 +901,20 @@ class StringToBigIntHelper : public StringToIntHelper<LocalIsolate> {
                             kDontThrow, allocation_type());
     if (!maybe.ToHandle(&result_)) {
       this->set_state(State::kError);
+      return;
+    }
+    // Multiplying the whole result once per part takes quadratic time, so
+    // long numbers are instead assembled from their parts in the end.
+    if (result_->length() > bigint::kFromStringLargeThreshold) {
+      accumulator_.reset(new bigint::FromStringAccumulator());
     }
   }
 
   void ResultMultiplyAdd(uint32_t multiplier, uint32_t part) override {
+    if (accumulator_) {
+      accumulator_->Add(multiplier, part);
+      return;
+    }
     BigInt::InplaceMultiplyAdd(*result_, static_cast<uintptr_t>(multiplier),
                                static_cast<uintptr_t>(part));
   }
@@ -913,6 +928,7 @@ class StringToBigIntHelper : public StringToIntHelper<LocalIsolate> {
 
  private:
   Handle<FreshlyAllocatedBigInt> result_;
+  std::unique_ptr<bigint::FromStringAccumulator> accumulator_;
   Behavior behavior_;
 };
 
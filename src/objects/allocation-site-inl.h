@@ -7,6 +7,7 @@
 
 #include "src/objects/allocation-site.h"
 
+#include "src/base/bits.h"
 #include "src/heap/heap-write-barrier-inl.h"
 #include "src/objects/js-objects-inl.h"
 
@@ -149,12 +150,7 @@ int AllocationSite::memento_found_count() const {
 
 inline void AllocationSite::set_memento_found_count(int count) {
   int32_t value = pretenure_data();
-  // Verify that we can count more mementos than we can possibly find in one
-  // new space collection.
-  DCHECK((GetHeap()->MaxSemiSpaceSize() /
-          (Heap::kMinObjectSizeInTaggedWords * kTaggedSize +
-           AllocationMemento::kSize)) < MementoFoundCountBits::kMax);
-  DCHECK_LT(count, MementoFoundCountBits::kMax);
+  DCHECK_LE(count, MementoFoundCountBits::kMax);
   set_pretenure_data(MementoFoundCountBits::update(value, count));
 }
 
@@ -166,11 +162,35 @@ void AllocationSite::set_memento_create_count(int count) {
   set_pretenure_create_count(count);
 }
 
+int AllocationSite::survival_history() const {
+  return SurvivalHistoryBits::decode(pretenure_data());
+}
+
+void AllocationSite::RecordSurvival(bool high_survival) {
+  int history = ((survival_history() << 1) | (high_survival ? 1 : 0)) &
+                SurvivalHistoryBits::kMax;
+  set_pretenure_data(SurvivalHistoryBits::update(pretenure_data(), history));
+}
+
+int AllocationSite::HighSurvivalCount() const {
+  return base::bits::CountPopulation(
+      static_cast<uint32_t>(survival_history()));
+}
+
+bool AllocationSite::SurvivedRecently() const {
+  return (survival_history() & 0x3) == 0x3;
+}
+
 bool AllocationSite::IncrementMementoFoundCount(int increment) {
   if (IsZombie()) return false;
 
-  int value = memento_found_count();
-  set_memento_found_count(value + increment);
+  // With pointer compression, a semi-space larger than 256MB can hold more
+  // mementos than the counter can represent. Saturate instead of overflowing
+  // into the neighbouring bits. This can only underestimate the survival
+  // ratio of a site, which delays its pretenuring.
+  int value = memento_found_count() + increment;
+  if (value > MementoFoundCountBits::kMax) value = MementoFoundCountBits::kMax;
+  set_memento_found_count(value);
   return memento_found_count() >= kPretenureMinimumCreated;
 }
 
@@ -71,13 +71,21 @@ class AllocationSite : public Struct {
   // Unused bits 6-30.
 
   // Bitfields for pretenure_data
-  using MementoFoundCountBits = base::BitField<int, 0, 26>;
-  using PretenureDecisionBits = base::BitField<PretenureDecision, 26, 3>;
-  using DeoptDependentCodeBit = base::BitField<bool, 29, 1>;
+  using MementoFoundCountBits = base::BitField<int, 0, 24>;
+  using PretenureDecisionBits = base::BitField<PretenureDecision, 24, 3>;
+  using DeoptDependentCodeBit = base::BitField<bool, 27, 1>;
+  using SurvivalHistoryBits = base::BitField<int, 28, 4>;
   STATIC_ASSERT(PretenureDecisionBits::kMax >= kLastPretenureDecisionValue);
 
-  // Increments the mementos found counter and returns true when the first
-  // memento was found for a given allocation site.
+  // Number of high-survival scavenges among the last kSurvivalHistoryLength
+  // ones that make a site tenure before the semi-space reached its maximum
+  // capacity, see --survival-based-pretenuring.
+  static const int kSurvivalHistoryLength = SurvivalHistoryBits::kSize;
+  static const int kSurvivalHistoryTenureThreshold = 3;
+
+  // Increments the mementos found counter, saturating at
+  // MementoFoundCountBits::kMax, and returns true when the first memento was
+  // found for a given allocation site.
   inline bool IncrementMementoFoundCount(int increment = 1);
 
   inline void IncrementMementoCreateCount();
@@ -98,6 +106,16 @@ class AllocationSite : public Struct {
   inline int memento_create_count() const;
   inline void set_memento_create_count(int count);
 
+  // The survival history records, for each of the most recent scavenges that
+  // digested enough feedback for this site, whether the fraction of surviving
+  // objects reached kPretenureRatio. The most recent scavenge is in bit 0.
+  inline int survival_history() const;
+  inline void RecordSurvival(bool high_survival);
+  // Returns the number of high-survival scavenges in the history.
+  inline int HighSurvivalCount() const;
+  // Returns true if the last two recorded scavenges had high survival.
+  inline bool SurvivedRecently() const;
+
   // The pretenuring decision is made during gc, and the zombie state allows
   // us to recognize when an allocation site is just being kept alive because
   // a later traversal of new space may discover AllocationMementos that point
@@ -160,6 +160,7 @@ void BackingStore::Clear() {
     holds_shared_ptr_to_allocator_ = false;
   }
   type_specific_data_.v8_api_array_buffer_allocator = nullptr;
+  pool_.reset();
 }
 
 BackingStore::~BackingStore() {
@@ -202,12 +203,21 @@ BackingStore::~BackingStore() {
     Clear();
     return;
   }
+  if (pool_ && pool_->Release(buffer_start_, byte_capacity_)) {
+    // JSArrayBuffer backing store whose memory is recycled by the pool.
+    DCHECK(free_on_destruct_);
+    TRACE_BS("BS:pool   bs=%p mem=%p (length=%zu, capacity=%zu)\n", this,
+             buffer_start_, byte_length(), byte_capacity_);
+    Clear();
+    return;
+  }
   if (free_on_destruct_) {
     // JSArrayBuffer backing store. Deallocate through the embedder's allocator.
     auto allocator = get_v8_api_array_buffer_allocator();
     TRACE_BS("BS:free   bs=%p mem=%p (length=%zu, capacity=%zu)\n", this,
              buffer_start_, byte_length(), byte_capacity_);
-    allocator->Free(buffer_start_, byte_length_);
+    // Pooled memory was allocated with its rounded-up capacity.
+    allocator->Free(buffer_start_, pool_ ? byte_capacity_ : byte_length());
   }
   Clear();
 }
@@ -217,9 +227,27 @@ std::unique_ptr<BackingStore> BackingStore::Allocate(
     Isolate* isolate, size_t byte_length, SharedFlag shared,
     InitializedFlag initialized) {
   void* buffer_start = nullptr;
+  size_t byte_capacity = byte_length;
   auto allocator = isolate->array_buffer_allocator();
   CHECK_NOT_NULL(allocator);
-  if (byte_length != 0) {
+  const std::shared_ptr<BackingStorePool>& pool =
+      isolate->heap()->backing_store_pool();
+  bool use_pool = pool && pool->allocator() == allocator &&
+                  shared == SharedFlag::kNotShared &&
+                  BackingStorePool::IsPoolable(byte_length);
+  if (use_pool) {
+    byte_capacity = BackingStorePool::CapacityFor(byte_length);
+    buffer_start = pool->Acquire(byte_capacity);
+    if (buffer_start) {
+      isolate->counters()->backing_store_pool_hits()->Increment();
+      if (initialized == InitializedFlag::kZeroInitialized) {
+        memset(buffer_start, 0, byte_length);
+      }
+    } else {
+      isolate->counters()->backing_store_pool_misses()->Increment();
+    }
+  }
+  if (byte_length != 0 && buffer_start == nullptr) {
     auto counters = isolate->counters();
     int mb_length = static_cast<int>(byte_length / MB);
     if (mb_length > 0) {
@@ -247,7 +275,7 @@ std::unique_ptr<BackingStore> BackingStore::Allocate(
     };
 
     buffer_start = isolate->heap()->AllocateExternalBackingStore(
-        allocate_buffer, byte_length);
+        allocate_buffer, byte_capacity);
 
     if (buffer_start == nullptr) {
       // Allocation failed.
@@ -256,19 +284,20 @@ std::unique_ptr<BackingStore> BackingStore::Allocate(
     }
   }
 
-  auto result = new BackingStore(buffer_start,  // start
-                                 byte_length,   // length
-                                 byte_length,   // capacity
-                                 shared,        // shared
-                                 false,         // is_wasm_memory
-                                 true,          // free_on_destruct
-                                 false,         // has_guard_regions
-                                 false,         // custom_deleter
-                                 false);        // empty_deleter
-
-  TRACE_BS("BS:alloc  bs=%p mem=%p (length=%zu)\n", result,
-           result->buffer_start(), byte_length);
+  auto result = new BackingStore(buffer_start,   // start
+                                 byte_length,    // length
+                                 byte_capacity,  // capacity
+                                 shared,         // shared
+                                 false,          // is_wasm_memory
+                                 true,           // free_on_destruct
+                                 false,          // has_guard_regions
+                                 false,          // custom_deleter
+                                 false);         // empty_deleter
+
+  TRACE_BS("BS:alloc  bs=%p mem=%p (length=%zu, capacity=%zu)\n", result,
+           result->buffer_start(), byte_length, byte_capacity);
   result->SetAllocatorFromIsolate(isolate);
+  if (use_pool) result->pool_ = pool;
   return std::unique_ptr<BackingStore>(result);
 }
 
@@ -584,6 +613,21 @@ bool BackingStore::Reallocate(Isolate* isolate, size_t new_byte_length) {
         free_on_destruct_);
   auto allocator = get_v8_api_array_buffer_allocator();
   CHECK_EQ(isolate->array_buffer_allocator(), allocator);
+  if (pool_) {
+    // Reallocate the whole pooled capacity, whose tail may hold stale data
+    // from a previous use, and stop returning the memory to the pool.
+    DCHECK_LE(byte_length_, byte_capacity_);
+    memset(static_cast<byte*>(buffer_start_) + byte_length_, 0,
+           byte_capacity_ - byte_length_);
+    void* new_start =
+        allocator->Reallocate(buffer_start_, byte_capacity_, new_byte_length);
+    if (!new_start) return false;
+    pool_.reset();
+    buffer_start_ = new_start;
+    byte_capacity_ = new_byte_length;
+    byte_length_ = new_byte_length;
+    return true;
+  }
   CHECK_EQ(byte_length_, byte_capacity_);
   void* new_start =
       allocator->Reallocate(buffer_start_, byte_length_, new_byte_length);
@@ -611,6 +655,72 @@ SharedWasmMemoryData* BackingStore::get_shared_wasm_memory_data() {
   return shared_wasm_memory_data;
 }
 
+constexpr size_t BackingStorePool::kGranularity;
+constexpr size_t BackingStorePool::kMinByteLength;
+constexpr size_t BackingStorePool::kMaxByteLength;
+
+BackingStorePool::BackingStorePool(Isolate* isolate)
+    : max_size_(FLAG_backing_store_pool_max_size),
+      allocator_(isolate->array_buffer_allocator()),
+      allocator_shared_(isolate->array_buffer_allocator_shared()) {}
+
+BackingStorePool::~BackingStorePool() { TrimLocked(0); }
+
+void* BackingStorePool::Acquire(size_t capacity) {
+  base::MutexGuard guard(&mutex_);
+  std::vector<void*>& free_list = free_lists_[SizeClass(capacity)];
+  if (free_list.empty()) return nullptr;
+  void* buffer = free_list.back();
+  free_list.pop_back();
+  size_ -= capacity;
+  return buffer;
+}
+
+bool BackingStorePool::Release(void* buffer, size_t capacity) {
+  base::MutexGuard guard(&mutex_);
+  if (size_ + capacity > max_size_) return false;
+  free_lists_[SizeClass(capacity)].push_back(buffer);
+  size_ += capacity;
+  return true;
+}
+
+void BackingStorePool::SetMaxSize(size_t max_size) {
+  base::MutexGuard guard(&mutex_);
+  max_size_ = max_size;
+  TrimLocked(max_size);
+}
+
+void BackingStorePool::TearDown() {
+  base::MutexGuard guard(&mutex_);
+  max_size_ = 0;
+  TrimLocked(0);
+  allocator_shared_.reset();
+}
+
+size_t BackingStorePool::size() const {
+  base::MutexGuard guard(&mutex_);
+  return size_;
+}
+
+size_t BackingStorePool::max_size() const {
+  base::MutexGuard guard(&mutex_);
+  return max_size_;
+}
+
+void BackingStorePool::TrimLocked(size_t max_size) {
+  // Free the largest buffers first.
+  for (int i = kNumberOfSizeClasses - 1; i >= 0 && size_ > max_size; i--) {
+    const size_t capacity = (i + 1) * kGranularity;
+    std::vector<void*>& free_list = free_lists_[i];
+    while (!free_list.empty() && size_ > max_size) {
+      allocator_->Free(free_list.back(), capacity);
+      free_list.pop_back();
+      size_ -= capacity;
+    }
+    if (free_list.empty()) free_list.shrink_to_fit();
+  }
+}
+
 namespace {
 // Implementation details of GlobalBackingStoreRegistry.
 struct GlobalBackingStoreRegistryImpl {
@@ -6,14 +6,17 @@
 #define V8_OBJECTS_BACKING_STORE_H_
 
 #include <memory>
+#include <vector>
 
 #include "include/v8-internal.h"
 #include "include/v8.h"
+#include "src/base/platform/mutex.h"
 #include "src/handles/handles.h"
 
 namespace v8 {
 namespace internal {
 
+class BackingStorePool;
 class Isolate;
 class WasmMemoryObject;
 
@@ -41,7 +44,9 @@ class V8_EXPORT_PRIVATE BackingStore : public BackingStoreBase {
   ~BackingStore();
 
   // Allocate an array buffer backing store using the default method,
-  // which currently is the embedder-provided array buffer allocator.
+  // which currently is the embedder-provided array buffer allocator. Small
+  // non-shared backing stores are recycled through the heap's
+  // {BackingStorePool}, if there is one.
   static std::unique_ptr<BackingStore> Allocate(Isolate* isolate,
                                                 size_t byte_length,
                                                 SharedFlag shared,
@@ -82,6 +87,7 @@ class V8_EXPORT_PRIVATE BackingStore : public BackingStoreBase {
   bool is_wasm_memory() const { return is_wasm_memory_; }
   bool has_guard_regions() const { return has_guard_regions_; }
   bool free_on_destruct() const { return free_on_destruct_; }
+  bool is_pooled() const { return pool_ != nullptr; }
 
   // Attempt to grow this backing store in place.
   bool GrowWasmMemoryInPlace(Isolate* isolate, size_t delta_pages,
@@ -191,6 +197,10 @@ class V8_EXPORT_PRIVATE BackingStore : public BackingStoreBase {
     DeleterInfo deleter;
   } type_specific_data_;
 
+  // The pool that the memory of this backing store is returned to on
+  // destruction. Pooled memory is {byte_capacity_} bytes long.
+  std::shared_ptr<BackingStorePool> pool_;
+
   bool is_shared_ : 1;
   bool is_wasm_memory_ : 1;
   bool holds_shared_ptr_to_allocator_ : 1;
@@ -212,6 +222,71 @@ class V8_EXPORT_PRIVATE BackingStore : public BackingStoreBase {
   DISALLOW_COPY_AND_ASSIGN(BackingStore);
 };
 
+// Recycles the memory of short-lived, non-shared array buffers between
+// {kMinByteLength} and {kMaxByteLength} bytes. Their capacity is rounded up to
+// a multiple of {kGranularity}, and freed buffers are kept in one free list
+// per size class instead of going back to the embedder's allocator. The heap
+// limits the number of cached bytes after every mark-compact. Backing stores
+// share ownership of the pool, since they may be freed on background threads
+// and may outlive the isolate.
+class V8_EXPORT_PRIVATE BackingStorePool {
+ public:
+  static constexpr size_t kGranularity = 4 * KB;
+  static constexpr size_t kMinByteLength = 4 * KB;
+  static constexpr size_t kMaxByteLength = 64 * KB;
+
+  explicit BackingStorePool(Isolate* isolate);
+  ~BackingStorePool();
+
+  static bool IsPoolable(size_t byte_length) {
+    return byte_length >= kMinByteLength && byte_length <= kMaxByteLength;
+  }
+  static size_t CapacityFor(size_t byte_length) {
+    return RoundUp(byte_length, kGranularity);
+  }
+
+  // Returns a cached buffer of {capacity} bytes with unspecified contents, or
+  // nullptr if there is none.
+  void* Acquire(size_t capacity);
+
+  // Caches a buffer of {capacity} bytes that was allocated with {allocator()}.
+  // Returns false if the pool is full, in which case the caller frees it.
+  bool Release(void* buffer, size_t capacity);
+
+  // Frees cached buffers until at most {max_size} bytes are left, and caches
+  // at most that many bytes from now on.
+  void SetMaxSize(size_t max_size);
+
+  // Frees all cached buffers and drops the reference to the allocator. The
+  // pool caches nothing afterwards.
+  void TearDown();
+
+  v8::ArrayBuffer::Allocator* allocator() const { return allocator_; }
+  size_t size() const;
+  size_t max_size() const;
+
+ private:
+  static constexpr int kNumberOfSizeClasses = kMaxByteLength / kGranularity;
+
+  static int SizeClass(size_t capacity) {
+    DCHECK(IsAligned(capacity, kGranularity));
+    DCHECK(IsPoolable(capacity));
+    return static_cast<int>(capacity / kGranularity) - 1;
+  }
+
+  void TrimLocked(size_t max_size);
+
+  mutable base::Mutex mutex_;
+  std::vector<void*> free_lists_[kNumberOfSizeClasses];
+  size_t size_ = 0;
+  size_t max_size_;
+  v8::ArrayBuffer::Allocator* allocator_;
+  // Keeps a shared allocator alive until the pool is torn down.
+  std::shared_ptr<v8::ArrayBuffer::Allocator> allocator_shared_;
+
+  DISALLOW_COPY_AND_ASSIGN(BackingStorePool);
+};
+
 // A global, per-process mapping from buffer addresses to backing stores.
 // This is generally only used for dealing with an embedder that has not
 // migrated to the new API which should use proper pointers to manage
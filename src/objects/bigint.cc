@@ -23,6 +23,7 @@
 #include "src/execution/off-thread-isolate.h"
 #include "src/heap/factory.h"
 #include "src/heap/heap-write-barrier-inl.h"
+#include "src/numbers/bigint-algorithms-inl.h"
 #include "src/numbers/conversions.h"
 #include "src/numbers/double.h"
 #include "src/objects/heap-number-inl.h"
@@ -147,6 +148,9 @@ class MutableBigInt : public FreshlyAllocatedBigInt {
   static void InternalMultiplyAdd(BigIntBase source, digit_t factor,
                                   digit_t summand, int n, MutableBigInt result);
   void InplaceMultiplyAdd(uintptr_t factor, uintptr_t summand);
+  static bool AbsoluteMulLarge(Isolate* isolate, Handle<BigIntBase> x,
+                               Handle<BigIntBase> y,
+                               Handle<MutableBigInt> result);
 
   // Specialized helpers for Divide/Remainder.
   static void AbsoluteDivSmall(Isolate* isolate, Handle<BigIntBase> x,
@@ -156,6 +160,11 @@ class MutableBigInt : public FreshlyAllocatedBigInt {
                                Handle<BigIntBase> divisor,
                                Handle<MutableBigInt>* quotient,
                                Handle<MutableBigInt>* remainder);
+  static bool AbsoluteDivBurnikelZiegler(Isolate* isolate,
+                                         Handle<BigIntBase> dividend,
+                                         Handle<BigIntBase> divisor,
+                                         Handle<MutableBigInt>* quotient,
+                                         Handle<MutableBigInt>* remainder);
   static bool ProductGreaterThan(digit_t factor1, digit_t factor2, digit_t high,
                                  digit_t low);
   digit_t InplaceAdd(Handle<BigIntBase> summand, int start_index);
@@ -187,6 +196,14 @@ class MutableBigInt : public FreshlyAllocatedBigInt {
   static MaybeHandle<String> ToStringGeneric(Isolate* isolate,
                                              Handle<BigIntBase> x, int radix,
                                              ShouldThrow should_throw);
+  static MaybeHandle<String> ToStringLarge(Isolate* isolate,
+                                           Handle<BigIntBase> x, int radix,
+                                           int chars_required);
+
+  // Helpers for the algorithms in src/numbers/bigint-algorithms.h, which
+  // work on off-heap copies of the digits.
+  static std::vector<digit_t> CopyDigitsOut(BigIntBase x);
+  void CopyDigitsIn(const std::vector<digit_t>& digits);
 
   static double ToDouble(Handle<BigIntBase> x);
   enum Rounding { kRoundDown, kTie, kRoundUp };
@@ -517,6 +534,20 @@ MaybeHandle<BigInt> BigInt::Exponentiate(Isolate* isolate, Handle<BigInt> base,
   return result;
 }
 
+namespace {
+
+// Lets the algorithms in src/numbers/bigint-algorithms.h check for interrupt
+// requests while they run.
+std::function<bool()> InterruptCallback(Isolate* isolate) {
+  return [isolate]() {
+    StackLimitCheck interrupt_check(isolate);
+    return interrupt_check.InterruptRequested() &&
+           isolate->stack_guard()->HandleInterrupts().IsException(isolate);
+  };
+}
+
+}  // namespace
+
 MaybeHandle<BigInt> BigInt::Multiply(Isolate* isolate, Handle<BigInt> x,
                                      Handle<BigInt> y) {
   if (x->is_zero()) return x;
@@ -526,6 +557,13 @@ MaybeHandle<BigInt> BigInt::Multiply(Isolate* isolate, Handle<BigInt> x,
   if (!MutableBigInt::New(isolate, result_length).ToHandle(&result)) {
     return MaybeHandle<BigInt>();
   }
+  if (std::min(x->length(), y->length()) >= bigint::kKaratsubaThreshold) {
+    if (!MutableBigInt::AbsoluteMulLarge(isolate, x, y, result)) {
+      return MaybeHandle<BigInt>();
+    }
+    result->set_sign(x->sign() != y->sign());
+    return MutableBigInt::MakeImmutable(result);
+  }
   result->InitializeDigits(result_length);
   uintptr_t work_estimate = 0;
   for (int i = 0; i < x->length(); i++) {
@@ -1528,6 +1566,50 @@ void BigInt::InplaceMultiplyAdd(FreshlyAllocatedBigInt x, uintptr_t factor,
                                      bigint);
 }
 
+// Assembles {x} from the parts collected by {accumulator}.
+void BigInt::InplaceFromParts(FreshlyAllocatedBigInt x,
+                              bigint::FromStringAccumulator* accumulator) {
+  std::vector<digit_t> digits(accumulator->ResultLength());
+  // Parsing does not check for interrupts, so neither does this.
+  bigint::Processor processor;
+  accumulator->Finish(&processor, bigint::RWDigits(&digits));
+  MutableBigInt::cast(x).CopyDigitsIn(digits);
+}
+
+// Computes the absolute value of {x} * {y} into {result}, which must have
+// x.length() + y.length() digits, using a subquadratic algorithm.
+// Returns false if execution was terminated.
+bool MutableBigInt::AbsoluteMulLarge(Isolate* isolate, Handle<BigIntBase> x,
+                                     Handle<BigIntBase> y,
+                                     Handle<MutableBigInt> result) {
+  DCHECK_EQ(result->length(), x->length() + y->length());
+  std::vector<digit_t> x_digits = CopyDigitsOut(*x);
+  std::vector<digit_t> y_digits = CopyDigitsOut(*y);
+  std::vector<digit_t> result_digits(result->length());
+  bigint::Processor processor(InterruptCallback(isolate));
+  bigint::Multiply(&processor, bigint::RWDigits(&result_digits),
+                   bigint::Digits(x_digits), bigint::Digits(y_digits));
+  if (processor.terminated()) return false;
+  result->CopyDigitsIn(result_digits);
+  return true;
+}
+
+std::vector<BigInt::digit_t> MutableBigInt::CopyDigitsOut(BigIntBase x) {
+  std::vector<digit_t> digits(x.length());
+  for (int i = 0; i < x.length(); i++) digits[i] = x.digit(i);
+  return digits;
+}
+
+// Copies {digits} into this BigInt. Digits beyond either length must be zero.
+void MutableBigInt::CopyDigitsIn(const std::vector<digit_t>& digits) {
+  int count = std::min(length(), static_cast<int>(digits.size()));
+  for (int i = 0; i < count; i++) set_digit(i, digits[i]);
+  for (int i = count; i < length(); i++) set_digit(i, 0);
+#if DEBUG
+  for (size_t i = count; i < digits.size(); i++) DCHECK_EQ(digits[i], 0);
+#endif
+}
+
 // Divides {x} by {divisor}, returning the result in {quotient} and {remainder}.
 // Mathematically, the contract is:
 // quotient = (x - remainder) / divisor, with 0 <= remainder < divisor.
@@ -1571,6 +1653,11 @@ bool MutableBigInt::AbsoluteDivLarge(Isolate* isolate,
                                      Handle<MutableBigInt>* remainder) {
   DCHECK_GE(divisor->length(), 2);
   DCHECK(dividend->length() >= divisor->length());
+  if (divisor->length() >= bigint::kBurnikelThreshold &&
+      dividend->length() - divisor->length() >= bigint::kBurnikelThreshold) {
+    return AbsoluteDivBurnikelZiegler(isolate, dividend, divisor, quotient,
+                                      remainder);
+  }
   // The unusual variable names inside this function are consistent with
   // Knuth's book, as well as with Go's implementation of this algorithm.
   // Maintaining this consistency is probably more useful than trying to
@@ -1677,6 +1764,38 @@ bool MutableBigInt::AbsoluteDivLarge(Isolate* isolate,
   return true;
 }
 
+// Same contract as {AbsoluteDivLarge}, for large operands: uses the
+// Burnikel-Ziegler algorithm, whose running time is dominated by the
+// subquadratic multiplications it performs.
+bool MutableBigInt::AbsoluteDivBurnikelZiegler(
+    Isolate* isolate, Handle<BigIntBase> dividend, Handle<BigIntBase> divisor,
+    Handle<MutableBigInt>* quotient, Handle<MutableBigInt>* remainder) {
+  int n = divisor->length();
+  int m = dividend->length() - n;
+  Handle<MutableBigInt> q;
+  Handle<MutableBigInt> r;
+  if (quotient != nullptr) q = New(isolate, m + 1).ToHandleChecked();
+  if (remainder != nullptr) r = New(isolate, n).ToHandleChecked();
+  std::vector<digit_t> dividend_digits = CopyDigitsOut(*dividend);
+  std::vector<digit_t> divisor_digits = CopyDigitsOut(*divisor);
+  std::vector<digit_t> q_digits(quotient != nullptr ? m + 1 : 0);
+  std::vector<digit_t> r_digits(remainder != nullptr ? n : 0);
+  bigint::Processor processor(InterruptCallback(isolate));
+  bigint::Divide(&processor, bigint::RWDigits(&q_digits),
+                 bigint::RWDigits(&r_digits), bigint::Digits(dividend_digits),
+                 bigint::Digits(divisor_digits));
+  if (processor.terminated()) return false;
+  if (quotient != nullptr) {
+    q->CopyDigitsIn(q_digits);
+    *quotient = q;  // Caller will right-trim.
+  }
+  if (remainder != nullptr) {
+    r->CopyDigitsIn(r_digits);
+    *remainder = r;
+  }
+  return true;
+}
+
 // Returns whether (factor1 * factor2) > (high << kDigitBits) + low.
 bool MutableBigInt::ProductGreaterThan(digit_t factor1, digit_t factor2,
                                        digit_t high, digit_t low) {
@@ -2152,6 +2271,9 @@ MaybeHandle<String> MutableBigInt::ToStringGeneric(Isolate* isolate,
       return MaybeHandle<String>();
     }
   }
+  if (length >= bigint::kToStringFastThreshold) {
+    return ToStringLarge(isolate, x, radix, static_cast<int>(chars_required));
+  }
   Handle<SeqOneByteString> result =
       isolate->factory()
           ->NewRawOneByteString(static_cast<int>(chars_required))
@@ -2267,6 +2389,29 @@ MaybeHandle<String> MutableBigInt::ToStringGeneric(Isolate* isolate,
   return result;
 }
 
+// Converts a large {x} to a string by recursively splitting it into halves,
+// see bigint::ToString. Since that computes the exact number of characters,
+// the result string does not need to be trimmed afterwards.
+MaybeHandle<String> MutableBigInt::ToStringLarge(Isolate* isolate,
+                                                 Handle<BigIntBase> x,
+                                                 int radix,
+                                                 int chars_required) {
+  std::vector<digit_t> digits = CopyDigitsOut(*x);
+  std::vector<char> buffer(chars_required);
+  bigint::Processor processor(InterruptCallback(isolate));
+  int count = bigint::ToString(&processor, buffer.data(), chars_required,
+                               bigint::Digits(digits), radix);
+  if (processor.terminated()) return MaybeHandle<String>();
+  const bool sign = x->sign();
+  Handle<SeqOneByteString> result =
+      isolate->factory()->NewRawOneByteString(count + sign).ToHandleChecked();
+  DisallowHeapAllocation no_gc;
+  uint8_t* chars = result->GetChars(no_gc);
+  if (sign) *chars++ = '-';
+  std::copy(buffer.end() - count, buffer.end(), chars);
+  return result;
+}
+
 Handle<BigInt> BigInt::AsIntN(Isolate* isolate, uint64_t n, Handle<BigInt> x) {
   if (x->is_zero()) return x;
   if (n == 0) return MutableBigInt::Zero(isolate);
@@ -2547,154 +2692,28 @@ uint64_t BigInt::AsUint64(bool* lossless) {
   return result;
 }
 
-// Digit arithmetic helpers.
-
-#if V8_TARGET_ARCH_32_BIT
-#define HAVE_TWODIGIT_T 1
-using twodigit_t = uint64_t;
-#elif defined(__SIZEOF_INT128__)
-// Both Clang and GCC support this on x64.
-#define HAVE_TWODIGIT_T 1
-using twodigit_t = __uint128_t;
-#endif
+// Digit arithmetic helpers. These are shared with the algorithms in
+// src/numbers/bigint-algorithms.cc.
 
-// {carry} must point to an initialized digit_t and will either be incremented
-// by one or left alone.
 inline BigInt::digit_t MutableBigInt::digit_add(digit_t a, digit_t b,
                                                 digit_t* carry) {
-#if HAVE_TWODIGIT_T
-  twodigit_t result = static_cast<twodigit_t>(a) + static_cast<twodigit_t>(b);
-  *carry += result >> kDigitBits;
-  return static_cast<digit_t>(result);
-#else
-  digit_t result = a + b;
-  if (result < a) *carry += 1;
-  return result;
-#endif
+  return bigint::digit_add(a, b, carry);
 }
 
-// {borrow} must point to an initialized digit_t and will either be incremented
-// by one or left alone.
 inline BigInt::digit_t MutableBigInt::digit_sub(digit_t a, digit_t b,
                                                 digit_t* borrow) {
-#if HAVE_TWODIGIT_T
-  twodigit_t result = static_cast<twodigit_t>(a) - static_cast<twodigit_t>(b);
-  *borrow += (result >> kDigitBits) & 1;
-  return static_cast<digit_t>(result);
-#else
-  digit_t result = a - b;
-  if (result > a) *borrow += 1;
-  return static_cast<digit_t>(result);
-#endif
+  return bigint::digit_sub(a, b, borrow);
 }
 
-// Returns the low half of the result. High half is in {high}.
 inline BigInt::digit_t MutableBigInt::digit_mul(digit_t a, digit_t b,
                                                 digit_t* high) {
-#if HAVE_TWODIGIT_T
-  twodigit_t result = static_cast<twodigit_t>(a) * static_cast<twodigit_t>(b);
-  *high = result >> kDigitBits;
-  return static_cast<digit_t>(result);
-#else
-  // Multiply in half-pointer-sized chunks.
-  // For inputs [AH AL]*[BH BL], the result is:
-  //
-  //            [AL*BL]  // r_low
-  //    +    [AL*BH]     // r_mid1
-  //    +    [AH*BL]     // r_mid2
-  //    + [AH*BH]        // r_high
-  //    = [R4 R3 R2 R1]  // high = [R4 R3], low = [R2 R1]
-  //
-  // Where of course we must be careful with carries between the columns.
-  digit_t a_low = a & kHalfDigitMask;
-  digit_t a_high = a >> kHalfDigitBits;
-  digit_t b_low = b & kHalfDigitMask;
-  digit_t b_high = b >> kHalfDigitBits;
-
-  digit_t r_low = a_low * b_low;
-  digit_t r_mid1 = a_low * b_high;
-  digit_t r_mid2 = a_high * b_low;
-  digit_t r_high = a_high * b_high;
-
-  digit_t carry = 0;
-  digit_t low = digit_add(r_low, r_mid1 << kHalfDigitBits, &carry);
-  low = digit_add(low, r_mid2 << kHalfDigitBits, &carry);
-  *high =
-      (r_mid1 >> kHalfDigitBits) + (r_mid2 >> kHalfDigitBits) + r_high + carry;
-  return low;
-#endif
+  return bigint::digit_mul(a, b, high);
 }
 
-// Returns the quotient.
-// quotient = (high << kDigitBits + low - remainder) / divisor
-BigInt::digit_t MutableBigInt::digit_div(digit_t high, digit_t low,
-                                         digit_t divisor, digit_t* remainder) {
-  DCHECK(high < divisor);
-#if V8_TARGET_ARCH_X64 && (__GNUC__ || __clang__)
-  digit_t quotient;
-  digit_t rem;
-  __asm__("divq  %[divisor]"
-          // Outputs: {quotient} will be in rax, {rem} in rdx.
-          : "=a"(quotient), "=d"(rem)
-          // Inputs: put {high} into rdx, {low} into rax, and {divisor} into
-          // any register or stack slot.
-          : "d"(high), "a"(low), [divisor] "rm"(divisor));
-  *remainder = rem;
-  return quotient;
-#elif V8_TARGET_ARCH_IA32 && (__GNUC__ || __clang__)
-  digit_t quotient;
-  digit_t rem;
-  __asm__("divl  %[divisor]"
-          // Outputs: {quotient} will be in eax, {rem} in edx.
-          : "=a"(quotient), "=d"(rem)
-          // Inputs: put {high} into edx, {low} into eax, and {divisor} into
-          // any register or stack slot.
-          : "d"(high), "a"(low), [divisor] "rm"(divisor));
-  *remainder = rem;
-  return quotient;
-#else
-  static const digit_t kHalfDigitBase = 1ull << kHalfDigitBits;
-  // Adapted from Warren, Hacker's Delight, p. 152.
-  int s = base::bits::CountLeadingZeros(divisor);
-  DCHECK_NE(s, kDigitBits);  // {divisor} is not 0.
-  divisor <<= s;
-
-  digit_t vn1 = divisor >> kHalfDigitBits;
-  digit_t vn0 = divisor & kHalfDigitMask;
-  // {s} can be 0. {low >> kDigitBits} would be undefined behavior, so
-  // we mask the shift amount with {kShiftMask}, and the result with
-  // {s_zero_mask} which is 0 if s == 0 and all 1-bits otherwise.
-  STATIC_ASSERT(sizeof(intptr_t) == sizeof(digit_t));
-  const int kShiftMask = kDigitBits - 1;
-  digit_t s_zero_mask =
-      static_cast<digit_t>(static_cast<intptr_t>(-s) >> (kDigitBits - 1));
-  digit_t un32 =
-      (high << s) | ((low >> ((kDigitBits - s) & kShiftMask)) & s_zero_mask);
-  digit_t un10 = low << s;
-  digit_t un1 = un10 >> kHalfDigitBits;
-  digit_t un0 = un10 & kHalfDigitMask;
-  digit_t q1 = un32 / vn1;
-  digit_t rhat = un32 - q1 * vn1;
-
-  while (q1 >= kHalfDigitBase || q1 * vn0 > rhat * kHalfDigitBase + un1) {
-    q1--;
-    rhat += vn1;
-    if (rhat >= kHalfDigitBase) break;
-  }
-
-  digit_t un21 = un32 * kHalfDigitBase + un1 - q1 * divisor;
-  digit_t q0 = un21 / vn1;
-  rhat = un21 - q0 * vn1;
-
-  while (q0 >= kHalfDigitBase || q0 * vn0 > rhat * kHalfDigitBase + un0) {
-    q0--;
-    rhat += vn1;
-    if (rhat >= kHalfDigitBase) break;
-  }
-
-  *remainder = (un21 * kHalfDigitBase + un0 - q0 * divisor) >> s;
-  return q1 * kHalfDigitBase + q0;
-#endif
+inline BigInt::digit_t MutableBigInt::digit_div(digit_t high, digit_t low,
+                                                digit_t divisor,
+                                                digit_t* remainder) {
+  return bigint::digit_div(high, low, divisor, remainder);
 }
 
 // Raises {base} to the power of {exponent}. Does not check for overflow.
@@ -2710,8 +2729,6 @@ BigInt::digit_t MutableBigInt::digit_pow(digit_t base, digit_t exponent) {
   return result;
 }
 
-#undef HAVE_TWODIGIT_T
-
 void MutableBigInt::set_64_bits(uint64_t bits) {
   STATIC_ASSERT(kDigitBits == 64 || kDigitBits == 32);
   if (kDigitBits == 64) {
@@ -22,6 +22,10 @@ int32_t MutableBigInt_AbsoluteCompare(Address x_addr, Address y_addr);
 void MutableBigInt_AbsoluteSubAndCanonicalize(Address result_addr,
                                               Address x_addr, Address y_addr);
 
+namespace bigint {
+class FromStringAccumulator;
+}  // namespace bigint
+
 class BigInt;
 class ValueDeserializer;
 class ValueSerializer;
@@ -253,6 +257,8 @@ class BigInt : public BigIntBase {
       AllocationType allocation);
   static void InplaceMultiplyAdd(FreshlyAllocatedBigInt x, uintptr_t factor,
                                  uintptr_t summand);
+  static void InplaceFromParts(FreshlyAllocatedBigInt x,
+                               bigint::FromStringAccumulator* accumulator);
   template <typename LocalIsolate>
   static Handle<BigInt> Finalize(Handle<FreshlyAllocatedBigInt> x, bool sign);
 
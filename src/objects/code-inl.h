@@ -675,6 +675,17 @@ ACCESSORS(BytecodeArray, constant_pool, FixedArray, kConstantPoolOffset)
 ACCESSORS(BytecodeArray, handler_table, ByteArray, kHandlerTableOffset)
 ACCESSORS(BytecodeArray, source_position_table, Object,
           kSourcePositionTableOffset)
+#ifdef V8_ENABLE_BASELINE
+ACCESSORS(BytecodeArray, baseline_code, Object, kBaselineCodeOffset)
+#endif  // V8_ENABLE_BASELINE
+
+bool BytecodeArray::HasBaselineCode() const {
+#ifdef V8_ENABLE_BASELINE
+  return baseline_code().IsCode();
+#else
+  return false;
+#endif  // V8_ENABLE_BASELINE
+}
 
 void BytecodeArray::clear_padding() {
   int data_size = kHeaderSize + length();
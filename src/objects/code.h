@@ -48,7 +48,8 @@ class Code : public HeapObject {
   V(JS_TO_WASM_FUNCTION)    \
   V(JS_TO_JS_FUNCTION)      \
   V(WASM_INTERPRETER_ENTRY) \
-  V(C_WASM_ENTRY)
+  V(C_WASM_ENTRY)           \
+  V(BASELINE)
 
   enum Kind {
 #define DEFINE_CODE_KIND_ENUM(name) name,
@@ -785,6 +786,14 @@ class BytecodeArray : public FixedArrayBase {
   // positions for pre-existing bytecode).
   DECL_ACCESSORS(source_position_table, Object)
 
+#ifdef V8_ENABLE_BASELINE
+  // Accessors for the code generated by the baseline compiler. Holds undefined
+  // until the function has been compiled by the baseline tier.
+  DECL_ACCESSORS(baseline_code, Object)
+#endif  // V8_ENABLE_BASELINE
+  // Always false in builds without the baseline tier.
+  inline bool HasBaselineCode() const;
+
   // This must only be called if source position collection has already been
   // attempted. (If it failed because of an exception then it will return
   // empty_byte_array).
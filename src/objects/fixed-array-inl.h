@@ -125,6 +125,15 @@ void FixedArray::set(int index, Object value) {
   WRITE_BARRIER(*this, offset, value);
 }
 
+void FixedArray::synchronized_set(int index, Object value) {
+  DCHECK_NE(GetReadOnlyRoots().fixed_cow_array_map(), map());
+  DCHECK(IsFixedArray());
+  DCHECK_LT(static_cast<unsigned>(index), static_cast<unsigned>(length()));
+  int offset = OffsetOfElementAt(index);
+  RELEASE_WRITE_FIELD(*this, offset, value);
+  WRITE_BARRIER(*this, offset, value);
+}
+
 void FixedArray::set(int index, Object value, WriteBarrierMode mode) {
   DCHECK_NE(map(), GetReadOnlyRoots().fixed_cow_array_map());
   DCHECK_LT(static_cast<unsigned>(index), static_cast<unsigned>(length()));
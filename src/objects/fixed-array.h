@@ -131,6 +131,9 @@ class FixedArray : public FixedArrayBase {
   // Setter with explicit barrier mode.
   inline void set(int index, Object value, WriteBarrierMode mode);
 
+  // Setter with release semantics, for arrays read by other threads.
+  inline void synchronized_set(int index, Object value);
+
   // Setters for frequently used oddballs located in old space.
   inline void set_undefined(int index);
   inline void set_undefined(Isolate* isolate, int index);
@@ -17,7 +17,8 @@ namespace internal {
 // The regular expression holds a single reference to a FixedArray in
 // the kDataOffset field.
 // The FixedArray contains the following data:
-// - tag : type of regexp implementation (not compiled yet, atom or irregexp)
+// - tag : type of regexp implementation (not compiled yet, atom, irregexp or
+//   linear)
 // - reference to the original source string
 // - reference to the original flag string
 // If it is an atom regexp
@@ -35,7 +36,9 @@ class JSRegExp : public TorqueGeneratedJSRegExp<JSRegExp, JSObject> {
   // NOT_COMPILED: Initial value. No data has been stored in the JSRegExp yet.
   // ATOM: A simple string to match against using an indexOf operation.
   // IRREGEXP: Compiled with Irregexp.
-  enum Type { NOT_COMPILED, ATOM, IRREGEXP };
+  // LINEAR: Compiled for the linear-time engine. Uses the same data layout as
+  //     IRREGEXP, with the program of the engine in both bytecode slots.
+  enum Type { NOT_COMPILED, ATOM, IRREGEXP, LINEAR };
   struct FlagShiftBit {
     static constexpr int kGlobal = 0;
     static constexpr int kIgnoreCase = 1;
@@ -443,8 +443,12 @@ class ByteArray::BodyDescriptor final : public BodyDescriptorBase {
 class BytecodeArray::BodyDescriptor final : public BodyDescriptorBase {
  public:
   static bool IsValidSlot(Map map, HeapObject obj, int offset) {
+#ifdef V8_ENABLE_BASELINE
+    return offset >= kConstantPoolOffset && offset <= kBaselineCodeOffset;
+#else
     return offset >= kConstantPoolOffset &&
            offset <= kSourcePositionTableOffset;
+#endif  // V8_ENABLE_BASELINE
   }
 
   template <typename ObjectVisitor>
@@ -453,6 +457,9 @@ class BytecodeArray::BodyDescriptor final : public BodyDescriptorBase {
     IteratePointer(obj, kConstantPoolOffset, v);
     IteratePointer(obj, kHandlerTableOffset, v);
     IteratePointer(obj, kSourcePositionTableOffset, v);
+#ifdef V8_ENABLE_BASELINE
+    IteratePointer(obj, kBaselineCodeOffset, v);
+#endif  // V8_ENABLE_BASELINE
   }
 
   static inline int SizeOf(Map map, HeapObject obj) {
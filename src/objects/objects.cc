@@ -36,6 +36,7 @@
 #include "src/execution/microtask-queue.h"
 #include "src/execution/off-thread-isolate.h"
 #include "src/execution/protectors-inl.h"
+#include "src/handles/local-handles-inl.h"
 #include "src/heap/factory-inl.h"
 #include "src/heap/heap-inl.h"
 #include "src/heap/off-thread-factory-inl.h"
@@ -5683,6 +5684,7 @@ void AllocationSite::ResetPretenureDecision() {
   set_pretenure_decision(kUndecided);
   set_memento_found_count(0);
   set_memento_create_count(0);
+  set_pretenure_data(SurvivalHistoryBits::update(pretenure_data(), 0));
 }
 
 AllocationType AllocationSite::GetAllocationType() const {
@@ -6894,12 +6896,49 @@ Handle<String> StringTable::AddKeyNoResize(Isolate* isolate,
 
   // Add the new string and return it along with the string table.
   InternalIndex entry = table->FindInsertionEntry(key->hash());
-  table->set(EntryToIndex(entry), *string);
+  table->synchronized_set(EntryToIndex(entry), *string);
   table->ElementAdded();
 
   return Handle<String>::cast(string);
 }
 
+// static
+template <typename StringTableKey>
+MaybeHandle<String> StringTable::LookupKeyIfExists(Isolate* isolate,
+                                                   LocalHeap* local_heap,
+                                                   StringTableKey* key) {
+  DCHECK(FLAG_local_heaps);
+  DisallowHeapAllocation no_gc;
+  // The main thread may externalize internalized strings, which changes their
+  // layout, so don't look at them while that happens.
+  base::SharedMutexGuard<base::kShared> access_guard(
+      isolate->internalized_string_access());
+
+  // The table can be grown or shrunk while we are probing. The old table stays
+  // alive until the next GC, for which this thread has to reach a safepoint,
+  // so at worst we miss strings that were added in the meantime.
+  StringTable table = isolate->heap()->synchronized_string_table();
+  ReadOnlyRoots roots(isolate);
+  uint32_t capacity = table.Capacity();
+  uint32_t count = 1;
+  for (InternalIndex entry = FirstProbe(key->hash(), capacity);;
+       entry = NextProbe(entry, count++, capacity)) {
+    Object element =
+        table.RawFieldOfElementAt(EntryToIndex(entry)).Acquire_Load();
+    if (element == roots.undefined_value()) break;
+    if (element == roots.the_hole_value()) continue;
+    if (StringTableShape::IsMatch(key, element)) {
+      return handle(String::cast(element), local_heap);
+    }
+  }
+  return MaybeHandle<String>();
+}
+
+template MaybeHandle<String> StringTable::LookupKeyIfExists(
+    Isolate* isolate, LocalHeap* local_heap, OneByteStringKey* key);
+template MaybeHandle<String> StringTable::LookupKeyIfExists(
+    Isolate* isolate, LocalHeap* local_heap, TwoByteStringKey* key);
+
 Handle<StringTable> StringTable::CautiousShrink(Isolate* isolate,
                                                 Handle<StringTable> table) {
   // Only shrink if the table is very empty to avoid performance penalty.
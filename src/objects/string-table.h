@@ -53,6 +53,7 @@ class V8_EXPORT_PRIVATE StringTableShape : public BaseShape<StringTableKey*> {
   static const int kEntrySize = 1;
 };
 
+class LocalHeap;
 class SeqOneByteString;
 
 EXTERN_DECLARE_HASH_TABLE(StringTable, StringTableShape)
@@ -71,6 +72,16 @@ class V8_EXPORT_PRIVATE StringTable
   static Handle<String> LookupKey(Isolate* isolate, StringTableKey* key);
   static Handle<String> AddKeyNoResize(Isolate* isolate, StringTableKey* key);
 
+  // Find string in the string table without adding it. Unlike the functions
+  // above, this can be called from a background thread which owns
+  // {local_heap}, concurrently with insertions on the main thread: strings are
+  // added to the table, and grown tables are published, with release stores.
+  // Returns an empty handle if the string is not in the table.
+  template <typename StringTableKey>
+  static MaybeHandle<String> LookupKeyIfExists(Isolate* isolate,
+                                               LocalHeap* local_heap,
+                                               StringTableKey* key);
+
   // Shrink the StringTable if it's very empty (kMaxEmptyFactor) to avoid the
   // performance overhead of re-allocating the StringTable over and over again.
   static Handle<StringTable> CautiousShrink(Isolate* isolate,
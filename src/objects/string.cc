@@ -160,6 +160,12 @@ bool String::MakeExternal(v8::String::ExternalStringResource* resource) {
   Isolate* isolate = GetIsolateFromWritableObject(*this);
   bool is_internalized = this->IsInternalizedString();
   bool has_pointers = StringShape(*this).IsIndirect();
+  // Background threads may be comparing against internalized strings in the
+  // string table (see StringTable::LookupKeyIfExists).
+  base::SharedMutexGuard<base::kExclusive, base::NullBehavior::kIgnoreIfNull>
+      access_guard(is_internalized && FLAG_local_heaps
+                       ? isolate->internalized_string_access()
+                       : nullptr);
 
   if (has_pointers) {
     isolate->heap()->NotifyObjectLayoutChange(*this, no_allocation,
@@ -231,6 +237,12 @@ bool String::MakeExternal(v8::String::ExternalOneByteStringResource* resource) {
   Isolate* isolate = GetIsolateFromWritableObject(*this);
   bool is_internalized = this->IsInternalizedString();
   bool has_pointers = StringShape(*this).IsIndirect();
+  // Background threads may be comparing against internalized strings in the
+  // string table (see StringTable::LookupKeyIfExists).
+  base::SharedMutexGuard<base::kExclusive, base::NullBehavior::kIgnoreIfNull>
+      access_guard(is_internalized && FLAG_local_heaps
+                       ? isolate->internalized_string_access()
+                       : nullptr);
 
   if (has_pointers) {
     isolate->heap()->NotifyObjectLayoutChange(*this, no_allocation,
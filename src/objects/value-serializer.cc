@@ -4,8 +4,12 @@
 
 #include "src/objects/value-serializer.h"
 
+#include <algorithm>
+#include <atomic>
 #include <type_traits>
+#include <vector>
 
+#include "include/v8-platform.h"
 #include "include/v8-value-serializer-version.h"
 #include "src/api/api-inl.h"
 #include "src/base/logging.h"
@@ -14,7 +18,9 @@
 #include "src/handles/handles-inl.h"
 #include "src/handles/maybe-handles-inl.h"
 #include "src/heap/factory.h"
+#include "src/init/v8.h"
 #include "src/numbers/conversions.h"
+#include "src/objects/backing-store.h"
 #include "src/objects/heap-number-inl.h"
 #include "src/objects/js-array-inl.h"
 #include "src/objects/js-collection-inl.h"
@@ -144,6 +150,12 @@ enum class SerializationTag : uint8_t {
   kArrayBufferView = 'V',
   // Shared array buffer. transferID:uint32_t
   kSharedArrayBuffer = 'u',
+  // Array buffer and strings whose contents were handed to the delegate
+  // instead of being written to the buffer (transfer only, never persisted).
+  // backingStoreID:uint32_t
+  kOutOfBandArrayBuffer = 'X',
+  kOutOfBandOneByteString = 'O',
+  kOutOfBandTwoByteString = 'W',
   // A wasm module object transfer. next value is its index.
   kWasmModuleTransfer = 'w',
   // The delegate is responsible for processing all following data.
@@ -257,6 +269,11 @@ void ValueSerializer::SetTreatArrayBufferViewsAsHostObjects(bool mode) {
   treat_array_buffer_views_as_host_objects_ = mode;
 }
 
+void ValueSerializer::SetOutOfBandThreshold(size_t threshold_in_bytes) {
+  DCHECK_IMPLIES(threshold_in_bytes > 0, delegate_ != nullptr);
+  out_of_band_threshold_ = threshold_in_bytes;
+}
+
 void ValueSerializer::WriteTag(SerializationTag tag) {
   uint8_t raw_tag = static_cast<uint8_t>(tag);
   WriteRawBytes(&raw_tag, sizeof(raw_tag));
@@ -478,6 +495,7 @@ void ValueSerializer::WriteBigInt(BigInt bigint) {
 
 void ValueSerializer::WriteString(Handle<String> string) {
   string = String::Flatten(isolate_, string);
+  if (out_of_band_threshold_ > 0 && WriteStringOutOfBand(string)) return;
   DisallowHeapAllocation no_gc;
   String::FlatContent flat = string->GetFlatContent(no_gc);
   DCHECK(flat.IsFlat());
@@ -498,6 +516,37 @@ void ValueSerializer::WriteString(Handle<String> string) {
   }
 }
 
+bool ValueSerializer::WriteStringOutOfBand(Handle<String> string) {
+  bool is_one_byte;
+  {
+    DisallowHeapAllocation no_gc;
+    is_one_byte = string->GetFlatContent(no_gc).IsOneByte();
+  }
+  size_t byte_length =
+      static_cast<size_t>(string->length()) * (is_one_byte ? 1 : sizeof(uc16));
+  std::unique_ptr<BackingStore> backing_store =
+      NewOutOfBandBackingStore(byte_length);
+  if (!backing_store) return false;
+
+  if (is_one_byte) {
+    String::WriteToFlat(*string,
+                        static_cast<uint8_t*>(backing_store->buffer_start()),
+                        0, string->length());
+  } else {
+    String::WriteToFlat(*string,
+                        static_cast<uint16_t*>(backing_store->buffer_start()),
+                        0, string->length());
+  }
+  uint32_t id;
+  if (!GetOutOfBandBackingStoreId(std::move(backing_store)).To(&id)) {
+    return false;
+  }
+  WriteTag(is_one_byte ? SerializationTag::kOutOfBandOneByteString
+                       : SerializationTag::kOutOfBandTwoByteString);
+  WriteVarint(id);
+  return true;
+}
+
 Maybe<bool> ValueSerializer::WriteJSReceiver(Handle<JSReceiver> receiver) {
   // If the object has already been serialized, just write its ID.
   uint32_t* id_map_entry = id_map_.Get(receiver);
@@ -876,6 +925,18 @@ Maybe<bool> ValueSerializer::WriteJSArrayBuffer(
     ThrowDataCloneError(MessageTemplate::kDataCloneError, array_buffer);
     return Nothing<bool>();
   }
+  std::unique_ptr<BackingStore> backing_store =
+      NewOutOfBandBackingStore(static_cast<size_t>(byte_length));
+  if (backing_store) {
+    memcpy(backing_store->buffer_start(), array_buffer->backing_store(),
+           byte_length);
+    uint32_t id;
+    if (GetOutOfBandBackingStoreId(std::move(backing_store)).To(&id)) {
+      WriteTag(SerializationTag::kOutOfBandArrayBuffer);
+      WriteVarint(id);
+      return ThrowIfOutOfMemory();
+    }
+  }
   WriteTag(SerializationTag::kArrayBuffer);
   WriteVarint<uint32_t>(byte_length);
   WriteRawBytes(array_buffer->backing_store(), byte_length);
@@ -1017,6 +1078,26 @@ Maybe<bool> ValueSerializer::WriteHostObject(Handle<JSObject> object) {
   return ThrowIfOutOfMemory();
 }
 
+std::unique_ptr<BackingStore> ValueSerializer::NewOutOfBandBackingStore(
+    size_t byte_length) {
+  if (out_of_band_threshold_ == 0 || byte_length < out_of_band_threshold_) {
+    return nullptr;
+  }
+  // If the allocation fails, the contents are simply written to the buffer.
+  return BackingStore::Allocate(isolate_, byte_length, SharedFlag::kNotShared,
+                                InitializedFlag::kUninitialized);
+}
+
+Maybe<uint32_t> ValueSerializer::GetOutOfBandBackingStoreId(
+    std::unique_ptr<BackingStore> backing_store) {
+  DCHECK_NOT_NULL(delegate_);
+  std::shared_ptr<BackingStoreBase> backing_store_base =
+      std::move(backing_store);
+  return delegate_->GetOutOfBandBackingStoreId(
+      reinterpret_cast<v8::Isolate*>(isolate_),
+      std::static_pointer_cast<v8::BackingStore>(backing_store_base));
+}
+
 Maybe<uint32_t> ValueSerializer::WriteJSObjectPropertiesSlow(
     Handle<JSObject> object, Handle<FixedArray> keys) {
   uint32_t properties_written = 0;
@@ -1070,6 +1151,401 @@ void ValueSerializer::ThrowDataCloneError(MessageTemplate index,
   }
 }
 
+// An index of the wire format, built on a background thread without touching
+// the heap while the main thread deserializes the same buffer.
+//
+// The wire format only states the number of properties of a JSObject after
+// its properties, which is too late for the main thread to allocate the object
+// with enough in-object space for them. The index records the property count
+// of every JSObject, by the ordinal of its kBeginJSObject tag in wire order,
+// and publishes each count as soon as the object has been scanned. Scanning is
+// much cheaper than allocating, so it usually stays ahead of the main thread.
+//
+// The index is only a hint. It stops at anything it does not understand (host
+// objects, wasm transfers, raw data read by the embedder, malformed data), and
+// the main thread uses the generic map whenever a count is not known (yet).
+class ValueDeserializer::Index {
+ public:
+  class Job;
+
+  explicit Index(Vector<const uint8_t> data);
+  ~Index();
+
+  // Scans the buffer until its end, or until |delegate| asks to yield. In
+  // that case, the next call resumes where this one stopped. Called on a
+  // background thread, one call at a time.
+  void Build(JobDelegate* delegate);
+  bool IsDone() const { return done_.load(std::memory_order_acquire); }
+
+  // Returns the property count of the |ordinal|-th JSObject, if it has been
+  // scanned already. Called on the main thread.
+  Maybe<uint32_t> GetPropertyCount(uint32_t ordinal) const;
+
+ private:
+  // A value whose nested values are being scanned. The scan keeps these on
+  // an explicit stack, so that it neither recurses on the worker's stack nor
+  // loses its progress when it yields.
+  struct Frame {
+    // The tag that started the value.
+    SerializationTag tag;
+    // The ordinal of a JSObject.
+    uint32_t ordinal;
+    // The elements of a dense array that are still to be scanned.
+    uint32_t remaining_elements;
+  };
+
+  // Counts are stored plus one, so that zero means "not known", and saturate
+  // since only small objects are allocated with preallocated maps.
+  using Entry = std::atomic<uint8_t>;
+  static constexpr uint32_t kMaxRecordedCount = 254;
+  static constexpr size_t kChunkSize = 4 * KB;
+  // Deeper values are left to the main thread, which checks its stack.
+  static constexpr size_t kMaxDepth = 1000;
+  static constexpr int kStepsPerYieldCheck = 1024;
+
+  // Each of these returns false at the end of the scan, i.e. at the end of
+  // the buffer or at anything the index does not understand.
+  bool Step();
+  bool BeginValue();
+  bool EndValue();
+  bool EndContainer();
+  bool ScanErrorTag();
+  bool PushFrame(SerializationTag tag, uint32_t ordinal = 0,
+                 uint32_t remaining_elements = 0);
+  bool ScanArrayBufferView();
+  bool PeekTag(SerializationTag* tag) const;
+  bool ReadTag(SerializationTag* tag);
+  template <typename T>
+  bool ReadVarint(T* value);
+  bool Skip(size_t size);
+  void Record(uint32_t ordinal, uint32_t count);
+
+  const uint8_t* position_;
+  const uint8_t* const end_;
+  std::vector<Frame> stack_;
+  uint32_t next_ordinal_ = 0;
+
+  // A JSObject takes at least three bytes (both tags and its count), which
+  // bounds the number of chunks. Chunks are allocated and published by the
+  // background thread on first use.
+  const size_t num_chunks_;
+  std::unique_ptr<std::atomic<Entry*>[]> chunks_;
+  std::atomic<bool> done_{false};
+
+  DISALLOW_COPY_AND_ASSIGN(Index);
+};
+
+class ValueDeserializer::Index::Job final : public JobTask {
+ public:
+  explicit Job(Index* index) : index_(index) {}
+
+  void Run(JobDelegate* delegate) override { index_->Build(delegate); }
+
+  size_t GetMaxConcurrency(size_t worker_count) const override {
+    return index_->IsDone() ? 0 : 1;
+  }
+
+ private:
+  Index* const index_;
+};
+
+ValueDeserializer::Index::Index(Vector<const uint8_t> data)
+    : position_(data.begin()),
+      end_(data.end()),
+      num_chunks_(data.size() / 3 / kChunkSize + 1),
+      chunks_(new std::atomic<Entry*>[num_chunks_]()) {}
+
+ValueDeserializer::Index::~Index() {
+  for (size_t i = 0; i < num_chunks_; i++) {
+    delete[] chunks_[i].load(std::memory_order_relaxed);
+  }
+}
+
+void ValueDeserializer::Index::Build(JobDelegate* delegate) {
+  DCHECK(!IsDone());
+  for (int steps = 1;; steps++) {
+    if (steps % kStepsPerYieldCheck == 0 && delegate->ShouldYield()) return;
+    if (!Step()) break;
+  }
+  done_.store(true, std::memory_order_release);
+}
+
+Maybe<uint32_t> ValueDeserializer::Index::GetPropertyCount(
+    uint32_t ordinal) const {
+  size_t chunk_index = ordinal / kChunkSize;
+  if (chunk_index >= num_chunks_) return Nothing<uint32_t>();
+  Entry* chunk = chunks_[chunk_index].load(std::memory_order_acquire);
+  if (chunk == nullptr) return Nothing<uint32_t>();
+  uint8_t entry = chunk[ordinal % kChunkSize].load(std::memory_order_relaxed);
+  if (entry == 0) return Nothing<uint32_t>();
+  return Just<uint32_t>(entry - 1);
+}
+
+void ValueDeserializer::Index::Record(uint32_t ordinal, uint32_t count) {
+  // Only possible for malformed data.
+  size_t chunk_index = ordinal / kChunkSize;
+  if (chunk_index >= num_chunks_) return;
+  Entry* chunk = chunks_[chunk_index].load(std::memory_order_relaxed);
+  if (chunk == nullptr) {
+    chunk = new Entry[kChunkSize]();
+    chunks_[chunk_index].store(chunk, std::memory_order_release);
+  }
+  chunk[ordinal % kChunkSize].store(
+      static_cast<uint8_t>(std::min(count, kMaxRecordedCount) + 1),
+      std::memory_order_relaxed);
+}
+
+bool ValueDeserializer::Index::PeekTag(SerializationTag* tag) const {
+  const uint8_t* peek_position = position_;
+  do {
+    if (peek_position >= end_) return false;
+    *tag = static_cast<SerializationTag>(*peek_position);
+    peek_position++;
+  } while (*tag == SerializationTag::kPadding);
+  return true;
+}
+
+bool ValueDeserializer::Index::ReadTag(SerializationTag* tag) {
+  do {
+    if (position_ >= end_) return false;
+    *tag = static_cast<SerializationTag>(*position_);
+    position_++;
+  } while (*tag == SerializationTag::kPadding);
+  return true;
+}
+
+template <typename T>
+bool ValueDeserializer::Index::ReadVarint(T* value) {
+  // See ValueDeserializer::ReadVarint.
+  *value = 0;
+  unsigned shift = 0;
+  bool has_another_byte;
+  do {
+    if (position_ >= end_) return false;
+    uint8_t byte = *position_;
+    if (V8_LIKELY(shift < sizeof(T) * 8)) {
+      *value |= static_cast<T>(byte & 0x7F) << shift;
+      shift += 7;
+    }
+    has_another_byte = byte & 0x80;
+    position_++;
+  } while (has_another_byte);
+  return true;
+}
+
+bool ValueDeserializer::Index::Skip(size_t size) {
+  if (size > static_cast<size_t>(end_ - position_)) return false;
+  position_ += size;
+  return true;
+}
+
+// Scans the next value at the top level, or the next part of the innermost
+// value on the stack.
+bool ValueDeserializer::Index::Step() {
+  if (stack_.empty()) return position_ < end_ && BeginValue();
+  Frame& frame = stack_.back();
+  SerializationTag end_tag;
+  switch (frame.tag) {
+    case SerializationTag::kStringObject:
+    case SerializationTag::kRegExp:
+      return BeginValue();
+    case SerializationTag::kError:
+      return ScanErrorTag();
+    case SerializationTag::kBeginDenseJSArray:
+      if (frame.remaining_elements > 0) {
+        SerializationTag element_tag;
+        if (PeekTag(&element_tag) &&
+            element_tag == SerializationTag::kTheHole) {
+          frame.remaining_elements--;
+          return ReadTag(&element_tag);
+        }
+        return BeginValue();
+      }
+      end_tag = SerializationTag::kEndDenseJSArray;
+      break;
+    case SerializationTag::kBeginJSObject:
+      end_tag = SerializationTag::kEndJSObject;
+      break;
+    case SerializationTag::kBeginSparseJSArray:
+      end_tag = SerializationTag::kEndSparseJSArray;
+      break;
+    case SerializationTag::kBeginJSMap:
+      end_tag = SerializationTag::kEndJSMap;
+      break;
+    case SerializationTag::kBeginJSSet:
+      end_tag = SerializationTag::kEndJSSet;
+      break;
+    default:
+      UNREACHABLE();
+  }
+  SerializationTag tag;
+  if (!PeekTag(&tag)) return false;
+  if (tag != end_tag) return BeginValue();
+  return ReadTag(&tag) && EndContainer();
+}
+
+// Mirrors ValueDeserializer::ReadObjectInternal for version 13. Values that
+// contain other values are pushed onto the stack.
+bool ValueDeserializer::Index::BeginValue() {
+  SerializationTag tag;
+  if (!ReadTag(&tag)) return false;
+  while (tag == SerializationTag::kVerifyObjectCount) {
+    uint32_t count;
+    if (!ReadVarint(&count) || !ReadTag(&tag)) return false;
+  }
+  switch (tag) {
+    case SerializationTag::kUndefined:
+    case SerializationTag::kNull:
+    case SerializationTag::kTrue:
+    case SerializationTag::kFalse:
+    case SerializationTag::kTrueObject:
+    case SerializationTag::kFalseObject:
+      return EndValue();
+    case SerializationTag::kInt32:
+    case SerializationTag::kUint32:
+    case SerializationTag::kObjectReference:
+    case SerializationTag::kArrayBufferTransfer:
+    case SerializationTag::kSharedArrayBuffer:
+    case SerializationTag::kOutOfBandArrayBuffer:
+    case SerializationTag::kOutOfBandOneByteString:
+    case SerializationTag::kOutOfBandTwoByteString: {
+      uint32_t value;
+      return ReadVarint(&value) && EndValue();
+    }
+    case SerializationTag::kDouble:
+    case SerializationTag::kDate:
+    case SerializationTag::kNumberObject:
+      return Skip(sizeof(double)) && EndValue();
+    case SerializationTag::kBigInt:
+    case SerializationTag::kBigIntObject: {
+      uint32_t bitfield;
+      return ReadVarint(&bitfield) &&
+             Skip(BigInt::DigitsByteLengthForBitfield(bitfield)) && EndValue();
+    }
+    case SerializationTag::kUtf8String:
+    case SerializationTag::kOneByteString:
+    case SerializationTag::kTwoByteString:
+    case SerializationTag::kArrayBuffer: {
+      uint32_t byte_length;
+      return ReadVarint(&byte_length) && Skip(byte_length) && EndValue();
+    }
+    case SerializationTag::kStringObject:
+    case SerializationTag::kRegExp:
+    case SerializationTag::kError:
+    case SerializationTag::kBeginJSMap:
+    case SerializationTag::kBeginJSSet:
+      return PushFrame(tag);
+    case SerializationTag::kBeginJSObject:
+      return PushFrame(tag, next_ordinal_++);
+    case SerializationTag::kBeginSparseJSArray: {
+      uint32_t length;
+      return ReadVarint(&length) && PushFrame(tag);
+    }
+    case SerializationTag::kBeginDenseJSArray: {
+      uint32_t length;
+      return ReadVarint(&length) &&
+             length <= static_cast<size_t>(end_ - position_) &&
+             PushFrame(tag, 0, length);
+    }
+    default:
+      // Host objects and wasm transfers are up to the delegate.
+      return false;
+  }
+}
+
+// Called once a value has been scanned, including everything it contains.
+// Mirrors ValueDeserializer::ReadObject, and finishes the values on the stack
+// that this value completes.
+bool ValueDeserializer::Index::EndValue() {
+  while (true) {
+    SerializationTag tag;
+    if (PeekTag(&tag) && tag == SerializationTag::kArrayBufferView &&
+        (!ReadTag(&tag) || !ScanArrayBufferView())) {
+      return false;
+    }
+    if (stack_.empty()) return true;
+    Frame& frame = stack_.back();
+    switch (frame.tag) {
+      case SerializationTag::kStringObject:
+        stack_.pop_back();
+        break;
+      case SerializationTag::kRegExp: {
+        uint32_t flags;
+        if (!ReadVarint(&flags)) return false;
+        stack_.pop_back();
+        break;
+      }
+      case SerializationTag::kBeginDenseJSArray:
+        if (frame.remaining_elements > 0) frame.remaining_elements--;
+        return true;
+      default:
+        return true;
+    }
+  }
+}
+
+// Called after the end tag of the innermost value on the stack.
+bool ValueDeserializer::Index::EndContainer() {
+  Frame frame = stack_.back();
+  stack_.pop_back();
+  uint32_t count, length;
+  switch (frame.tag) {
+    case SerializationTag::kBeginJSObject:
+      if (!ReadVarint(&count)) return false;
+      Record(frame.ordinal, count);
+      break;
+    case SerializationTag::kBeginSparseJSArray:
+    case SerializationTag::kBeginDenseJSArray:
+      if (!ReadVarint(&count) || !ReadVarint(&length)) return false;
+      break;
+    case SerializationTag::kBeginJSMap:
+    case SerializationTag::kBeginJSSet:
+      if (!ReadVarint(&length)) return false;
+      break;
+    default:
+      UNREACHABLE();
+  }
+  return EndValue();
+}
+
+// Mirrors ValueDeserializer::ReadJSError.
+bool ValueDeserializer::Index::ScanErrorTag() {
+  uint8_t tag;
+  if (!ReadVarint(&tag)) return false;
+  switch (static_cast<ErrorTag>(tag)) {
+    case ErrorTag::kEvalErrorPrototype:
+    case ErrorTag::kRangeErrorPrototype:
+    case ErrorTag::kReferenceErrorPrototype:
+    case ErrorTag::kSyntaxErrorPrototype:
+    case ErrorTag::kTypeErrorPrototype:
+    case ErrorTag::kUriErrorPrototype:
+      return true;
+    case ErrorTag::kMessage:
+    case ErrorTag::kStack:
+      return BeginValue();
+    case ErrorTag::kEnd:
+      stack_.pop_back();
+      return EndValue();
+    default:
+      return false;
+  }
+}
+
+bool ValueDeserializer::Index::PushFrame(SerializationTag tag,
+                                         uint32_t ordinal,
+                                         uint32_t remaining_elements) {
+  if (stack_.size() >= kMaxDepth) return false;
+  stack_.push_back({tag, ordinal, remaining_elements});
+  return true;
+}
+
+bool ValueDeserializer::Index::ScanArrayBufferView() {
+  uint8_t tag;
+  uint32_t byte_offset, byte_length;
+  return ReadVarint(&tag) && ReadVarint(&byte_offset) &&
+         ReadVarint(&byte_length);
+}
+
 ValueDeserializer::ValueDeserializer(Isolate* isolate,
                                      Vector<const uint8_t> data,
                                      v8::ValueDeserializer::Delegate* delegate)
@@ -1081,6 +1557,9 @@ ValueDeserializer::ValueDeserializer(Isolate* isolate,
           ReadOnlyRoots(isolate_).empty_fixed_array())) {}
 
 ValueDeserializer::~ValueDeserializer() {
+  // The index job reads the buffer, which need not outlive the deserializer.
+  if (index_job_) index_job_->Cancel();
+
   GlobalHandles::Destroy(id_map_.location());
 
   Handle<Object> transfer_map_handle;
@@ -1099,9 +1578,38 @@ Maybe<bool> ValueDeserializer::ReadHeader() {
       return Nothing<bool>();
     }
   }
+  StartIndexing();
   return Just(true);
 }
 
+void ValueDeserializer::StartIndexing() {
+  // The index relies on host objects having an explicit tag, and is only worth
+  // a background task for large payloads.
+  if (!FLAG_parallel_value_deserialization || version_ < 13 || index_ ||
+      static_cast<size_t>(end_ - position_) <
+          FLAG_parallel_value_deserialization_min_size) {
+    return;
+  }
+  index_ = std::make_unique<Index>(
+      Vector<const uint8_t>(position_, end_ - position_));
+  index_job_ = V8::GetCurrentPlatform()->PostJob(
+      TaskPriority::kUserBlocking, std::make_unique<Index::Job>(index_.get()));
+}
+
+Handle<Map> ValueDeserializer::GetJSObjectInitialMap(uint32_t ordinal) {
+  // ObjectLiteralMapFromCache() returns dictionary maps beyond this.
+  static constexpr uint32_t kMaxPreallocatedProperties = 128;
+  uint32_t num_properties;
+  if (index_ && index_->GetPropertyCount(ordinal).To(&num_properties) &&
+      num_properties <= kMaxPreallocatedProperties) {
+    // Object literals with as many properties use the same maps, which have
+    // in-object space for all of them.
+    return isolate_->factory()->ObjectLiteralMapFromCache(
+        isolate_->native_context(), static_cast<int>(num_properties));
+  }
+  return handle(isolate_->object_function()->initial_map(), isolate_);
+}
+
 Maybe<SerializationTag> ValueDeserializer::PeekTag() const {
   const uint8_t* peek_position = position_;
   SerializationTag tag;
@@ -1285,6 +1793,10 @@ MaybeHandle<Object> ValueDeserializer::ReadObjectInternal() {
       return ReadOneByteString();
     case SerializationTag::kTwoByteString:
       return ReadTwoByteString();
+    case SerializationTag::kOutOfBandOneByteString:
+      return ReadOutOfBandString(true);
+    case SerializationTag::kOutOfBandTwoByteString:
+      return ReadOutOfBandString(false);
     case SerializationTag::kObjectReference: {
       uint32_t id;
       if (!ReadVarint<uint32_t>().To(&id)) return MaybeHandle<Object>();
@@ -1317,6 +1829,8 @@ MaybeHandle<Object> ValueDeserializer::ReadObjectInternal() {
     case SerializationTag::kArrayBufferTransfer: {
       return ReadTransferredJSArrayBuffer();
     }
+    case SerializationTag::kOutOfBandArrayBuffer:
+      return ReadOutOfBandJSArrayBuffer();
     case SerializationTag::kSharedArrayBuffer: {
       const bool is_shared = true;
       return ReadJSArrayBuffer(is_shared);
@@ -1413,6 +1927,61 @@ MaybeHandle<String> ValueDeserializer::ReadTwoByteString() {
   return string;
 }
 
+namespace {
+
+// Keeps the backing store of an out-of-band string alive for as long as the
+// external string refers to it.
+template <typename Base, typename Char>
+class OutOfBandStringResource final : public Base {
+ public:
+  explicit OutOfBandStringResource(std::shared_ptr<BackingStore> backing_store)
+      : backing_store_(std::move(backing_store)) {}
+
+  const Char* data() const override {
+    return static_cast<const Char*>(backing_store_->buffer_start());
+  }
+  size_t length() const override {
+    return backing_store_->byte_length() / sizeof(Char);
+  }
+
+ private:
+  std::shared_ptr<BackingStore> backing_store_;
+};
+
+using OutOfBandOneByteStringResource =
+    OutOfBandStringResource<v8::String::ExternalOneByteStringResource, char>;
+using OutOfBandTwoByteStringResource =
+    OutOfBandStringResource<v8::String::ExternalStringResource, uint16_t>;
+
+}  // namespace
+
+MaybeHandle<String> ValueDeserializer::ReadOutOfBandString(bool is_one_byte) {
+  std::shared_ptr<BackingStore> backing_store = ReadOutOfBandBackingStore();
+  if (!backing_store) return MaybeHandle<String>();
+  size_t byte_length = backing_store->byte_length();
+  size_t char_size = is_one_byte ? 1 : sizeof(uc16);
+  if (byte_length % char_size != 0 ||
+      byte_length / char_size > static_cast<size_t>(String::kMaxLength)) {
+    return MaybeHandle<String>();
+  }
+  if (byte_length == 0) return isolate_->factory()->empty_string();
+
+  // The string refers to the backing store directly, so its contents are not
+  // copied again.
+  if (is_one_byte) {
+    auto* resource = new OutOfBandOneByteStringResource(backing_store);
+    MaybeHandle<String> result =
+        isolate_->factory()->NewExternalStringFromOneByte(resource);
+    if (result.is_null()) delete resource;
+    return result;
+  }
+  auto* resource = new OutOfBandTwoByteStringResource(backing_store);
+  MaybeHandle<String> result =
+      isolate_->factory()->NewExternalStringFromTwoByte(resource);
+  if (result.is_null()) delete resource;
+  return result;
+}
+
 bool ValueDeserializer::ReadExpectedString(Handle<String> expected) {
   DisallowHeapAllocation no_gc;
   // In the case of failure, the position in the stream is reset.
@@ -1464,8 +2033,8 @@ MaybeHandle<JSObject> ValueDeserializer::ReadJSObject() {
 
   uint32_t id = next_id_++;
   HandleScope scope(isolate_);
-  Handle<JSObject> object =
-      isolate_->factory()->NewJSObject(isolate_->object_function());
+  Handle<JSObject> object = isolate_->factory()->NewJSObjectFromMap(
+      GetJSObjectInitialMap(next_js_object_ordinal_++));
   AddObjectWithID(id, object);
 
   uint32_t num_properties;
@@ -1789,6 +2358,34 @@ MaybeHandle<JSArrayBuffer> ValueDeserializer::ReadTransferredJSArrayBuffer() {
   return array_buffer;
 }
 
+MaybeHandle<JSArrayBuffer> ValueDeserializer::ReadOutOfBandJSArrayBuffer() {
+  uint32_t id = next_id_++;
+  std::shared_ptr<BackingStore> backing_store = ReadOutOfBandBackingStore();
+  if (!backing_store || backing_store->is_shared() ||
+      backing_store->byte_length() > JSArrayBuffer::kMaxByteLength) {
+    return MaybeHandle<JSArrayBuffer>();
+  }
+  Handle<JSArrayBuffer> array_buffer =
+      isolate_->factory()->NewJSArrayBuffer(std::move(backing_store));
+  AddObjectWithID(id, array_buffer);
+  return array_buffer;
+}
+
+std::shared_ptr<BackingStore> ValueDeserializer::ReadOutOfBandBackingStore() {
+  uint32_t backing_store_id;
+  if (!ReadVarint<uint32_t>().To(&backing_store_id) || delegate_ == nullptr) {
+    return nullptr;
+  }
+  std::shared_ptr<v8::BackingStore> backing_store =
+      delegate_->GetOutOfBandBackingStoreFromId(
+          reinterpret_cast<v8::Isolate*>(isolate_), backing_store_id);
+  RETURN_VALUE_IF_SCHEDULED_EXCEPTION(isolate_, nullptr);
+  if (!backing_store) return nullptr;
+  std::shared_ptr<BackingStoreBase> backing_store_base =
+      std::move(backing_store);
+  return std::static_pointer_cast<BackingStore>(backing_store_base);
+}
+
 MaybeHandle<JSArrayBufferView> ValueDeserializer::ReadJSArrayBufferView(
     Handle<JSArrayBuffer> buffer) {
   uint32_t buffer_byte_length = static_cast<uint32_t>(buffer->byte_length());
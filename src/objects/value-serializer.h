@@ -6,6 +6,7 @@
 #define V8_OBJECTS_VALUE_SERIALIZER_H_
 
 #include <cstdint>
+#include <memory>
 #include <vector>
 
 #include "include/v8.h"
@@ -18,8 +19,12 @@
 #include "src/zone/zone.h"
 
 namespace v8 {
+
+class JobHandle;
+
 namespace internal {
 
+class BackingStore;
 class BigInt;
 class HeapNumber;
 class Isolate;
@@ -30,6 +35,7 @@ class JSMap;
 class JSPrimitiveWrapper;
 class JSRegExp;
 class JSSet;
+class Map;
 class Object;
 class Oddball;
 class Smi;
@@ -91,6 +97,13 @@ class ValueSerializer {
    */
   void SetTreatArrayBufferViewsAsHostObjects(bool mode);
 
+  /*
+   * Sets the minimum size of ArrayBuffer contents and strings that are handed
+   * to the delegate by reference instead of being copied to the buffer. Zero
+   * disables this.
+   */
+  void SetOutOfBandThreshold(size_t threshold_in_bytes);
+
  private:
   // Managing allocations of the internal buffer.
   Maybe<bool> ExpandBuffer(size_t required_capacity);
@@ -112,6 +125,7 @@ class ValueSerializer {
   void WriteHeapNumber(HeapNumber number);
   void WriteBigInt(BigInt bigint);
   void WriteString(Handle<String> string);
+  bool WriteStringOutOfBand(Handle<String> string);
   Maybe<bool> WriteJSReceiver(Handle<JSReceiver> receiver)
       V8_WARN_UNUSED_RESULT;
   Maybe<bool> WriteJSObject(Handle<JSObject> object) V8_WARN_UNUSED_RESULT;
@@ -133,6 +147,20 @@ class ValueSerializer {
       V8_WARN_UNUSED_RESULT;
   Maybe<bool> WriteHostObject(Handle<JSObject> object) V8_WARN_UNUSED_RESULT;
 
+  /*
+   * Allocates a backing store for contents of |byte_length| bytes that may be
+   * written out of band, or returns nullptr if they should be written to the
+   * buffer.
+   */
+  std::unique_ptr<BackingStore> NewOutOfBandBackingStore(size_t byte_length);
+
+  /*
+   * Offers a backing store filled by the caller to the delegate. Returns the
+   * ID to write, or Nothing if the contents should be written to the buffer.
+   */
+  Maybe<uint32_t> GetOutOfBandBackingStoreId(
+      std::unique_ptr<BackingStore> backing_store);
+
   /*
    * Reads the specified keys from the object and writes key-value pairs to the
    * buffer. Returns the number of keys actually written, which may be smaller
@@ -157,6 +185,7 @@ class ValueSerializer {
   size_t buffer_size_ = 0;
   size_t buffer_capacity_ = 0;
   bool treat_array_buffer_views_as_host_objects_ = false;
+  size_t out_of_band_threshold_ = 0;
   bool out_of_memory_ = false;
   Zone zone_;
 
@@ -237,6 +266,13 @@ class ValueDeserializer {
   Maybe<double> ReadDouble() V8_WARN_UNUSED_RESULT;
   Maybe<Vector<const uint8_t>> ReadRawBytes(int size) V8_WARN_UNUSED_RESULT;
 
+  // Starts indexing the rest of the buffer in the background if it is large
+  // enough to be worth it. See ValueDeserializer::Index.
+  void StartIndexing();
+
+  // Returns the map to allocate the |ordinal|-th JSObject in wire order with.
+  Handle<Map> GetJSObjectInitialMap(uint32_t ordinal);
+
   // Reads a string if it matches the one provided.
   // Returns true if this was the case. Otherwise, nothing is consumed.
   bool ReadExpectedString(Handle<String> expected) V8_WARN_UNUSED_RESULT;
@@ -256,6 +292,8 @@ class ValueDeserializer {
   MaybeHandle<String> ReadUtf8String() V8_WARN_UNUSED_RESULT;
   MaybeHandle<String> ReadOneByteString() V8_WARN_UNUSED_RESULT;
   MaybeHandle<String> ReadTwoByteString() V8_WARN_UNUSED_RESULT;
+  MaybeHandle<String> ReadOutOfBandString(bool is_one_byte)
+      V8_WARN_UNUSED_RESULT;
   MaybeHandle<JSObject> ReadJSObject() V8_WARN_UNUSED_RESULT;
   MaybeHandle<JSArray> ReadSparseJSArray() V8_WARN_UNUSED_RESULT;
   MaybeHandle<JSArray> ReadDenseJSArray() V8_WARN_UNUSED_RESULT;
@@ -269,6 +307,8 @@ class ValueDeserializer {
       V8_WARN_UNUSED_RESULT;
   MaybeHandle<JSArrayBuffer> ReadTransferredJSArrayBuffer()
       V8_WARN_UNUSED_RESULT;
+  MaybeHandle<JSArrayBuffer> ReadOutOfBandJSArrayBuffer()
+      V8_WARN_UNUSED_RESULT;
   MaybeHandle<JSArrayBufferView> ReadJSArrayBufferView(
       Handle<JSArrayBuffer> buffer) V8_WARN_UNUSED_RESULT;
   MaybeHandle<Object> ReadJSError() V8_WARN_UNUSED_RESULT;
@@ -276,6 +316,10 @@ class ValueDeserializer {
   MaybeHandle<WasmMemoryObject> ReadWasmMemory() V8_WARN_UNUSED_RESULT;
   MaybeHandle<JSObject> ReadHostObject() V8_WARN_UNUSED_RESULT;
 
+  // Asks the delegate for the backing store of out-of-band contents.
+  std::shared_ptr<BackingStore> ReadOutOfBandBackingStore()
+      V8_WARN_UNUSED_RESULT;
+
   /*
    * Reads key-value pairs into the object until the specified end tag is
    * encountered. If successful, returns the number of properties read.
@@ -289,12 +333,19 @@ class ValueDeserializer {
   MaybeHandle<JSReceiver> GetObjectWithID(uint32_t id);
   void AddObjectWithID(uint32_t id, Handle<JSReceiver> object);
 
+  class Index;
+
   Isolate* const isolate_;
   v8::ValueDeserializer::Delegate* const delegate_;
   const uint8_t* position_;
   const uint8_t* const end_;
   uint32_t version_ = 0;
   uint32_t next_id_ = 0;
+  uint32_t next_js_object_ordinal_ = 0;
+
+  // Built concurrently by |index_job_| while the main thread deserializes.
+  std::unique_ptr<Index> index_;
+  std::unique_ptr<v8::JobHandle> index_job_;
 
   // Always global handles.
   Handle<FixedArray> id_map_;
@@ -35,6 +35,7 @@ ParseInfo::ParseInfo(AccountingAllocator* zone_allocator, int script_id)
       parameters_end_pos_(kNoSourcePosition),
       function_literal_id_(kFunctionLiteralIdInvalid),
       max_function_literal_id_(kFunctionLiteralIdInvalid),
+      eager_compile_budget_(0),
       character_stream_(nullptr),
       ast_value_factory_(nullptr),
       ast_string_constants_(nullptr),
@@ -211,6 +211,14 @@ class V8_EXPORT_PRIVATE ParseInfo {
     max_function_literal_id_ = max_function_literal_id;
   }
 
+  // Number of source characters of lazy top-level functions which the parser
+  // may instead mark for eager compilation, so that they are compiled
+  // together with the top-level code.
+  int eager_compile_budget() const { return eager_compile_budget_; }
+  void set_eager_compile_budget(int eager_compile_budget) {
+    eager_compile_budget_ = eager_compile_budget;
+  }
+
   const AstStringConstants* ast_string_constants() const {
     return ast_string_constants_;
   }
@@ -349,6 +357,7 @@ class V8_EXPORT_PRIVATE ParseInfo {
   int parameters_end_pos_;
   int function_literal_id_;
   int max_function_literal_id_;
+  int eager_compile_budget_;
 
   //----------- Inputs+Outputs of parsing and scope analysis -----------------
   std::unique_ptr<Utf16CharacterStream> character_stream_;
@@ -428,6 +428,7 @@ Parser::Parser(ParseInfo* info)
       mode_(PARSE_EAGERLY),  // Lazy mode must be set explicitly.
       source_range_map_(info->source_range_map()),
       total_preparse_skipped_(0),
+      eager_compile_budget_(info->eager_compile_budget()),
       consumed_preparse_data_(info->consumed_preparse_data()),
       preparse_data_buffer_(),
       parameters_end_pos_(info->parameters_end_pos()) {
@@ -2382,6 +2383,18 @@ FunctionLiteral* Parser::ParseFunctionLiteral(
   DCHECK_IMPLIES(parse_lazily(), has_error() || allow_lazy_);
   DCHECK_IMPLIES(parse_lazily(), extension_ == nullptr);
 
+  // Top-level functions which would be compiled lazily are compiled eagerly
+  // instead while the eager compile budget lasts. This moves their
+  // compilation off the main thread when streaming, at the cost of a full
+  // parse of the function.
+  bool uses_eager_compile_budget = false;
+  if (eager_compile_hint == FunctionLiteral::kShouldLazyCompile &&
+      eager_compile_budget_ > 0 && parse_lazily() &&
+      AllowsLazyParsingWithoutUnresolvedVariables()) {
+    eager_compile_hint = FunctionLiteral::kShouldEagerCompile;
+    uses_eager_compile_budget = true;
+  }
+
   const bool is_lazy =
       eager_compile_hint == FunctionLiteral::kShouldLazyCompile;
   const bool is_top_level = AllowsLazyParsingWithoutUnresolvedVariables();
@@ -2491,6 +2504,10 @@ FunctionLiteral* Parser::ParseFunctionLiteral(
     }
   }
 
+  if (uses_eager_compile_budget) {
+    eager_compile_budget_ -= scope->end_position() - scope->start_position();
+  }
+
   // Validate function name. We can do this only after parsing the function,
   // since the function can declare itself strict.
   language_mode = scope->language_mode();
@@ -1059,6 +1059,7 @@ class V8_EXPORT_PRIVATE Parser : public NON_EXPORTED_BASE(ParserBase<Parser>) {
   // parsing.
   int use_counts_[v8::Isolate::kUseCounterFeatureCount];
   int total_preparse_skipped_;
+  int eager_compile_budget_;
   bool allow_lazy_;
   bool temp_zoned_;
   ConsumedPreparseData* consumed_preparse_data_;
@@ -127,6 +127,7 @@ RegExpMacroAssemblerARM::~RegExpMacroAssemblerARM() {
   exit_label_.Unuse();
   check_preempt_label_.Unuse();
   stack_overflow_label_.Unuse();
+  fallback_label_.Unuse();
 }
 
 
@@ -164,8 +165,13 @@ void RegExpMacroAssemblerARM::Backtrack() {
     __ cmp(r0, Operand(backtrack_limit()));
     __ b(ne, &next);
 
-    // Exceeded limits are treated as a failed match.
-    Fail();
+    // Exceeded limits are treated as a failed match, unless the pattern
+    // can be handed over to the linear-time engine.
+    if (can_fallback()) {
+      __ jmp(&fallback_label_);
+    } else {
+      Fail();
+    }
 
     __ bind(&next);
   }
@@ -890,6 +896,14 @@ Handle<HeapObject> RegExpMacroAssemblerARM::GetCode(Handle<String> source) {
     SafeReturn();
   }
 
+  if (fallback_label_.is_linked()) {
+    // Backtrack limit exceeded in a pattern that the linear-time engine
+    // can handle.
+    __ bind(&fallback_label_);
+    __ mov(r0, Operand(FALLBACK_TO_LINEAR));
+    __ jmp(&return_r0);
+  }
+
   if (exit_with_exception.is_linked()) {
     // If any of the code above needed to exit with an exception.
     __ bind(&exit_with_exception);
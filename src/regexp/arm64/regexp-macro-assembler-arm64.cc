@@ -142,6 +142,7 @@ RegExpMacroAssemblerARM64::~RegExpMacroAssemblerARM64() {
   exit_label_.Unuse();
   check_preempt_label_.Unuse();
   stack_overflow_label_.Unuse();
+  fallback_label_.Unuse();
 }
 
 int RegExpMacroAssemblerARM64::stack_limit_slack()  {
@@ -201,8 +202,13 @@ void RegExpMacroAssemblerARM64::Backtrack() {
     __ Cmp(scratch, Operand(backtrack_limit()));
     __ B(ne, &next);
 
-    // Exceeded limits are treated as a failed match.
-    Fail();
+    // Exceeded limits are treated as a failed match, unless the pattern
+    // can be handed over to the linear-time engine.
+    if (can_fallback()) {
+      __ B(&fallback_label_);
+    } else {
+      Fail();
+    }
 
     __ bind(&next);
   }
@@ -597,6 +603,147 @@ void RegExpMacroAssemblerARM64::CheckBitInTable(
 }
 
 
+void RegExpMacroAssemblerARM64::SkipUntilChar(int cp_offset, int advance_by,
+                                              unsigned c) {
+  Label found;
+  uc16 chars[] = {static_cast<uc16>(c)};
+  SkipUntilCharsSimd(cp_offset, chars, 1, false, &found);
+  RegExpMacroAssembler::SkipUntilChar(cp_offset, advance_by, c);
+  __ Bind(&found);
+}
+
+
+void RegExpMacroAssemblerARM64::SkipUntilCharAfterAnd(int cp_offset,
+                                                      int advance_by,
+                                                      unsigned c,
+                                                      unsigned and_with) {
+  Label found;
+  if (and_with == kTableMask) {
+    uc16 chars[] = {static_cast<uc16>(c)};
+    SkipUntilCharsSimd(cp_offset, chars, 1, true, &found);
+  }
+  RegExpMacroAssembler::SkipUntilCharAfterAnd(cp_offset, advance_by, c,
+                                              and_with);
+  __ Bind(&found);
+}
+
+
+void RegExpMacroAssemblerARM64::SkipUntilBitInTable(int cp_offset,
+                                                    int advance_by,
+                                                    Handle<ByteArray> table) {
+  Label found;
+  uc16 chars[kMaxSimdSkipChars];
+  int count = GetTableCharacters(table, chars, kMaxSimdSkipChars);
+  if (count > 0) {
+    SkipUntilCharsSimd(cp_offset, chars, count, true, &found);
+  } else if (mode_ == LATIN1) {
+    SkipUntilBitInTableSimd(cp_offset, table, &found);
+  }
+  RegExpMacroAssembler::SkipUntilBitInTable(cp_offset, advance_by, table);
+  __ Bind(&found);
+}
+
+
+void RegExpMacroAssemblerARM64::SkipUntilCharsSimd(int cp_offset,
+                                                   const uc16* chars,
+                                                   int count, bool masked,
+                                                   Label* on_found) {
+  DCHECK_LE(1, count);
+  DCHECK_LE(count, kMaxSimdSkipChars);
+  auto lanes = [this](const VRegister& reg) {
+    return mode_ == LATIN1 ? reg.V16B() : reg.V8H();
+  };
+  const VRegister char_registers[] = {v2, v3, v4, v5};
+  STATIC_ASSERT(arraysize(char_registers) == kMaxSimdSkipChars);
+  // Instead of and'ing the input with kTableMask, the bits above it are
+  // shifted out of each character, and the characters compared against are
+  // shifted to match.
+  const int shift = masked ? kBitsPerByte * char_size() - kTableSizeBits : 0;
+  for (int i = 0; i < count; i++) {
+    uint32_t c = masked ? (chars[i] & kTableMask) << shift : chars[i];
+    DCHECK(mode_ == UC16 || c <= String::kMaxOneByteCharCode);
+    __ Mov(w10, c);
+    __ Dup(lanes(char_registers[i]), w10);
+  }
+
+  Label loop, exit;
+  SkipUntilSimdLoopHeader(cp_offset, &loop, &exit);
+  if (masked) __ Shl(lanes(v0), lanes(v0), shift);
+  __ Cmeq(lanes(v1), lanes(v0), lanes(char_registers[0]));
+  for (int i = 1; i < count; i++) {
+    __ Cmeq(lanes(v6), lanes(v0), lanes(char_registers[i]));
+    __ Orr(v1.V16B(), v1.V16B(), v6.V16B());
+  }
+  SkipUntilSimdLoopFooter(&loop, on_found);
+  __ Bind(&exit);
+}
+
+
+void RegExpMacroAssemblerARM64::SkipUntilBitInTableSimd(
+    int cp_offset, Handle<ByteArray> table, Label* on_found) {
+  DCHECK_EQ(LATIN1, mode_);
+  // The characters are looked up in two steps, with the low and the high
+  // nibble of each character as table indices.  The first table holds, for
+  // each low nibble, a bit for each high nibble that completes it to a
+  // character in the table.  The second table maps the high nibble to that
+  // bit, ignoring the bit above kTableMask.
+  STATIC_ASSERT(kTableSize == 8 * 16);
+  uint8_t low_nibble_table[16] = {0};
+  for (int i = 0; i < kTableSize; i++) {
+    if (table->get(i) != 0) low_nibble_table[i & 0xF] |= 1 << (i >> 4);
+  }
+  uint64_t low_nibble_table_low;
+  uint64_t low_nibble_table_high;
+  memcpy(&low_nibble_table_low, &low_nibble_table[0], sizeof(uint64_t));
+  memcpy(&low_nibble_table_high, &low_nibble_table[8], sizeof(uint64_t));
+  const uint64_t high_nibble_bits = uint64_t{0x8040201008040201};
+
+  __ Movi(v2.V2D(), low_nibble_table_high, low_nibble_table_low);
+  __ Movi(v3.V2D(), high_nibble_bits, high_nibble_bits);
+  __ Movi(v4.V16B(), 0x0F);
+
+  Label loop, exit;
+  SkipUntilSimdLoopHeader(cp_offset, &loop, &exit);
+  __ Ushr(v1.V16B(), v0.V16B(), 4);
+  __ And(v0.V16B(), v0.V16B(), v4.V16B());
+  __ Tbl(v5.V16B(), v2.V16B(), v0.V16B());
+  __ Tbl(v6.V16B(), v3.V16B(), v1.V16B());
+  __ Cmtst(v1.V16B(), v5.V16B(), v6.V16B());
+  SkipUntilSimdLoopFooter(&loop, on_found);
+  __ Bind(&exit);
+}
+
+
+void RegExpMacroAssemblerARM64::SkipUntilSimdLoopHeader(int cp_offset,
+                                                        Label* loop,
+                                                        Label* exit) {
+  __ Bind(loop);
+  __ Add(w10, current_input_offset(), cp_offset * char_size());
+  __ Cmp(w10, -kQRegSize);
+  __ B(gt, exit);
+  __ Ldr(q0, MemOperand(input_end(), w10, SXTW));
+}
+
+
+void RegExpMacroAssemblerARM64::SkipUntilSimdLoopFooter(Label* loop,
+                                                        Label* on_found) {
+  Label found;
+  // Narrow each byte of the mask to a nibble, so that it fits into x11.
+  __ Shrn(v1.V8B(), v1.V8H(), 4);
+  __ Fmov(x11, d1);
+  __ Cbnz(x11, &found);
+  __ Add(current_input_offset(), current_input_offset(), kQRegSize);
+  __ B(loop);
+  __ Bind(&found);
+  // The lowest set nibble is at the byte offset of the first matching
+  // character.
+  __ Rbit(x11, x11);
+  __ Clz(x11, x11);
+  __ Add(current_input_offset(), current_input_offset(), Operand(w11, LSR, 2));
+  __ B(on_found);
+}
+
+
 bool RegExpMacroAssemblerARM64::CheckSpecialCharacterClass(uc16 type,
                                                            Label* on_no_match) {
   // Range checks (c in min..max) are generally implemented by an unsigned
@@ -1085,6 +1232,14 @@ Handle<HeapObject> RegExpMacroAssemblerARM64::GetCode(Handle<String> source) {
     __ Ret();
   }
 
+  if (fallback_label_.is_linked()) {
+    // Backtrack limit exceeded in a pattern that the linear-time engine
+    // can handle.
+    __ Bind(&fallback_label_);
+    __ Mov(w0, FALLBACK_TO_LINEAR);
+    __ B(&return_w0);
+  }
+
   if (exit_with_exception.is_linked()) {
     __ Bind(&exit_with_exception);
     __ Mov(w0, EXCEPTION);
@@ -59,6 +59,11 @@ class V8_EXPORT_PRIVATE RegExpMacroAssemblerARM64
                                         uc16 to,
                                         Label* on_not_in_range);
   virtual void CheckBitInTable(Handle<ByteArray> table, Label* on_bit_set);
+  virtual void SkipUntilChar(int cp_offset, int advance_by, unsigned c);
+  virtual void SkipUntilCharAfterAnd(int cp_offset, int advance_by, unsigned c,
+                                     unsigned and_with);
+  virtual void SkipUntilBitInTable(int cp_offset, int advance_by,
+                                   Handle<ByteArray> table);
 
   // Checks whether the given offset from the current position is before
   // the end of the string.
@@ -143,6 +148,25 @@ class V8_EXPORT_PRIVATE RegExpMacroAssemblerARM64
   // current position, into the current-character register.
   void LoadCurrentCharacterUnchecked(int cp_offset, int character_count);
 
+  // The maximal number of characters SkipUntilCharsSimd can look for.
+  static const int kMaxSimdSkipChars = 4;
+
+  // Scan the input 16 bytes at a time for a character at cp_offset that is
+  // one of the given characters, after and'ing it with kTableMask if
+  // {masked}.  Branches to {on_found} with the current position at the first
+  // such character, and falls through once fewer than 16 bytes are left.
+  void SkipUntilCharsSimd(int cp_offset, const uc16* chars, int count,
+                          bool masked, Label* on_found);
+  // Like SkipUntilCharsSimd, but for the characters whose byte in {table} is
+  // non-zero.  Latin1 only.
+  void SkipUntilBitInTableSimd(int cp_offset, Handle<ByteArray> table,
+                               Label* on_found);
+  // Emit the part of the SIMD scan loops that checks the bounds and loads
+  // the next 16 bytes into v0, and the part that finds the first match in
+  // the byte mask in v1.
+  void SkipUntilSimdLoopHeader(int cp_offset, Label* loop, Label* exit);
+  void SkipUntilSimdLoopFooter(Label* loop, Label* on_found);
+
   // Check whether preemption has been requested.
   void CheckPreemption();
 
@@ -284,6 +308,7 @@ class V8_EXPORT_PRIVATE RegExpMacroAssemblerARM64
   Label exit_label_;
   Label check_preempt_label_;
   Label stack_overflow_label_;
+  Label fallback_label_;
 };
 
 }  // namespace internal
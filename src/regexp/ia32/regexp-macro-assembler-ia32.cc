@@ -116,6 +116,7 @@ RegExpMacroAssemblerIA32::~RegExpMacroAssemblerIA32() {
   exit_label_.Unuse();
   check_preempt_label_.Unuse();
   stack_overflow_label_.Unuse();
+  fallback_label_.Unuse();
 }
 
 
@@ -148,8 +149,13 @@ void RegExpMacroAssemblerIA32::Backtrack() {
     __ cmp(Operand(ebp, kBacktrackCount), Immediate(backtrack_limit()));
     __ j(not_equal, &next);
 
-    // Exceeded limits are treated as a failed match.
-    Fail();
+    // Exceeded limits are treated as a failed match, unless the pattern
+    // can be handed over to the linear-time engine.
+    if (can_fallback()) {
+      __ jmp(&fallback_label_);
+    } else {
+      Fail();
+    }
 
     __ bind(&next);
   }
@@ -929,6 +935,14 @@ Handle<HeapObject> RegExpMacroAssemblerIA32::GetCode(Handle<String> source) {
     SafeReturn();
   }
 
+  if (fallback_label_.is_linked()) {
+    // Backtrack limit exceeded in a pattern that the linear-time engine
+    // can handle.
+    __ bind(&fallback_label_);
+    __ mov(eax, FALLBACK_TO_LINEAR);
+    __ jmp(&return_eax);
+  }
+
   if (exit_with_exception.is_linked()) {
     // If any of the code above needed to exit with an exception.
     __ bind(&exit_with_exception);
@@ -128,6 +128,7 @@ RegExpMacroAssemblerMIPS::~RegExpMacroAssemblerMIPS() {
   exit_label_.Unuse();
   check_preempt_label_.Unuse();
   stack_overflow_label_.Unuse();
+  fallback_label_.Unuse();
   internal_failure_label_.Unuse();
 }
 
@@ -165,8 +166,13 @@ void RegExpMacroAssemblerMIPS::Backtrack() {
     __ Sw(a0, MemOperand(frame_pointer(), kBacktrackCount));
     __ Branch(&next, ne, a0, Operand(backtrack_limit()));
 
-    // Exceeded limits are treated as a failed match.
-    Fail();
+    // Exceeded limits are treated as a failed match, unless the pattern
+    // can be handed over to the linear-time engine.
+    if (can_fallback()) {
+      __ jmp(&fallback_label_);
+    } else {
+      Fail();
+    }
 
     __ bind(&next);
   }
@@ -900,6 +906,14 @@ Handle<HeapObject> RegExpMacroAssemblerMIPS::GetCode(Handle<String> source) {
       SafeReturn();
     }
 
+    if (fallback_label_.is_linked()) {
+      // Backtrack limit exceeded in a pattern that the linear-time engine
+      // can handle.
+      __ bind(&fallback_label_);
+      __ li(v0, Operand(FALLBACK_TO_LINEAR));
+      __ jmp(&return_v0);
+    }
+
     if (exit_with_exception.is_linked()) {
       // If any of the code above needed to exit with an exception.
       __ bind(&exit_with_exception);
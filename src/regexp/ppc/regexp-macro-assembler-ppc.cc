@@ -135,6 +135,7 @@ RegExpMacroAssemblerPPC::~RegExpMacroAssemblerPPC() {
   exit_label_.Unuse();
   check_preempt_label_.Unuse();
   stack_overflow_label_.Unuse();
+  fallback_label_.Unuse();
   internal_failure_label_.Unuse();
 }
 
@@ -179,8 +180,13 @@ void RegExpMacroAssemblerPPC::Backtrack() {
     __ cmpi(r3, Operand(backtrack_limit()));
     __ bne(&next);
 
-    // Exceeded limits are treated as a failed match.
-    Fail();
+    // Exceeded limits are treated as a failed match, unless the pattern
+    // can be handed over to the linear-time engine.
+    if (can_fallback()) {
+      __ b(&fallback_label_);
+    } else {
+      Fail();
+    }
 
     __ bind(&next);
   }
@@ -941,6 +947,14 @@ Handle<HeapObject> RegExpMacroAssemblerPPC::GetCode(Handle<String> source) {
       SafeReturn();
     }
 
+    if (fallback_label_.is_linked()) {
+      // Backtrack limit exceeded in a pattern that the linear-time engine
+      // can handle.
+      __ bind(&fallback_label_);
+      __ li(r3, Operand(FALLBACK_TO_LINEAR));
+      __ b(&return_r3);
+    }
+
     if (exit_with_exception.is_linked()) {
       // If any of the code above needed to exit with an exception.
       __ bind(&exit_with_exception);
@@ -0,0 +1,154 @@
+// Copyright 2020 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "src/regexp/regexp-bytecode-cache.h"
+
+#include "src/base/functional.h"
+#include "src/base/lazy-instance.h"
+#include "src/execution/isolate.h"
+#include "src/flags/flags.h"
+#include "src/heap/factory.h"
+#include "src/objects/objects-inl.h"
+
+namespace v8 {
+namespace internal {
+
+namespace {
+
+DEFINE_LAZY_LEAKY_OBJECT_GETTER(RegExpBytecodeCache,
+                                GetProcessWideRegExpBytecodeCache,
+                                FLAG_regexp_shared_bytecode_cache_size * KB)
+
+}  // namespace
+
+bool RegExpBytecodeCache::Key::operator==(const Key& other) const {
+  return flags == other.flags && is_one_byte == other.is_one_byte &&
+         backtrack_limit == other.backtrack_limit &&
+         flag_hash == other.flag_hash && pattern == other.pattern;
+}
+
+size_t RegExpBytecodeCache::KeyHash::operator()(const Key& key) const {
+  return base::hash_combine(
+      base::hash_range(key.pattern.begin(), key.pattern.end()), key.flags,
+      key.is_one_byte, key.backtrack_limit, key.flag_hash);
+}
+
+RegExpBytecodeCache::RegExpBytecodeCache(size_t capacity)
+    : capacity_(capacity) {}
+
+// static
+RegExpBytecodeCache* RegExpBytecodeCache::GetProcessWideCache() {
+  return GetProcessWideRegExpBytecodeCache();
+}
+
+// static
+RegExpBytecodeCache::Key RegExpBytecodeCache::MakeKey(
+    Handle<String> pattern, JSRegExp::Flags flags, bool is_one_byte,
+    uint32_t backtrack_limit) {
+  Key key;
+  key.flags = static_cast<int>(flags);
+  key.is_one_byte = is_one_byte;
+  key.backtrack_limit = backtrack_limit;
+  key.flag_hash = FlagList::Hash();
+  DisallowHeapAllocation no_gc;
+  String::FlatContent content = pattern->GetFlatContent(no_gc);
+  DCHECK(content.IsFlat());
+  if (content.IsOneByte()) {
+    Vector<const uint8_t> chars = content.ToOneByteVector();
+    key.pattern.assign(chars.begin(), chars.end());
+  } else {
+    Vector<const uc16> chars = content.ToUC16Vector();
+    key.pattern.assign(chars.begin(), chars.end());
+  }
+  return key;
+}
+
+bool RegExpBytecodeCache::Lookup(Isolate* isolate, Handle<String> pattern,
+                                 JSRegExp::Flags flags, bool is_one_byte,
+                                 uint32_t backtrack_limit,
+                                 Handle<ByteArray>* bytecode,
+                                 int* register_count) {
+  Key key = MakeKey(pattern, flags, is_one_byte, backtrack_limit);
+  std::shared_ptr<const Entry> entry;
+  {
+    base::MutexGuard guard(&mutex_);
+    auto it = entries_.find(key);
+    if (it == entries_.end()) {
+      misses_++;
+      return false;
+    }
+    hits_++;
+    Node& node = it->second;
+    lru_.splice(lru_.begin(), lru_, node.lru_position);
+    entry = node.entry;
+  }
+
+  // Copy the bytecode outside of {mutex_}, since allocating may trigger a GC.
+  int length = static_cast<int>(entry->bytecode.size());
+  *bytecode = isolate->factory()->NewByteArray(length, AllocationType::kOld);
+  (*bytecode)->copy_in(0, entry->bytecode.data(), length);
+  *register_count = entry->register_count;
+  return true;
+}
+
+void RegExpBytecodeCache::Insert(Handle<String> pattern, JSRegExp::Flags flags,
+                                 bool is_one_byte, uint32_t backtrack_limit,
+                                 Handle<ByteArray> bytecode,
+                                 int register_count) {
+  Key key = MakeKey(pattern, flags, is_one_byte, backtrack_limit);
+  size_t size = sizeof(Key) + sizeof(Node) + sizeof(Entry) +
+                key.pattern.size() * sizeof(uc16) + bytecode->length();
+  if (size > capacity_) return;
+
+  auto entry = std::make_shared<Entry>();
+  entry->bytecode.assign(bytecode->GetDataStartAddress(),
+                         bytecode->GetDataEndAddress());
+  entry->register_count = register_count;
+
+  base::MutexGuard guard(&mutex_);
+  auto result = entries_.emplace(std::move(key), Node());
+  // Another isolate may have compiled the same pattern concurrently.
+  if (!result.second) return;
+  Node& node = result.first->second;
+  node.entry = std::move(entry);
+  node.size = size;
+  lru_.push_front(&result.first->first);
+  node.lru_position = lru_.begin();
+  size_ += size;
+  Shrink();
+}
+
+void RegExpBytecodeCache::Shrink() {
+  while (size_ > capacity_) {
+    DCHECK(!lru_.empty());
+    auto it = entries_.find(*lru_.back());
+    DCHECK(it != entries_.end());
+    size_ -= it->second.size;
+    lru_.pop_back();
+    entries_.erase(it);
+  }
+}
+
+size_t RegExpBytecodeCache::size() {
+  base::MutexGuard guard(&mutex_);
+  return size_;
+}
+
+size_t RegExpBytecodeCache::number_of_entries() {
+  base::MutexGuard guard(&mutex_);
+  return entries_.size();
+}
+
+size_t RegExpBytecodeCache::hits() {
+  base::MutexGuard guard(&mutex_);
+  return hits_;
+}
+
+size_t RegExpBytecodeCache::misses() {
+  base::MutexGuard guard(&mutex_);
+  return misses_;
+}
+
+}  // namespace internal
+}  // namespace v8
@@ -0,0 +1,105 @@
+// Copyright 2020 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#ifndef V8_REGEXP_REGEXP_BYTECODE_CACHE_H_
+#define V8_REGEXP_REGEXP_BYTECODE_CACHE_H_
+
+#include <list>
+#include <memory>
+#include <unordered_map>
+#include <vector>
+
+#include "src/base/platform/mutex.h"
+#include "src/common/globals.h"
+#include "src/objects/js-regexp.h"
+
+namespace v8 {
+namespace internal {
+
+// A process-wide cache of irregexp bytecode, keyed by the pattern and
+// everything else that goes into compiling it. Bytecode does not refer to
+// any heap objects, so isolates can adopt bytecode compiled by another
+// isolate, or compiled by themselves for a regexp that has since been
+// dropped from their compilation cache. Native code embeds isolate-specific
+// addresses and is not shared.
+//
+// Once the cache grows beyond its capacity, the least recently used entries
+// are dropped.
+class V8_EXPORT_PRIVATE RegExpBytecodeCache final {
+ public:
+  explicit RegExpBytecodeCache(size_t capacity);
+  RegExpBytecodeCache(const RegExpBytecodeCache&) = delete;
+  RegExpBytecodeCache& operator=(const RegExpBytecodeCache&) = delete;
+
+  // The cache shared by all isolates, sized by
+  // --regexp-shared-bytecode-cache-size.
+  static RegExpBytecodeCache* GetProcessWideCache();
+
+  // Copies the bytecode for the flat {pattern} compiled with the given
+  // parameters into a new ByteArray on the heap of {isolate}. Returns false
+  // if the cache holds no such bytecode.
+  bool Lookup(Isolate* isolate, Handle<String> pattern, JSRegExp::Flags flags,
+              bool is_one_byte, uint32_t backtrack_limit,
+              Handle<ByteArray>* bytecode, int* register_count);
+
+  // Adds the bytecode for the flat {pattern} compiled with the given
+  // parameters.
+  void Insert(Handle<String> pattern, JSRegExp::Flags flags, bool is_one_byte,
+              uint32_t backtrack_limit, Handle<ByteArray> bytecode,
+              int register_count);
+
+  size_t capacity() const { return capacity_; }
+  size_t size();
+  size_t number_of_entries();
+  size_t hits();
+  size_t misses();
+
+ private:
+  struct Key {
+    std::vector<uc16> pattern;
+    int flags;
+    bool is_one_byte;
+    uint32_t backtrack_limit;
+    // Hash of the V8 flags, some of which change the generated bytecode.
+    uint32_t flag_hash;
+
+    bool operator==(const Key& other) const;
+  };
+
+  struct KeyHash {
+    size_t operator()(const Key& key) const;
+  };
+
+  struct Entry {
+    std::vector<byte> bytecode;
+    int register_count;
+  };
+
+  struct Node {
+    std::shared_ptr<const Entry> entry;
+    size_t size;
+    std::list<const Key*>::iterator lru_position;
+  };
+
+  static Key MakeKey(Handle<String> pattern, JSRegExp::Flags flags,
+                     bool is_one_byte, uint32_t backtrack_limit);
+
+  // Drops the least recently used entries until the cache fits into its
+  // capacity again. Requires {mutex_} to be held.
+  void Shrink();
+
+  const size_t capacity_;
+  base::Mutex mutex_;
+  std::unordered_map<Key, Node, KeyHash> entries_;
+  // The keys of {entries_}, most recently used first.
+  std::list<const Key*> lru_;
+  size_t size_ = 0;
+  size_t hits_ = 0;
+  size_t misses_ = 0;
+};
+
+}  // namespace internal
+}  // namespace v8
+
+#endif  // V8_REGEXP_REGEXP_BYTECODE_CACHE_H_
@@ -446,8 +446,12 @@ IrregexpInterpreter::Result RawMatch(Isolate* isolate, ByteArray code_array,
     BYTECODE(POP_BT) {
       STATIC_ASSERT(JSRegExp::kNoBacktrackLimit == 0);
       if (++backtrack_count == backtrack_limit) {
-        // Exceeded limits are treated as a failed match.
-        return IrregexpInterpreter::FAILURE;
+        // Exceeded limits are treated as a failed match, unless the bytecode
+        // hands the pattern over to the linear-time engine.
+        int return_code = insn >> BYTECODE_SHIFT;
+        DCHECK(return_code == IrregexpInterpreter::FAILURE ||
+               return_code == IrregexpInterpreter::FALLBACK_TO_LINEAR);
+        return static_cast<IrregexpInterpreter::Result>(return_code);
       }
 
       IrregexpInterpreter::Result return_code =
@@ -19,6 +19,7 @@ class V8_EXPORT_PRIVATE IrregexpInterpreter : public AllStatic {
     SUCCESS = RegExp::kInternalRegExpSuccess,
     EXCEPTION = RegExp::kInternalRegExpException,
     RETRY = RegExp::kInternalRegExpRetry,
+    FALLBACK_TO_LINEAR = RegExp::kInternalRegExpFallbackToLinear,
   };
 
   // In case a StackOverflow occurs, a StackOverflowException is created and
@@ -33,6 +34,8 @@ class V8_EXPORT_PRIVATE IrregexpInterpreter : public AllStatic {
   // responsible for creating the exception.
   // RETRY is returned if a retry through the runtime is needed (e.g. when
   // interrupts have been scheduled or the regexp is marked for tier-up).
+  // FALLBACK_TO_LINEAR is returned if the backtrack limit was exceeded in a
+  // pattern that the linear-time engine can handle.
   // Arguments input_start, input_end and backtrack_stack are
   // unused. They are only passed to match the signature of the native irregex
   // code.
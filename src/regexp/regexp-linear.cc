@@ -0,0 +1,613 @@
+// Copyright 2020 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "src/regexp/regexp-linear.h"
+
+#include <algorithm>
+#include <memory>
+#include <vector>
+
+#include "src/execution/isolate.h"
+#include "src/heap/factory.h"
+#include "src/objects/js-regexp-inl.h"
+#include "src/regexp/regexp-ast.h"
+#include "src/regexp/regexp-compiler.h"
+#include "src/strings/char-predicates-inl.h"
+#include "src/zone/zone-containers.h"
+
+namespace v8 {
+namespace internal {
+
+namespace {
+
+struct Instruction {
+  enum Opcode : int32_t {
+    // Consumes one character in one of the {a} RANGE instructions that
+    // follow.
+    CONSUME_RANGES,
+    // The characters from {a} to {b}, both inclusive.
+    RANGE,
+    // Checks the RegExpAssertion::AssertionType {a} at the current position.
+    ASSERTION,
+    // Continues at the next instruction and, with lower priority, at {a}.
+    FORK,
+    // Continues at {a}.
+    JUMP,
+    // Sets register {a} to the current position.
+    SET_REGISTER,
+    // Clears the registers from {a} to {b}, both inclusive.
+    CLEAR_REGISTERS,
+    // Reports a match.
+    ACCEPT,
+  };
+
+  int32_t opcode;
+  int32_t a;
+  int32_t b;
+};
+STATIC_ASSERT(sizeof(Instruction) == 3 * kInt32Size);
+
+// A program starts with a header word that is 1 if the pattern is anchored at
+// the start of the subject, followed by the instructions.
+constexpr int kAnchoredAtStartIndex = 0;
+constexpr int kInstructionsOffset = kInt32Size;
+
+// Quantifiers with large bounds are unrolled into large programs, and the
+// registers of each thread are copied when it advances. Leave such patterns
+// to irregexp.
+constexpr size_t kMaxProgramLength = 1 << 13;
+
+// A thread list holds at most one thread per instruction that consumes a
+// character or accepts. Patterns whose lists may need more registers than
+// this are left to irregexp, so that the buffers of a match stay small.
+constexpr size_t kMaxThreadListRegisters = 1 << 18;
+
+class Compiler {
+ public:
+  explicit Compiler(Zone* zone) : zone_(zone), code_(zone) {}
+
+  // Returns false if the pattern is not supported.
+  bool Compile(RegExpTree* tree, JSRegExp::Flags flags) {
+    if (IgnoreCase(flags) || IsUnicode(flags)) return false;
+    Emit(Instruction::SET_REGISTER, RegExpCapture::StartRegister(0));
+    if (!Visit(tree)) return false;
+    Emit(Instruction::SET_REGISTER, RegExpCapture::EndRegister(0));
+    Emit(Instruction::ACCEPT);
+    if (code_.size() > kMaxProgramLength) return false;
+    size_t max_threads = 0;
+    int max_register = 0;
+    for (const Instruction& insn : code_) {
+      switch (insn.opcode) {
+        case Instruction::CONSUME_RANGES:
+        case Instruction::ACCEPT:
+          max_threads++;
+          break;
+        case Instruction::SET_REGISTER:
+          max_register = std::max(max_register, insn.a);
+          break;
+        case Instruction::CLEAR_REGISTERS:
+          max_register = std::max(max_register, insn.b);
+          break;
+      }
+    }
+    return max_threads * (max_register + 1) <= kMaxThreadListRegisters;
+  }
+
+  const ZoneVector<Instruction>& code() const { return code_; }
+
+ private:
+  int pc() const { return static_cast<int>(code_.size()); }
+
+  int Emit(Instruction::Opcode opcode, int a = 0, int b = 0) {
+    code_.push_back({opcode, a, b});
+    return pc() - 1;
+  }
+
+  // Points the FORK or JUMP at {pc} to the next instruction to be emitted.
+  void PatchToHere(int pc) { code_[pc].a = this->pc(); }
+
+  bool Visit(RegExpTree* tree) {
+    if (code_.size() > kMaxProgramLength) return false;
+    if (tree->IsDisjunction()) return VisitDisjunction(tree->AsDisjunction());
+    if (tree->IsAlternative()) {
+      for (RegExpTree* node : *tree->AsAlternative()->nodes()) {
+        if (!Visit(node)) return false;
+      }
+      return true;
+    }
+    if (tree->IsAssertion()) {
+      Emit(Instruction::ASSERTION, tree->AsAssertion()->assertion_type());
+      return true;
+    }
+    if (tree->IsCharacterClass()) {
+      return VisitCharacterClass(tree->AsCharacterClass());
+    }
+    if (tree->IsAtom()) return VisitAtom(tree->AsAtom());
+    if (tree->IsText()) {
+      for (const TextElement& element : *tree->AsText()->elements()) {
+        bool ok = element.text_type() == TextElement::ATOM
+                      ? VisitAtom(element.atom())
+                      : VisitCharacterClass(element.char_class());
+        if (!ok) return false;
+      }
+      return true;
+    }
+    if (tree->IsQuantifier()) return VisitQuantifier(tree->AsQuantifier());
+    if (tree->IsCapture()) {
+      RegExpCapture* capture = tree->AsCapture();
+      Emit(Instruction::SET_REGISTER,
+           RegExpCapture::StartRegister(capture->index()));
+      if (!Visit(capture->body())) return false;
+      Emit(Instruction::SET_REGISTER,
+           RegExpCapture::EndRegister(capture->index()));
+      return true;
+    }
+    if (tree->IsGroup()) return Visit(tree->AsGroup()->body());
+    if (tree->IsEmpty()) return true;
+    // Lookarounds and back references need backtracking.
+    DCHECK(tree->IsLookaround() || tree->IsBackReference());
+    return false;
+  }
+
+  bool VisitDisjunction(RegExpDisjunction* disjunction) {
+    ZoneList<RegExpTree*>* alternatives = disjunction->alternatives();
+    ZoneVector<int> jumps(zone_);
+    for (int i = 0; i < alternatives->length() - 1; i++) {
+      int fork = Emit(Instruction::FORK);
+      if (!Visit(alternatives->at(i))) return false;
+      jumps.push_back(Emit(Instruction::JUMP));
+      PatchToHere(fork);
+    }
+    if (!Visit(alternatives->last())) return false;
+    for (int jump : jumps) PatchToHere(jump);
+    return true;
+  }
+
+  bool VisitCharacterClass(RegExpCharacterClass* char_class) {
+    if (IgnoreCase(char_class->flags())) return false;
+    // Canonicalize a copy, the tree may still be compiled by irregexp.
+    ZoneList<CharacterRange>* ranges =
+        new (zone_) ZoneList<CharacterRange>(*char_class->ranges(zone_), zone_);
+    CharacterRange::Canonicalize(ranges);
+    if (char_class->is_negated()) {
+      ZoneList<CharacterRange>* negated =
+          new (zone_) ZoneList<CharacterRange>(2, zone_);
+      CharacterRange::Negate(ranges, negated, zone_);
+      ranges = negated;
+    }
+    Emit(Instruction::CONSUME_RANGES, ranges->length());
+    for (const CharacterRange& range : *ranges) {
+      Emit(Instruction::RANGE, range.from(), range.to());
+    }
+    return true;
+  }
+
+  bool VisitAtom(RegExpAtom* atom) {
+    if (atom->ignore_case()) return false;
+    for (uc16 c : atom->data()) {
+      Emit(Instruction::CONSUME_RANGES, 1);
+      Emit(Instruction::RANGE, c, c);
+    }
+    return true;
+  }
+
+  bool VisitQuantifier(RegExpQuantifier* quantifier) {
+    RegExpTree* body = quantifier->body();
+    if (quantifier->is_possessive()) return false;
+    // Optional iterations that match the empty string fail in ECMA-262.
+    if (quantifier->max() > quantifier->min() && body->min_match() == 0) {
+      return false;
+    }
+    Interval captures = body->CaptureRegisters();
+
+    // Captures in the body are reset at the start of every iteration.
+    auto visit_iteration = [&]() {
+      if (!captures.is_empty()) {
+        Emit(Instruction::CLEAR_REGISTERS, captures.from(), captures.to());
+      }
+      return Visit(body);
+    };
+
+    for (int i = 0; i < quantifier->min(); i++) {
+      if (!visit_iteration()) return false;
+    }
+    if (quantifier->max() == RegExpTree::kInfinity) {
+      int loop = pc();
+      if (quantifier->is_greedy()) {
+        //   loop: FORK end
+        //         <body>
+        //         JUMP loop
+        //   end:
+        int fork = Emit(Instruction::FORK);
+        if (!visit_iteration()) return false;
+        Emit(Instruction::JUMP, loop);
+        PatchToHere(fork);
+      } else {
+        //   loop: FORK iteration
+        //         JUMP end
+        //   iteration:
+        //         <body>
+        //         JUMP loop
+        //   end:
+        int fork = Emit(Instruction::FORK);
+        int exit = Emit(Instruction::JUMP);
+        PatchToHere(fork);
+        if (!visit_iteration()) return false;
+        Emit(Instruction::JUMP, loop);
+        PatchToHere(exit);
+      }
+      return true;
+    }
+    ZoneVector<int> exits(zone_);
+    for (int i = quantifier->min(); i < quantifier->max(); i++) {
+      if (quantifier->is_greedy()) {
+        exits.push_back(Emit(Instruction::FORK));
+      } else {
+        int fork = Emit(Instruction::FORK);
+        exits.push_back(Emit(Instruction::JUMP));
+        PatchToHere(fork);
+      }
+      if (!visit_iteration()) return false;
+    }
+    for (int exit : exits) PatchToHere(exit);
+    return true;
+  }
+
+  Zone* zone_;
+  ZoneVector<Instruction> code_;
+};
+
+inline bool IsLineTerminator(uc16 c) {
+  return c == '\n' || c == '\r' || c == 0x2028 || c == 0x2029;
+}
+
+template <typename Char>
+class PikeVM {
+ public:
+  enum Status { kMatched, kFailed, kInterrupted };
+
+  PikeVM(Isolate* isolate, RegExpLinearBuffers* buffers, int register_count,
+         int index, bool anchored)
+      : isolate_(isolate),
+        buffers_(buffers),
+        register_count_(register_count),
+        anchored_(anchored),
+        position_(index) {
+    buffers_->scratch_registers.resize(register_count);
+  }
+
+  // Runs the match until it is decided, or until an interrupt is requested.
+  // In the latter case, the match continues where it left off with the next
+  // call, which passes the program and the subject again since they may have
+  // moved in the meantime.
+  Status Run(Vector<const Instruction> code, Vector<const Char> subject,
+             int32_t* output) {
+    code_ = code;
+    subject_ = subject;
+    if (buffers_->visited.size() < code.size()) {
+      buffers_->visited.resize(code.size(), 0);
+    }
+    if (!started_) {
+      started_ = true;
+      NextGeneration();
+      Clear(current());
+      AddThreads(current(), 0, nullptr, position_);
+    }
+
+    StackLimitCheck check(isolate_);
+    while (true) {
+      if (check.InterruptRequested()) return kInterrupted;
+      const bool at_end = position_ == subject_.length();
+      const Char c = at_end ? 0 : subject_[position_];
+      RegExpLinearBuffers::ThreadList* current = this->current();
+      RegExpLinearBuffers::ThreadList* next = this->next();
+      NextGeneration();
+      Clear(next);
+      for (size_t i = 0; i < current->pcs.size(); i++) {
+        int pc = current->pcs[i];
+        const int32_t* registers = &current->registers[i * register_count_];
+        if (code_[pc].opcode == Instruction::ACCEPT) {
+          // All remaining threads have a lower priority than this match. The
+          // threads that already advanced have a higher priority and may
+          // still find a preferred match.
+          std::copy(registers, registers + register_count_, output);
+          matched_ = true;
+          break;
+        }
+        DCHECK_EQ(Instruction::CONSUME_RANGES, code_[pc].opcode);
+        if (!at_end && Consumes(pc, c)) {
+          AddThreads(next, pc + 1 + code_[pc].a, registers, position_ + 1);
+        }
+      }
+      if (at_end) break;
+      current_ ^= 1;
+      position_++;
+      current = next;
+      // Threads starting at later positions have the lowest priority. They
+      // share the visited marks of the threads advanced to the same position.
+      if (!matched_ && !anchored_) {
+        AddThreads(current, 0, nullptr, position_);
+      }
+      if (current->pcs.empty() && (matched_ || anchored_)) break;
+    }
+    return matched_ ? kMatched : kFailed;
+  }
+
+ private:
+  using WorkItem = RegExpLinearBuffers::WorkItem;
+
+  RegExpLinearBuffers::ThreadList* current() {
+    return &buffers_->lists[current_];
+  }
+  RegExpLinearBuffers::ThreadList* next() {
+    return &buffers_->lists[current_ ^ 1];
+  }
+
+  // Keeps the capacity of the list for the next position and the next match.
+  static void Clear(RegExpLinearBuffers::ThreadList* list) {
+    list->pcs.clear();
+    list->registers.clear();
+  }
+
+  void NextGeneration() {
+    if (buffers_->generation == kMaxInt) {
+      std::fill(buffers_->visited.begin(), buffers_->visited.end(), 0);
+      buffers_->generation = 0;
+    }
+    buffers_->generation++;
+  }
+
+  // Follows all paths from {pc} that do not consume a character and adds a
+  // thread to {list} for every instruction reached that does, in priority
+  // order. Instructions already visited for {list} are skipped, since they
+  // were reached with a higher priority. The registers of the new threads
+  // start out as {registers}, or cleared if that is null.
+  void AddThreads(RegExpLinearBuffers::ThreadList* list, int pc,
+                  const int32_t* registers, int position) {
+    std::vector<int32_t>& scratch_registers = buffers_->scratch_registers;
+    std::vector<WorkItem>& work_list = buffers_->work_list;
+    std::vector<int>& visited = buffers_->visited;
+    if (registers == nullptr) {
+      std::fill(scratch_registers.begin(), scratch_registers.end(), -1);
+    } else {
+      std::copy(registers, registers + register_count_,
+                scratch_registers.begin());
+    }
+    work_list.push_back({WorkItem::kExplore, pc, 0});
+    while (!work_list.empty()) {
+      WorkItem item = work_list.back();
+      work_list.pop_back();
+      if (item.kind == WorkItem::kRestoreRegister) {
+        scratch_registers[item.index] = item.value;
+        continue;
+      }
+      pc = item.index;
+      if (visited[pc] == buffers_->generation) continue;
+      visited[pc] = buffers_->generation;
+      const Instruction& insn = code_[pc];
+      switch (insn.opcode) {
+        case Instruction::CONSUME_RANGES:
+        case Instruction::ACCEPT:
+          list->pcs.push_back(pc);
+          list->registers.insert(list->registers.end(),
+                                 scratch_registers.begin(),
+                                 scratch_registers.end());
+          break;
+        case Instruction::ASSERTION:
+          if (CheckAssertion(insn.a, position)) Explore(pc + 1);
+          break;
+        case Instruction::FORK:
+          // Pushed in reverse order of priority.
+          Explore(insn.a);
+          Explore(pc + 1);
+          break;
+        case Instruction::JUMP:
+          Explore(insn.a);
+          break;
+        case Instruction::SET_REGISTER:
+          SetRegister(insn.a, position);
+          Explore(pc + 1);
+          break;
+        case Instruction::CLEAR_REGISTERS:
+          for (int reg = insn.a; reg <= insn.b; reg++) SetRegister(reg, -1);
+          Explore(pc + 1);
+          break;
+        case Instruction::RANGE:
+          UNREACHABLE();
+      }
+    }
+  }
+
+  void Explore(int pc) {
+    buffers_->work_list.push_back({WorkItem::kExplore, pc, 0});
+  }
+
+  // Sets a register for the instructions explored next, and restores it for
+  // the instructions explored before them.
+  void SetRegister(int reg, int32_t value) {
+    buffers_->work_list.push_back(
+        {WorkItem::kRestoreRegister, reg, buffers_->scratch_registers[reg]});
+    buffers_->scratch_registers[reg] = value;
+  }
+
+  bool Consumes(int pc, Char c) const {
+    // The ranges are sorted and do not overlap.
+    for (int i = 1; i <= code_[pc].a; i++) {
+      const Instruction& range = code_[pc + i];
+      DCHECK_EQ(Instruction::RANGE, range.opcode);
+      if (c < range.a) return false;
+      if (c <= range.b) return true;
+    }
+    return false;
+  }
+
+  bool IsWordCharacterAt(int position) const {
+    if (position < 0 || position >= subject_.length()) return false;
+    return IsRegExpWord(static_cast<uc16>(subject_[position]));
+  }
+
+  bool CheckAssertion(int type, int position) const {
+    switch (type) {
+      case RegExpAssertion::START_OF_INPUT:
+        return position == 0;
+      case RegExpAssertion::END_OF_INPUT:
+        return position == subject_.length();
+      case RegExpAssertion::START_OF_LINE:
+        return position == 0 || IsLineTerminator(subject_[position - 1]);
+      case RegExpAssertion::END_OF_LINE:
+        return position == subject_.length() ||
+               IsLineTerminator(subject_[position]);
+      case RegExpAssertion::BOUNDARY:
+        return IsWordCharacterAt(position - 1) != IsWordCharacterAt(position);
+      case RegExpAssertion::NON_BOUNDARY:
+        return IsWordCharacterAt(position - 1) == IsWordCharacterAt(position);
+    }
+    UNREACHABLE();
+  }
+
+  Isolate* const isolate_;
+  RegExpLinearBuffers* const buffers_;
+  const int register_count_;
+  const bool anchored_;
+
+  Vector<const Instruction> code_;
+  Vector<const Char> subject_;
+  // The position of the threads in the current list.
+  int position_;
+  int current_ = 0;
+  bool started_ = false;
+  bool matched_ = false;
+};
+
+// Claims the buffers of the isolate for a match, or separate buffers if the
+// match was started by an interrupt of another match.
+class BuffersScope {
+ public:
+  explicit BuffersScope(Isolate* isolate)
+      : cached_(isolate->regexp_linear_buffers()) {
+    if (cached_->in_use) {
+      owned_.reset(new RegExpLinearBuffers());
+    } else {
+      cached_->in_use = true;
+    }
+  }
+  ~BuffersScope() {
+    if (!owned_) cached_->in_use = false;
+  }
+
+  RegExpLinearBuffers* buffers() {
+    return owned_ ? owned_.get() : cached_;
+  }
+
+ private:
+  RegExpLinearBuffers* const cached_;
+  std::unique_ptr<RegExpLinearBuffers> owned_;
+  DISALLOW_COPY_AND_ASSIGN(BuffersScope);
+};
+
+Vector<const Instruction> GetCode(ByteArray program) {
+  const int length = (program.length() - kInstructionsOffset) /
+                     static_cast<int>(sizeof(Instruction));
+  return Vector<const Instruction>(
+      reinterpret_cast<const Instruction*>(program.GetDataStartAddress() +
+                                           kInstructionsOffset),
+      length);
+}
+
+ByteArray GetProgram(JSRegExp regexp) {
+  // The program does not depend on the representation of the subject, see
+  // RegExpImpl::LinearInitialize.
+  return ByteArray::cast(
+      regexp.DataAt(JSRegExp::kIrregexpLatin1BytecodeIndex));
+}
+
+// Returns an IrregexpResult, or kInternalRegExpRetry if the representation of
+// the subject changed while handling interrupts and the match must start over.
+template <typename Char>
+int RunProgram(Isolate* isolate, Handle<JSRegExp> regexp,
+               Handle<String> subject, int index, int register_count,
+               int32_t* output) {
+  bool anchored = IsSticky(regexp->GetFlags()) ||
+                  GetProgram(*regexp).get_int(kAnchoredAtStartIndex) != 0;
+  BuffersScope buffers_scope(isolate);
+  PikeVM<Char> vm(isolate, buffers_scope.buffers(), register_count, index,
+                  anchored);
+  while (true) {
+    typename PikeVM<Char>::Status status;
+    {
+      DisallowHeapAllocation no_gc;
+      if (String::IsOneByteRepresentationUnderneath(*subject) !=
+          (sizeof(Char) == 1)) {
+        return RegExp::kInternalRegExpRetry;
+      }
+      status = vm.Run(GetCode(GetProgram(*regexp)),
+                      subject->GetCharVector<Char>(no_gc), output);
+    }
+    switch (status) {
+      case PikeVM<Char>::kMatched:
+        return RegExp::RE_SUCCESS;
+      case PikeVM<Char>::kFailed:
+        return RegExp::RE_FAILURE;
+      case PikeVM<Char>::kInterrupted:
+        if (isolate->stack_guard()->HandleInterrupts().IsException(isolate)) {
+          return RegExp::RE_EXCEPTION;
+        }
+        break;
+    }
+  }
+}
+
+}  // namespace
+
+// static
+bool RegExpLinear::CanBeHandled(RegExpTree* tree, JSRegExp::Flags flags,
+                                Zone* zone) {
+  Compiler compiler(zone);
+  return compiler.Compile(tree, flags);
+}
+
+// static
+Handle<ByteArray> RegExpLinear::Compile(Isolate* isolate, RegExpTree* tree,
+                                        JSRegExp::Flags flags, Zone* zone) {
+  Compiler compiler(zone);
+  CHECK(compiler.Compile(tree, flags));
+  const ZoneVector<Instruction>& code = compiler.code();
+  const int code_size = static_cast<int>(code.size() * sizeof(Instruction));
+  Handle<ByteArray> program = isolate->factory()->NewByteArray(
+      kInstructionsOffset + code_size, AllocationType::kOld);
+  program->set_int(kAnchoredAtStartIndex, tree->IsAnchoredAtStart() ? 1 : 0);
+  program->copy_in(kInstructionsOffset,
+                   reinterpret_cast<const byte*>(code.data()), code_size);
+  return program;
+}
+
+// static
+int RegExpLinear::Match(Isolate* isolate, Handle<JSRegExp> regexp,
+                        Handle<String> subject, int32_t* output,
+                        int output_size, int index) {
+  DCHECK_EQ(JSRegExp::LINEAR, regexp->TypeTag());
+  DCHECK(subject->IsFlat());
+  DCHECK_LE(0, index);
+  DCHECK_LE(index, subject->length());
+  const int register_count = (regexp->CaptureCount() + 1) * 2;
+  DCHECK_LE(register_count, output_size);
+  USE(output_size);
+
+  while (true) {
+    int result =
+        String::IsOneByteRepresentationUnderneath(*subject)
+            ? RunProgram<uint8_t>(isolate, regexp, subject, index,
+                                  register_count, output)
+            : RunProgram<uc16>(isolate, regexp, subject, index,
+                               register_count, output);
+    if (result != RegExp::kInternalRegExpRetry) {
+      DCHECK_IMPLIES(result == RegExp::RE_EXCEPTION,
+                     isolate->has_pending_exception());
+      return result;
+    }
+  }
+}
+
+}  // namespace internal
+}  // namespace v8
@@ -0,0 +1,85 @@
+// Copyright 2020 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#ifndef V8_REGEXP_REGEXP_LINEAR_H_
+#define V8_REGEXP_REGEXP_LINEAR_H_
+
+#include <vector>
+
+#include "src/regexp/regexp.h"
+
+namespace v8 {
+namespace internal {
+
+// A regexp engine that runs in time linear in the length of the subject
+// string. Patterns are compiled from the RegExpTree into a program for a
+// non-backtracking automaton, which is simulated breadth-first over all
+// threads of the pattern at once (Pike's VM). Threads are kept in priority
+// order, so matches and captures are the same as with irregexp.
+//
+// Back references and lookarounds are not supported, and neither are the
+// ignore-case and unicode flags. Quantified bodies that can match the empty
+// string are only supported if they are repeated a fixed number of times,
+// since the empty check of ECMA-262 depends on the order of backtracking.
+//
+// With --linear-regexp-engine, all supported patterns use the linear engine.
+// With --linear-regexp-engine-on-excessive-backtracks, supported patterns
+// start out in irregexp and switch to the linear engine once a match exceeds
+// --regexp-backtracks-before-fallback backtracks.
+class RegExpLinear final : public AllStatic {
+ public:
+  // Whether the linear engine supports the pattern.
+  V8_EXPORT_PRIVATE static bool CanBeHandled(RegExpTree* tree,
+                                             JSRegExp::Flags flags,
+                                             Zone* zone);
+
+  // Compiles a supported pattern into a program for the linear engine.
+  static Handle<ByteArray> Compile(Isolate* isolate, RegExpTree* tree,
+                                   JSRegExp::Flags flags, Zone* zone);
+
+  // Runs the program of {regexp} on the flat {subject}, starting from
+  // {index}. Unlike irregexp code, at most one match is found per call, even
+  // for global regexps. Returns RE_SUCCESS and stores the captures into the
+  // first (capture count + 1) * 2 elements of {output}, or RE_FAILURE.
+  // Interrupts are handled while matching. If that throws, sets a pending
+  // exception and returns RE_EXCEPTION.
+  static int Match(Isolate* isolate, Handle<JSRegExp> regexp,
+                   Handle<String> subject, int32_t* output, int output_size,
+                   int index);
+};
+
+// The memory for the threads of the linear engine. It is owned by the isolate
+// and reused across matches, and only grows as far as a match needs it.
+struct RegExpLinearBuffers {
+  // The threads at one position of the subject, in priority order.
+  struct ThreadList {
+    std::vector<int> pcs;
+    // The registers of the threads, one block of register count per thread.
+    std::vector<int32_t> registers;
+  };
+
+  struct WorkItem {
+    enum Kind { kExplore, kRestoreRegister };
+    Kind kind;
+    // The instruction to explore or the register to restore.
+    int index;
+    int32_t value;
+  };
+
+  ThreadList lists[2];
+  std::vector<int32_t> scratch_registers;
+  std::vector<WorkItem> work_list;
+  // Instructions visited while adding threads to a list are marked with the
+  // current generation.
+  std::vector<int> visited;
+  int generation = 0;
+  // Set while a match uses the buffers. Matches started by interrupts of
+  // that match use their own buffers.
+  bool in_use = false;
+};
+
+}  // namespace internal
+}  // namespace v8
+
+#endif  // V8_REGEXP_REGEXP_LINEAR_H_
@@ -342,6 +342,41 @@ void RegExpMacroAssemblerTracer::CheckBitInTable(
   assembler_->CheckBitInTable(table, on_bit_set);
 }
 
+void RegExpMacroAssemblerTracer::SkipUntilChar(int cp_offset, int advance_by,
+                                               unsigned c) {
+  PrintablePrinter printable(c);
+  PrintF(" SkipUntilChar(cp_offset=%d, advance_by=%d, c=0x%04x%s);\n",
+         cp_offset, advance_by, c, *printable);
+  assembler_->SkipUntilChar(cp_offset, advance_by, c);
+}
+
+void RegExpMacroAssemblerTracer::SkipUntilCharAfterAnd(int cp_offset,
+                                                       int advance_by,
+                                                       unsigned c,
+                                                       unsigned mask) {
+  PrintablePrinter printable(c);
+  PrintF(
+      " SkipUntilCharAfterAnd(cp_offset=%d, advance_by=%d, c=0x%04x%s, "
+      "mask=0x%04x);\n",
+      cp_offset, advance_by, c, *printable, mask);
+  assembler_->SkipUntilCharAfterAnd(cp_offset, advance_by, c, mask);
+}
+
+void RegExpMacroAssemblerTracer::SkipUntilBitInTable(int cp_offset,
+                                                     int advance_by,
+                                                     Handle<ByteArray> table) {
+  PrintF(" SkipUntilBitInTable(cp_offset=%d, advance_by=%d, ", cp_offset,
+         advance_by);
+  for (int i = 0; i < kTableSize; i++) {
+    PrintF("%c", table->get(i) != 0 ? 'X' : '.');
+    if (i % 32 == 31 && i != kTableMask) {
+      PrintF("\n                                 ");
+    }
+  }
+  PrintF(");\n");
+  assembler_->SkipUntilBitInTable(cp_offset, advance_by, table);
+}
+
 
 void RegExpMacroAssemblerTracer::CheckNotBackReference(int start_reg,
                                                        bool read_backward,
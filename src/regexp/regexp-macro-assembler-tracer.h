@@ -43,6 +43,11 @@ class RegExpMacroAssemblerTracer: public RegExpMacroAssembler {
   void CheckCharacterNotInRange(uc16 from, uc16 to,
                                 Label* on_not_in_range) override;
   void CheckBitInTable(Handle<ByteArray> table, Label* on_bit_set) override;
+  void SkipUntilChar(int cp_offset, int advance_by, unsigned c) override;
+  void SkipUntilCharAfterAnd(int cp_offset, int advance_by, unsigned c,
+                             unsigned and_with) override;
+  void SkipUntilBitInTable(int cp_offset, int advance_by,
+                           Handle<ByteArray> table) override;
   void CheckPosition(int cp_offset, Label* on_outside_input) override;
   bool CheckSpecialCharacterClass(uc16 type, Label* on_no_match) override;
   void Fail() override;
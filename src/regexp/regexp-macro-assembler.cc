@@ -105,6 +105,52 @@ bool RegExpMacroAssembler::CheckSpecialCharacterClass(uc16 type,
   return false;
 }
 
+void RegExpMacroAssembler::SkipUntilChar(int cp_offset, int advance_by,
+                                         unsigned c) {
+  Label cont, again;
+  Bind(&again);
+  LoadCurrentCharacter(cp_offset, &cont, true);
+  CheckCharacter(c, &cont);
+  AdvanceCurrentPosition(advance_by);
+  GoTo(&again);
+  Bind(&cont);
+}
+
+void RegExpMacroAssembler::SkipUntilCharAfterAnd(int cp_offset, int advance_by,
+                                                 unsigned c,
+                                                 unsigned and_with) {
+  Label cont, again;
+  Bind(&again);
+  LoadCurrentCharacter(cp_offset, &cont, true);
+  CheckCharacterAfterAnd(c, and_with, &cont);
+  AdvanceCurrentPosition(advance_by);
+  GoTo(&again);
+  Bind(&cont);
+}
+
+void RegExpMacroAssembler::SkipUntilBitInTable(int cp_offset, int advance_by,
+                                               Handle<ByteArray> table) {
+  Label cont, again;
+  Bind(&again);
+  LoadCurrentCharacter(cp_offset, &cont, true);
+  CheckBitInTable(table, &cont);
+  AdvanceCurrentPosition(advance_by);
+  GoTo(&again);
+  Bind(&cont);
+}
+
+// static
+int RegExpMacroAssembler::GetTableCharacters(Handle<ByteArray> table,
+                                             uc16* chars, int max_count) {
+  int count = 0;
+  for (int i = 0; i < kTableSize; i++) {
+    if (table->get(i) == 0) continue;
+    if (count == max_count) return -1;
+    chars[count++] = i;
+  }
+  return count;
+}
+
 NativeRegExpMacroAssembler::NativeRegExpMacroAssembler(Isolate* isolate,
                                                        Zone* zone)
     : RegExpMacroAssembler(isolate, zone) {}
@@ -268,7 +314,7 @@ int NativeRegExpMacroAssembler::Execute(
   int result =
       fn.Call(input.ptr(), start_offset, input_start, input_end, output,
               output_size, stack_base, call_origin, isolate, regexp.ptr());
-  DCHECK(result >= RETRY);
+  DCHECK_GE(result, FALLBACK_TO_LINEAR);
 
   if (result == EXCEPTION && !isolate->has_pending_exception()) {
     // We detected a stack overflow (on the backtrack stack) in RegExp code,
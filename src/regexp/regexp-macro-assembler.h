@@ -114,6 +114,21 @@ class RegExpMacroAssembler {
   // array, and if the found byte is non-zero, we jump to the on_bit_set label.
   virtual void CheckBitInTable(Handle<ByteArray> table, Label* on_bit_set) = 0;
 
+  // Advance the current position by {advance_by} until the character at
+  // {cp_offset} from it is {c}, or until that character would be outside the
+  // input.  Used to skip over positions where no match can start, so
+  // implementations may also stop at any position in between, e.g. to scan
+  // the input several characters at a time.
+  virtual void SkipUntilChar(int cp_offset, int advance_by, unsigned c);
+  // Like SkipUntilChar, but bitwise ands the character with the given
+  // constant before comparing it with c.
+  virtual void SkipUntilCharAfterAnd(int cp_offset, int advance_by, unsigned c,
+                                     unsigned and_with);
+  // Like SkipUntilChar, but stops at characters whose byte in the table is
+  // non-zero (see CheckBitInTable).
+  virtual void SkipUntilBitInTable(int cp_offset, int advance_by,
+                                   Handle<ByteArray> table);
+
   // Checks whether the given offset from the current position is before
   // the end of the string.  May overwrite the current character.
   virtual void CheckPosition(int cp_offset, Label* on_outside_input);
@@ -181,6 +196,10 @@ class RegExpMacroAssembler {
     backtrack_limit_ = backtrack_limit;
   }
 
+  // Set whether exceeding the backtrack limit hands the match over to the
+  // linear-time engine instead of failing it.
+  void set_can_fallback(bool val) { can_fallback_ = val; }
+
   enum GlobalMode {
     NOT_GLOBAL,
     GLOBAL_NO_ZERO_LENGTH_CHECK,
@@ -200,14 +219,23 @@ class RegExpMacroAssembler {
   Zone* zone() const { return zone_; }
 
  protected:
+  // Stores the indices of the non-zero bytes of a CheckBitInTable table into
+  // {chars} and returns how many there are, or -1 if there are more than
+  // {max_count}.
+  static int GetTableCharacters(Handle<ByteArray> table, uc16* chars,
+                                int max_count);
+
   bool has_backtrack_limit() const {
     return backtrack_limit_ != JSRegExp::kNoBacktrackLimit;
   }
   uint32_t backtrack_limit() const { return backtrack_limit_; }
 
+  bool can_fallback() const { return can_fallback_; }
+
  private:
   bool slow_safe_compiler_;
   uint32_t backtrack_limit_ = JSRegExp::kNoBacktrackLimit;
+  bool can_fallback_ = false;
   GlobalMode global_mode_;
   Isolate* isolate_;
   Zone* zone_;
@@ -232,6 +260,7 @@ class NativeRegExpMacroAssembler: public RegExpMacroAssembler {
     SUCCESS = RegExp::kInternalRegExpSuccess,
     EXCEPTION = RegExp::kInternalRegExpException,
     RETRY = RegExp::kInternalRegExpRetry,
+    FALLBACK_TO_LINEAR = RegExp::kInternalRegExpFallbackToLinear,
   };
 
   NativeRegExpMacroAssembler(Isolate* isolate, Zone* zone);
@@ -8,11 +8,13 @@
 #include "src/diagnostics/code-tracer.h"
 #include "src/heap/heap-inl.h"
 #include "src/objects/js-regexp-inl.h"
+#include "src/regexp/regexp-bytecode-cache.h"
 #include "src/regexp/regexp-bytecode-generator.h"
 #include "src/regexp/regexp-bytecodes.h"
 #include "src/regexp/regexp-compiler.h"
 #include "src/regexp/regexp-dotprinter.h"
 #include "src/regexp/regexp-interpreter.h"
+#include "src/regexp/regexp-linear.h"
 #include "src/regexp/regexp-macro-assembler-arch.h"
 #include "src/regexp/regexp-macro-assembler-tracer.h"
 #include "src/regexp/regexp-parser.h"
@@ -67,6 +69,28 @@ class RegExpImpl final : public AllStatic {
       Isolate* isolate, Handle<JSRegExp> regexp, Handle<String> subject,
       int index, Handle<RegExpMatchInfo> last_match_info);
 
+  // Prepares a JSRegExp object for the linear-time engine.
+  static void LinearInitialize(Isolate* isolate, Handle<JSRegExp> re,
+                               Handle<String> pattern, JSRegExp::Flags flags,
+                               RegExpCompileData* parse_result, Zone* zone);
+
+  // Switches an irregexp JSRegExp object that exceeded its backtrack limit to
+  // the linear-time engine. Returns false if an exception is pending.
+  static bool LinearSwitchFromIrregexp(Isolate* isolate, Handle<JSRegExp> re);
+
+  // Compiles the parsed pattern for the linear-time engine and stores the
+  // program in the data of {re}, which has the irregexp layout.
+  static void LinearCompile(Isolate* isolate, Handle<JSRegExp> re,
+                            RegExpCompileData* parse_result, Zone* zone);
+
+  // Execute a pattern with the linear-time engine.
+  // On a successful match, the result is a JSArray containing
+  // captured positions.  On a failure, the result is the null value.
+  // Returns an empty handle in case of an exception.
+  V8_WARN_UNUSED_RESULT static MaybeHandle<Object> LinearExec(
+      Isolate* isolate, Handle<JSRegExp> regexp, Handle<String> subject,
+      int index, Handle<RegExpMatchInfo> last_match_info);
+
   static bool CompileIrregexp(Isolate* isolate, Handle<JSRegExp> re,
                               Handle<String> sample_subject, bool is_one_byte);
   static inline bool EnsureCompiledIrregexp(Isolate* isolate,
@@ -193,7 +217,25 @@ MaybeHandle<Object> RegExp::Compile(Isolate* isolate, Handle<JSRegExp> re,
       has_been_compiled = true;
     }
   }
+  if (!has_been_compiled && FLAG_linear_regexp_engine &&
+      RegExpLinear::CanBeHandled(parse_result.tree, flags, &zone)) {
+    RegExpImpl::LinearInitialize(isolate, re, pattern, flags, &parse_result,
+                                 &zone);
+    has_been_compiled = true;
+  }
   if (!has_been_compiled) {
+    if (FLAG_linear_regexp_engine_on_excessive_backtracks &&
+        FLAG_regexp_backtracks_before_fallback !=
+            JSRegExp::kNoBacktrackLimit &&
+        RegExpLinear::CanBeHandled(parse_result.tree, flags, &zone)) {
+      // Irregexp code hands the match over to the linear-time engine once it
+      // exceeds the fallback threshold, or an explicit backtrack limit if that
+      // is lower.
+      if (backtrack_limit == JSRegExp::kNoBacktrackLimit ||
+          backtrack_limit > FLAG_regexp_backtracks_before_fallback) {
+        backtrack_limit = FLAG_regexp_backtracks_before_fallback;
+      }
+    }
     RegExpImpl::IrregexpInitialize(isolate, re, pattern, flags,
                                    parse_result.capture_count, backtrack_limit);
   }
@@ -220,6 +262,9 @@ MaybeHandle<Object> RegExp::Exec(Isolate* isolate, Handle<JSRegExp> regexp,
       return RegExpImpl::IrregexpExec(isolate, regexp, subject, index,
                                       last_match_info);
     }
+    case JSRegExp::LINEAR:
+      return RegExpImpl::LinearExec(isolate, regexp, subject, index,
+                                    last_match_info);
     default:
       UNREACHABLE();
   }
@@ -410,13 +455,38 @@ bool RegExpImpl::CompileIrregexp(Isolate* isolate, Handle<JSRegExp> re,
   compile_data.compilation_target = re->ShouldProduceBytecode()
                                         ? RegExpCompilationTarget::kBytecode
                                         : RegExpCompilationTarget::kNative;
-  const bool compilation_succeeded =
-      Compile(isolate, &zone, &compile_data, flags, pattern, sample_subject,
-              is_one_byte, re->BacktrackLimit());
-  if (!compilation_succeeded) {
-    DCHECK(compile_data.error != RegExpError::kNone);
-    ThrowRegExpException(isolate, re, compile_data.error);
-    return false;
+  // Bytecode can be shared with other isolates, see RegExpBytecodeCache.
+  // Printing or tracing compilation bypasses the cache, so that the output is
+  // the same for every compilation.
+  const bool use_shared_cache =
+      FLAG_regexp_shared_bytecode_cache && !FLAG_print_regexp_bytecode &&
+      !FLAG_trace_regexp_assembler &&
+      compile_data.compilation_target == RegExpCompilationTarget::kBytecode;
+  RegExpBytecodeCache* shared_cache =
+      RegExpBytecodeCache::GetProcessWideCache();
+  Handle<ByteArray> cached_bytecode;
+  int cached_register_count;
+  if (use_shared_cache &&
+      shared_cache->Lookup(isolate, pattern, flags, is_one_byte,
+                           re->BacktrackLimit(), &cached_bytecode,
+                           &cached_register_count)) {
+    compile_data.code = *cached_bytecode;
+    compile_data.register_count = cached_register_count;
+  } else {
+    const bool compilation_succeeded =
+        Compile(isolate, &zone, &compile_data, flags, pattern, sample_subject,
+                is_one_byte, re->BacktrackLimit());
+    if (!compilation_succeeded) {
+      DCHECK(compile_data.error != RegExpError::kNone);
+      ThrowRegExpException(isolate, re, compile_data.error);
+      return false;
+    }
+    if (use_shared_cache) {
+      shared_cache->Insert(
+          pattern, flags, is_one_byte, re->BacktrackLimit(),
+          handle(ByteArray::cast(compile_data.code), isolate),
+          compile_data.register_count);
+    }
   }
 
   Handle<FixedArray> data =
@@ -546,6 +616,13 @@ int RegExpImpl::IrregexpExecRaw(Isolate* isolate, Handle<JSRegExp> regexp,
       // match.  We can use that to set the last match info lazily.
       int res = NativeRegExpMacroAssembler::Match(regexp, subject, output,
                                                   output_size, index, isolate);
+      if (res == NativeRegExpMacroAssembler::FALLBACK_TO_LINEAR) {
+        if (!LinearSwitchFromIrregexp(isolate, regexp)) {
+          return RegExp::RE_EXCEPTION;
+        }
+        return RegExpLinear::Match(isolate, regexp, subject, output,
+                                   output_size, index);
+      }
       if (res != NativeRegExpMacroAssembler::RETRY) {
         DCHECK(res != NativeRegExpMacroAssembler::EXCEPTION ||
                isolate->has_pending_exception());
@@ -592,6 +669,12 @@ int RegExpImpl::IrregexpExecRaw(Isolate* isolate, Handle<JSRegExp> regexp,
         case IrregexpInterpreter::EXCEPTION:
         case IrregexpInterpreter::FAILURE:
           return result;
+        case IrregexpInterpreter::FALLBACK_TO_LINEAR:
+          if (!LinearSwitchFromIrregexp(isolate, regexp)) {
+            return RegExp::RE_EXCEPTION;
+          }
+          return RegExpLinear::Match(isolate, regexp, subject, output,
+                                     number_of_capture_registers, index);
         case IrregexpInterpreter::RETRY:
           // The string has changed representation, and we must restart the
           // match.
@@ -672,6 +755,98 @@ MaybeHandle<Object> RegExpImpl::IrregexpExec(
   return isolate->factory()->null_value();
 }
 
+// Linear-time engine implementation.
+
+void RegExpImpl::LinearInitialize(Isolate* isolate, Handle<JSRegExp> re,
+                                  Handle<String> pattern,
+                                  JSRegExp::Flags flags,
+                                  RegExpCompileData* parse_result,
+                                  Zone* zone) {
+  isolate->factory()->SetRegExpIrregexpData(re, JSRegExp::LINEAR, pattern,
+                                            flags, parse_result->capture_count,
+                                            JSRegExp::kNoBacktrackLimit);
+  LinearCompile(isolate, re, parse_result, zone);
+}
+
+bool RegExpImpl::LinearSwitchFromIrregexp(Isolate* isolate,
+                                          Handle<JSRegExp> re) {
+  DCHECK_EQ(re->TypeTag(), JSRegExp::IRREGEXP);
+  Zone zone(isolate->allocator(), ZONE_NAME);
+  Handle<String> pattern(re->Pattern(), isolate);
+  pattern = String::Flatten(isolate, pattern);
+  RegExpCompileData parse_result;
+  FlatStringReader reader(isolate, pattern);
+  if (!RegExpParser::ParseRegExp(isolate, &zone, &reader, re->GetFlags(),
+                                 &parse_result)) {
+    // Throw an exception if we fail to parse the pattern.
+    // THIS SHOULD NOT HAPPEN. We already pre-parsed it successfully once.
+    USE(ThrowRegExpException(isolate, re, pattern, parse_result.error));
+    return false;
+  }
+  if (FLAG_trace_linear_regexp_engine) {
+    PrintF("JSRegExp object %p exceeded %u backtracks, falling back to the "
+           "linear-time engine\n",
+           reinterpret_cast<void*>(re->ptr()), re->BacktrackLimit());
+  }
+  // The data is shared with all JSRegExp objects of the same pattern and
+  // flags through the compilation cache, which switch along with {re}.
+  LinearCompile(isolate, re, &parse_result, &zone);
+  return true;
+}
+
+void RegExpImpl::LinearCompile(Isolate* isolate, Handle<JSRegExp> re,
+                               RegExpCompileData* parse_result, Zone* zone) {
+  Handle<ByteArray> program =
+      RegExpLinear::Compile(isolate, parse_result->tree, re->GetFlags(), zone);
+  if (FLAG_trace_linear_regexp_engine) {
+    PrintF("JSRegExp object %p linear program size: %d\n",
+           reinterpret_cast<void*>(re->ptr()), program->length());
+  }
+
+  DisallowHeapAllocation no_gc;
+  FixedArray data = FixedArray::cast(re->data());
+  Smi uninitialized = Smi::FromInt(JSRegExp::kUninitializedValue);
+  data.set(JSRegExp::kTagIndex, Smi::FromInt(JSRegExp::LINEAR));
+  // The program does not depend on the representation of the subject.
+  for (bool is_one_byte : {true, false}) {
+    data.set(JSRegExp::code_index(is_one_byte), uninitialized);
+    data.set(JSRegExp::bytecode_index(is_one_byte), *program);
+  }
+  SetIrregexpMaxRegisterCount(data, (parse_result->capture_count + 1) * 2);
+  SetIrregexpCaptureNameMap(data, parse_result->capture_name_map);
+}
+
+MaybeHandle<Object> RegExpImpl::LinearExec(
+    Isolate* isolate, Handle<JSRegExp> regexp, Handle<String> subject,
+    int index, Handle<RegExpMatchInfo> last_match_info) {
+  DCHECK_EQ(regexp->TypeTag(), JSRegExp::LINEAR);
+
+  subject = String::Flatten(isolate, subject);
+
+  int capture_count = regexp->CaptureCount();
+  int required_registers = (capture_count + 1) * 2;
+  int32_t* output_registers = nullptr;
+  if (required_registers > Isolate::kJSRegexpStaticOffsetsVectorSize) {
+    output_registers = NewArray<int32_t>(required_registers);
+  }
+  std::unique_ptr<int32_t[]> auto_release(output_registers);
+  if (output_registers == nullptr) {
+    output_registers = isolate->jsregexp_static_offsets_vector();
+  }
+
+  int res = RegExpLinear::Match(isolate, regexp, subject, output_registers,
+                                required_registers, index);
+  if (res == RegExp::RE_EXCEPTION) {
+    DCHECK(isolate->has_pending_exception());
+    return MaybeHandle<Object>();
+  }
+  if (res == RegExp::RE_FAILURE) return isolate->factory()->null_value();
+
+  DCHECK_EQ(res, RegExp::RE_SUCCESS);
+  return RegExp::SetLastMatchInfo(isolate, last_match_info, subject,
+                                  capture_count, output_registers);
+}
+
 // static
 Handle<RegExpMatchInfo> RegExp::SetLastMatchInfo(
     Isolate* isolate, Handle<RegExpMatchInfo> last_match_info,
@@ -865,6 +1040,9 @@ bool RegExpImpl::Compile(Isolate* isolate, Zone* zone, RegExpCompileData* data,
 
   macro_assembler->set_slow_safe(TooMuchRegExpCode(isolate, pattern));
   macro_assembler->set_backtrack_limit(backtrack_limit);
+  macro_assembler->set_can_fallback(
+      FLAG_linear_regexp_engine_on_excessive_backtracks &&
+      RegExpLinear::CanBeHandled(data->tree, flags, zone));
 
   // Inserted here, instead of in Assembler, because it depends on information
   // in the AST that isn't replicated in the Node structure.
@@ -946,6 +1124,10 @@ RegExpGlobalCache::RegExpGlobalCache(Handle<JSRegExp> regexp,
     registers_per_match_ = kAtomRegistersPerMatch;
     // There is no distinction between interpreted and native for atom regexps.
     interpreted = false;
+  } else if (regexp_->TypeTag() == JSRegExp::LINEAR) {
+    registers_per_match_ = (regexp_->CaptureCount() + 1) * 2;
+    // Like the interpreter, the linear-time engine finds one match at a time.
+    interpreted = true;
   } else {
     registers_per_match_ = RegExp::IrregexpPrepare(isolate_, regexp_, subject_);
     if (registers_per_match_ < 0) {
@@ -1031,9 +1213,18 @@ int32_t* RegExpGlobalCache::FetchNext() {
         num_matches_ = 0;  // Signal failed match.
         return nullptr;
       }
-      num_matches_ = RegExpImpl::IrregexpExecRaw(
-          isolate_, regexp_, subject_, last_end_index, register_array_,
-          register_array_size_);
+      if (regexp_->TypeTag() == JSRegExp::LINEAR) {
+        num_matches_ =
+            RegExpLinear::Match(isolate_, regexp_, subject_, register_array_,
+                                register_array_size_, last_end_index);
+      } else {
+        num_matches_ = RegExpImpl::IrregexpExecRaw(
+            isolate_, regexp_, subject_, last_end_index, register_array_,
+            register_array_size_);
+        // Irregexp may have fallen back to the linear-time engine, which
+        // returns one match at a time.
+        if (regexp_->TypeTag() == JSRegExp::LINEAR) max_matches_ = 1;
+      }
     }
 
     if (num_matches_ <= 0) return nullptr;
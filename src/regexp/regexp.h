@@ -90,6 +90,10 @@ class RegExp final : public AllStatic {
   static constexpr int kInternalRegExpSuccess = 1;
   static constexpr int kInternalRegExpException = -1;
   static constexpr int kInternalRegExpRetry = -2;
+  // Returned by irregexp code when it exceeded the backtrack limit of a
+  // pattern that the linear-time engine can handle instead, see
+  // RegExpLinear.
+  static constexpr int kInternalRegExpFallbackToLinear = -3;
 
   enum IrregexpResult : int32_t {
     RE_FAILURE = kInternalRegExpFailure,
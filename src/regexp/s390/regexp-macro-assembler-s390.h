@@ -202,6 +202,7 @@ class V8_EXPORT_PRIVATE RegExpMacroAssemblerS390
   Label exit_label_;
   Label check_preempt_label_;
   Label stack_overflow_label_;
+  Label fallback_label_;
   Label internal_failure_label_;
 };
 
@@ -125,6 +125,7 @@ RegExpMacroAssemblerX64::~RegExpMacroAssemblerX64() {
   exit_label_.Unuse();
   check_preempt_label_.Unuse();
   stack_overflow_label_.Unuse();
+  fallback_label_.Unuse();
 }
 
 
@@ -157,8 +158,13 @@ void RegExpMacroAssemblerX64::Backtrack() {
     __ cmpq(Operand(rbp, kBacktrackCount), Immediate(backtrack_limit()));
     __ j(not_equal, &next);
 
-    // Exceeded limits are treated as a failed match.
-    Fail();
+    // Exceeded limits are treated as a failed match, unless the pattern
+    // can be handed over to the linear-time engine.
+    if (can_fallback()) {
+      __ jmp(&fallback_label_);
+    } else {
+      Fail();
+    }
 
     __ bind(&next);
   }
@@ -539,6 +545,172 @@ void RegExpMacroAssemblerX64::CheckBitInTable(
 }
 
 
+void RegExpMacroAssemblerX64::SkipUntilChar(int cp_offset, int advance_by,
+                                            unsigned c) {
+  Label found;
+  uc16 chars[] = {static_cast<uc16>(c)};
+  SkipUntilCharsSimd(cp_offset, chars, 1, false, &found);
+  RegExpMacroAssembler::SkipUntilChar(cp_offset, advance_by, c);
+  __ bind(&found);
+}
+
+
+void RegExpMacroAssemblerX64::SkipUntilCharAfterAnd(int cp_offset,
+                                                    int advance_by,
+                                                    unsigned c,
+                                                    unsigned and_with) {
+  Label found;
+  if (and_with == kTableMask) {
+    uc16 chars[] = {static_cast<uc16>(c)};
+    SkipUntilCharsSimd(cp_offset, chars, 1, true, &found);
+  }
+  RegExpMacroAssembler::SkipUntilCharAfterAnd(cp_offset, advance_by, c,
+                                              and_with);
+  __ bind(&found);
+}
+
+
+void RegExpMacroAssemblerX64::SkipUntilBitInTable(int cp_offset,
+                                                  int advance_by,
+                                                  Handle<ByteArray> table) {
+  Label found;
+  uc16 chars[kMaxSimdSkipChars];
+  int count = GetTableCharacters(table, chars, kMaxSimdSkipChars);
+  if (count > 0) {
+    SkipUntilCharsSimd(cp_offset, chars, count, true, &found);
+  } else if (mode_ == LATIN1 && CpuFeatures::IsSupported(SSSE3)) {
+    SkipUntilBitInTableSimd(cp_offset, table, &found);
+  }
+  RegExpMacroAssembler::SkipUntilBitInTable(cp_offset, advance_by, table);
+  __ bind(&found);
+}
+
+
+void RegExpMacroAssemblerX64::SkipUntilCharsSimd(int cp_offset,
+                                                 const uc16* chars, int count,
+                                                 bool masked,
+                                                 Label* on_found) {
+  DCHECK_LE(1, count);
+  DCHECK_LE(count, kMaxSimdSkipChars);
+  // Only xmm0 to xmm5 are used, since the others are callee-saved on Windows.
+  const XMMRegister char_registers[] = {xmm2, xmm3, xmm4};
+  STATIC_ASSERT(arraysize(char_registers) == kMaxSimdSkipChars);
+  // Instead of and'ing the input with kTableMask, which would need another
+  // register for the mask, the bits above it are shifted out of each
+  // character, and the characters compared against are shifted to match.
+  const int shift = masked ? kBitsPerByte * char_size() - kTableSizeBits : 0;
+  for (int i = 0; i < count; i++) {
+    uint32_t c = masked ? (chars[i] & kTableMask) << shift : chars[i];
+    DCHECK(mode_ == UC16 || c <= String::kMaxOneByteCharCode);
+    uint32_t splat = mode_ == LATIN1 ? c * 0x01010101u : c * 0x00010001u;
+    __ movl(rax, Immediate(static_cast<int32_t>(splat)));
+    __ movd(char_registers[i], rax);
+    __ pshufd(char_registers[i], char_registers[i], 0);
+  }
+
+  Label loop, exit;
+  SkipUntilSimdLoopHeader(cp_offset, &loop, &exit);
+  if (masked) {
+    if (mode_ == LATIN1) {
+      STATIC_ASSERT(kTableSizeBits == kBitsPerByte - 1);
+      __ paddb(xmm0, xmm0);
+    } else {
+      __ psllw(xmm0, static_cast<byte>(shift));
+    }
+  }
+  for (int i = 0; i < count; i++) {
+    XMMRegister result = i == 0 ? xmm1 : xmm5;
+    __ movaps(result, xmm0);
+    if (mode_ == LATIN1) {
+      __ pcmpeqb(result, char_registers[i]);
+    } else {
+      __ pcmpeqw(result, char_registers[i]);
+    }
+    if (i > 0) __ por(xmm1, result);
+  }
+  __ pmovmskb(rbx, xmm1);
+  SkipUntilSimdLoopFooter(&loop, on_found);
+  __ bind(&exit);
+}
+
+
+void RegExpMacroAssemblerX64::SkipUntilBitInTableSimd(int cp_offset,
+                                                      Handle<ByteArray> table,
+                                                      Label* on_found) {
+  DCHECK_EQ(LATIN1, mode_);
+  CpuFeatureScope ssse3_scope(&masm_, SSSE3);
+  // The characters are looked up in two steps, with the low and the high
+  // nibble of each character as pshufb indices.  The first table holds, for
+  // each low nibble, a bit for each high nibble that completes it to a
+  // character in the table.  The second table maps the high nibble to that
+  // bit, ignoring the bit above kTableMask.
+  STATIC_ASSERT(kTableSize == 8 * 16);
+  uint8_t low_nibble_table[16] = {0};
+  for (int i = 0; i < kTableSize; i++) {
+    if (table->get(i) != 0) low_nibble_table[i & 0xF] |= 1 << (i >> 4);
+  }
+  uint64_t low_nibble_table_low;
+  uint64_t low_nibble_table_high;
+  memcpy(&low_nibble_table_low, &low_nibble_table[0], sizeof(uint64_t));
+  memcpy(&low_nibble_table_high, &low_nibble_table[8], sizeof(uint64_t));
+  const uint64_t high_nibble_bits = uint64_t{0x8040201008040201};
+
+  __ movq(rax, low_nibble_table_low);
+  __ movq(xmm2, rax);
+  __ movq(rax, low_nibble_table_high);
+  __ movq(xmm5, rax);
+  __ punpcklqdq(xmm2, xmm5);
+  __ movq(rax, high_nibble_bits);
+  __ movq(xmm3, rax);
+  __ punpcklqdq(xmm3, xmm3);
+  __ movl(rax, Immediate(0x0F0F0F0F));
+  __ movd(xmm4, rax);
+  __ pshufd(xmm4, xmm4, 0);
+
+  Label loop, exit;
+  SkipUntilSimdLoopHeader(cp_offset, &loop, &exit);
+  __ movaps(xmm1, xmm0);
+  __ psrlw(xmm1, 4);
+  __ pand(xmm1, xmm4);
+  __ pand(xmm0, xmm4);
+  __ movaps(xmm5, xmm2);
+  __ pshufb(xmm5, xmm0);
+  __ movaps(xmm0, xmm3);
+  __ pshufb(xmm0, xmm1);
+  __ pand(xmm5, xmm0);
+  __ pcmpeqb(xmm5, xmm0);
+  __ pmovmskb(rbx, xmm5);
+  SkipUntilSimdLoopFooter(&loop, on_found);
+  __ bind(&exit);
+}
+
+
+void RegExpMacroAssemblerX64::SkipUntilSimdLoopHeader(int cp_offset,
+                                                      Label* loop,
+                                                      Label* exit) {
+  __ bind(loop);
+  __ leaq(rax, Operand(rdi, cp_offset * char_size()));
+  __ cmpq(rax, Immediate(-kSimd128Size));
+  __ j(greater, exit);
+  __ movdqu(xmm0, Operand(rsi, rax, times_1, 0));
+}
+
+
+void RegExpMacroAssemblerX64::SkipUntilSimdLoopFooter(Label* loop,
+                                                      Label* on_found) {
+  Label found;
+  __ testl(rbx, rbx);
+  __ j(not_zero, &found);
+  __ addq(rdi, Immediate(kSimd128Size));
+  __ jmp(loop);
+  __ bind(&found);
+  // The lowest set bit is the byte offset of the first matching character.
+  __ bsfl(rbx, rbx);
+  __ addq(rdi, rbx);
+  __ jmp(on_found);
+}
+
+
 bool RegExpMacroAssemblerX64::CheckSpecialCharacterClass(uc16 type,
                                                          Label* on_no_match) {
   // Range checks (c in min..max) are generally implemented by an unsigned
@@ -989,6 +1161,14 @@ Handle<HeapObject> RegExpMacroAssemblerX64::GetCode(Handle<String> source) {
     SafeReturn();
   }
 
+  if (fallback_label_.is_linked()) {
+    // Backtrack limit exceeded in a pattern that the linear-time engine
+    // can handle.
+    __ bind(&fallback_label_);
+    __ Set(rax, FALLBACK_TO_LINEAR);
+    __ jmp(&return_rax);
+  }
+
   if (exit_with_exception.is_linked()) {
     // If any of the code above needed to exit with an exception.
     __ bind(&exit_with_exception);
@@ -9,6 +9,7 @@
 
 #include "src/api/api-inl.h"
 #include "src/base/platform/mutex.h"
+#include "src/baseline/baseline-compiler.h"
 #include "src/codegen/assembler-inl.h"
 #include "src/codegen/compiler.h"
 #include "src/codegen/pending-optimization-table.h"
@@ -638,6 +639,40 @@ RUNTIME_FUNCTION(Runtime_ClearFunctionFeedback) {
   return ReadOnlyRoots(isolate).undefined_value();
 }
 
+RUNTIME_FUNCTION(Runtime_CompileBaseline) {
+  HandleScope scope(isolate);
+  DCHECK_EQ(1, args.length());
+  if (!args[0].IsJSFunction()) {
+    return ReadOnlyRoots(isolate).undefined_value();
+  }
+  CONVERT_ARG_HANDLE_CHECKED(JSFunction, function, 0);
+
+  IsCompiledScope is_compiled_scope(function->shared().is_compiled_scope());
+  if (!is_compiled_scope.is_compiled() &&
+      !Compiler::Compile(function, Compiler::CLEAR_EXCEPTION,
+                         &is_compiled_scope)) {
+    return ReadOnlyRoots(isolate).undefined_value();
+  }
+
+  Handle<SharedFunctionInfo> shared(function->shared(), isolate);
+  if (!FLAG_baseline || !shared->HasBytecodeArray()) {
+    return ReadOnlyRoots(isolate).false_value();
+  }
+  return isolate->heap()->ToBoolean(
+      baseline::BaselineCompiler::Compile(isolate, shared));
+}
+
+RUNTIME_FUNCTION(Runtime_HasBaselineCode) {
+  SealHandleScope shs(isolate);
+  DCHECK_EQ(1, args.length());
+  if (!args[0].IsJSFunction()) return ReadOnlyRoots(isolate).false_value();
+  CONVERT_ARG_CHECKED(JSFunction, function, 0);
+  SharedFunctionInfo shared = function.shared();
+  return isolate->heap()->ToBoolean(
+      shared.HasBytecodeArray() &&
+      shared.GetBytecodeArray().HasBaselineCode());
+}
+
 RUNTIME_FUNCTION(Runtime_SetWasmCompileControls) {
   HandleScope scope(isolate);
   v8::Isolate* v8_isolate = reinterpret_cast<v8::Isolate*>(isolate);
@@ -1145,6 +1180,28 @@ RUNTIME_FUNCTION(Runtime_RegexpHasNativeCode) {
   return isolate->heap()->ToBoolean(result);
 }
 
+RUNTIME_FUNCTION(Runtime_RegexpTypeTag) {
+  HandleScope shs(isolate);
+  DCHECK_EQ(1, args.length());
+  CONVERT_ARG_CHECKED(JSRegExp, regexp, 0);
+  const char* type_str;
+  switch (regexp.TypeTag()) {
+    case JSRegExp::NOT_COMPILED:
+      type_str = "NOT_COMPILED";
+      break;
+    case JSRegExp::ATOM:
+      type_str = "ATOM";
+      break;
+    case JSRegExp::IRREGEXP:
+      type_str = "IRREGEXP";
+      break;
+    case JSRegExp::LINEAR:
+      type_str = "LINEAR";
+      break;
+  }
+  return *isolate->factory()->NewStringFromAsciiChecked(type_str);
+}
+
 #define ELEMENTS_KIND_CHECK_RUNTIME_FUNCTION(Name)      \
   RUNTIME_FUNCTION(Runtime_Has##Name) {                 \
     CONVERT_ARG_CHECKED(JSObject, obj, 0);              \
@@ -154,6 +154,21 @@ void CodeSerializer::SerializeObject(HeapObject obj) {
     return;
   }
 
+#ifdef V8_ENABLE_BASELINE
+  if (obj.IsBytecodeArray()) {
+    BytecodeArray bytecode_array = BytecodeArray::cast(obj);
+    // Baseline code is not serialized, it is recompiled on demand once the
+    // deserialized function gets warm again.
+    if (bytecode_array.HasBaselineCode()) {
+      Object baseline_code = bytecode_array.baseline_code();
+      bytecode_array.set_baseline_code(roots.undefined_value());
+      SerializeGeneric(obj);
+      bytecode_array.set_baseline_code(baseline_code);
+      return;
+    }
+  }
+#endif  // V8_ENABLE_BASELINE
+
   if (obj.IsSharedFunctionInfo()) {
     SharedFunctionInfo sfi = SharedFunctionInfo::cast(obj);
     // TODO(7110): Enable serializing of Asm modules once the AsmWasmData
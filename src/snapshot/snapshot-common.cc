@@ -21,8 +21,14 @@
 namespace v8 {
 namespace internal {
 
-SnapshotData MaybeDecompress(const Vector<const byte>& snapshot_data) {
+SnapshotData MaybeDecompress(Isolate* isolate,
+                             const Vector<const byte>& snapshot_data) {
 #ifdef V8_SNAPSHOT_COMPRESSION
+  if (isolate->shares_decompressed_snapshot()) {
+    Vector<const byte> shared =
+        SnapshotCompression::DecompressShared(snapshot_data);
+    if (!shared.empty()) return SnapshotData(shared);
+  }
   return SnapshotCompression::Decompress(snapshot_data);
 #else
   return SnapshotData(snapshot_data);
@@ -54,11 +60,24 @@ bool Snapshot::Initialize(Isolate* isolate) {
   const v8::StartupData* blob = isolate->snapshot_blob();
   CheckVersion(blob);
   CHECK(VerifyChecksum(blob));
+#ifdef V8_SNAPSHOT_COMPRESSION
+  // Sections of the default blob may be decompressed once and shared with
+  // other isolates. Embedder-provided blobs may be freed after isolate
+  // creation, so their sections are decompressed into a private copy every
+  // time.
+  const v8::StartupData* default_blob = DefaultSnapshotBlob();
+  if (FLAG_share_decompressed_snapshot && default_blob != nullptr &&
+      blob->data == default_blob->data) {
+    isolate->set_shares_decompressed_snapshot(true);
+    SnapshotCompression::AddSharedUser();
+  }
+#endif
   Vector<const byte> startup_data = ExtractStartupData(blob);
   Vector<const byte> read_only_data = ExtractReadOnlyData(blob);
 
-  SnapshotData startup_snapshot_data(MaybeDecompress(startup_data));
-  SnapshotData read_only_snapshot_data(MaybeDecompress(read_only_data));
+  SnapshotData startup_snapshot_data(MaybeDecompress(isolate, startup_data));
+  SnapshotData read_only_snapshot_data(
+      MaybeDecompress(isolate, read_only_data));
 
   StartupDeserializer startup_deserializer(&startup_snapshot_data);
   ReadOnlyDeserializer read_only_deserializer(&read_only_snapshot_data);
@@ -74,6 +93,15 @@ bool Snapshot::Initialize(Isolate* isolate) {
   return success;
 }
 
+void Snapshot::TearDown(Isolate* isolate) {
+#ifdef V8_SNAPSHOT_COMPRESSION
+  if (isolate->shares_decompressed_snapshot()) {
+    isolate->set_shares_decompressed_snapshot(false);
+    SnapshotCompression::RemoveSharedUser();
+  }
+#endif
+}
+
 MaybeHandle<Context> Snapshot::NewContextFromSnapshot(
     Isolate* isolate, Handle<JSGlobalProxy> global_proxy, size_t context_index,
     v8::DeserializeEmbedderFieldsCallback embedder_fields_deserializer) {
@@ -87,7 +115,7 @@ MaybeHandle<Context> Snapshot::NewContextFromSnapshot(
   bool can_rehash = ExtractRehashability(blob);
   Vector<const byte> context_data =
       ExtractContextData(blob, static_cast<uint32_t>(context_index));
-  SnapshotData snapshot_data(MaybeDecompress(context_data));
+  SnapshotData snapshot_data(MaybeDecompress(isolate, context_data));
 
   MaybeHandle<Context> maybe_result = PartialDeserializer::DeserializeContext(
       isolate, &snapshot_data, can_rehash, global_proxy,
@@ -4,6 +4,11 @@
 
 #include "src/snapshot/snapshot-compression.h"
 
+#include <memory>
+#include <unordered_map>
+
+#include "src/base/lazy-instance.h"
+#include "src/base/platform/mutex.h"
 #include "src/utils/memcopy.h"
 #include "third_party/zlib/google/compression_utils_portable.h"
 
@@ -16,6 +21,71 @@ uint32_t GetUncompressedSize(const Bytef* compressed_data) {
   return size;
 }
 
+namespace {
+
+// Process-wide cache of decompressed snapshot sections, keyed by the address
+// of their compressed data. Sections are only added while at least two
+// isolates use the cache, so that a process with a single isolate does not
+// keep decompressed data alive. The cache is emptied when its last user is
+// torn down.
+class SharedDecompressedSections {
+ public:
+  void AddUser() {
+    base::MutexGuard guard(&mutex_);
+    users_++;
+  }
+
+  void RemoveUser() {
+    base::MutexGuard guard(&mutex_);
+    DCHECK_GT(users_, 0);
+    if (--users_ == 0) entries_.clear();
+  }
+
+  Vector<const byte> Get(Vector<const byte> compressed_data) {
+    Entry* entry;
+    {
+      base::MutexGuard guard(&mutex_);
+      // The caller is a user, so the entry stays alive after |mutex_| is
+      // released.
+      DCHECK_GT(users_, 0);
+      auto it = entries_.find(compressed_data.begin());
+      if (it == entries_.end()) {
+        if (users_ < 2) return Vector<const byte>();
+        it = entries_
+                 .emplace(compressed_data.begin(),
+                          std::unique_ptr<Entry>(new Entry()))
+                 .first;
+      }
+      entry = it->second.get();
+    }
+    // Decompress outside of |mutex_| so that isolates waiting for different
+    // sections do not block each other.
+    base::MutexGuard guard(&entry->mutex);
+    if (!entry->data) {
+      entry->data.reset(
+          new SnapshotData(SnapshotCompression::Decompress(compressed_data)));
+    }
+    DCHECK_EQ(GetUncompressedSize(compressed_data.begin()),
+              entry->data->RawData().size());
+    return entry->data->RawData();
+  }
+
+ private:
+  struct Entry {
+    base::Mutex mutex;
+    std::unique_ptr<SnapshotData> data;
+  };
+
+  base::Mutex mutex_;
+  int users_ = 0;
+  std::unordered_map<const byte*, std::unique_ptr<Entry>> entries_;
+};
+
+DEFINE_LAZY_LEAKY_OBJECT_GETTER(SharedDecompressedSections,
+                                GetSharedDecompressedSections)
+
+}  // namespace
+
 SnapshotData SnapshotCompression::Compress(
     const SnapshotData* uncompressed_data) {
   SnapshotData snapshot_data;
@@ -91,5 +161,18 @@ SnapshotData SnapshotCompression::Decompress(
   return snapshot_data;
 }
 
+void SnapshotCompression::AddSharedUser() {
+  GetSharedDecompressedSections()->AddUser();
+}
+
+void SnapshotCompression::RemoveSharedUser() {
+  GetSharedDecompressedSections()->RemoveUser();
+}
+
+Vector<const byte> SnapshotCompression::DecompressShared(
+    Vector<const byte> compressed_data) {
+  return GetSharedDecompressedSections()->Get(compressed_data);
+}
+
 }  // namespace internal
 }  // namespace v8
@@ -19,6 +19,19 @@ class SnapshotCompression : public AllStatic {
       const SnapshotData* uncompressed_data);
   V8_EXPORT_PRIVATE static SnapshotData Decompress(
       Vector<const byte> compressed_data);
+
+  // Like Decompress(), but the result is shared between all users of the
+  // shared sections, i.e. isolates created from the default snapshot.
+  // Sections are decompressed on their first use once there are at least two
+  // users, and released when the last user is removed. Returns an empty
+  // vector if the section is not shared, in which case the caller should
+  // Decompress() it into a private copy. Must only be called between
+  // AddSharedUser() and RemoveSharedUser(), and |compressed_data| must stay
+  // valid until the last user is removed.
+  V8_EXPORT_PRIVATE static Vector<const byte> DecompressShared(
+      Vector<const byte> compressed_data);
+  V8_EXPORT_PRIVATE static void AddSharedUser();
+  V8_EXPORT_PRIVATE static void RemoveSharedUser();
 };
 
 }  // namespace internal
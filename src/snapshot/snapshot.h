@@ -68,6 +68,9 @@ class Snapshot : public AllStatic {
   // snapshot could be found.
   static bool Initialize(Isolate* isolate);
 
+  // Releases the snapshot data the isolate shares with other isolates.
+  static void TearDown(Isolate* isolate);
+
   // Create a new context using the internal partial snapshot.
   static MaybeHandle<Context> NewContextFromSnapshot(
       Isolate* isolate, Handle<JSGlobalProxy> global_proxy,
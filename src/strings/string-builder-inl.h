@@ -115,6 +115,16 @@ class ReplacementStringBuilder {
 
 class IncrementalStringBuilder {
  public:
+  // Receives completed parts of the result in order. While a consumer is
+  // installed, parts are handed to it instead of being concatenated, so the
+  // result is never materialized as a single string and is not subject to
+  // String::kMaxLength.
+  class PartConsumer {
+   public:
+    virtual ~PartConsumer() = default;
+    virtual void Consume(Handle<String> part) = 0;
+  };
+
   explicit IncrementalStringBuilder(Isolate* isolate);
 
   V8_INLINE String::Encoding CurrentEncoding() { return encoding_; }
@@ -173,8 +183,15 @@ class IncrementalStringBuilder {
 
   void AppendString(Handle<String> string);
 
+  // Returns the result. With a PartConsumer installed, this hands the last
+  // part to the consumer and returns the empty string.
   MaybeHandle<String> Finish();
 
+  void set_part_consumer(PartConsumer* consumer) {
+    DCHECK_EQ(0, Length());
+    part_consumer_ = consumer;
+  }
+
   V8_INLINE bool HasOverflowed() const { return overflowed_; }
 
   int Length() const;
@@ -299,6 +316,7 @@ class IncrementalStringBuilder {
   int current_index_;
   Handle<String> accumulator_;
   Handle<String> current_part_;
+  PartConsumer* part_consumer_;
 };
 
 template <typename SrcChar, typename DestChar>
@@ -233,7 +233,8 @@ IncrementalStringBuilder::IncrementalStringBuilder(Isolate* isolate)
       encoding_(String::ONE_BYTE_ENCODING),
       overflowed_(false),
       part_length_(kInitialPartLength),
-      current_index_(0) {
+      current_index_(0),
+      part_consumer_(nullptr) {
   // Create an accumulator handle starting with the empty string.
   accumulator_ =
       Handle<String>::New(ReadOnlyRoots(isolate).empty_string(), isolate);
@@ -246,6 +247,10 @@ int IncrementalStringBuilder::Length() const {
 }
 
 void IncrementalStringBuilder::Accumulate(Handle<String> new_part) {
+  if (part_consumer_ != nullptr) {
+    if (new_part->length() > 0) part_consumer_->Consume(new_part);
+    return;
+  }
   Handle<String> new_accumulator;
   if (accumulator()->length() + new_part->length() > String::kMaxLength) {
     // Set the flag and carry on. Delay throwing the exception till the end.
@@ -44,6 +44,7 @@ class BuildFlags : public ContextualClass<BuildFlags> {
     build_flags_["V8_DOUBLE_FIELDS_UNBOXING"] = V8_DOUBLE_FIELDS_UNBOXING;
     build_flags_["V8_ARRAY_BUFFER_EXTENSION_BOOL"] =
         V8_ARRAY_BUFFER_EXTENSION_BOOL;
+    build_flags_["V8_ENABLE_BASELINE_BOOL"] = V8_ENABLE_BASELINE_BOOL;
     build_flags_["TRUE_FOR_TESTING"] = true;
     build_flags_["FALSE_FOR_TESTING"] = false;
   }
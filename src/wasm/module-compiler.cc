@@ -364,13 +364,14 @@ class CompilationUnitQueues {
 
 // The {CompilationStateImpl} keeps track of the compilation state of the
 // owning NativeModule, i.e. which functions are left to be compiled.
-// It contains a task manager to allow parallel and asynchronous background
+// It owns the Job that performs parallel and asynchronous background
 // compilation of functions.
 // Its public interface {CompilationState} lives in compilation-environment.h.
 class CompilationStateImpl {
  public:
   CompilationStateImpl(const std::shared_ptr<NativeModule>& native_module,
                        std::shared_ptr<Counters> async_counters);
+  ~CompilationStateImpl();
 
   // Cancel all background compilation and wait for all tasks to finish. Call
   // this before destructing this object.
@@ -412,10 +413,15 @@ class CompilationStateImpl {
   void OnFinishedUnits(Vector<WasmCode*>, Vector<WasmCompilationResult>);
   void OnFinishedJSToWasmWrapperUnits(int num);
 
-  void OnBackgroundTaskStopped(int task_id, const WasmFeatures& detected);
   void UpdateDetectedFeatures(const WasmFeatures& detected);
   void PublishDetectedFeatures(Isolate*);
-  void RestartBackgroundTasks();
+  // Posts the background compile job if it is not running yet, or notifies it
+  // that more units are available otherwise.
+  void ScheduleCompileJobForNewUnits();
+
+  // Returns the number of units (including wrappers) which have not been
+  // picked up by any compile thread yet. This is only a momentary snapshot.
+  size_t NumOutstandingCompilations() const;
 
   void SetError();
 
@@ -522,8 +528,6 @@ class CompilationStateImpl {
   //////////////////////////////////////////////////////////////////////////////
   // Protected by {mutex_}:
 
-  // Set of unused task ids; <= {max_background_tasks_} many.
-  std::vector<int> available_task_ids_;
 
   // Features detected to be used in this module. Features can be detected
   // as a module is being compiled.
@@ -537,6 +541,25 @@ class CompilationStateImpl {
   // End of fields protected by {mutex_}.
   //////////////////////////////////////////////////////////////////////////////
 
+  // This mutex protects {current_compile_job_} and the flags below. It is
+  // never held while acquiring {mutex_} or {callbacks_mutex_}, nor while
+  // calling into the platform: posting or notifying the job may run
+  // {BackgroundCompileJob} synchronously, which can take this mutex again.
+  mutable base::Mutex job_mutex_;
+
+  // The job compiling units in the background. Created lazily when the first
+  // units are added, and detached (not joined) once the last reference is
+  // gone, since the job only holds the {BackgroundCompileToken} and stops on
+  // its own once that is cancelled. Callers notify the job through their own
+  // reference, outside of {job_mutex_}.
+  std::shared_ptr<JobHandle> current_compile_job_;
+  // Set while a thread posts the job outside of {job_mutex_}.
+  bool posting_compile_job_ = false;
+  // Set if more units were added while the job was being posted.
+  bool compile_job_needs_notification_ = false;
+  // Set on abort; no job is posted afterwards.
+  bool compile_job_aborted_ = false;
+
   // This mutex protects the callbacks vector, and the counters used to
   // determine which callbacks to call. The counters plus the callbacks
   // themselves need to be synchronized to ensure correct order of events.
@@ -997,11 +1020,10 @@ bool ExecuteCompilationUnits(
     return false;
   }
 
-  const bool is_foreground = task_id == kMainThreadTaskId;
   // The main thread uses task id 0, which might collide with one of the
   // background tasks. This is fine, as it will only cause some contention on
   // the one queue, but work otherwise.
-  if (is_foreground) task_id = 0;
+  if (task_id == kMainThreadTaskId) task_id = 0;
 
   Platform* platform = V8::GetCurrentPlatform();
   double compilation_start = platform->MonotonicallyIncreasingTime();
@@ -1017,15 +1039,9 @@ bool ExecuteCompilationUnits(
   base::Optional<WasmCompilationUnit> unit;
   WasmFeatures detected_features = WasmFeatures::None();
 
-  auto stop = [is_foreground, task_id,
-               &detected_features](BackgroundCompileScope& compile_scope) {
-    if (is_foreground) {
-      compile_scope.compilation_state()->UpdateDetectedFeatures(
-          detected_features);
-    } else {
-      compile_scope.compilation_state()->OnBackgroundTaskStopped(
-          task_id, detected_features);
-    }
+  auto stop = [&detected_features](BackgroundCompileScope& compile_scope) {
+    compile_scope.compilation_state()->UpdateDetectedFeatures(
+        detected_features);
   };
 
   // Preparation (synchronized): Initialize the fields above and get the first
@@ -1344,29 +1360,64 @@ void CompileNativeModule(Isolate* isolate, ErrorThrower* thrower,
   }
 }
 
-// The runnable task that performs compilations in the background.
-class BackgroundCompileTask : public CancelableTask {
+// The job that performs compilations in the background. It only holds the
+// {BackgroundCompileToken}, so it can outlive the {NativeModule}; once the
+// token is cancelled, {GetMaxConcurrency} drops to zero and all workers return.
+// The {WasmEngine} waits for all jobs to die before shutting down.
+class BackgroundCompileJob : public JobTask {
  public:
-  explicit BackgroundCompileTask(CancelableTaskManager* manager,
-                                 std::shared_ptr<BackgroundCompileToken> token,
-                                 std::shared_ptr<Counters> async_counters,
-                                 int task_id)
-      : CancelableTask(manager),
+  BackgroundCompileJob(WasmEngine* engine,
+                       std::shared_ptr<BackgroundCompileToken> token,
+                       std::shared_ptr<Counters> async_counters,
+                       int max_concurrency)
+      : engine_(engine),
         token_(std::move(token)),
         async_counters_(std::move(async_counters)),
-        task_id_(task_id) {}
+        max_concurrency_(max_concurrency) {
+    DCHECK_LT(0, max_concurrency_);
+    engine_->OnBackgroundCompileJobCreated();
+  }
 
-  void RunInternal() override {
-    ExecuteCompilationUnits(token_, async_counters_.get(), task_id_,
+  ~BackgroundCompileJob() override {
+    engine_->OnBackgroundCompileJobDestroyed();
+  }
+
+  void Run(JobDelegate* delegate) override {
+    // Task ids are below the number of concurrent workers, which is bounded by
+    // {max_concurrency_}. Still clamp them for platforms that hand out larger
+    // ids; a collision only causes contention on one unit queue.
+    int task_id = std::min(int{delegate->GetTaskId()}, max_concurrency_ - 1);
+    ExecuteCompilationUnits(token_, async_counters_.get(), task_id,
                             kBaselineOrTopTier);
   }
 
+  size_t GetMaxConcurrency(size_t worker_count) const override {
+    BackgroundCompileScope compile_scope(token_);
+    if (compile_scope.cancelled()) return 0;
+    CompilationStateImpl* compilation_state =
+        compile_scope.compilation_state();
+    if (compilation_state->failed()) return 0;
+    // {NumOutstandingCompilations} does not include the units which running
+    // workers are currently processing, so add the current worker count.
+    return std::min(static_cast<size_t>(max_concurrency_),
+                    worker_count +
+                        compilation_state->NumOutstandingCompilations());
+  }
+
  private:
+  WasmEngine* const engine_;
   const std::shared_ptr<BackgroundCompileToken> token_;
   const std::shared_ptr<Counters> async_counters_;
-  const int task_id_;
+  const int max_concurrency_;
 };
 
+// Deleter of the shared compile job handle. Called once the last caller that
+// notifies the job dropped its reference.
+void DetachCompileJob(JobHandle* handle) {
+  if (handle->IsRunning()) handle->CancelAndDetach();
+  delete handle;
+}
+
 }  // namespace
 
 std::shared_ptr<NativeModule> CompileToNativeModule(
@@ -2426,17 +2477,26 @@ CompilationStateImpl::CompilationStateImpl(
                         : CompileMode::kRegular),
       async_counters_(std::move(async_counters)),
       max_background_tasks_(std::max(GetMaxBackgroundTasks(), 1)),
-      compilation_unit_queues_(max_background_tasks_),
-      available_task_ids_(max_background_tasks_) {
-  for (int i = 0; i < max_background_tasks_; ++i) {
-    // Ids are popped on task creation, so reverse this list. This ensures that
-    // the first background task gets id 0.
-    available_task_ids_[i] = max_background_tasks_ - 1 - i;
-  }
+      compilation_unit_queues_(max_background_tasks_) {}
+
+CompilationStateImpl::~CompilationStateImpl() {
+  // {AbortCompilation} must have dropped the job already.
+  DCHECK(!current_compile_job_);
 }
 
 void CompilationStateImpl::AbortCompilation() {
   background_compile_token_->Cancel();
+  // Do not wait for the job here: {AbortCompilation} can be called from a
+  // compile thread dropping the last reference to the {NativeModule}. Workers
+  // see the cancelled token and return after finishing their current unit.
+  std::shared_ptr<JobHandle> job;
+  {
+    base::MutexGuard guard(&job_mutex_);
+    compile_job_aborted_ = true;
+    job = std::move(current_compile_job_);
+  }
+  // Detaches the job unless a concurrent caller still notifies it.
+  job.reset();
   // No more callbacks after abort.
   base::MutexGuard callbacks_guard(&callbacks_mutex_);
   callbacks_.clear();
@@ -2602,7 +2662,7 @@ void CompilationStateImpl::AddCompilationUnits(
                                    js_to_wasm_wrapper_units.begin(),
                                    js_to_wasm_wrapper_units.end());
 
-  RestartBackgroundTasks();
+  ScheduleCompileJobForNewUnits();
 }
 
 void CompilationStateImpl::AddTopTierCompilationUnit(WasmCompilationUnit unit) {
@@ -2793,23 +2853,6 @@ void CompilationStateImpl::TriggerCallbacks(
   }
 }
 
-void CompilationStateImpl::OnBackgroundTaskStopped(
-    int task_id, const WasmFeatures& detected) {
-  {
-    base::MutexGuard guard(&mutex_);
-    DCHECK_EQ(0, std::count(available_task_ids_.begin(),
-                            available_task_ids_.end(), task_id));
-    DCHECK_GT(max_background_tasks_, available_task_ids_.size());
-    available_task_ids_.push_back(task_id);
-    detected_features_.Add(detected);
-  }
-
-  // The background task could have stopped while we were adding new units, or
-  // because it reached its deadline. In both cases we need to restart tasks to
-  // avoid a potential deadlock.
-  RestartBackgroundTasks();
-}
-
 void CompilationStateImpl::UpdateDetectedFeatures(
     const WasmFeatures& detected) {
   base::MutexGuard guard(&mutex_);
@@ -2824,46 +2867,63 @@ void CompilationStateImpl::PublishDetectedFeatures(Isolate* isolate) {
   UpdateFeatureUseCounts(isolate, detected_features_);
 }
 
-void CompilationStateImpl::RestartBackgroundTasks() {
-  // Create new tasks, but only spawn them after releasing the mutex, because
-  // some platforms (e.g. the predictable platform) might execute tasks right
-  // away.
-  std::vector<std::unique_ptr<Task>> new_tasks;
+void CompilationStateImpl::ScheduleCompileJobForNewUnits() {
+  // No need to schedule anything if compilation already failed.
+  if (failed()) return;
+
+  // Once baseline compilation finished, the remaining (top tier) units are not
+  // on the critical path any more. A running job keeps its initial priority.
+  TaskPriority priority =
+      baseline_compilation_finished() && recompilation_finished()
+          ? TaskPriority::kBestEffort
+          : TaskPriority::kUserVisible;
+
+  std::shared_ptr<JobHandle> job;
   {
-    base::MutexGuard guard(&mutex_);
-    // Explicit fast path (quite common): If no more task ids are available
-    // (i.e. {max_background_tasks_} tasks are already running), spawn nothing.
-    if (available_task_ids_.empty()) return;
-    // No need to restart tasks if compilation already failed.
-    if (failed()) return;
-
-    size_t max_num_restart = compilation_unit_queues_.GetTotalSize();
-    if (js_to_wasm_wrapper_id_ <
-        static_cast<int>(js_to_wasm_wrapper_units_.size())) {
-      max_num_restart +=
-          js_to_wasm_wrapper_units_.size() - js_to_wasm_wrapper_id_;
+    base::MutexGuard guard(&job_mutex_);
+    if (compile_job_aborted_) return;
+    job = current_compile_job_;
+    if (!job) {
+      if (posting_compile_job_) {
+        // Let the posting thread notify the job once it is posted.
+        compile_job_needs_notification_ = true;
+        return;
+      }
+      posting_compile_job_ = true;
     }
+  }
+  if (job) {
+    job->NotifyConcurrencyIncrease();
+    return;
+  }
 
-    while (!available_task_ids_.empty() && max_num_restart-- > 0) {
-      int task_id = available_task_ids_.back();
-      available_task_ids_.pop_back();
-      new_tasks.emplace_back(
-          native_module_->engine()
-              ->NewBackgroundCompileTask<BackgroundCompileTask>(
-                  background_compile_token_, async_counters_, task_id));
-    }
+  job = std::shared_ptr<JobHandle>(
+      V8::GetCurrentPlatform()
+          ->PostJob(priority, std::make_unique<BackgroundCompileJob>(
+                                  native_module_->engine(),
+                                  background_compile_token_, async_counters_,
+                                  max_background_tasks_))
+          .release(),
+      DetachCompileJob);
+  bool needs_notification = false;
+  {
+    base::MutexGuard guard(&job_mutex_);
+    posting_compile_job_ = false;
+    // On abort, {job} is detached on return, after releasing the mutex.
+    if (compile_job_aborted_) return;
+    current_compile_job_ = job;
+    std::swap(needs_notification, compile_job_needs_notification_);
   }
+  if (needs_notification) job->NotifyConcurrencyIncrease();
+}
 
-  if (baseline_compilation_finished() && recompilation_finished()) {
-    for (auto& task : new_tasks) {
-      V8::GetCurrentPlatform()->CallLowPriorityTaskOnWorkerThread(
-          std::move(task));
-    }
-  } else {
-    for (auto& task : new_tasks) {
-      V8::GetCurrentPlatform()->CallOnWorkerThread(std::move(task));
-    }
+size_t CompilationStateImpl::NumOutstandingCompilations() const {
+  size_t outstanding_wrappers = 0;
+  int next_wrapper = js_to_wasm_wrapper_id_.load(std::memory_order_relaxed);
+  if (next_wrapper < static_cast<int>(js_to_wasm_wrapper_units_.size())) {
+    outstanding_wrappers = js_to_wasm_wrapper_units_.size() - next_wrapper;
   }
+  return compilation_unit_queues_.GetTotalSize() + outstanding_wrappers;
 }
 
 void CompilationStateImpl::SetError() {
@@ -2889,25 +2949,38 @@ using JSToWasmWrapperUnitMap =
                        std::unique_ptr<JSToWasmWrapperCompilationUnit>,
                        base::hash<JSToWasmWrapperKey>>;
 
-class CompileJSToWasmWrapperTask final : public CancelableTask {
+class CompileJSToWasmWrapperJob final : public JobTask {
  public:
-  CompileJSToWasmWrapperTask(CancelableTaskManager* task_manager,
-                             JSToWasmWrapperQueue* queue,
-                             JSToWasmWrapperUnitMap* compilation_units)
-      : CancelableTask(task_manager),
-        queue_(queue),
-        compilation_units_(compilation_units) {}
-
-  void RunInternal() override {
+  CompileJSToWasmWrapperJob(JSToWasmWrapperQueue* queue,
+                            JSToWasmWrapperUnitMap* compilation_units,
+                            size_t max_concurrency)
+      : queue_(queue),
+        compilation_units_(compilation_units),
+        outstanding_units_(compilation_units->size()),
+        max_concurrency_(max_concurrency) {}
+
+  void Run(JobDelegate* delegate) override {
     while (base::Optional<JSToWasmWrapperKey> key = queue_->pop()) {
+      outstanding_units_.fetch_sub(1, std::memory_order_relaxed);
       JSToWasmWrapperCompilationUnit* unit = (*compilation_units_)[*key].get();
       unit->Execute();
+      if (delegate->ShouldYield()) return;
     }
   }
 
+  size_t GetMaxConcurrency(size_t worker_count) const override {
+    // {outstanding_units_} does not include the units which running workers
+    // are currently processing, so add the current worker count.
+    return std::min(max_concurrency_,
+                    worker_count +
+                        outstanding_units_.load(std::memory_order_relaxed));
+  }
+
  private:
   JSToWasmWrapperQueue* const queue_;
   JSToWasmWrapperUnitMap* const compilation_units_;
+  std::atomic<size_t> outstanding_units_;
+  const size_t max_concurrency_;
 };
 }  // namespace
 
@@ -2933,21 +3006,15 @@ void CompileJsToWasmWrappers(Isolate* isolate, const WasmModule* module,
     }
   }
 
-  // Execute compilation jobs in the background.
-  CancelableTaskManager task_manager;
-  const int max_background_tasks = GetMaxBackgroundTasks();
-  for (int i = 0; i < max_background_tasks; ++i) {
-    auto task = std::make_unique<CompileJSToWasmWrapperTask>(
-        &task_manager, &queue, &compilation_units);
-    V8::GetCurrentPlatform()->CallOnWorkerThread(std::move(task));
-  }
-
-  // Work in the main thread too.
-  while (base::Optional<JSToWasmWrapperKey> key = queue.pop()) {
-    JSToWasmWrapperCompilationUnit* unit = compilation_units[*key].get();
-    unit->Execute();
-  }
-  task_manager.CancelAndWait();
+  // Execute compilation jobs in the background, with the main thread
+  // contributing via {Join}.
+  const size_t max_concurrency =
+      static_cast<size_t>(GetMaxBackgroundTasks()) + 1;
+  auto job = std::make_unique<CompileJSToWasmWrapperJob>(
+      &queue, &compilation_units, max_concurrency);
+  V8::GetCurrentPlatform()
+      ->PostJob(TaskPriority::kUserVisible, std::move(job))
+      ->Join();
 
   // Finalize compilation jobs in the main thread.
   // TODO(6792): Wrappers below are allocated with {Factory::NewCode}. As an
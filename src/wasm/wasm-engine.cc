@@ -393,8 +393,14 @@ WasmEngine::~WasmEngine() {
   gdb_server_ = nullptr;
 #endif  // V8_ENABLE_WASM_GDB_REMOTE_DEBUGGING
 
-  // Synchronize on all background compile tasks.
-  background_compile_task_manager_.CancelAndWait();
+  // Synchronize on all background compile jobs. They have all been cancelled
+  // when their NativeModule died, but might still finish a compilation unit.
+  {
+    base::MutexGuard guard(&background_compile_jobs_mutex_);
+    while (num_background_compile_jobs_ > 0) {
+      background_compile_jobs_finished_.Wait(&background_compile_jobs_mutex_);
+    }
+  }
   // All AsyncCompileJobs have been canceled.
   DCHECK(async_compile_jobs_.empty());
   // All Isolates have been deregistered.
@@ -405,6 +411,19 @@ WasmEngine::~WasmEngine() {
   DCHECK(native_module_cache_.empty());
 }
 
+void WasmEngine::OnBackgroundCompileJobCreated() {
+  base::MutexGuard guard(&background_compile_jobs_mutex_);
+  ++num_background_compile_jobs_;
+}
+
+void WasmEngine::OnBackgroundCompileJobDestroyed() {
+  base::MutexGuard guard(&background_compile_jobs_mutex_);
+  DCHECK_LT(0, num_background_compile_jobs_);
+  if (--num_background_compile_jobs_ == 0) {
+    background_compile_jobs_finished_.NotifyAll();
+  }
+}
+
 bool WasmEngine::SyncValidate(Isolate* isolate, const WasmFeatures& enabled,
                               const ModuleWireBytes& bytes) {
   // TODO(titzer): remove dependency on the isolate.
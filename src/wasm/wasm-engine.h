@@ -244,11 +244,10 @@ class V8_EXPORT_PRIVATE WasmEngine {
   void AddIsolate(Isolate* isolate);
   void RemoveIsolate(Isolate* isolate);
 
-  template <typename T, typename... Args>
-  std::unique_ptr<T> NewBackgroundCompileTask(Args&&... args) {
-    return std::make_unique<T>(&background_compile_task_manager_,
-                               std::forward<Args>(args)...);
-  }
+  // Background compile jobs register on creation and deregister on
+  // destruction, such that shut down of the engine can wait for them.
+  void OnBackgroundCompileJobCreated();
+  void OnBackgroundCompileJobDestroyed();
 
   // Trigger code logging for the given code objects in all Isolates which have
   // access to the NativeModule containing this code. This method can be called
@@ -373,9 +372,13 @@ class V8_EXPORT_PRIVATE WasmEngine {
   WasmCodeManager code_manager_;
   AccountingAllocator allocator_;
 
-  // Task manager managing all background compile jobs. Before shut down of the
-  // engine, they must all be finished because they access the allocator.
-  CancelableTaskManager background_compile_task_manager_;
+  // Number of live background compile jobs. Before shut down of the engine,
+  // they must all be finished because they access the allocator. Protected by
+  // {background_compile_jobs_mutex_}, which is separate from {mutex_} because
+  // jobs can die while a NativeModule is being freed.
+  base::Mutex background_compile_jobs_mutex_;
+  base::ConditionVariable background_compile_jobs_finished_;
+  int num_background_compile_jobs_ = 0;
 
 #ifdef V8_ENABLE_WASM_GDB_REMOTE_DEBUGGING
   // Implements a GDB-remote stub for WebAssembly debugging.
@@ -16,6 +16,8 @@
   V(CompactionPartiallyAbortedPageIntraAbortedPointers)     \
   V(CompactionPartiallyAbortedPageWithInvalidatedSlots)     \
   V(CompactionPartiallyAbortedPageWithRememberedSetEntries) \
+  V(CompactionPauseTargetLimitsCandidates)                  \
+  V(CompactionPauseTargetSpreadsCompaction)                 \
   V(CompactionSpaceDivideMultiplePages)                     \
   V(CompactionSpaceDivideSinglePage)                        \
   V(InvalidatedSlotsAfterTrimming)                          \
@@ -44,6 +46,8 @@
   V(Regression39128)                                        \
   V(ResetWeakHandle)                                        \
   V(StressHandles)                                          \
+  V(SurvivalBasedEarlyPromotion)                            \
+  V(SurvivalBasedPretenuring)                               \
   V(TestMemoryReducerSampleJsCalls)                         \
   V(TestSizeOfObjects)                                      \
   V(Regress5831)                                            \
@@ -4,6 +4,7 @@
 
 #include "src/execution/isolate.h"
 #include "src/heap/factory.h"
+#include "src/heap/gc-tracer.h"
 #include "src/heap/heap-inl.h"
 #include "src/heap/mark-compact.h"
 #include "src/heap/remembered-set.h"
@@ -459,6 +460,132 @@ HEAP_TEST(CompactionPartiallyAbortedPageWithRememberedSetEntries) {
   }
 }
 
+HEAP_TEST(CompactionPauseTargetLimitsCandidates) {
+  if (FLAG_never_compact || !FLAG_incremental_marking) return;
+  if (FLAG_stress_compaction || FLAG_stress_compaction_random) return;
+  // Test that fragmented pages are not selected as evacuation candidates if
+  // evacuating them at the traced compaction speed takes longer than
+  // --compaction-pause-target-ms.
+
+  ManualGCScope manual_gc_scope;
+
+  const int objects_per_page = 16;
+  const int object_size = GetObjectSize(objects_per_page);
+  const int kPages = 2;
+
+  CcTest::InitializeVM();
+  Isolate* isolate = CcTest::i_isolate();
+  Heap* heap = isolate->heap();
+  {
+    HandleScope scope1(isolate);
+    Handle<FixedArray> root_array =
+        isolate->factory()->NewFixedArray(kPages, AllocationType::kOld);
+    heap::SealCurrentObjects(heap);
+
+    Page* pages[kPages];
+    for (int i = 0; i < kPages; i++) {
+      HandleScope temporary_scope(isolate);
+      CHECK(heap->old_space()->Expand());
+      auto page_handles = heap::CreatePadding(
+          heap,
+          static_cast<int>(MemoryChunkLayout::AllocatableMemoryInDataPage()),
+          AllocationType::kOld, object_size);
+      pages[i] = Page::FromHeapObject(*page_handles.front());
+      CheckAllObjectsOnPage(page_handles, pages[i]);
+      // Only one object per page survives, which leaves the pages fragmented
+      // enough to be selected as evacuation candidates.
+      root_array->set(i, *page_handles.front());
+    }
+    CcTest::CollectAllGarbage();
+    heap->mark_compact_collector()->EnsureSweepingCompleted();
+
+    // At 64KB/ms, the pages qualify by their fragmentation, but evacuating
+    // the surviving object of a single page takes longer than the target.
+    FLAG_compaction_pause_target_ms = 0.01;
+    for (int i = 0; i < base::RingBuffer<BytesAndDuration>::kSize; i++) {
+      heap->tracer()->AddCompactionEvent(1, 64 * KB);
+    }
+    heap::SimulateIncrementalMarking(heap, false);
+    for (int i = 0; i < kPages; i++) {
+      CHECK(!pages[i]->IsEvacuationCandidate());
+    }
+    CcTest::CollectAllGarbage();
+    heap->mark_compact_collector()->EnsureSweepingCompleted();
+
+    // Without a target, the same pages are selected.
+    FLAG_compaction_pause_target_ms = 0;
+    for (int i = 0; i < base::RingBuffer<BytesAndDuration>::kSize; i++) {
+      heap->tracer()->AddCompactionEvent(1, 64 * KB);
+    }
+    heap::SimulateIncrementalMarking(heap, false);
+    for (int i = 0; i < kPages; i++) {
+      CHECK(pages[i]->IsEvacuationCandidate());
+    }
+    CcTest::CollectAllGarbage();
+  }
+}
+
+HEAP_TEST(CompactionPauseTargetSpreadsCompaction) {
+  if (FLAG_never_compact || !FLAG_incremental_marking) return;
+  if (FLAG_stress_compaction || FLAG_stress_compaction_random) return;
+  // Test that with --compaction-pause-target-ms, fragmented pages are still
+  // compacted by later GCs, so that fragmentation does not persist.
+
+  FLAG_parallel_compaction = false;
+  ManualGCScope manual_gc_scope;
+
+  const int objects_per_page = 16;
+  const int object_size = GetObjectSize(objects_per_page);
+  const int kPages = 4;
+
+  CcTest::InitializeVM();
+  Isolate* isolate = CcTest::i_isolate();
+  Heap* heap = isolate->heap();
+  {
+    HandleScope scope1(isolate);
+    Handle<FixedArray> root_array =
+        isolate->factory()->NewFixedArray(kPages, AllocationType::kOld);
+    heap::SealCurrentObjects(heap);
+
+    for (int i = 0; i < kPages; i++) {
+      HandleScope temporary_scope(isolate);
+      CHECK(heap->old_space()->Expand());
+      auto page_handles = heap::CreatePadding(
+          heap,
+          static_cast<int>(MemoryChunkLayout::AllocatableMemoryInDataPage()),
+          AllocationType::kOld, object_size);
+      CheckAllObjectsOnPage(page_handles,
+                            Page::FromHeapObject(*page_handles.front()));
+      root_array->set(i, *page_handles.front());
+    }
+    CcTest::CollectAllGarbage();
+    heap->mark_compact_collector()->EnsureSweepingCompleted();
+    const int pages_before = heap->old_space()->CountTotalPages();
+
+    // At 64KB/ms with a single compaction task, the target allows to evacuate
+    // the surviving objects of two of the fragmented pages per GC.
+    FLAG_compaction_pause_target_ms = 2.5 * object_size / (64 * KB);
+    for (int gc = 0; gc < kPages; gc++) {
+      for (int i = 0; i < base::RingBuffer<BytesAndDuration>::kSize; i++) {
+        heap->tracer()->AddCompactionEvent(1, 64 * KB);
+      }
+      heap::SimulateIncrementalMarking(heap, false);
+      CcTest::CollectAllGarbage();
+      heap->mark_compact_collector()->EnsureSweepingCompleted();
+      if (gc == 0) {
+        // Evacuating all fragmented pages at once would leave a single page
+        // for their surviving objects.
+        CHECK_GT(heap->old_space()->CountTotalPages(),
+                 pages_before - kPages + 1);
+      }
+    }
+    // All fragmented pages have been released. The surviving objects were
+    // compacted onto at most two pages.
+    CHECK_LE(heap->old_space()->CountTotalPages(), pages_before - kPages + 2);
+    FLAG_compaction_pause_target_ms = 0;
+  }
+}
+
 }  // namespace heap
 }  // namespace internal
 }  // namespace v8
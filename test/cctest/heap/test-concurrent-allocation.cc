@@ -0,0 +1,210 @@
+// Copyright 2020 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include <atomic>
+#include <memory>
+#include <vector>
+
+#include "src/base/platform/platform.h"
+#include "src/heap/concurrent-allocator.h"
+#include "src/heap/heap.h"
+#include "src/heap/incremental-marking.h"
+#include "src/heap/local-heap-inl.h"
+#include "src/heap/safepoint.h"
+#include "src/objects/fixed-array.h"
+#include "src/objects/heap-object.h"
+#include "test/cctest/cctest.h"
+#include "test/cctest/heap/heap-utils.h"
+
+namespace v8 {
+namespace internal {
+
+namespace {
+
+const int kNumIterations = 2000;
+const int kSmallObjectSize = 10 * kTaggedSize;
+const int kMediumObjectSize = 8 * KB;
+const int kLargeObjectSize = 2 * kMaxRegularHeapObjectSize;
+
+static_assert(kSmallObjectSize <= ConcurrentAllocator::kMaxLabObjectSize,
+              "small objects should be allocated in the LAB");
+static_assert(kMediumObjectSize > ConcurrentAllocator::kMaxLabObjectSize,
+              "medium objects should be allocated outside of the LAB");
+static_assert(kLargeObjectSize > kMaxRegularHeapObjectSize,
+              "large objects should be allocated in large object space");
+
+// Initializes the object without write barriers, as required for background
+// allocations.
+void CreateFixedArray(Heap* heap, Address start, int size) {
+  HeapObject object = HeapObject::FromAddress(start);
+  object.set_map_after_allocation(ReadOnlyRoots(heap).fixed_array_map(),
+                                  SKIP_WRITE_BARRIER);
+  FixedArray array = FixedArray::cast(object);
+  int length = (size - FixedArray::kHeaderSize) / kTaggedSize;
+  array.set_length(length);
+  MemsetTagged(array.data_start(), ReadOnlyRoots(heap).undefined_value(),
+               length);
+}
+
+void CheckBlackIfBlackAllocation(Heap* heap, Address start) {
+  // Black allocation is only switched on in a safepoint, so if it is on now,
+  // it was already on when the object was allocated.
+  if (!heap->incremental_marking()->black_allocation()) return;
+  CHECK(heap->incremental_marking()->atomic_marking_state()->IsBlack(
+      HeapObject::FromAddress(start)));
+}
+
+void AllocateSomeObjects(Heap* heap, LocalHeap* local_heap) {
+  for (int i = 0; i < kNumIterations; i++) {
+    Address address = local_heap->AllocateRawOrFail(
+        kSmallObjectSize, AllocationType::kOld, AllocationOrigin::kRuntime,
+        AllocationAlignment::kWordAligned);
+    CreateFixedArray(heap, address, kSmallObjectSize);
+    CheckBlackIfBlackAllocation(heap, address);
+
+    address = local_heap->AllocateRawOrFail(
+        kMediumObjectSize, AllocationType::kOld, AllocationOrigin::kRuntime,
+        AllocationAlignment::kWordAligned);
+    CreateFixedArray(heap, address, kMediumObjectSize);
+    CheckBlackIfBlackAllocation(heap, address);
+
+    if (i % 10 == 0) {
+      local_heap->Safepoint();
+    }
+
+    if (i % 100 == 0) {
+      address = local_heap->AllocateRawOrFail(
+          kLargeObjectSize, AllocationType::kOld, AllocationOrigin::kRuntime,
+          AllocationAlignment::kWordAligned);
+      CreateFixedArray(heap, address, kLargeObjectSize);
+      CHECK(heap->lo_space()->Contains(HeapObject::FromAddress(address)));
+      CheckBlackIfBlackAllocation(heap, address);
+    }
+  }
+}
+
+class ConcurrentAllocationThread final : public v8::base::Thread {
+ public:
+  ConcurrentAllocationThread(Heap* heap, std::atomic<int>* pending)
+      : v8::base::Thread(base::Thread::Options("ThreadWithLocalHeap")),
+        heap_(heap),
+        pending_(pending) {}
+
+  void Run() override {
+    LocalHeap local_heap(heap_);
+    AllocateSomeObjects(heap_, &local_heap);
+    pending_->fetch_sub(1);
+  }
+
+  Heap* heap_;
+  std::atomic<int>* pending_;
+};
+
+// Starts |kThreads| allocating threads and calls |step| on the main thread
+// until all of them are done. The main thread has to keep serving safepoint
+// and GC requests while the threads allocate.
+template <typename Step>
+void RunAllocationThreads(Heap* heap, Step step) {
+  const int kThreads = 4;
+  std::atomic<int> pending(kThreads);
+  std::vector<std::unique_ptr<ConcurrentAllocationThread>> threads;
+
+  for (int i = 0; i < kThreads; i++) {
+    auto thread = std::make_unique<ConcurrentAllocationThread>(heap, &pending);
+    CHECK(thread->Start());
+    threads.push_back(std::move(thread));
+  }
+
+  while (pending > 0) {
+    step();
+  }
+
+  for (auto& thread : threads) {
+    thread->Join();
+  }
+}
+
+}  // namespace
+
+TEST(ConcurrentAllocationInOldSpace) {
+  FLAG_concurrent_allocation = true;
+  FLAG_local_heaps = true;
+  CcTest::InitializeVM();
+  Heap* heap = CcTest::heap();
+
+  RunAllocationThreads(heap, [heap]() {
+    heap->CheckCollectionRequested();
+    base::OS::Sleep(base::TimeDelta::FromMilliseconds(1));
+  });
+
+  CcTest::CollectAllGarbage();
+}
+
+TEST(ConcurrentAllocationWithGCStress) {
+  FLAG_concurrent_allocation = true;
+  FLAG_local_heaps = true;
+  CcTest::InitializeVM();
+  Heap* heap = CcTest::heap();
+
+  // Every garbage collection frees the threads' LABs in a safepoint, so the
+  // threads keep refilling them from the free list in between.
+  RunAllocationThreads(heap, []() { CcTest::CollectAllGarbage(); });
+
+  CcTest::CollectAllGarbage();
+}
+
+TEST(ConcurrentAllocationWhileMarking) {
+  if (!FLAG_incremental_marking) return;
+  FLAG_concurrent_allocation = true;
+  FLAG_local_heaps = true;
+  CcTest::InitializeVM();
+  Heap* heap = CcTest::heap();
+  IncrementalMarking* marking = heap->incremental_marking();
+
+  CcTest::CollectAllGarbage();
+  heap::SimulateIncrementalMarking(heap, false);
+  CHECK(marking->black_allocation());
+
+  RunAllocationThreads(heap, [heap, marking]() {
+    heap->CheckCollectionRequested();
+    if (marking->IsMarking()) {
+      const double kStepSizeInMs = 1;
+      marking->Step(kStepSizeInMs, IncrementalMarking::NO_GC_VIA_STACK_GUARD,
+                    StepOrigin::kV8);
+    }
+  });
+
+  // Finalizing marking flushes the live bytes of the background black areas;
+  // heap verification checks them against the marking bitmap.
+  CcTest::CollectAllGarbage();
+}
+
+UNINITIALIZED_TEST(ConcurrentAllocationRequestsGC) {
+  FLAG_concurrent_allocation = true;
+  FLAG_local_heaps = true;
+  FLAG_max_old_space_size = 32;
+
+  v8::Isolate::CreateParams create_params;
+  create_params.array_buffer_allocator = CcTest::array_buffer_allocator();
+  v8::Isolate* isolate = v8::Isolate::New(create_params);
+  Isolate* i_isolate = reinterpret_cast<Isolate*>(isolate);
+  Heap* heap = i_isolate->heap();
+  const int initial_ms_count = heap->ms_count();
+
+  {
+    v8::Isolate::Scope isolate_scope(isolate);
+    // The threads allocate more garbage than fits into the old generation, so
+    // they have to request garbage collections from the main thread.
+    RunAllocationThreads(heap, [heap]() {
+      heap->CheckCollectionRequested();
+      base::OS::Sleep(base::TimeDelta::FromMilliseconds(1));
+    });
+  }
+
+  CHECK_LT(initial_ms_count, heap->ms_count());
+  isolate->Dispose();
+}
+
+}  // namespace internal
+}  // namespace v8
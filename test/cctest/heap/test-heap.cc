@@ -3872,6 +3872,83 @@ TEST(EnsureAllocationSiteDependentCodesProcessed) {
   CHECK(site->dependent_code().object_at(0)->IsCleared());
 }
 
+HEAP_TEST(SurvivalBasedPretenuring) {
+  FLAG_allocation_site_pretenuring = true;
+  FLAG_survival_based_pretenuring = true;
+  CcTest::InitializeVM();
+  Isolate* isolate = CcTest::i_isolate();
+  Heap* heap = isolate->heap();
+  HandleScope scope(isolate);
+  if (heap->MaximumSizeScavenge()) return;
+
+  auto process_feedback = [heap](Handle<AllocationSite> site, int found) {
+    site->set_memento_create_count(AllocationSite::kPretenureMinimumCreated);
+    site->set_memento_found_count(found);
+    heap->global_pretenuring_feedback_.insert(std::make_pair(*site, 0));
+    heap->ProcessPretenuringFeedback();
+  };
+
+  Handle<AllocationSite> surviving =
+      isolate->factory()->NewAllocationSite(true);
+  for (int i = 0; i < AllocationSite::kSurvivalHistoryTenureThreshold; i++) {
+    CHECK_NE(AllocationSite::kTenure, surviving->pretenure_decision());
+    process_feedback(surviving, AllocationSite::kPretenureMinimumCreated);
+    // Objects from the site are promoted early once it had high survival in
+    // two consecutive scavenges.
+    CHECK_EQ(i > 0, heap->IsEarlyPromotionSite(surviving->ptr()));
+  }
+  CHECK_EQ(AllocationSite::kTenure, surviving->pretenure_decision());
+  CHECK_EQ(0x7, surviving->survival_history());
+  CHECK(heap->IsEarlyPromotionSite(surviving->ptr()));
+
+  Handle<AllocationSite> dying = isolate->factory()->NewAllocationSite(true);
+  process_feedback(dying, AllocationSite::kPretenureMinimumCreated / 10);
+  CHECK_EQ(AllocationSite::kDontTenure, dying->pretenure_decision());
+  CHECK_EQ(0, dying->survival_history());
+  CHECK(!heap->IsEarlyPromotionSite(dying->ptr()));
+  // Sites only stay candidates while they keep reporting feedback.
+  CHECK(!heap->IsEarlyPromotionSite(surviving->ptr()));
+}
+
+HEAP_TEST(SurvivalBasedEarlyPromotion) {
+  if (FLAG_single_generation || FLAG_gc_interval != -1) return;
+  FLAG_allow_natives_syntax = true;
+  FLAG_allocation_site_pretenuring = true;
+  FLAG_survival_based_pretenuring = true;
+  FLAG_lazy_feedback_allocation = false;
+  CcTest::InitializeVM();
+  Isolate* isolate = CcTest::i_isolate();
+  Heap* heap = isolate->heap();
+  LocalContext context;
+  v8::HandleScope scope(context->GetIsolate());
+
+  int count = AllocationSitesCount(heap);
+  CompileRun(
+      "function make() { return {a: 1, b: 2}; };"
+      "var keep;"
+      "for (var i = 0; i < 3; i++) make();");
+  CHECK_EQ(count + 1, AllocationSitesCount(heap));
+  Handle<AllocationSite> site(
+      AllocationSite::cast(heap->allocation_sites_list()), isolate);
+
+  CcTest::CollectGarbage(NEW_SPACE);
+  heap->early_promotion_sites_.insert(site->ptr());
+  size_t early_promoted_before =
+      heap->tracer()->scavenge_early_promoted_bytes();
+  v8::Local<v8::Value> result = CompileRun("keep = make()");
+  Handle<JSObject> object =
+      Handle<JSObject>::cast(v8::Utils::OpenHandle(*result));
+  CHECK(Heap::InYoungGeneration(*object));
+  CHECK(!heap->FindAllocationMemento<Heap::kForGC>(object->map(), *object)
+             .is_null());
+
+  // The object is promoted by the first scavenge it survives.
+  CcTest::CollectGarbage(NEW_SPACE);
+  CHECK(!Heap::InYoungGeneration(*object));
+  CHECK_LT(early_promoted_before,
+           heap->tracer()->scavenge_early_promoted_bytes());
+}
+
 void CheckNumberOfAllocations(Heap* heap, const char* source,
                               int expected_full_alloc,
                               int expected_slim_alloc) {
@@ -6933,6 +7010,55 @@ TEST(NoCodeRangeInJitlessMode) {
       CcTest::i_isolate()->heap()->memory_allocator()->code_range().is_empty());
 }
 
+#ifdef ENABLE_MINOR_MC
+UNINITIALIZED_TEST(MinorMCOnlyForLargeSemiSpaces) {
+  FLAG_minor_mc = true;
+  FLAG_min_semi_space_size = 1;
+  FLAG_max_semi_space_size = 4;
+  FLAG_minor_mc_min_semi_space_size = 2;
+  v8::Isolate::CreateParams create_params;
+  create_params.array_buffer_allocator = CcTest::array_buffer_allocator();
+  v8::Isolate* isolate = v8::Isolate::New(create_params);
+  Isolate* i_isolate = reinterpret_cast<Isolate*>(isolate);
+  Heap* heap = i_isolate->heap();
+  {
+    v8::Isolate::Scope isolate_scope(isolate);
+    v8::HandleScope handle_scope(isolate);
+    v8::Context::Scope context_scope(v8::Context::New(isolate));
+    HandleScope scope(i_isolate);
+    Handle<FixedArray> survivor = i_isolate->factory()->NewFixedArray(100);
+
+    CHECK_LT(heap->new_space()->TotalCapacity(), 2 * MB);
+    CHECK_EQ(SCAVENGER, heap->YoungGenerationCollector());
+    heap->CollectGarbage(NEW_SPACE, GarbageCollectionReason::kTesting);
+
+    while (heap->new_space()->TotalCapacity() < 2 * MB) {
+      heap->new_space()->Grow();
+    }
+    CHECK_EQ(MINOR_MARK_COMPACTOR, heap->YoungGenerationCollector());
+    heap->CollectGarbage(NEW_SPACE, GarbageCollectionReason::kTesting);
+    heap->CollectGarbage(NEW_SPACE, GarbageCollectionReason::kTesting);
+
+    // Alternate with a scavenge after the minor mark-compacts promoted pages
+    // in place.
+    heap->new_space()->Shrink();
+    CHECK_EQ(SCAVENGER, heap->YoungGenerationCollector());
+    heap->CollectGarbage(NEW_SPACE, GarbageCollectionReason::kTesting);
+
+    // Promoted pages are swept lazily, at the latest when iterating the heap.
+    bool found = false;
+    HeapObjectIterator iterator(heap);
+    for (HeapObject obj = iterator.Next(); !obj.is_null();
+         obj = iterator.Next()) {
+      if (obj == *survivor) found = true;
+    }
+    CHECK(found);
+    CHECK_EQ(100, survivor->length());
+  }
+  isolate->Dispose();
+}
+#endif  // ENABLE_MINOR_MC
+
 }  // namespace heap
 }  // namespace internal
 }  // namespace v8
@@ -11,6 +11,7 @@
 #include "src/objects/smi.h"
 #include "test/cctest/compiler/code-assembler-tester.h"
 #include "test/cctest/compiler/function-tester.h"
+#include "test/common/wasm/flag-utils.h"
 
 namespace v8 {
 namespace internal {
@@ -27,17 +28,21 @@ void TestStubCacheOffsetCalculation(StubCache::Table table) {
   CodeAssemblerTester data(isolate, kNumParams);
   AccessorAssembler m(data.state());
 
+  StubCache stub_cache(isolate);
+  stub_cache.Clear();
+
   {
     TNode<Name> name = m.CAST(m.Parameter(0));
     TNode<Map> map = m.CAST(m.Parameter(1));
     TNode<IntPtrT> primary_offset =
-        m.StubCachePrimaryOffsetForTesting(name, map);
+        m.StubCachePrimaryOffsetForTesting(&stub_cache, name, map);
     Node* result;
     if (table == StubCache::kPrimary) {
       result = primary_offset;
     } else {
       CHECK_EQ(StubCache::kSecondary, table);
-      result = m.StubCacheSecondaryOffsetForTesting(name, primary_offset);
+      result = m.StubCacheSecondaryOffsetForTesting(&stub_cache, name,
+                                                    primary_offset);
     }
     m.Return(m.SmiTag(result));
   }
@@ -72,26 +77,32 @@ void TestStubCacheOffsetCalculation(StubCache::Table table) {
       factory->sloppy_arguments_elements_map(),
   };
 
-  for (size_t name_index = 0; name_index < arraysize(names); name_index++) {
-    Handle<Name> name = names[name_index];
-    for (size_t map_index = 0; map_index < arraysize(maps); map_index++) {
-      Handle<Map> map = maps[map_index];
-
-      int expected_result;
-      {
-        int primary_offset = StubCache::PrimaryOffsetForTesting(*name, *map);
-        if (table == StubCache::kPrimary) {
-          expected_result = primary_offset;
-        } else {
-          expected_result =
-              StubCache::SecondaryOffsetForTesting(*name, primary_offset);
+  // The generated code must pick up the larger index masks after the tables
+  // have grown.
+  for (int grow_count = 0; grow_count < 3; grow_count++) {
+    for (size_t name_index = 0; name_index < arraysize(names); name_index++) {
+      Handle<Name> name = names[name_index];
+      for (size_t map_index = 0; map_index < arraysize(maps); map_index++) {
+        Handle<Map> map = maps[map_index];
+
+        int expected_result;
+        {
+          int primary_offset =
+              stub_cache.PrimaryOffsetForTesting(*name, *map);
+          if (table == StubCache::kPrimary) {
+            expected_result = primary_offset;
+          } else {
+            expected_result =
+                stub_cache.SecondaryOffsetForTesting(*name, primary_offset);
+          }
         }
-      }
-      Handle<Object> result = ft.Call(name, map).ToHandleChecked();
+        Handle<Object> result = ft.Call(name, map).ToHandleChecked();
 
-      Smi expected = Smi::FromInt(expected_result & Smi::kMaxValue);
-      CHECK_EQ(expected, Smi::cast(*result));
+        Smi expected = Smi::FromInt(expected_result & Smi::kMaxValue);
+        CHECK_EQ(expected, Smi::cast(*result));
+      }
     }
+    stub_cache.GrowForTesting();
   }
 }
 
@@ -117,7 +128,9 @@ Handle<Code> CreateCodeOfKind(Code::Kind kind) {
 
 }  // namespace
 
-TEST(TryProbeStubCache) {
+namespace {
+
+void TestTryProbeStubCache(bool grow) {
   using Label = CodeStubAssembler::Label;
   Isolate* isolate(CcTest::InitIsolateOnce());
   const int kNumParams = 3;
@@ -211,8 +224,12 @@ TEST(TryProbeStubCache) {
   // own stub cache instance with raw values.
   DisallowHeapAllocation no_gc;
 
+  // The generated code must find the entries in the new tables.
+  if (grow) stub_cache.GrowForTesting();
+
   // Populate {stub_cache}.
-  const int N = StubCache::kPrimaryTableSize + StubCache::kSecondaryTableSize;
+  const int N =
+      stub_cache.primary_table_size() + stub_cache.secondary_table_size();
   for (int i = 0; i < N; i++) {
     int index = rand_gen.NextInt();
     Handle<Name> name = names[index % names.size()];
@@ -258,5 +275,95 @@ TEST(TryProbeStubCache) {
   CHECK(queried_existing && queried_non_existing);
 }
 
+}  // namespace
+
+TEST(TryProbeStubCache) { TestTryProbeStubCache(false); }
+
+TEST(TryProbeGrownStubCache) { TestTryProbeStubCache(true); }
+
+namespace {
+
+double stub_cache_time_ms = 0;
+
+double StubCacheTime() { return stub_cache_time_ms; }
+
+}  // namespace
+
+TEST(StubCacheGrowsOnMisses) {
+  // Allow a single step of growth.
+  FlagScope<int> max_bits(&FLAG_stub_cache_max_primary_table_bits,
+                          StubCache::kPrimaryTableBits + 1);
+  Isolate* isolate(CcTest::InitIsolateOnce());
+  Factory* factory = isolate->factory();
+  HandleScope scope(isolate);
+  StubCache stub_cache(isolate);
+  stub_cache_time_ms = 0;
+  stub_cache.SetTimeFunctionForTesting(StubCacheTime);
+  stub_cache.Clear();
+  CHECK_EQ(StubCache::kPrimaryTableSize, stub_cache.primary_table_size());
+  CHECK_EQ(StubCache::kSecondaryTableSize, stub_cache.secondary_table_size());
+
+  Handle<Name> name = factory->InternalizeUtf8String("name");
+  Handle<Code> handler = CreateCodeOfKind(Code::STUB);
+  std::vector<Handle<Map>> maps;
+  for (int i = 0; i < 64; i++) maps.push_back(Map::Create(isolate, 0));
+
+  DisallowHeapAllocation no_gc;
+  const int kMissesBeforeGrowing =
+      StubCache::kMissesPerEntryBeforeGrowing * StubCache::kPrimaryTableSize;
+  // Updates without a miss, like the entries copied from an IC when it goes
+  // megamorphic, don't count.
+  for (int i = 0; i <= kMissesBeforeGrowing; i++) {
+    stub_cache.Set(*name, *maps[i % maps.size()],
+                   MaybeObject::FromObject(*handler));
+  }
+  CHECK_EQ(StubCache::kPrimaryTableSize, stub_cache.primary_table_size());
+
+  // The tables don't grow while there have been few misses in one window,
+  // even if there have been many misses in total.
+  for (int i = 0; i < kMissesBeforeGrowing; i++) {
+    stub_cache.RecordMiss();
+    stub_cache.Set(*name, *maps[i % maps.size()],
+                   MaybeObject::FromObject(*handler));
+  }
+  stub_cache_time_ms += StubCache::kMissWindowMs;
+  for (int i = 0; i < kMissesBeforeGrowing; i++) {
+    stub_cache.RecordMiss();
+    stub_cache.Set(*name, *maps[i % maps.size()],
+                   MaybeObject::FromObject(*handler));
+  }
+  CHECK_EQ(StubCache::kPrimaryTableSize, stub_cache.primary_table_size());
+  stub_cache.RecordMiss();
+  Handle<Map> last_map = maps[kMissesBeforeGrowing % maps.size()];
+  stub_cache.Set(*name, *last_map, MaybeObject::FromObject(*handler));
+  CHECK_EQ(2 * StubCache::kPrimaryTableSize, stub_cache.primary_table_size());
+  CHECK_EQ(2 * StubCache::kSecondaryTableSize,
+           stub_cache.secondary_table_size());
+  // The entry for the miss that triggered growing is in the new tables.
+  CHECK(MaybeObject::FromObject(*handler) ==
+        stub_cache.Get(*name, *last_map));
+
+  // The tables stop growing at the configured limit.
+  for (int i = 0; i < 4 * kMissesBeforeGrowing; i++) {
+    stub_cache.RecordMiss();
+    stub_cache.Set(*name, *maps[i % maps.size()],
+                   MaybeObject::FromObject(*handler));
+  }
+  CHECK_EQ(2 * StubCache::kPrimaryTableSize, stub_cache.primary_table_size());
+
+  // Clearing the tables right after they missed often does not shrink them.
+  stub_cache.Clear();
+  CHECK_EQ(2 * StubCache::kPrimaryTableSize, stub_cache.primary_table_size());
+  stub_cache_time_ms += StubCache::kMissWindowMs;
+  stub_cache.Clear();
+  CHECK_EQ(2 * StubCache::kPrimaryTableSize, stub_cache.primary_table_size());
+
+  // Once two windows have passed without misses, clearing shrinks them.
+  stub_cache_time_ms += 2 * StubCache::kMissWindowMs;
+  stub_cache.Clear();
+  CHECK_EQ(StubCache::kPrimaryTableSize, stub_cache.primary_table_size());
+  CHECK_EQ(StubCache::kSecondaryTableSize, stub_cache.secondary_table_size());
+}
+
 }  // namespace internal
 }  // namespace v8
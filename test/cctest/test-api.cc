@@ -20882,6 +20882,112 @@ THREADED_TEST(JSONStringifyObjectWithGap) {
   ExpectString("JSON.stringify(obj, null,  '*')", *utf8);
 }
 
+namespace {
+class TestJSONOutputStream : public v8::JSON::OutputStream {
+ public:
+  explicit TestJSONOutputStream(int chunk_size, int abort_after = -1)
+      : chunk_size_(chunk_size), abort_after_(abort_after) {}
+
+  int GetChunkSize() override { return chunk_size_; }
+  WriteResult WriteUtf8Chunk(const char* data, int size) override {
+    CHECK_LE(size, chunk_size_);
+    CHECK(!eos_);
+    output_.append(data, size);
+    chunks_++;
+    return chunks_ == abort_after_ ? kAbort : kContinue;
+  }
+  void EndOfStream() override { eos_ = true; }
+
+  const std::string& output() const { return output_; }
+  int chunks() const { return chunks_; }
+  bool eos() const { return eos_; }
+
+ private:
+  const int chunk_size_;
+  const int abort_after_;
+  std::string output_;
+  int chunks_ = 0;
+  bool eos_ = false;
+};
+
+void CheckStringifyToStream(LocalContext* context, const char* source,
+                            int chunk_size, Local<String> gap) {
+  Local<Value> value = CompileRun(source);
+  TestJSONOutputStream stream(chunk_size);
+  CHECK(v8::JSON::StringifyToStream(context->local(), value, &stream, gap)
+            .FromJust());
+  CHECK(stream.eos());
+  Local<String> expected =
+      v8::JSON::Stringify(context->local(), value, gap).ToLocalChecked();
+  v8::String::Utf8Value utf8(context->local()->GetIsolate(), expected);
+  CHECK_EQ(std::string(*utf8, utf8.length()), stream.output());
+}
+}  // namespace
+
+THREADED_TEST(JSONStringifyToStream) {
+  LocalContext context;
+  HandleScope scope(context->GetIsolate());
+  const char* kSources[] = {
+      "({x: 42, y: [1, 2.5, 'three', null, true], z: {}})",
+      "'\\u00e9t\\u00e9 \\u20ac \\ud83d\\ude00 \\ud800 \"quoted\"'",
+      "(function() {"
+      "  var a = [];"
+      "  for (var i = 0; i < 5000; i++) {"
+      "    a.push({i: i, s: '\\u00e4\\ud83d\\ude00'.repeat(i % 7)});"
+      "  }"
+      "  return a;"
+      "})()"};
+  for (const char* source : kSources) {
+    for (int chunk_size : {4, 7, 1024}) {
+      CheckStringifyToStream(&context, source, chunk_size, Local<String>());
+      CheckStringifyToStream(&context, source, chunk_size, v8_str("  "));
+    }
+  }
+}
+
+THREADED_TEST(JSONStringifyToStreamNoOutput) {
+  LocalContext context;
+  HandleScope scope(context->GetIsolate());
+  TestJSONOutputStream stream(1024);
+  Local<Value> value = CompileRun("(function() {})");
+  CHECK(!v8::JSON::StringifyToStream(context.local(), value, &stream)
+             .FromJust());
+  CHECK_EQ(0, stream.chunks());
+  CHECK(!stream.eos());
+}
+
+THREADED_TEST(JSONStringifyToStreamAbort) {
+  LocalContext context;
+  HandleScope scope(context->GetIsolate());
+  CompileRun(
+      "var visited = 0;"
+      "var big = [];"
+      "for (var i = 0; i < 100000; i++) {"
+      "  big.push({toJSON() { visited++; return {i: i}; }});"
+      "}");
+  Local<Value> value = CompileRun("big");
+  TestJSONOutputStream stream(64, 3);
+  CHECK(!v8::JSON::StringifyToStream(context.local(), value, &stream)
+             .FromJust());
+  CHECK_EQ(3, stream.chunks());
+  CHECK(!stream.eos());
+  // Traversal stops soon after the stream aborts.
+  CHECK_GT(100000,
+           CompileRun("visited")->Int32Value(context.local()).FromJust());
+}
+
+THREADED_TEST(JSONStringifyToStreamException) {
+  LocalContext context;
+  HandleScope scope(context->GetIsolate());
+  v8::TryCatch try_catch(context->GetIsolate());
+  TestJSONOutputStream stream(1024);
+  Local<Value> value = CompileRun("var o = {}; o.self = o; o");
+  CHECK(v8::JSON::StringifyToStream(context.local(), value, &stream)
+            .IsNothing());
+  CHECK(try_catch.HasCaught());
+  CHECK(!stream.eos());
+}
+
 #if V8_OS_POSIX
 class ThreadInterruptTest {
  public:
@@ -23276,6 +23382,28 @@ TEST(StreamingSimpleScript) {
   RunStreamingTest(chunks);
 }
 
+TEST(StreamingScriptWithLocalHeaps) {
+  // With --local-heaps, the background task looks up strings which already
+  // exist in the string table ("Math", "foo" after the first run) itself.
+  i::FLAG_local_heaps = true;
+  const char* chunks[] = {"function foo() { return Math.floor(13.5); }",
+                          "foo(); ", nullptr};
+  RunStreamingTest(chunks);
+  RunStreamingTest(chunks);
+}
+
+TEST(StreamingScriptWithConcurrentAllocation) {
+  // With --concurrent-allocation, the background task also allocates the
+  // strings which are missing ("bar", "baz"), and the main thread internalizes
+  // them in place.
+  i::FLAG_concurrent_allocation = true;
+  i::FLAG_local_heaps = true;
+  const char* chunks[] = {"function bar() { return 'baz'; }",
+                          "bar() === 'baz'; ", nullptr};
+  RunStreamingTest(chunks);
+  RunStreamingTest(chunks);
+}
+
 TEST(StreamingScriptConstantArray) {
   // When run with Ignition, tests that the streaming parser canonicalizes
   // handles so that they are only added to the constant pool array once.
@@ -23324,6 +23452,47 @@ TEST(StreamingBiggerScript) {
 }
 
 
+TEST(StreamingEagerCompileBudget) {
+  if (!i::FLAG_lazy) return;
+  // The first top-level function uses up the budget, so only it is compiled
+  // together with the script.
+  i::FlagScope<int> budget(&i::FLAG_streaming_eager_compile_budget, 1);
+  LocalContext env;
+  v8::Isolate* isolate = env->GetIsolate();
+  v8::HandleScope scope(isolate);
+
+  const char* chunks[] = {"function foo() { return 13; }\n",
+                          "function bar() { return 13; }\n", "13;", nullptr};
+  v8::ScriptCompiler::StreamedSource source(
+      std::make_unique<TestSourceStream>(chunks),
+      v8::ScriptCompiler::StreamedSource::ONE_BYTE);
+  v8::ScriptCompiler::ScriptStreamingTask* task =
+      v8::ScriptCompiler::StartStreamingScript(isolate, &source);
+  task->Run();
+  delete task;
+
+  v8::ScriptOrigin origin(v8_str("http://foo.com"));
+  char* full_source = TestSourceStream::FullSourceString(chunks);
+  v8::Local<Script> script =
+      v8::ScriptCompiler::Compile(env.local(), &source, v8_str(full_source),
+                                  origin)
+          .ToLocalChecked();
+  CHECK_EQ(13, script->Run(env.local())
+                   .ToLocalChecked()
+                   ->Int32Value(env.local())
+                   .FromJust());
+  delete[] full_source;
+
+  i::Handle<i::JSFunction> foo = i::Handle<i::JSFunction>::cast(
+      v8::Utils::OpenHandle(*env->Global()->Get(env.local(), v8_str("foo"))
+                                 .ToLocalChecked()));
+  i::Handle<i::JSFunction> bar = i::Handle<i::JSFunction>::cast(
+      v8::Utils::OpenHandle(*env->Global()->Get(env.local(), v8_str("bar"))
+                                 .ToLocalChecked()));
+  CHECK(foo->shared().is_compiled());
+  CHECK(!bar->shared().is_compiled());
+}
+
 TEST(StreamingScriptWithParseError) {
   // Test that parse errors from streamed scripts are propagated correctly.
   {
@@ -0,0 +1,255 @@
+// Copyright 2020 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include <memory>
+#include <string>
+
+#include "src/ast/ast-value-factory.h"
+#include "src/base/platform/semaphore.h"
+#include "src/handles/handles-inl.h"
+#include "src/handles/local-handles-inl.h"
+#include "src/handles/persistent-handles.h"
+#include "src/heap/heap.h"
+#include "src/heap/local-heap.h"
+#include "src/numbers/hash-seed-inl.h"
+#include "src/objects/string-table.h"
+#include "test/cctest/cctest.h"
+
+namespace v8 {
+namespace internal {
+
+namespace {
+
+const int kNumStrings = 1000;
+const int kNumRounds = 20;
+
+Vector<const uint8_t> StringChars(const char* chars) {
+  return Vector<const uint8_t>(reinterpret_cast<const uint8_t*>(chars),
+                               strlen(chars));
+}
+
+class StringLookupThread final : public v8::base::Thread {
+ public:
+  StringLookupThread(Isolate* isolate,
+                     std::vector<Handle<String>>* internalized,
+                     base::Semaphore* sema_started)
+      : v8::base::Thread(base::Thread::Options("ThreadWithLocalHeap")),
+        isolate_(isolate),
+        internalized_(internalized),
+        sema_started_(sema_started) {}
+
+  void Run() override {
+    LocalHeap local_heap(isolate_->heap());
+    uint64_t seed = HashSeed(isolate_);
+    sema_started_->Signal();
+
+    for (int round = 0; round < kNumRounds; round++) {
+      for (int i = 0; i < kNumStrings; i++) {
+        LocalHandleScope scope(&local_heap);
+        EmbeddedVector<char, 32> buffer;
+        SNPrintF(buffer, "concurrent-string-%d", i);
+        OneByteStringKey key(StringChars(buffer.begin()), seed);
+        Handle<String> result;
+        CHECK(StringTable::LookupKeyIfExists(isolate_, &local_heap, &key)
+                  .ToHandle(&result));
+        CHECK_EQ(*result, *(*internalized_)[i]);
+
+        SNPrintF(buffer, "missing-string-%d", i);
+        OneByteStringKey missing(StringChars(buffer.begin()), seed);
+        CHECK(StringTable::LookupKeyIfExists(isolate_, &local_heap, &missing)
+                  .is_null());
+
+        local_heap.Safepoint();
+      }
+    }
+  }
+
+ private:
+  Isolate* isolate_;
+  std::vector<Handle<String>>* internalized_;
+  base::Semaphore* sema_started_;
+};
+
+}  // namespace
+
+TEST(ConcurrentStringTableLookup) {
+  CcTest::InitializeVM();
+  FLAG_local_heaps = true;
+  Isolate* isolate = CcTest::i_isolate();
+  Factory* factory = isolate->factory();
+  HandleScope handle_scope(isolate);
+
+  std::vector<Handle<String>> internalized;
+  for (int i = 0; i < kNumStrings; i++) {
+    EmbeddedVector<char, 32> buffer;
+    SNPrintF(buffer, "concurrent-string-%d", i);
+    internalized.push_back(factory->InternalizeUtf8String(buffer.begin()));
+  }
+
+  const int kNumThreads = 4;
+  base::Semaphore sema_started(0);
+  std::vector<std::unique_ptr<StringLookupThread>> threads;
+  for (int i = 0; i < kNumThreads; i++) {
+    threads.emplace_back(
+        new StringLookupThread(isolate, &internalized, &sema_started));
+    CHECK(threads.back()->Start());
+  }
+  for (int i = 0; i < kNumThreads; i++) sema_started.Wait();
+
+  // Keep growing the string table and moving objects around while the
+  // background threads are looking up strings.
+  for (int round = 0; round < kNumRounds; round++) {
+    HandleScope scope(isolate);
+    for (int i = 0; i < kNumStrings; i++) {
+      EmbeddedVector<char, 32> buffer;
+      SNPrintF(buffer, "main-thread-string-%d-%d", round, i);
+      factory->InternalizeUtf8String(buffer.begin());
+    }
+    CcTest::CollectAllGarbage();
+  }
+
+  for (auto& thread : threads) thread->Join();
+}
+
+namespace {
+
+class AstStringLookupThread final : public v8::base::Thread {
+ public:
+  AstStringLookupThread(Isolate* isolate, AstValueFactory* ast_value_factory,
+                        std::unique_ptr<PersistentHandles>* persistent_handles)
+      : v8::base::Thread(base::Thread::Options("ThreadWithLocalHeap")),
+        isolate_(isolate),
+        ast_value_factory_(ast_value_factory),
+        persistent_handles_(persistent_handles) {}
+
+  void Run() override {
+    LocalHeap local_heap(isolate_->heap());
+    ast_value_factory_->LookupOrAllocateStrings(isolate_, &local_heap);
+    *persistent_handles_ = local_heap.DetachPersistentHandles();
+  }
+
+ private:
+  Isolate* isolate_;
+  AstValueFactory* ast_value_factory_;
+  std::unique_ptr<PersistentHandles>* persistent_handles_;
+};
+
+}  // namespace
+
+TEST(ConcurrentAstStringLookup) {
+  CcTest::InitializeVM();
+  FLAG_local_heaps = true;
+  Isolate* isolate = CcTest::i_isolate();
+  Factory* factory = isolate->factory();
+  HandleScope handle_scope(isolate);
+
+  Zone zone(isolate->allocator(), ZONE_NAME);
+  AstValueFactory ast_value_factory(&zone, isolate->ast_string_constants(),
+                                    HashSeed(isolate));
+  std::vector<Handle<String>> internalized;
+  std::vector<const AstRawString*> existing;
+  std::vector<const AstRawString*> missing;
+  for (int i = 0; i < kNumStrings; i++) {
+    EmbeddedVector<char, 32> buffer;
+    SNPrintF(buffer, "ast-string-%d", i);
+    internalized.push_back(factory->InternalizeUtf8String(buffer.begin()));
+    existing.push_back(ast_value_factory.GetOneByteString(buffer.begin()));
+    SNPrintF(buffer, "missing-ast-string-%d", i);
+    missing.push_back(ast_value_factory.GetOneByteString(buffer.begin()));
+  }
+
+  std::unique_ptr<PersistentHandles> persistent_handles;
+  AstStringLookupThread thread(isolate, &ast_value_factory,
+                               &persistent_handles);
+  CHECK(thread.Start());
+  // Move the strings around while the background thread looks them up.
+  for (int round = 0; round < kNumRounds; round++) {
+    CcTest::CollectAllGarbage();
+  }
+  thread.Join();
+  CcTest::CollectAllGarbage();
+
+  CHECK_NOT_NULL(persistent_handles);
+
+  ast_value_factory.Internalize(isolate);
+  for (int i = 0; i < kNumStrings; i++) {
+    // Strings found by the background thread are not looked up again.
+    CHECK_EQ(*internalized[i], *existing[i]->string());
+#ifdef DEBUG
+    CHECK(persistent_handles->Contains(existing[i]->string().location()));
+    CHECK(!persistent_handles->Contains(missing[i]->string().location()));
+#endif
+    EmbeddedVector<char, 32> buffer;
+    SNPrintF(buffer, "missing-ast-string-%d", i);
+    CHECK_EQ(*factory->InternalizeUtf8String(buffer.begin()),
+             *missing[i]->string());
+  }
+}
+
+TEST(ConcurrentAstStringAllocation) {
+  FLAG_concurrent_allocation = true;
+  FLAG_local_heaps = true;
+  CcTest::InitializeVM();
+  Isolate* isolate = CcTest::i_isolate();
+  Factory* factory = isolate->factory();
+  HandleScope handle_scope(isolate);
+
+  Zone zone(isolate->allocator(), ZONE_NAME);
+  AstValueFactory ast_value_factory(&zone, isolate->ast_string_constants(),
+                                    HashSeed(isolate));
+  std::vector<const AstRawString*> missing;
+  for (int i = 0; i < kNumStrings; i++) {
+    EmbeddedVector<char, 32> buffer;
+    SNPrintF(buffer, "allocated-ast-string-%d", i);
+    missing.push_back(ast_value_factory.GetOneByteString(buffer.begin()));
+  }
+  const uint16_t kTwoByteChars[] = {0x3b1, 0x3b2, 0x3b3};
+  const AstRawString* two_byte = ast_value_factory.GetTwoByteString(
+      Vector<const uint16_t>(kTwoByteChars, arraysize(kTwoByteChars)));
+  // Too large for a regular page, so it is allocated in large object space.
+  std::string large_chars(kMaxRegularHeapObjectSize + 1, 'x');
+  const AstRawString* large =
+      ast_value_factory.GetOneByteString(StringChars(large_chars.c_str()));
+
+  std::unique_ptr<PersistentHandles> persistent_handles;
+  AstStringLookupThread thread(isolate, &ast_value_factory,
+                               &persistent_handles);
+  CHECK(thread.Start());
+  // Move the allocated strings around before they are internalized.
+  for (int round = 0; round < kNumRounds; round++) {
+    CcTest::CollectAllGarbage();
+  }
+  thread.Join();
+  CcTest::CollectAllGarbage();
+
+  CHECK_NOT_NULL(persistent_handles);
+
+  ast_value_factory.Internalize(isolate);
+  for (int i = 0; i < kNumStrings; i++) {
+    Handle<String> string = missing[i]->string();
+    CHECK(string->IsInternalizedString());
+#ifdef DEBUG
+    // The strings allocated by the background thread are internalized in
+    // place instead of being copied.
+    CHECK(persistent_handles->Contains(string.location()));
+#endif
+    EmbeddedVector<char, 32> buffer;
+    SNPrintF(buffer, "allocated-ast-string-%d", i);
+    CHECK_EQ(*factory->InternalizeUtf8String(buffer.begin()), *string);
+  }
+
+  CHECK(two_byte->string()->IsInternalizedString());
+  CHECK(two_byte->string()->IsTwoByteRepresentation());
+  CHECK_EQ(*factory->InternalizeString(
+               Vector<const uint16_t>(kTwoByteChars, arraysize(kTwoByteChars))),
+           *two_byte->string());
+
+  CHECK(large->string()->IsInternalizedString());
+  CHECK(isolate->heap()->lo_space()->Contains(*large->string()));
+  CHECK_EQ(*factory->InternalizeString(StringChars(large_chars.c_str())),
+           *large->string());
+}
+
+}  // namespace internal
+}  // namespace v8
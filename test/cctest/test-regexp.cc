@@ -28,6 +28,7 @@
 #include <cstdlib>
 #include <memory>
 #include <sstream>
+#include <string>
 
 #include "include/v8.h"
 #include "src/api/api-inl.h"
@@ -37,10 +38,12 @@
 #include "src/init/v8.h"
 #include "src/objects/js-regexp-inl.h"
 #include "src/objects/objects-inl.h"
+#include "src/regexp/regexp-bytecode-cache.h"
 #include "src/regexp/regexp-bytecode-generator.h"
 #include "src/regexp/regexp-bytecodes.h"
 #include "src/regexp/regexp-compiler.h"
 #include "src/regexp/regexp-interpreter.h"
+#include "src/regexp/regexp-linear.h"
 #include "src/regexp/regexp-macro-assembler-arch.h"
 #include "src/regexp/regexp-parser.h"
 #include "src/regexp/regexp.h"
@@ -477,6 +480,147 @@ TEST(Errors) {
 }
 
 
+static bool CanBeHandledLinear(const char* input,
+                               JSRegExp::Flags flags = JSRegExp::kNone) {
+  v8::HandleScope scope(CcTest::isolate());
+  Zone zone(CcTest::i_isolate()->allocator(), ZONE_NAME);
+  FlatStringReader reader(CcTest::i_isolate(), CStrVector(input));
+  RegExpCompileData result;
+  CHECK(v8::internal::RegExpParser::ParseRegExp(CcTest::i_isolate(), &zone,
+                                                &reader, flags, &result));
+  return RegExpLinear::CanBeHandled(result.tree, flags, &zone);
+}
+
+TEST(RegExpLinearCanBeHandled) {
+  CHECK(CanBeHandledLinear("abc"));
+  CHECK(CanBeHandledLinear("a|b|"));
+  CHECK(CanBeHandledLinear("^(a|a)+$"));
+  CHECK(CanBeHandledLinear("(a*)b+?c{2,5}d{3}"));
+  CHECK(CanBeHandledLinear("[^a-z\\d]\\w\\B."));
+  CHECK(CanBeHandledLinear("(?:a*)"));
+  CHECK(CanBeHandledLinear("(?:a?){3}"));
+  CHECK(CanBeHandledLinear("(?<name>x)", JSRegExp::kGlobal));
+
+  // Back references and lookarounds.
+  CHECK(!CanBeHandledLinear("(a)\\1"));
+  CHECK(!CanBeHandledLinear("a(?=b)"));
+  CHECK(!CanBeHandledLinear("(?<!a)b"));
+  // Optional iterations that can match the empty string.
+  CHECK(!CanBeHandledLinear("(?:a*)*"));
+  CHECK(!CanBeHandledLinear("(?:a|)+"));
+  CHECK(!CanBeHandledLinear("(?:a?){1,3}"));
+  // Unsupported flags.
+  CHECK(!CanBeHandledLinear("abc", JSRegExp::kIgnoreCase));
+  CHECK(!CanBeHandledLinear("abc", JSRegExp::kUnicode));
+  // Threads that need too many registers in total.
+  std::string captures;
+  for (int i = 0; i < 400; i++) captures += "(x)";
+  CHECK(!CanBeHandledLinear(captures.c_str()));
+  CHECK(CanBeHandledLinear(captures.substr(0, 3 * 100).c_str()));
+}
+
+static Handle<ByteArray> NewBytecode(int length, byte value) {
+  Handle<ByteArray> bytecode = CcTest::i_isolate()->factory()->NewByteArray(
+      length, AllocationType::kOld);
+  for (int i = 0; i < length; i++) bytecode->set(i, value);
+  return bytecode;
+}
+
+TEST(RegExpBytecodeCache) {
+  CcTest::InitializeVM();
+  Isolate* isolate = CcTest::i_isolate();
+  Factory* factory = isolate->factory();
+  HandleScope scope(isolate);
+
+  RegExpBytecodeCache cache(4 * KB);
+  Handle<String> foo = factory->NewStringFromAsciiChecked("foo");
+  Handle<String> bar = factory->NewStringFromAsciiChecked("bar");
+  const uint32_t kNoLimit = JSRegExp::kNoBacktrackLimit;
+
+  Handle<ByteArray> bytecode;
+  int register_count = 0;
+  CHECK(!cache.Lookup(isolate, foo, JSRegExp::kNone, true, kNoLimit,
+                      &bytecode, &register_count));
+  cache.Insert(foo, JSRegExp::kNone, true, kNoLimit, NewBytecode(64, 1), 4);
+  CHECK(cache.Lookup(isolate, foo, JSRegExp::kNone, true, kNoLimit, &bytecode,
+                     &register_count));
+  CHECK_EQ(64, bytecode->length());
+  CHECK_EQ(1, bytecode->get(63));
+  CHECK_EQ(4, register_count);
+
+  // All compilation parameters are part of the key.
+  CHECK(!cache.Lookup(isolate, bar, JSRegExp::kNone, true, kNoLimit,
+                      &bytecode, &register_count));
+  CHECK(!cache.Lookup(isolate, foo, JSRegExp::kGlobal, true, kNoLimit,
+                      &bytecode, &register_count));
+  CHECK(!cache.Lookup(isolate, foo, JSRegExp::kNone, false, kNoLimit,
+                      &bytecode, &register_count));
+  CHECK(!cache.Lookup(isolate, foo, JSRegExp::kNone, true, 1000, &bytecode,
+                      &register_count));
+  CHECK_EQ(1u, cache.hits());
+  CHECK_EQ(5u, cache.misses());
+
+  // Two-byte patterns match one-byte patterns with the same characters.
+  const uc16 two_byte_foo[] = {'f', 'o', 'o'};
+  Handle<SeqTwoByteString> foo_two_byte =
+      factory->NewRawTwoByteString(3).ToHandleChecked();
+  {
+    DisallowHeapAllocation no_gc;
+    CopyChars(foo_two_byte->GetChars(no_gc), two_byte_foo, 3);
+  }
+  CHECK(cache.Lookup(isolate, foo_two_byte, JSRegExp::kNone, true, kNoLimit,
+                     &bytecode, &register_count));
+
+  // Entries that don't fit are not added, and the least recently used
+  // entries are dropped to make room for new ones.
+  cache.Insert(bar, JSRegExp::kNone, true, kNoLimit, NewBytecode(8 * KB, 2),
+               2);
+  CHECK_EQ(1u, cache.number_of_entries());
+  cache.Insert(bar, JSRegExp::kNone, true, kNoLimit, NewBytecode(2 * KB, 2),
+               2);
+  CHECK_EQ(2u, cache.number_of_entries());
+  CHECK(cache.Lookup(isolate, foo, JSRegExp::kNone, true, kNoLimit, &bytecode,
+                     &register_count));
+  cache.Insert(bar, JSRegExp::kGlobal, true, kNoLimit,
+               NewBytecode(2 * KB, 3), 2);
+  CHECK_EQ(2u, cache.number_of_entries());
+  CHECK_LE(cache.size(), cache.capacity());
+  CHECK(cache.Lookup(isolate, foo, JSRegExp::kNone, true, kNoLimit, &bytecode,
+                     &register_count));
+  CHECK(!cache.Lookup(isolate, bar, JSRegExp::kNone, true, kNoLimit,
+                      &bytecode, &register_count));
+  CHECK(cache.Lookup(isolate, bar, JSRegExp::kGlobal, true, kNoLimit,
+                     &bytecode, &register_count));
+  CHECK_EQ(3, bytecode->get(0));
+}
+
+TEST(RegExpBytecodeCacheSharedBetweenIsolates) {
+  if (!FLAG_regexp_shared_bytecode_cache) return;
+  // The first compilation of a regexp produces bytecode.
+  FLAG_regexp_interpret_all = true;
+
+  RegExpBytecodeCache* cache = RegExpBytecodeCache::GetProcessWideCache();
+  size_t hits = cache->hits();
+  for (int i = 0; i < 2; i++) {
+    v8::Isolate::CreateParams create_params;
+    create_params.array_buffer_allocator = CcTest::array_buffer_allocator();
+    v8::Isolate* isolate = v8::Isolate::New(create_params);
+    {
+      v8::Isolate::Scope isolate_scope(isolate);
+      v8::HandleScope handle_scope(isolate);
+      v8::Local<v8::Context> context = v8::Context::New(isolate);
+      v8::Context::Scope context_scope(context);
+      v8::Local<v8::Value> result =
+          CompileRun("/(a|b)*c\\d+x{2}/.exec('xxabc42xxy')[0]");
+      CHECK(result->StrictEquals(v8_str(isolate, "abc42xx")));
+    }
+    isolate->Dispose();
+  }
+  // The second isolate adopts the bytecode compiled by the first one.
+  CHECK_EQ(hits + 1, cache->hits());
+}
+
+
 static bool IsDigit(uc16 c) {
   return ('0' <= c && c <= '9');
 }
@@ -1237,6 +1381,127 @@ TEST(MacroAssemblerNativeLotsOfRegisters) {
   isolate->clear_pending_exception();
 }
 
+// Runs the skip loop emitted by {emit} on {input} from position 0 and
+// returns the position it stops at.
+template <typename EmitFunction>
+static int RunSkipUntil(Handle<String> input, EmitFunction emit) {
+  Isolate* isolate = CcTest::i_isolate();
+  Factory* factory = isolate->factory();
+  Zone zone(isolate->allocator(), ZONE_NAME);
+  bool is_one_byte = input->IsOneByteRepresentation();
+
+  ArchRegExpMacroAssembler m(isolate, &zone,
+                             is_one_byte ? NativeRegExpMacroAssembler::LATIN1
+                                         : NativeRegExpMacroAssembler::UC16,
+                             2);
+  emit(&m);
+  m.WriteCurrentPositionToRegister(0, 0);
+  m.WriteCurrentPositionToRegister(1, 0);
+  m.Succeed();
+
+  Handle<String> source = factory->NewStringFromStaticChars("<skip test>");
+  Handle<Object> code_object = m.GetCode(source);
+  Handle<Code> code = Handle<Code>::cast(code_object);
+  Handle<JSRegExp> regexp = CreateJSRegExp(source, code, !is_one_byte);
+
+  Address start_adr;
+  int byte_length;
+  if (is_one_byte) {
+    start_adr = Handle<SeqOneByteString>::cast(input)->GetCharsAddress();
+    byte_length = input->length();
+  } else {
+    start_adr = Handle<SeqTwoByteString>::cast(input)->GetCharsAddress();
+    byte_length = input->length() * kUC16Size;
+  }
+
+  int captures[2];
+  NativeRegExpMacroAssembler::Result result =
+      Execute(*regexp, *input, 0, start_adr, start_adr + byte_length, captures);
+  CHECK_EQ(NativeRegExpMacroAssembler::SUCCESS, result);
+  return captures[0];
+}
+
+TEST(MacroAssemblerNativeSkipUntil) {
+  v8::V8::Initialize();
+  ContextInitializer initializer;
+  Isolate* isolate = CcTest::i_isolate();
+  Factory* factory = isolate->factory();
+
+  const int kLength = 100;
+  // Candidates in the middle, in the last 16 bytes, and none at all, where
+  // the loop stops once the character at cp_offset is past the end.
+  const int kPositions[] = {70, kLength - 3, -1};
+  const int kCpOffset = 1;
+
+  Handle<ByteArray> small_table =
+      factory->NewByteArray(RegExpMacroAssembler::kTableSize);
+  Handle<ByteArray> large_table =
+      factory->NewByteArray(RegExpMacroAssembler::kTableSize);
+  for (int i = 0; i < RegExpMacroAssembler::kTableSize; i++) {
+    small_table->set(i, i == 'x' || i == 'y');
+    large_table->set(i, i == 'x' || (i >= '0' && i <= '9'));
+  }
+
+  for (int position : kPositions) {
+    int expected = position == -1 ? kLength - kCpOffset : position - kCpOffset;
+    uint8_t one_byte[kLength];
+    uc16 two_byte[kLength];
+    for (int i = 0; i < kLength; i++) {
+      one_byte[i] = 'a';
+      two_byte[i] = 0x1261;
+    }
+
+    // Exact characters.
+    if (position != -1) {
+      one_byte[position] = 'x';
+      two_byte[position] = 'x';
+    }
+    Handle<String> one_byte_input =
+        factory->NewStringFromOneByte(Vector<const uint8_t>(one_byte, kLength))
+            .ToHandleChecked();
+    Handle<String> two_byte_input =
+        factory->NewStringFromTwoByte(Vector<const uc16>(two_byte, kLength))
+            .ToHandleChecked();
+    for (Handle<String> input : {one_byte_input, two_byte_input}) {
+      auto char_loop = [=](RegExpMacroAssembler* m) {
+        m->SkipUntilChar(kCpOffset, 1, 'x');
+      };
+      CHECK_EQ(expected, RunSkipUntil(input, char_loop));
+      auto small_table_loop = [=](RegExpMacroAssembler* m) {
+        m->SkipUntilBitInTable(kCpOffset, 1, small_table);
+      };
+      CHECK_EQ(expected, RunSkipUntil(input, small_table_loop));
+      auto large_table_loop = [=](RegExpMacroAssembler* m) {
+        m->SkipUntilBitInTable(kCpOffset, 1, large_table);
+      };
+      CHECK_EQ(expected, RunSkipUntil(input, large_table_loop));
+    }
+
+    // Characters that only match after and'ing them with kTableMask.
+    if (position != -1) {
+      one_byte[position] = 'x' | 0x80;
+      two_byte[position] = 'x' | 0x1200;
+    }
+    one_byte_input =
+        factory->NewStringFromOneByte(Vector<const uint8_t>(one_byte, kLength))
+            .ToHandleChecked();
+    two_byte_input =
+        factory->NewStringFromTwoByte(Vector<const uc16>(two_byte, kLength))
+            .ToHandleChecked();
+    for (Handle<String> input : {one_byte_input, two_byte_input}) {
+      auto char_loop = [=](RegExpMacroAssembler* m) {
+        m->SkipUntilCharAfterAnd(kCpOffset, 1, 'x',
+                                 RegExpMacroAssembler::kTableMask);
+      };
+      CHECK_EQ(expected, RunSkipUntil(input, char_loop));
+      auto table_loop = [=](RegExpMacroAssembler* m) {
+        m->SkipUntilBitInTable(kCpOffset, 1, large_table);
+      };
+      CHECK_EQ(expected, RunSkipUntil(input, table_loop));
+    }
+  }
+}
+
 TEST(MacroAssembler) {
   Zone zone(CcTest::i_isolate()->allocator(), ZONE_NAME);
   RegExpBytecodeGenerator m(CcTest::i_isolate(), &zone);
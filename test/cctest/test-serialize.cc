@@ -433,6 +433,48 @@ UNINITIALIZED_TEST(SnapshotCompression) {
   partial_blob.Dispose();
 }
 
+UNINITIALIZED_TEST(SnapshotCompressionShared) {
+  DisableAlwaysOpt();
+  Vector<const byte> startup_blob;
+  Vector<const byte> read_only_blob;
+  Vector<const byte> partial_blob;
+  PartiallySerializeContext(&startup_blob, &read_only_blob, &partial_blob);
+  SnapshotData original_snapshot_data(partial_blob);
+  SnapshotData compressed =
+      i::SnapshotCompression::Compress(&original_snapshot_data);
+
+  // A single user decompresses into a private copy.
+  i::SnapshotCompression::AddSharedUser();
+  CHECK(i::SnapshotCompression::DecompressShared(compressed.RawData())
+            .empty());
+
+  // Once there is a second user, the section is decompressed once and shared.
+  i::SnapshotCompression::AddSharedUser();
+  Vector<const byte> decompressed =
+      i::SnapshotCompression::DecompressShared(compressed.RawData());
+  CHECK_EQ(partial_blob, decompressed);
+  CHECK_EQ(decompressed.begin(),
+           i::SnapshotCompression::DecompressShared(compressed.RawData())
+               .begin());
+
+  // Sections decompressed before stay shared until the last user is gone.
+  i::SnapshotCompression::RemoveSharedUser();
+  CHECK_EQ(decompressed.begin(),
+           i::SnapshotCompression::DecompressShared(compressed.RawData())
+               .begin());
+  i::SnapshotCompression::RemoveSharedUser();
+
+  // After that, the cache starts over.
+  i::SnapshotCompression::AddSharedUser();
+  CHECK(i::SnapshotCompression::DecompressShared(compressed.RawData())
+            .empty());
+  i::SnapshotCompression::RemoveSharedUser();
+
+  startup_blob.Dispose();
+  read_only_blob.Dispose();
+  partial_blob.Dispose();
+}
+
 UNINITIALIZED_TEST(PartialSerializerContext) {
   DisableAlwaysOpt();
   Vector<const byte> startup_blob;
@@ -2,6 +2,7 @@
 // Use of this source code is governed by a BSD-style license that can be
 // found in the LICENSE file.
 
+#include "include/libplatform/libplatform.h"
 #include "src/api/api-inl.h"
 #include "src/init/v8.h"
 #include "src/objects/managed.h"
@@ -42,6 +43,15 @@ class MockPlatform final : public TestPlatform {
     task_runner_->PostTask(std::move(task));
   }
 
+  std::unique_ptr<v8::JobHandle> PostJob(
+      v8::TaskPriority priority,
+      std::unique_ptr<v8::JobTask> job_task) override {
+    // Post the worker tasks through {CallOnWorkerThread}, such that they only
+    // run on {ExecuteTasks}.
+    return v8::platform::NewDefaultJobHandle(this, priority,
+                                             std::move(job_task), 1);
+  }
+
   bool IdleTasksEnabled(v8::Isolate* isolate) override { return false; }
 
   void ExecuteTasks() { task_runner_->ExecuteTasks(); }
@@ -0,0 +1,44 @@
+// Copyright 2020 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Flags: --allow-natives-syntax --baseline
+
+// Break points set in a function that is running baseline code are hit once
+// the activation continues in the interpreter.
+
+Debug = debug.Debug;
+
+let break_count = 0;
+let exception = null;
+
+function listener(event, exec_state, event_data, data) {
+  if (event != Debug.DebugEvent.Break) return;
+  try {
+    break_count++;
+    assertTrue(exec_state.frame(0).sourceLineText().indexOf("// Break.") > 0);
+  } catch (e) {
+    exception = e;
+  }
+}
+
+function setBreakPoint() {
+  Debug.setBreakPoint(f, 2);
+}
+
+function f() {
+  setBreakPoint();
+  let x = 1;  // Break.
+  return x + 1;
+}
+
+// Baseline code is not generated while the debugger is active.
+assertTrue(%CompileBaseline(f));
+assertTrue(%HasBaselineCode(f));
+
+Debug.setListener(listener);
+assertEquals(2, f());
+Debug.setListener(null);
+
+assertNull(exception);
+assertEquals(1, break_count);
@@ -9,6 +9,11 @@ const TEST_ITERATIONS = 1000;
 const SLOW_TEST_ITERATIONS = 50;
 const BITS_CASES = [32, 64, 128, 256, 512, 1024, 2048, 4096, 8192];
 const RANDOM_BIGINTS_MAX_BITS = 64 * 100;
+// Operand sizes for the operations whose cost grows faster than linearly.
+const LARGE_BITS_CASES = [64, 1024, 4096, 16384, 65536, 262144, 1048576];
+// From this operand size on, a single round of 100 runs takes about a second,
+// so it is measured once and without warmup.
+const SINGLE_ROUND_MIN_BITS = 1048576;
 
 
 function RandomHexDigit(allow_zero) {
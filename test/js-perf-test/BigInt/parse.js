@@ -0,0 +1,38 @@
+// Copyright 2020 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+"use strict";
+
+load('bigint-util.js');
+
+let decimal_string = "";
+
+// This dummy ensures that the feedback for benchmark.run() in the Measure
+// function from base.js is not monomorphic, thereby preventing the benchmarks
+// below from being inlined. This ensures consistent behavior and comparable
+// results.
+new BenchmarkSuite('Prevent-Inline-Dummy', [10000], [
+  new Benchmark('Prevent-Inline-Dummy', true, false, 0, () => {})
+]);
+
+
+LARGE_BITS_CASES.forEach((d) => {
+  const single_round = d >= SINGLE_ROUND_MIN_BITS;
+  new BenchmarkSuite(`Parse-${d}`, [1000], [
+    new Benchmark(`Parse-${d}`, !single_round, single_round, 1, TestParse,
+      () => SetUpTestParse(d))
+  ]);
+});
+
+
+function SetUpTestParse(bits) {
+  // Converting a BigInt to hex is linear, converting it to decimal is not;
+  // the latter is done once here, outside of the measured code.
+  decimal_string = RandomBigIntWithBits(bits).toString();
+}
+
+
+function TestParse() {
+  return BigInt(decimal_string);
+}
@@ -0,0 +1,36 @@
+// Copyright 2020 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+"use strict";
+
+load('bigint-util.js');
+
+let a = 0n;
+
+// This dummy ensures that the feedback for benchmark.run() in the Measure
+// function from base.js is not monomorphic, thereby preventing the benchmarks
+// below from being inlined. This ensures consistent behavior and comparable
+// results.
+new BenchmarkSuite('Prevent-Inline-Dummy', [10000], [
+  new Benchmark('Prevent-Inline-Dummy', true, false, 0, () => {})
+]);
+
+
+LARGE_BITS_CASES.forEach((d) => {
+  const single_round = d >= SINGLE_ROUND_MIN_BITS;
+  new BenchmarkSuite(`ToString-${d}`, [1000], [
+    new Benchmark(`ToString-${d}`, !single_round, single_round, 1, TestToString,
+      () => SetUpTestToString(d))
+  ]);
+});
+
+
+function SetUpTestToString(bits) {
+  a = RandomBigIntWithBits(bits);
+}
+
+
+function TestToString() {
+  return a.toString();
+}
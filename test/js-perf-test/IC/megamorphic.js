@@ -0,0 +1,55 @@
+// Copyright 2020 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Megamorphic property accesses over working sets of (map, name) pairs that
+// fit into the initial stub cache, and that only fit after it has grown.
+
+const SMALL_MAP_COUNT = 256;
+const LARGE_MAP_COUNT = 16384;
+
+new BenchmarkSuite('MegamorphicLoad-Small', [1000], [
+  new Benchmark('MegamorphicLoad-Small', false, false, 0,
+                () => MegamorphicLoad(small_objects))
+]);
+
+new BenchmarkSuite('MegamorphicLoad-Large', [1000], [
+  new Benchmark('MegamorphicLoad-Large', false, false, 0,
+                () => MegamorphicLoad(large_objects))
+]);
+
+new BenchmarkSuite('MegamorphicStore-Large', [1000], [
+  new Benchmark('MegamorphicStore-Large', false, false, 0,
+                () => MegamorphicStore(large_objects))
+]);
+
+// Returns {count} objects, each with its own map.
+function CreateObjects(count) {
+  let objects = [];
+  for (let i = 0; i < count; ++i) {
+    let o = {x: i, y: i};
+    o['p' + i] = i;
+    objects.push(o);
+  }
+  return objects;
+}
+
+const small_objects = CreateObjects(SMALL_MAP_COUNT);
+const large_objects = CreateObjects(LARGE_MAP_COUNT);
+
+function MegamorphicLoad(objects) {
+  let sum = 0;
+  for (let i = 0; i < objects.length; ++i) {
+    let o = objects[i];
+    sum += o.x + o.y;
+  }
+  return sum;
+}
+
+function MegamorphicStore(objects) {
+  for (let i = 0; i < objects.length; ++i) {
+    let o = objects[i];
+    o.x = i;
+    o.y = i;
+  }
+}
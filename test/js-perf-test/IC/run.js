@@ -5,6 +5,7 @@
 load('../base.js');
 
 load('loadconstantfromprototype.js');
+load('megamorphic.js');
 
 function PrintResult(name, result) {
   print(name + '-IC(Score): ' + result);
@@ -0,0 +1,65 @@
+// Copyright 2020 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// JSON.parse throughput on roughly 1MB payloads. The reference value of each
+// suite is chosen such that its score is the parse throughput in MB/s.
+
+function CreateRecords(count, text) {
+  const records = [];
+  for (let i = 0; i < count; i++) {
+    records.push({
+      id: i,
+      name: 'record-' + i,
+      active: i % 3 == 0,
+      score: i * 1.25,
+      tags: ['alpha', 'beta', 'gamma'].slice(0, i % 4),
+      text: text,
+      position: {x: i % 1024, y: (i * 7) % 1024, z: null}
+    });
+  }
+  return records;
+}
+
+function CreatePayload(value, indent) {
+  const json = JSON.stringify(value, null, indent);
+  // Multiply the length by the character size to get bytes.
+  const bytes = json.length * (/[^\u0000-\u00ff]/.test(json) ? 2 : 1);
+  return {json: json, megabytes: bytes / (1024 * 1024)};
+}
+
+function CreateParseSuite(name, payload) {
+  let result;
+  createSuite(name, payload.megabytes * 10, () => {
+    result = JSON.parse(payload.json);
+  }, () => {}, () => {
+    if (result === undefined) throw new Error(name + ' produced no result');
+  });
+}
+
+// Compact output, mostly short keys and values.
+CreateParseSuite('Parse-Minified',
+                 CreatePayload(CreateRecords(6000, 'short text'), undefined));
+
+// Indented output, where a lot of the input is whitespace.
+CreateParseSuite('Parse-Pretty',
+                 CreatePayload(CreateRecords(3000, 'short text'), 8));
+
+// Long string values with the occasional escape sequence.
+const kLongText = ('Lorem ipsum dolor sit amet, consectetur adipiscing ' +
+                   'elit, sed do eiusmod tempor incididunt ut labore. ')
+                      .repeat(8) + '"quoted"\n';
+CreateParseSuite('Parse-LongStrings',
+                 CreatePayload(CreateRecords(1200, kLongText), undefined));
+
+// Long string values in a two-byte payload.
+CreateParseSuite('Parse-TwoByteStrings',
+                 CreatePayload(CreateRecords(600, kLongText + '\u20ac'),
+                               undefined));
+
+// Arrays of numbers with many digits.
+const kNumbers = [];
+for (let i = 0; i < 60000; i++) {
+  kNumbers.push(i * 1234567.0987654321, 123456789012345 + i);
+}
+CreateParseSuite('Parse-Numbers', CreatePayload(kNumbers, undefined));
@@ -0,0 +1,48 @@
+// Copyright 2020 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Unanchored searches in long subjects, where most of the time is spent
+// skipping over start positions that cannot begin a match.
+
+function createLongSubject(filler, needle) {
+  let s = filler;
+  while (s.length < 64 * 1024) s += s;
+  return s + needle;
+}
+
+const latin1Subject = createLongSubject(
+    "Lorem ipsum dolor sit amet, consectetur adipiscing elit. ",
+    "needle 2020-06-01 QX7");
+const twoByteSubject = createLongSubject(
+    "Лорем ипсум долор сит амет, цонсецтетур адиписцинг елит. ",
+    "needle 2020-06-01 QX7");
+
+function LiteralPrefix() {
+  /needle \d+/.exec(latin1Subject);
+}
+
+function SmallClass() {
+  /[QZ]X\d/.exec(latin1Subject);
+}
+
+function LargeClass() {
+  /[0-9]{4}-[0-9]{2}/.exec(latin1Subject);
+}
+
+function LiteralPrefixTwoByte() {
+  /needle \d+/.exec(twoByteSubject);
+}
+
+function SmallClassTwoByte() {
+  /[QZ]X\d/.exec(twoByteSubject);
+}
+
+benchmarks = [ [LiteralPrefix, () => {}],
+               [SmallClass, () => {}],
+               [LargeClass, () => {}],
+               [LiteralPrefixTwoByte, () => {}],
+               [SmallClassTwoByte, () => {}],
+             ];
+
+createBenchmarkSuite("LongSubject");
@@ -9,6 +9,7 @@ load('ctor.js');
 load('exec.js');
 load('flags.js');
 load('inline_test.js')
+load('long_subject.js');
 load('complex_case_test.js');
 load('case_test.js');
 load('match.js');
@@ -0,0 +1,56 @@
+// Copyright 2020 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// A loop whose call sites compete for the cumulative inlining budget. The
+// result of {divmod} is only read from, so inlining it lets escape analysis
+// remove the allocation of the result. Compare with
+// --max-inlined-bytecode-size-temporary-result=0 to see the effect of
+// inlining such calls first.
+
+function divmod(a, b) {
+  let quotient = Math.floor(a / b);
+  let remainder = a - quotient * b;
+  if (remainder < 0) {
+    quotient--;
+    remainder += b;
+  }
+  return {quotient, remainder};
+}
+
+// Ten helpers of more than 100 bytes of bytecode each, which are called as often
+// as {divmod} and exhaust the cumulative inlining budget on their own.
+const mixers = [];
+for (let i = 0; i < 10; i++) {
+  mixers.push(new Function('h', `
+    h = (h ^ ${i}) * 31 | 0;
+    h = (h ^ (h >>> 16)) * 0x45d9f3b | 0;
+    h = (h ^ (h >>> 13)) * 0x45d9f3b | 0;
+    h = h ^ (h >>> 16);
+    if (h < 0) h = -h;
+    h = (h + ${i * 7}) % 1000003;
+    h = (h * 17 + (h >>> 3)) | 0;
+    h = (h ^ (h << 5)) | 0;
+    return h & 0xffff;`));
+}
+const [mix0, mix1, mix2, mix3, mix4, mix5, mix6, mix7, mix8, mix9] = mixers;
+
+function InlineTemporaryResult() {
+  let h = 0;
+  for (let i = 1; i < 1000; i++) {
+    const r = divmod(i, 7);
+    h = mix0(h + r.quotient + r.remainder);
+    h = mix1(h);
+    h = mix2(h);
+    h = mix3(h);
+    h = mix4(h);
+    h = mix5(h);
+    h = mix6(h);
+    h = mix7(h);
+    h = mix8(h);
+    h = mix9(h);
+  }
+  return h;
+}
+
+createSuite('InlineTemporaryResult', 1000, InlineTemporaryResult);
@@ -8,6 +8,7 @@ load("../base.js");
 const iterations = 100;
 
 load("typedLowering.js");
+load("inlineTemporaryResult.js");
 
 var success = true;
 
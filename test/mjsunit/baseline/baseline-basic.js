@@ -0,0 +1,107 @@
+// Copyright 2020 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Flags: --allow-natives-syntax --baseline
+
+function run(f, ...args) {
+  %PrepareFunctionForOptimization(f);
+  const expected = f(...args);
+  assertTrue(%CompileBaseline(f));
+  assertTrue(%HasBaselineCode(f));
+  assertEquals(expected, f(...args));
+  assertEquals(expected, f(...args));
+  return expected;
+}
+
+// Straight-line code, register moves and constants.
+assertEquals(42, run(function(a, b) {
+  let x = a;
+  let y = b;
+  let z = x * y;
+  return z + 12;
+}, 5, 6));
+
+assertEquals("foo-bar", run(function(a) { return a + "-bar"; }, "foo"));
+assertEquals(undefined, run(function() { let u; return u; }));
+assertEquals(1.5, run(function() { return 1.5; }));
+
+// Loops and conditional control flow.
+assertEquals(4950, run(function(n) {
+  let sum = 0;
+  for (let i = 0; i < n; i++) sum += i;
+  return sum;
+}, 100));
+
+assertEquals(25, run(function(n) {
+  let sum = 0;
+  for (let i = 0; i < n; i++) {
+    if (i % 2 == 0) continue;
+    sum += i;
+  }
+  return sum;
+}, 10));
+
+// Switches.
+function classify(x) {
+  switch (x) {
+    case 0: return "zero";
+    case 1: return "one";
+    case 2: return "two";
+    case 3: return "three";
+    default: return "many";
+  }
+}
+%PrepareFunctionForOptimization(classify);
+assertTrue(%CompileBaseline(classify));
+assertEquals("zero", classify(0));
+assertEquals("two", classify(2));
+assertEquals("many", classify(10));
+
+// Calls, construction and closures.
+function Point(x, y) { this.x = x; this.y = y; }
+assertEquals(7, run(function(a) {
+  const p = new Point(a, 4);
+  const add = (q) => q.x + q.y;
+  return add(p);
+}, 3));
+
+assertEquals(6, run(function() {
+  let c = 0;
+  const inc = () => ++c;
+  inc(); inc(); inc();
+  return [1, 2, 3].reduce((a, b) => a + b, 0);
+}));
+
+// Exceptions, caught inside and outside the baseline frame.
+assertEquals("caught", run(function() {
+  try {
+    throw new Error("x");
+  } catch (e) {
+    return "caught";
+  }
+}));
+
+function thrower() { throw 1; }
+%PrepareFunctionForOptimization(thrower);
+assertTrue(%CompileBaseline(thrower));
+assertThrows(thrower);
+assertThrows(thrower);
+
+// Generators suspend and resume through the interpreter frame.
+function* gen(n) {
+  for (let i = 0; i < n; i++) yield i;
+}
+%PrepareFunctionForOptimization(gen);
+assertTrue(%CompileBaseline(gen));
+assertEquals([0, 1, 2, 3], [...gen(4)]);
+assertEquals([0, 1], [...gen(2)]);
+
+// Functions with enough locals to require wide register operands.
+(function() {
+  let src = "let s = 0;";
+  for (let i = 0; i < 300; i++) src += `let v${i} = ${i}; s += v${i};`;
+  src += "return s;";
+  const f = new Function(src);
+  assertEquals(44850, run(f));
+})();
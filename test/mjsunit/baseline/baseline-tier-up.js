@@ -0,0 +1,32 @@
+// Copyright 2020 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Flags: --allow-natives-syntax --baseline --interrupt-budget=1024
+
+// Functions tier up to baseline code from the bytecode budget interrupt.
+function sum(n) {
+  let s = 0;
+  for (let i = 0; i < n; i++) s += i;
+  return s;
+}
+
+%NeverOptimizeFunction(sum);
+assertFalse(%HasBaselineCode(sum));
+for (let i = 0; i < 100; i++) {
+  assertEquals(i * (i - 1) / 2, sum(i));
+}
+assertTrue(%HasBaselineCode(sum));
+
+// OSR from a long-running loop still works with baseline code present.
+function osr(n) {
+  let s = 0;
+  for (let i = 0; i < n; i++) {
+    s += i % 7;
+    if (i == 500) %OptimizeOsr();
+  }
+  return s;
+}
+%PrepareFunctionForOptimization(osr);
+assertTrue(%CompileBaseline(osr));
+assertEquals(osr(1000), osr(1000));
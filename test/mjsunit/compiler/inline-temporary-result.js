@@ -0,0 +1,53 @@
+// Copyright 2020 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Flags: --allow-natives-syntax --opt --no-always-opt
+// Flags: --max-inlined-bytecode-size-small=0
+// Flags: --max-inlined-bytecode-size-cumulative=50 --no-turboprop
+
+// Calls whose result is only read from are inlined before equally frequent
+// calls, so that escape analysis can remove the temporary result object. The
+// cumulative budget only allows inlining one of the calls to {pair} below.
+// Deoptimizing from within the callee tells whether it was inlined. Turboprop
+// does not inline, so it is turned off.
+
+let deopt_on = 0;
+
+function pair(a, b) {
+  if (a === deopt_on) %DeoptimizeNow();
+  return {first: a, second: b};
+}
+
+function f(a, b) {
+  const p = pair(a, b);  // Only read from.
+  const q = pair(b, a);  // Escapes.
+  return [p.first + p.second, q];
+}
+
+(function TemporaryResultIsInlined() {
+  deopt_on = 0;
+  %PrepareFunctionForOptimization(f);
+  assertEquals(3, f(1, 2)[0]);
+  assertEquals(7, f(3, 4)[0]);
+  %OptimizeFunctionOnNextCall(f);
+  assertEquals(11, f(5, 6)[0]);
+  assertOptimized(f);
+
+  deopt_on = 7;
+  assertEquals(15, f(7, 8)[0]);
+  assertUnoptimized(f);
+})();
+
+(function EscapingResultIsNotInlined() {
+  deopt_on = 0;
+  %PrepareFunctionForOptimization(f);
+  assertEquals(3, f(1, 2)[0]);
+  %OptimizeFunctionOnNextCall(f);
+  assertEquals(7, f(3, 4)[0]);
+  assertOptimized(f);
+
+  deopt_on = 9;
+  assertEquals(9, f(1, 9)[1].first);
+  assertOptimized(f);
+})();
@@ -0,0 +1,82 @@
+// Copyright 2020 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Operands large enough to use the subquadratic multiplication, division
+// and string conversion algorithms.
+
+// Deterministic pseudo-random BigInts with {bits} bits.
+let seed = 42;
+function RandomBigInt(bits) {
+  let s = "0x1";
+  for (let i = 4; i < bits; i += 4) {
+    seed = (seed * 1103515245 + 12345) & 0x7fffffff;
+    s += "0123456789abcdef"[seed >> 16 & 15];
+  }
+  return BigInt(s);
+}
+
+// Straightforward parsing, eight characters at a time.
+function ParseWithRadix(string, radix) {
+  let result = 0n;
+  for (let i = 0; i < string.length; i += 8) {
+    let chunk = string.substring(i, i + 8);
+    result = result * BigInt(radix) ** BigInt(chunk.length) +
+             BigInt(parseInt(chunk, radix));
+  }
+  return result;
+}
+
+const kBits = [2000, 2200, 4096, 12500, 40000, 150000];
+
+(function TestMultiplyDivide() {
+  for (let a_bits of kBits) {
+    for (let b_bits of kBits) {
+      let a = RandomBigInt(a_bits);
+      let b = RandomBigInt(b_bits);
+      let product = a * b;
+      // Compare with the sum of the products by 1024-bit parts of b, which
+      // are short enough for the schoolbook algorithm.
+      let schoolbook = 0n;
+      for (let shift = 0n; (b >> shift) > 0n; shift += 1024n) {
+        schoolbook += (a * BigInt.asUintN(1024, b >> shift)) << shift;
+      }
+      assertEquals(product, schoolbook);
+      assertEquals(-product, -a * b);
+      assertEquals(a, product / b);
+      assertEquals(-a, -product / b);
+      assertEquals(0n, product % b);
+      let remainder = b - 1n;
+      assertEquals(a, (product + remainder) / b);
+      assertEquals(remainder, (product + remainder) % b);
+      assertEquals(-remainder, -(product + remainder) % b);
+    }
+  }
+})();
+
+(function TestToStringAndParse() {
+  for (let bits of kBits) {
+    let x = RandomBigInt(bits);
+    // Hexadecimal conversion is independent of the algorithms under test.
+    assertEquals(x, BigInt("0x" + x.toString(16)));
+    for (let radix of [7, 36]) {
+      assertEquals(x, ParseWithRadix(x.toString(radix), radix));
+    }
+    assertEquals(x, BigInt(x.toString()));
+    assertEquals("-" + x.toString(), (-x).toString());
+    assertEquals(-x, BigInt("-" + x.toString()));
+    assertEquals(x, eval(x.toString() + "n"));
+  }
+})();
+
+(function TestPowersOfTen() {
+  for (let zeros of [1000, 5000, 20000]) {
+    let expected = "1" + "0".repeat(zeros);
+    let power = 10n ** BigInt(zeros);
+    assertEquals(expected, power.toString());
+    assertEquals(power, BigInt(expected));
+    assertEquals("1" + "0".repeat(zeros - 1) + "1", (power + 1n).toString());
+    assertEquals("9".repeat(zeros), (power - 1n).toString());
+    assertEquals(power - 1n, BigInt("9".repeat(zeros)));
+  }
+})();
@@ -0,0 +1,69 @@
+// Copyright 2020 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// The JSON parser skips long runs of whitespace, digits and string characters
+// in blocks. Check that tokens are found at every offset within and across
+// block boundaries, for both one-byte and two-byte sources.
+
+function Repeat(s, n) {
+  return n > 0 ? s.repeat(n) : "";
+}
+
+function TestWhitespace(ws) {
+  for (let n = 0; n < 70; n++) {
+    assertEquals([1, 2], JSON.parse("[" + Repeat(ws, n) + "1," +
+                                    Repeat(ws, n) + "2" + Repeat(ws, n) + "]"));
+    assertEquals({a: true},
+                 JSON.parse(Repeat(ws, n) + '{"a":' + Repeat(ws, n) + "true}"));
+    assertThrows(() => JSON.parse("[" + Repeat(ws, n) + "\u000b1]"),
+                 SyntaxError);
+  }
+}
+TestWhitespace(" ");
+TestWhitespace("\t");
+TestWhitespace("\r\n");
+TestWhitespace(" \n  \t");
+
+(function TestDigits() {
+  for (let n = 1; n < 70; n++) {
+    const digits = Repeat("7", n);
+    assertEquals(Number(digits), JSON.parse(digits));
+    assertEquals(Number("1." + digits), JSON.parse("1." + digits));
+    assertEquals(Number("1e" + digits.slice(0, 2)),
+                 JSON.parse("1e" + digits.slice(0, 2)));
+    assertEquals([Number(digits), 1], JSON.parse("[" + digits + ",1]"));
+    assertThrows(() => JSON.parse(digits + "x"), SyntaxError);
+  }
+})();
+
+(function TestStrings() {
+  const specials = ['\\"', "\\\\", "\\n", "\\u0041", "\\u20ac", "\u00e9",
+                    "\u20ac"];
+  for (let n = 0; n < 70; n++) {
+    const prefix = Repeat("a", n);
+    assertEquals(prefix, JSON.parse('"' + prefix + '"'));
+    for (const special of specials) {
+      const json = '"' + prefix + special + prefix + '"';
+      assertEquals(eval(json), JSON.parse(json));
+    }
+    // Control characters terminate the scan and are rejected.
+    assertThrows(() => JSON.parse('"' + prefix + "\u0001" + prefix + '"'),
+                 SyntaxError);
+    assertThrows(() => JSON.parse('"' + prefix), SyntaxError);
+  }
+})();
+
+(function TestTwoByteStrings() {
+  // Strings in a two-byte source which only contain Latin1 characters still
+  // have to be distinguished from those that don't.
+  for (let n = 0; n < 40; n++) {
+    const latin1 = Repeat("\u00e9", n);
+    const wide = Repeat("\u0100", n);
+    assertEquals([latin1, wide, latin1 + wide],
+                 JSON.parse('["' + latin1 + '","' + wide + '","' + latin1 +
+                            wide + '"]'));
+    assertEquals({[latin1]: wide},
+                 JSON.parse('{"' + latin1 + '":"' + wide + '"}'));
+  }
+})();
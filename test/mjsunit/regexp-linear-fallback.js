@@ -0,0 +1,43 @@
+// Copyright 2020 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Flags: --allow-natives-syntax --linear-regexp-engine-on-excessive-backtracks
+// Flags: --regexp-backtracks-before-fallback=1000 --no-linear-regexp-engine
+
+// Supported patterns switch to the linear engine once irregexp exceeds the
+// backtrack threshold.
+(function FallbackOnExcessiveBacktracks() {
+  const re = /^(a|a)+$/;
+  assertEquals(["aaa", "a"], re.exec("aaa"));
+  assertEquals("IRREGEXP", %RegexpTypeTag(re));
+
+  assertNull(re.exec("a".repeat(50) + "b"));
+  assertEquals("LINEAR", %RegexpTypeTag(re));
+  assertEquals(["aaaa", "a"], re.exec("aaaa"));
+  assertNull(re.exec("a".repeat(10000) + "b"));
+})();
+
+// The match that triggers the fallback still gets the right result.
+(function ResultOfFallbackMatch() {
+  const re = /(x+x+)+y/;
+  const subject = "x".repeat(30) + "y";
+  assertEquals(subject, re.exec("x".repeat(30) + "z" + subject)[0]);
+  assertEquals("LINEAR", %RegexpTypeTag(re));
+})();
+
+// Global regexps continue with the linear engine after a fallback.
+(function GlobalFallback() {
+  const re = /(?:a|a)+b/g;
+  const subject = "a".repeat(40) + " aab ab " + "a".repeat(40) + "b";
+  assertEquals(["aab", "ab", "a".repeat(40) + "b"], subject.match(re));
+  assertEquals("LINEAR", %RegexpTypeTag(re));
+})();
+
+// Unsupported patterns are not limited by the threshold.
+(function NoFallbackForUnsupportedPatterns() {
+  const re = /^(?:a|b)*?(a)\1$/;
+  const subject = "ab".repeat(1000) + "aa";
+  assertEquals([subject, "a"], re.exec(subject));
+  assertEquals("IRREGEXP", %RegexpTypeTag(re));
+})();
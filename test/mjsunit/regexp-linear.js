@@ -0,0 +1,70 @@
+// Copyright 2020 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Flags: --allow-natives-syntax --linear-regexp-engine
+
+function assertLinear(re) {
+  re.exec("");
+  assertEquals("LINEAR", %RegexpTypeTag(re));
+}
+
+function assertNotLinear(re) {
+  re.exec("");
+  assertNotEquals("LINEAR", %RegexpTypeTag(re));
+}
+
+// Supported patterns are compiled for the linear engine.
+assertLinear(/a+b/);
+assertLinear(/(a|b)*c/g);
+assertLinear(/^x$/m);
+assertLinear(/[^\d]\w+\b/y);
+
+// Unsupported features stay with irregexp.
+assertNotLinear(/(a)\1/);
+assertNotLinear(/a(?=b)/);
+assertNotLinear(/(?<=a)b/);
+assertNotLinear(/abc+/i);
+assertNotLinear(/a+/u);
+assertNotLinear(/(?:a*)*/);
+
+// Matches and captures are the same as with irregexp.
+assertEquals(["abcd", "a", "bcd", ""], /(a|ab)(c|bcd)(d*)/.exec("abcd"));
+assertEquals(["aXb"], /a.*?b/.exec("aXbYb"));
+assertEquals(["aXbYb"], /a.*b/.exec("aXbYb"));
+assertEquals(["aaac"], /a{2,3}?c/.exec("aaac"));
+assertEquals(["y", undefined], /(x)?y/.exec("y"));
+assertEquals(["b", undefined], /(a)|b/.exec("cb"));
+assertEquals(["", undefined], /(a)*/.exec("b"));
+assertEquals(["foo"], /\bfoo\b/.exec("afoo foo"));
+assertEquals(4, /\bfoo\b/.exec("afoo foo").index);
+assertEquals(["bar"], /^bar$/m.exec("foo\nbar\nbaz"));
+assertEquals(["ሴስ"], /ሴ+ስ/.exec("xሴስ"));
+assertNull(/a+b/.exec("aaaa"));
+
+// Captures are reset at the start of each iteration of a quantifier.
+assertEquals(["ab", undefined], /(?:(a)|b)+/.exec("ab"));
+assertEquals(["ab", "b", undefined, "b"], /((a)|(b))+/.exec("ab"));
+
+// Named captures.
+assertEquals("b", /(?<x>b+)/.exec("abbc").groups.x);
+
+// Global and sticky regexps.
+assertEquals(["ab", "aab", "b"], "abcaabdb".match(/a*b/g));
+assertEquals("x-x-", "abcab".replace(/a?b/g, "x-").replace(/c/, ""));
+assertEquals(["", "", "", ""], "abc".match(/x*/g));
+{
+  const re = /b/y;
+  re.lastIndex = 1;
+  assertEquals(["b"], re.exec("abb"));
+  assertEquals(2, re.lastIndex);
+  re.lastIndex = 1;
+  assertNull(re.exec("aab"));
+}
+assertEquals(["a", "b", "c"], "a,b,c".split(/,/));
+
+// Patterns that make irregexp backtrack exponentially finish quickly.
+const subject = "a".repeat(10000) + "b";
+assertNull(/^(a|a)+$/.exec(subject));
+assertNull(/^(?:a+)+$/.exec(subject));
+assertFalse(/(x+x+)+y/.test("x".repeat(5000)));
@@ -0,0 +1,35 @@
+// Copyright 2020 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Unanchored regexps skip over start positions where no match can begin,
+// scanning several characters at a time on some platforms. Check matches
+// around the scan block boundaries and near the end of the subject, and
+// characters that only differ from candidates in the bits above 0x7f.
+
+const patterns = [
+  [/xyz\d/, "xyz1"],
+  [/[xy]yz\d/, "yyz2"],
+  [/[x-z0-3]{3}Q/, "x0zQ"],
+  [/[abc]*[qrstu]{3}X/, "rstX"],
+  [/(?:foo|bar)baz/, "barbaz"],
+];
+
+for (const [re, match] of patterns) {
+  for (const filler of ["-", "Ā", "ø", "Ÿ", "ቸ"]) {
+    for (let length = 0; length < 70; length++) {
+      const prefix = filler.repeat(length);
+      const subject = prefix + match + filler.repeat(length % 19);
+      const result = re.exec(subject);
+      assertNotNull(result, `${re} ${length}`);
+      assertEquals(match, result[0]);
+      assertEquals(length, result.index);
+      assertNull(re.exec(prefix + match.slice(0, -1)));
+    }
+  }
+}
+
+// Global matches continue scanning after each match.
+const subject = (".".repeat(37) + "xyz7").repeat(20);
+assertEquals(20, subject.match(/xyz\d/g).length);
+assertEquals(20, subject.replace(/xyz\d/g, "").length / 37);
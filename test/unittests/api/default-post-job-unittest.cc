@@ -0,0 +1,101 @@
+// Copyright 2020 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include <atomic>
+
+#include "include/v8-platform.h"
+#include "src/base/platform/platform.h"
+#include "src/base/platform/semaphore.h"
+#include "src/libplatform/default-platform.h"
+#include "testing/gtest/include/gtest/gtest.h"
+
+namespace v8 {
+namespace internal {
+namespace default_post_job_unittest {
+
+// Verify that with the default Platform::PostJob(), the worker and the joining
+// thread together process all work items, and Join() waits for the worker.
+TEST(DefaultPostJobTest, JoinProcessesAllWork) {
+  static constexpr size_t kWorkItems = 1000;
+  platform::DefaultPlatform platform;
+  platform.SetThreadPoolSize(2);
+
+  class JobTest : public JobTask {
+   public:
+    explicit JobTest(std::atomic_size_t* processed_items)
+        : processed_items_(processed_items) {}
+
+    void Run(JobDelegate* delegate) override {
+      uint8_t task_id = delegate->GetTaskId();
+      EXPECT_LT(task_id, 2);
+      EXPECT_FALSE(task_id_in_use_[task_id].exchange(true));
+      while (!delegate->ShouldYield()) {
+        size_t item = next_item_.fetch_add(1);
+        if (item >= kWorkItems) break;
+        (*processed_items_)++;
+      }
+      task_id_in_use_[task_id] = false;
+    }
+
+    size_t GetMaxConcurrency(size_t /* worker_count */) const override {
+      return next_item_.load() < kWorkItems ? 2 : 0;
+    }
+
+   private:
+    std::atomic_size_t* const processed_items_;
+    std::atomic_size_t next_item_{0};
+    std::atomic_bool task_id_in_use_[2] = {{false}, {false}};
+  };
+
+  std::atomic_size_t processed_items{0};
+  std::unique_ptr<JobHandle> handle =
+      platform.Platform::PostJob(TaskPriority::kUserVisible,
+                                 std::make_unique<JobTest>(&processed_items));
+  handle->Join();
+  EXPECT_FALSE(handle->IsRunning());
+  EXPECT_EQ(kWorkItems, processed_items.load());
+}
+
+// Verify that Cancel() makes a running worker yield and waits for it.
+TEST(DefaultPostJobTest, CancelJob) {
+  platform::DefaultPlatform platform;
+  platform.SetThreadPoolSize(1);
+
+  class JobTest : public JobTask {
+   public:
+    JobTest(base::Semaphore* started, std::atomic_bool* did_yield)
+        : started_(started), did_yield_(did_yield) {}
+
+    void Run(JobDelegate* delegate) override {
+      EXPECT_FALSE(delegate->IsJoiningThread());
+      started_->Signal();
+      while (!delegate->ShouldYield()) {
+        base::OS::Sleep(base::TimeDelta::FromMilliseconds(1));
+      }
+      *did_yield_ = true;
+    }
+
+    size_t GetMaxConcurrency(size_t /* worker_count */) const override {
+      return 1;
+    }
+
+   private:
+    base::Semaphore* const started_;
+    std::atomic_bool* const did_yield_;
+  };
+
+  base::Semaphore started(0);
+  std::atomic_bool did_yield{false};
+  std::unique_ptr<JobHandle> handle =
+      platform.Platform::PostJob(
+          TaskPriority::kUserBlocking,
+          std::make_unique<JobTest>(&started, &did_yield));
+  started.Wait();
+  handle->Cancel();
+  EXPECT_TRUE(did_yield.load());
+}
+
+}  // namespace default_post_job_unittest
+}  // namespace internal
+}  // namespace v8
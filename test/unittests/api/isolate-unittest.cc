@@ -11,6 +11,7 @@
 #include "src/base/platform/semaphore.h"
 #include "src/execution/execution.h"
 #include "src/execution/isolate.h"
+#include "src/flags/flags.h"
 #include "src/init/v8.h"
 #include "test/unittests/test-utils.h"
 
@@ -69,6 +70,44 @@ TEST_F(IsolateTest, MemoryPressureNotificationBackground) {
   v8::platform::PumpMessageLoop(internal::V8::GetCurrentPlatform(), isolate());
 }
 
+#ifdef V8_COMPRESS_POINTERS
+// Check that the pointer compression cage of a disposed isolate is reused by
+// the next isolate.
+TEST(IsolateAllocatorTest, ReusesReservationOfDisposedIsolate) {
+  const int saved_flag = internal::FLAG_cached_isolate_reservations;
+  // Make room in the cache regardless of what other tests left in it.
+  internal::FLAG_cached_isolate_reservations = 1000;
+  auto counter_lookup = [](const char* name) -> int* { return nullptr; };
+
+  internal::Address isolate_root;
+  {
+    IsolateWrapper isolate_wrapper(counter_lookup, true);
+    isolate_root = reinterpret_cast<internal::Isolate*>(
+                       isolate_wrapper.isolate())
+                       ->isolate_root();
+  }
+  {
+    IsolateWrapper isolate_wrapper(counter_lookup, true);
+    EXPECT_EQ(isolate_root, reinterpret_cast<internal::Isolate*>(
+                                isolate_wrapper.isolate())
+                                ->isolate_root());
+    // The reused cage is fully functional.
+    v8::Isolate::Scope isolate_scope(isolate_wrapper.isolate());
+    v8::HandleScope handle_scope(isolate_wrapper.isolate());
+    Local<Context> context = Context::New(isolate_wrapper.isolate());
+    Context::Scope context_scope(context);
+    Local<Value> result =
+        Script::Compile(context, String::NewFromUtf8Literal(
+                                     isolate_wrapper.isolate(), "6 * 7"))
+            .ToLocalChecked()
+            ->Run(context)
+            .ToLocalChecked();
+    EXPECT_EQ(42, result->Int32Value(context).FromJust());
+  }
+  internal::FLAG_cached_isolate_reservations = saved_flag;
+}
+#endif  // V8_COMPRESS_POINTERS
+
 using IncumbentContextTest = TestWithIsolate;
 
 // Check that Isolate::GetIncumbentContext() returns the correct one in basic
@@ -6,6 +6,7 @@
 
 #include <sstream>
 
+#include "include/libplatform/libplatform.h"
 #include "include/v8-platform.h"
 #include "src/api/api-inl.h"
 #include "src/ast/ast-value-factory.h"
@@ -137,6 +138,14 @@ class MockPlatform : public v8::Platform {
     UNREACHABLE();
   }
 
+  std::unique_ptr<JobHandle> PostJob(
+      TaskPriority priority, std::unique_ptr<JobTask> job_task) override {
+    // Worker tasks are run explicitly by the tests, so jobs only make progress
+    // on the joining thread.
+    return v8::platform::NewDefaultJobHandle(this, priority,
+                                             std::move(job_task), 0);
+  }
+
   bool IdleTasksEnabled(v8::Isolate* isolate) override { return true; }
 
   double MonotonicallyIncreasingTime() override {
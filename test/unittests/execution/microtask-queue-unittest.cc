@@ -641,6 +641,68 @@ TEST_P(MicrotaskQueueTest, MicrotasksScope) {
   EXPECT_TRUE(ran);
 }
 
+// Consecutive promise reaction jobs of the same native context enter it once.
+TEST_P(MicrotaskQueueTest, BatchPromiseReactionJobs) {
+  v8::MicrotaskStatistics before;
+  v8_isolate()->GetMicrotaskStatistics(&before);
+
+  RunJS("for (let i = 0; i < 100; i++) Promise.resolve(i).then(() => {});");
+  EXPECT_EQ(100, microtask_queue()->size());
+  EXPECT_EQ(100, microtask_queue()->RunMicrotasks(isolate()));
+  EXPECT_EQ(100, microtask_queue()->finished_microtask_count());
+  EXPECT_EQ(100, microtask_queue()->promise_reaction_job_count());
+  EXPECT_EQ(1, microtask_queue()->context_enter_count());
+  EXPECT_EQ(1, microtask_queue()->checkpoint_count());
+
+  v8::MicrotaskStatistics after;
+  v8_isolate()->GetMicrotaskStatistics(&after);
+  EXPECT_EQ(1u, after.checkpoint_count() - before.checkpoint_count());
+  EXPECT_EQ(100u, after.microtask_count() - before.microtask_count());
+  EXPECT_EQ(100u, after.promise_reaction_job_count() -
+                      before.promise_reaction_job_count());
+  EXPECT_EQ(1u, after.context_enter_count() - before.context_enter_count());
+}
+
+// A batch ends at a job of another native context, or at any other kind of
+// microtask, which must not see the context of the batch.
+TEST_P(MicrotaskQueueTest, BatchPromiseReactionJobsPerContext) {
+  Local<v8::Context> sub_context = v8::Context::New(v8_isolate());
+  Utils::OpenHandle(*sub_context)
+      ->native_context()
+      .set_microtask_queue(microtask_queue());
+  Handle<JSFunction> push_in_sub_context;
+  {
+    v8::Context::Scope scope(sub_context);
+    push_in_sub_context = RunJS<JSFunction>(
+        "(log, value) => { Promise.resolve().then(() => log.push(value)); }");
+  }
+  SetGlobalProperty("pushInSubContext", Utils::ToLocal(push_in_sub_context));
+
+  Handle<JSArray> log = RunJS<JSArray>(
+      "var log = [];"
+      "Promise.resolve().then(() => log.push(1));"
+      "Promise.resolve().then(() => log.push(2));"
+      "pushInSubContext(log, 3);"
+      "Promise.resolve().then(() => log.push(4));"
+      "log");
+  HandleScopeImplementer* hsi = isolate()->handle_scope_implementer();
+  size_t entered_context_count = hsi->EnteredContextCount();
+  microtask_queue()->EnqueueMicrotask(*NewMicrotask([=] {
+    EXPECT_EQ(entered_context_count, hsi->EnteredContextCount());
+  }));
+  RunJS("Promise.resolve().then(() => log.push(5));");
+
+  EXPECT_EQ(6, microtask_queue()->RunMicrotasks(isolate()));
+  EXPECT_EQ(entered_context_count, hsi->EnteredContextCount());
+  EXPECT_EQ(5, microtask_queue()->promise_reaction_job_count());
+  EXPECT_EQ(4, microtask_queue()->context_enter_count());
+  EXPECT_EQ(5, Smi::ToInt(log->length()));
+  for (int i = 0; i < 5; i++) {
+    EXPECT_EQ(i + 1, Smi::ToInt(*Object::GetElement(isolate(), log, i)
+                                     .ToHandleChecked()));
+  }
+}
+
 INSTANTIATE_TEST_SUITE_P(
     , MicrotaskQueueTest, ::testing::Values(false, true),
     [](const ::testing::TestParamInfo<MicrotaskQueueTest::ParamType>& info) {
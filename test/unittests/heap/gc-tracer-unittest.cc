@@ -364,6 +364,33 @@ TEST_F(GCTracerTest, BackgroundScavengerScope) {
               .scopes[GCTracer::Scope::SCAVENGER_BACKGROUND_SCAVENGE_PARALLEL]);
 }
 
+TEST_F(GCTracerTest, YoungGenerationCollectorComparison) {
+  GCTracer* tracer = i_isolate()->heap()->tracer();
+  tracer->ResetForTesting();
+  EXPECT_EQ(0, tracer->YoungGenerationSpeedInBytesPerMillisecond(SCAVENGER));
+  EXPECT_EQ(0, tracer->AverageYoungGenerationPauseInMilliseconds(SCAVENGER));
+
+  tracer->Start(MINOR_MARK_COMPACTOR, GarbageCollectionReason::kTesting,
+                "collector unittest");
+  tracer->Stop(MINOR_MARK_COMPACTOR);
+  EXPECT_EQ(0, tracer->recorded_scavenges_.Count());
+  EXPECT_EQ(1, tracer->recorded_minor_mark_compacts_.Count());
+  EXPECT_EQ(1, tracer->recorded_minor_gcs_total_.Count());
+
+  tracer->ResetForTesting();
+  tracer->recorded_scavenges_.Push(MakeBytesAndDuration(1000, 2));
+  tracer->recorded_scavenges_.Push(MakeBytesAndDuration(3000, 2));
+  tracer->recorded_minor_mark_compacts_.Push(MakeBytesAndDuration(4000, 1));
+  EXPECT_DOUBLE_EQ(
+      1000, tracer->YoungGenerationSpeedInBytesPerMillisecond(SCAVENGER));
+  EXPECT_DOUBLE_EQ(2, tracer->AverageYoungGenerationPauseInMilliseconds(
+                          SCAVENGER));
+  EXPECT_DOUBLE_EQ(4000, tracer->YoungGenerationSpeedInBytesPerMillisecond(
+                             MINOR_MARK_COMPACTOR));
+  EXPECT_DOUBLE_EQ(1, tracer->AverageYoungGenerationPauseInMilliseconds(
+                          MINOR_MARK_COMPACTOR));
+}
+
 TEST_F(GCTracerTest, BackgroundMinorMCScope) {
   GCTracer* tracer = i_isolate()->heap()->tracer();
   tracer->ResetForTesting();
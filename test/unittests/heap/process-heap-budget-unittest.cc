@@ -0,0 +1,177 @@
+// Copyright 2020 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "src/heap/process-heap-budget.h"
+
+#include <memory>
+
+#include "src/execution/isolate.h"
+#include "src/heap/heap.h"
+#include "test/unittests/test-utils.h"
+#include "testing/gtest/include/gtest/gtest.h"
+
+namespace v8 {
+namespace internal {
+
+namespace {
+
+const size_t kMinGrowingStep = 1u * MB;
+const size_t kLimit = 1024u * MB;
+
+class ProcessHeapBudgetTest : public ::testing::Test {
+ public:
+  static constexpr int kNumberOfIsolates = 3;
+
+  void SetUp() override {
+    for (int i = 0; i < kNumberOfIsolates; i++) {
+      isolates_[i] = std::make_unique<IsolateWrapper>(
+          [](const char* name) -> int* { return nullptr; });
+      budget_.Register(heap(i));
+    }
+  }
+
+  void TearDown() override {
+    for (int i = 0; i < kNumberOfIsolates; i++) {
+      budget_.Unregister(heap(i));
+      isolates_[i].reset();
+    }
+  }
+
+  Heap* heap(int i) {
+    return reinterpret_cast<Isolate*>(isolates_[i]->isolate())->heap();
+  }
+
+  ProcessHeapBudget* budget() { return &budget_; }
+
+  size_t Update(int i, size_t size, bool is_idle, double time_ms = 0) {
+    return budget_.UpdateHeap(heap(i), size, kLimit, kMinGrowingStep, is_idle,
+                              time_ms);
+  }
+
+  size_t ReductionsRequested() {
+    ProcessHeapBudget::Statistics statistics;
+    budget_.GetStatistics(&statistics);
+    return statistics.reductions_requested;
+  }
+
+ private:
+  ProcessHeapBudget budget_;
+  std::unique_ptr<IsolateWrapper> isolates_[kNumberOfIsolates];
+};
+
+}  // namespace
+
+TEST_F(ProcessHeapBudgetTest, NoBudget) {
+  EXPECT_EQ(kLimit, Update(0, 100u * MB, false));
+  EXPECT_EQ(kLimit, Update(1, 200u * MB, true));
+  EXPECT_FALSE(heap(0)->HighMemoryPressure());
+  EXPECT_FALSE(heap(1)->HighMemoryPressure());
+
+  ProcessHeapBudget::Statistics statistics;
+  budget()->GetStatistics(&statistics);
+  EXPECT_EQ(0u, statistics.budget);
+  EXPECT_EQ(300u * MB, statistics.total_size);
+  EXPECT_EQ(3u, statistics.number_of_heaps);
+  EXPECT_EQ(0u, statistics.reductions_requested);
+}
+
+TEST_F(ProcessHeapBudgetTest, SplitsHeadroom) {
+  budget()->SetBudget(90u * MB);
+  Update(0, 10u * MB, false);
+  Update(1, 20u * MB, false);
+  // 30MB are left for three heaps.
+  EXPECT_EQ(30u * MB + 10u * MB, Update(2, 30u * MB, false));
+  EXPECT_EQ(20u * MB + 10u * MB, Update(1, 20u * MB, false));
+  // Never above the limit computed by the heap's own controller.
+  EXPECT_EQ(11u * MB, budget()->UpdateHeap(heap(0), 10u * MB, 11u * MB,
+                                          kMinGrowingStep, false, 0));
+}
+
+TEST_F(ProcessHeapBudgetTest, KeepsMinimumHeadroomWhenOverBudget) {
+  budget()->SetBudget(10u * MB);
+  // The minimum growing factor of the memory controller.
+  EXPECT_EQ(22u * MB, Update(0, 20u * MB, false));
+  // The minimum growing step, for small heaps.
+  EXPECT_EQ(5u * MB + kMinGrowingStep, Update(1, 5u * MB, false));
+}
+
+TEST_F(ProcessHeapBudgetTest, AsksIdleHeapsFirst) {
+  budget()->SetBudget(100u * MB);
+  Update(0, 20u * MB, true);
+  Update(1, 60u * MB, false);
+  EXPECT_FALSE(heap(0)->HighMemoryPressure());
+  EXPECT_FALSE(heap(1)->HighMemoryPressure());
+
+  // 20MB over the low watermark: the idle heap covers the excess on its own.
+  Update(2, 30u * MB, false);
+  EXPECT_TRUE(heap(0)->HighMemoryPressure());
+  EXPECT_FALSE(heap(1)->HighMemoryPressure());
+  EXPECT_FALSE(heap(2)->HighMemoryPressure());
+
+  ProcessHeapBudget::Statistics statistics;
+  budget()->GetStatistics(&statistics);
+  EXPECT_EQ(110u * MB, statistics.total_size);
+  EXPECT_EQ(1u, statistics.reductions_requested);
+}
+
+TEST_F(ProcessHeapBudgetTest, AsksLargestHeapsUntilExcessIsCovered) {
+  budget()->SetBudget(50u * MB);
+  Update(0, 10u * MB, true);
+  Update(1, 40u * MB, false);
+
+  // 35MB over the low watermark: the idle heap does not cover the excess, so
+  // the largest one is asked too.
+  Update(2, 30u * MB, false);
+  EXPECT_TRUE(heap(0)->HighMemoryPressure());
+  EXPECT_TRUE(heap(1)->HighMemoryPressure());
+  EXPECT_FALSE(heap(2)->HighMemoryPressure());
+
+  // Heaps that were asked are not asked again before they report back.
+  Update(2, 30u * MB, false);
+  ProcessHeapBudget::Statistics statistics;
+  budget()->GetStatistics(&statistics);
+  EXPECT_EQ(2u, statistics.reductions_requested);
+}
+
+TEST_F(ProcessHeapBudgetTest, AsksUntilBelowLowWatermark) {
+  budget()->SetBudget(100u * MB);
+  Update(0, 60u * MB, false);
+  Update(1, 45u * MB, false);
+  EXPECT_EQ(1u, ReductionsRequested());
+
+  // Still over the low watermark, so the other heap is asked as well.
+  Update(0, 50u * MB, false);
+  EXPECT_EQ(2u, ReductionsRequested());
+
+  // Below the low watermark, and then within the budget again: nobody is
+  // asked until the budget is exceeded.
+  Update(1, 35u * MB, false);
+  Update(0, 60u * MB, false);
+  EXPECT_EQ(2u, ReductionsRequested());
+}
+
+TEST_F(ProcessHeapBudgetTest, AsksEachHeapOncePerCooldown) {
+  budget()->SetBudget(50u * MB);
+  Update(0, 40u * MB, false, 0);
+  Update(1, 20u * MB, false, 0);
+  EXPECT_TRUE(heap(0)->HighMemoryPressure());
+  EXPECT_EQ(1u, ReductionsRequested());
+
+  // The heap reports back without having freed anything, so the other heap
+  // is asked.
+  Update(0, 40u * MB, false, 1000);
+  EXPECT_TRUE(heap(1)->HighMemoryPressure());
+  EXPECT_EQ(2u, ReductionsRequested());
+
+  // Both have been asked too recently to be asked again.
+  Update(1, 20u * MB, false, 2000);
+  Update(0, 40u * MB, false, 3000);
+  EXPECT_EQ(2u, ReductionsRequested());
+
+  Update(1, 20u * MB, false, ProcessHeapBudget::kRequestCooldownMs);
+  EXPECT_EQ(3u, ReductionsRequested());
+}
+
+}  // namespace internal
+}  // namespace v8
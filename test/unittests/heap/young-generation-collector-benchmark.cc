@@ -0,0 +1,137 @@
+// Copyright 2020 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Micro-benchmark comparing scavenges with minor mark-compacts, and with the
+// selection between the two by --minor-mc-min-semi-space-size, on a workload
+// whose semi-spaces grow from 1MB to 16MB. It is disabled by default; run it
+// with
+//   unittests --gtest_also_run_disabled_tests \
+//             --gtest_filter=*YoungGenerationCollectorBenchmark*
+
+#include <cstdio>
+
+#include "include/v8.h"
+#include "src/base/platform/time.h"
+#include "src/execution/isolate.h"
+#include "src/flags/flags.h"
+#include "src/heap/gc-tracer.h"
+#include "src/heap/heap.h"
+#include "testing/gtest/include/gtest/gtest.h"
+
+namespace v8 {
+namespace internal {
+namespace {
+
+#ifdef ENABLE_MINOR_MC
+
+struct YoungGenerationStats {
+  GarbageCollector collector = SCAVENGER;
+  base::TimeTicks start;
+  int count[2] = {0, 0};
+  base::TimeDelta pause[2];
+};
+
+int IndexOf(GarbageCollector collector) {
+  return collector == SCAVENGER ? 0 : 1;
+}
+
+void YoungGenerationPrologue(v8::Isolate* isolate, GCType type,
+                             GCCallbackFlags flags, void* data) {
+  YoungGenerationStats* stats = static_cast<YoungGenerationStats*>(data);
+  // Both young generation collectors report kGCTypeScavenge. The semi-space
+  // size has not changed since the collector was selected, so selecting it
+  // again gives the collector of this GC.
+  stats->collector =
+      reinterpret_cast<Isolate*>(isolate)->heap()->YoungGenerationCollector();
+  stats->start = base::TimeTicks::HighResolutionNow();
+}
+
+void YoungGenerationEpilogue(v8::Isolate* isolate, GCType type,
+                             GCCallbackFlags flags, void* data) {
+  YoungGenerationStats* stats = static_cast<YoungGenerationStats*>(data);
+  int index = IndexOf(stats->collector);
+  stats->count[index]++;
+  stats->pause[index] += base::TimeTicks::HighResolutionNow() - stats->start;
+}
+
+// Allocates short-lived objects and keeps a sliding window of them alive, so
+// that a small fraction of every young generation survives.
+const char kWorkload[] =
+    "const window = new Array(50000);"
+    "for (let i = 0; i < 5e6; i++) {"
+    "  const o = {id: i, values: [i, i + 1]};"
+    "  if (i % 8 === 0) window[(i >> 3) % window.length] = o;"
+    "}";
+
+void Measure(const char* name, bool minor_mc,
+             size_t minor_mc_min_semi_space_size) {
+  const bool saved_minor_mc = FLAG_minor_mc;
+  const size_t saved_threshold = FLAG_minor_mc_min_semi_space_size;
+  const size_t saved_min_semi_space_size = FLAG_min_semi_space_size;
+  const size_t saved_max_semi_space_size = FLAG_max_semi_space_size;
+  FLAG_minor_mc = minor_mc;
+  FLAG_minor_mc_min_semi_space_size = minor_mc_min_semi_space_size;
+  FLAG_min_semi_space_size = 1;
+  FLAG_max_semi_space_size = 16;
+
+  v8::ArrayBuffer::Allocator* allocator =
+      v8::ArrayBuffer::Allocator::NewDefaultAllocator();
+  v8::Isolate::CreateParams create_params;
+  create_params.array_buffer_allocator = allocator;
+  v8::Isolate* isolate = v8::Isolate::New(create_params);
+  YoungGenerationStats stats;
+  isolate->AddGCPrologueCallback(YoungGenerationPrologue, &stats,
+                                 kGCTypeScavenge);
+  isolate->AddGCEpilogueCallback(YoungGenerationEpilogue, &stats,
+                                 kGCTypeScavenge);
+  base::TimeTicks start = base::TimeTicks::HighResolutionNow();
+  {
+    v8::Isolate::Scope isolate_scope(isolate);
+    v8::HandleScope handle_scope(isolate);
+    v8::Local<v8::Context> context = v8::Context::New(isolate);
+    v8::Context::Scope context_scope(context);
+    v8::Local<v8::Script> script =
+        v8::Script::Compile(context,
+                            v8::String::NewFromUtf8Literal(isolate, kWorkload))
+            .ToLocalChecked();
+    script->Run(context).ToLocalChecked();
+  }
+  double total_ms = (base::TimeTicks::HighResolutionNow() - start)
+                        .InMillisecondsF();
+
+  GCTracer* tracer = reinterpret_cast<Isolate*>(isolate)->heap()->tracer();
+  printf("%s: %.1fms total\n", name, total_ms);
+  for (GarbageCollector collector : {SCAVENGER, MINOR_MARK_COMPACTOR}) {
+    int index = IndexOf(collector);
+    if (stats.count[index] == 0) continue;
+    printf("  %s: %d GCs, %.2fms average pause, %.f bytes/ms recently\n",
+           Heap::CollectorName(collector), stats.count[index],
+           stats.pause[index].InMillisecondsF() / stats.count[index],
+           tracer->YoungGenerationSpeedInBytesPerMillisecond(collector));
+  }
+
+  isolate->Dispose();
+  delete allocator;
+  FLAG_minor_mc = saved_minor_mc;
+  FLAG_minor_mc_min_semi_space_size = saved_threshold;
+  FLAG_min_semi_space_size = saved_min_semi_space_size;
+  FLAG_max_semi_space_size = saved_max_semi_space_size;
+}
+
+TEST(YoungGenerationCollectorBenchmark, DISABLED_GrowingSemiSpaces) {
+  Measure("scavenger", false, 0);
+  Measure("minor_mc", true, 0);
+  for (size_t threshold : {2, 4, 8}) {
+    char name[64];
+    snprintf(name, sizeof(name), "minor_mc_min_semi_space_size=%zu",
+             threshold);
+    Measure(name, true, threshold);
+  }
+}
+
+#endif  // ENABLE_MINOR_MC
+
+}  // namespace
+}  // namespace internal
+}  // namespace v8
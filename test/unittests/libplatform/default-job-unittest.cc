@@ -0,0 +1,315 @@
+// Copyright 2020 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "src/libplatform/default-job.h"
+
+#include <atomic>
+
+#include "src/base/platform/condition-variable.h"
+#include "src/base/platform/platform.h"
+#include "src/base/platform/semaphore.h"
+#include "src/libplatform/default-platform.h"
+#include "testing/gtest/include/gtest/gtest.h"
+
+namespace v8 {
+namespace platform {
+namespace default_job_unittest {
+
+// Verify that Cancel() on a job stops running the worker task and causes
+// current workers to yield.
+TEST(DefaultJobTest, CancelJob) {
+  static constexpr size_t kTooManyTasks = 1000;
+  static constexpr size_t kMaxTask = 4;
+  DefaultPlatform platform;
+  platform.SetThreadPoolSize(kMaxTask);
+
+  // This Job notices when max concurrency is reached and blocks until
+  // Cancel() is called.
+  class JobTest : public JobTask {
+   public:
+    ~JobTest() override = default;
+
+    void Run(JobDelegate* delegate) override {
+      {
+        base::MutexGuard guard(&mutex);
+        worker_count++;
+      }
+      max_concurrency_reached.NotifyOne();
+      while (!delegate->ShouldYield()) {
+        base::OS::Sleep(base::TimeDelta::FromMilliseconds(1));
+      }
+      max_concurrency--;
+    }
+
+    size_t GetMaxConcurrency(size_t /* worker_count */) const override {
+      return max_concurrency.load(std::memory_order_relaxed);
+    }
+
+    base::Mutex mutex;
+    base::ConditionVariable max_concurrency_reached;
+    std::atomic_size_t max_concurrency{kTooManyTasks};
+    size_t worker_count = 0;
+  };
+
+  auto job = std::make_unique<JobTest>();
+  JobTest* job_raw = job.get();
+  auto state = std::make_shared<DefaultJobState>(
+      &platform, std::move(job), TaskPriority::kUserVisible, kMaxTask);
+  state->NotifyConcurrencyIncrease();
+
+  {
+    base::MutexGuard guard(&job_raw->mutex);
+    while (job_raw->worker_count < kMaxTask) {
+      job_raw->max_concurrency_reached.Wait(&job_raw->mutex);
+    }
+    EXPECT_EQ(kMaxTask, job_raw->worker_count);
+  }
+  state->CancelAndWait();
+  // Workers should return and this test should not hang.
+}
+
+// Verify that CancelAndDetach() on a job returns without waiting for workers,
+// which still yield and eventually release the job.
+TEST(DefaultJobTest, CancelAndDetachJob) {
+  static constexpr size_t kMaxTask = 4;
+  DefaultPlatform platform;
+  platform.SetThreadPoolSize(kMaxTask);
+
+  // This Job signals once it runs, and blocks until told to yield.
+  class JobTest : public JobTask {
+   public:
+    JobTest(base::Semaphore* started, base::Semaphore* destroyed)
+        : started_(started), destroyed_(destroyed) {}
+    ~JobTest() override { destroyed_->Signal(); }
+
+    void Run(JobDelegate* delegate) override {
+      if (!did_start_.exchange(true)) started_->Signal();
+      while (!delegate->ShouldYield()) {
+        base::OS::Sleep(base::TimeDelta::FromMilliseconds(1));
+      }
+    }
+
+    size_t GetMaxConcurrency(size_t /* worker_count */) const override {
+      return kMaxTask;
+    }
+
+   private:
+    base::Semaphore* const started_;
+    base::Semaphore* const destroyed_;
+    std::atomic<bool> did_start_{false};
+  };
+
+  base::Semaphore started(0);
+  base::Semaphore destroyed(0);
+  std::unique_ptr<JobHandle> handle = platform.PostJob(
+      TaskPriority::kUserVisible,
+      std::make_unique<JobTest>(&started, &destroyed));
+  started.Wait();
+  handle->CancelAndDetach();
+  EXPECT_FALSE(handle->IsRunning());
+  // The last worker to return releases the job; this test should not hang.
+  destroyed.Wait();
+}
+
+// Verify that Join() on a job contributes to max concurrency and waits for
+// all workers to return.
+TEST(DefaultJobTest, JoinJobContributes) {
+  static constexpr size_t kMaxTask = 4;
+  DefaultPlatform platform;
+  platform.SetThreadPoolSize(kMaxTask);
+
+  // This Job notices when max concurrency is reached and blocks until
+  // Join() is called.
+  class JobTest : public JobTask {
+   public:
+    ~JobTest() override = default;
+
+    void Run(JobDelegate* delegate) override {
+      {
+        base::MutexGuard guard(&mutex);
+        worker_count++;
+        if (delegate->IsJoiningThread()) join_participated = true;
+      }
+      max_concurrency_reached.NotifyAll();
+      {
+        base::MutexGuard guard(&mutex);
+        while (worker_count < kMaxTask + 1) {
+          max_concurrency_reached.Wait(&mutex);
+        }
+      }
+      max_concurrency--;
+    }
+
+    size_t GetMaxConcurrency(size_t /* worker_count */) const override {
+      return max_concurrency.load(std::memory_order_relaxed);
+    }
+
+    base::Mutex mutex;
+    base::ConditionVariable max_concurrency_reached;
+    std::atomic_size_t max_concurrency{kMaxTask + 1};
+    size_t worker_count = 0;
+    bool join_participated = false;
+  };
+
+  auto job = std::make_unique<JobTest>();
+  JobTest* job_raw = job.get();
+  auto state = std::make_shared<DefaultJobState>(
+      &platform, std::move(job), TaskPriority::kUserVisible, kMaxTask);
+  state->NotifyConcurrencyIncrease();
+
+  // The main thread contributing is necessary for |worker_count| to reach
+  // kMaxTask + 1 thus, Join() should not hang.
+  state->Join();
+  EXPECT_EQ(0U, job_raw->max_concurrency);
+  EXPECT_TRUE(job_raw->join_participated);
+}
+
+// Verify that calling NotifyConcurrencyIncrease() (re)schedules tasks with the
+// intended concurrency.
+TEST(DefaultJobTest, JobNotifyConcurrencyIncrease) {
+  static constexpr size_t kMaxTask = 4;
+  DefaultPlatform platform;
+  platform.SetThreadPoolSize(kMaxTask);
+
+  // This Job notices when max concurrency is reached and blocks until
+  // Cancel() is called.
+  class JobTest : public JobTask {
+   public:
+    ~JobTest() override = default;
+
+    void Run(JobDelegate* delegate) override {
+      {
+        base::MutexGuard guard(&mutex);
+        worker_count++;
+      }
+      max_concurrency_reached.NotifyAll();
+      while (!delegate->ShouldYield()) {
+        base::OS::Sleep(base::TimeDelta::FromMilliseconds(1));
+      }
+    }
+
+    size_t GetMaxConcurrency(size_t /* worker_count */) const override {
+      return max_concurrency.load(std::memory_order_relaxed);
+    }
+
+    base::Mutex mutex;
+    base::ConditionVariable max_concurrency_reached;
+    std::atomic_size_t max_concurrency{kMaxTask / 2};
+    size_t worker_count = 0;
+  };
+
+  auto job = std::make_unique<JobTest>();
+  JobTest* job_raw = job.get();
+  auto state = std::make_shared<DefaultJobState>(
+      &platform, std::move(job), TaskPriority::kUserVisible, kMaxTask);
+  state->NotifyConcurrencyIncrease();
+
+  {
+    base::MutexGuard guard(&job_raw->mutex);
+    while (job_raw->worker_count < kMaxTask / 2) {
+      job_raw->max_concurrency_reached.Wait(&job_raw->mutex);
+    }
+    EXPECT_EQ(kMaxTask / 2, job_raw->worker_count);
+
+    job_raw->max_concurrency = kMaxTask;
+  }
+  state->NotifyConcurrencyIncrease();
+
+  {
+    base::MutexGuard guard(&job_raw->mutex);
+    while (job_raw->worker_count < kMaxTask) {
+      job_raw->max_concurrency_reached.Wait(&job_raw->mutex);
+    }
+    EXPECT_EQ(kMaxTask, job_raw->worker_count);
+  }
+  state->CancelAndWait();
+}
+
+// Verify that Join() doesn't contribute if the Job is already finished.
+TEST(DefaultJobTest, FinishBeforeJoin) {
+  static constexpr size_t kMaxTask = 4;
+  DefaultPlatform platform;
+  platform.SetThreadPoolSize(kMaxTask);
+
+  // This Job notices when max concurrency is reached and returns.
+  class JobTest : public JobTask {
+   public:
+    ~JobTest() override = default;
+
+    void Run(JobDelegate* delegate) override {
+      EXPECT_FALSE(delegate->IsJoiningThread());
+      {
+        base::MutexGuard guard(&mutex);
+        ++worker_count;
+      }
+      max_concurrency_reached.NotifyOne();
+      --max_concurrency;
+    }
+
+    size_t GetMaxConcurrency(size_t /* worker_count */) const override {
+      return max_concurrency.load(std::memory_order_relaxed);
+    }
+
+    base::Mutex mutex;
+    base::ConditionVariable max_concurrency_reached;
+    std::atomic_size_t max_concurrency{kMaxTask};
+    size_t worker_count = 0;
+  };
+
+  auto job = std::make_unique<JobTest>();
+  JobTest* job_raw = job.get();
+  auto state = std::make_shared<DefaultJobState>(
+      &platform, std::move(job), TaskPriority::kUserVisible, kMaxTask);
+  state->NotifyConcurrencyIncrease();
+
+  {
+    base::MutexGuard guard(&job_raw->mutex);
+    while (job_raw->worker_count < kMaxTask) {
+      job_raw->max_concurrency_reached.Wait(&job_raw->mutex);
+    }
+  }
+  // Join() should not run the job on this thread since max concurrency is 0.
+  state->Join();
+  EXPECT_EQ(kMaxTask, job_raw->worker_count);
+}
+
+// Verify that task ids are unique among concurrently running workers and
+// smaller than max concurrency.
+TEST(DefaultJobTest, UniqueTaskIds) {
+  static constexpr size_t kMaxTask = 4;
+  static constexpr size_t kWorkItems = 1000;
+  DefaultPlatform platform;
+  platform.SetThreadPoolSize(kMaxTask);
+
+  class JobTest : public JobTask {
+   public:
+    ~JobTest() override = default;
+
+    void Run(JobDelegate* delegate) override {
+      uint8_t task_id = delegate->GetTaskId();
+      EXPECT_LT(task_id, kMaxTask + 1);
+      EXPECT_FALSE(task_ids_in_use[task_id].exchange(true));
+      while (!delegate->ShouldYield() && remaining_items.fetch_sub(1) > 0) {
+      }
+      task_ids_in_use[task_id] = false;
+    }
+
+    size_t GetMaxConcurrency(size_t /* worker_count */) const override {
+      int remaining = remaining_items.load();
+      return remaining > 0 ? std::min<size_t>(remaining, kMaxTask + 1) : 0;
+    }
+
+    std::atomic<bool> task_ids_in_use[kMaxTask + 1] = {};
+    std::atomic<int> remaining_items{kWorkItems};
+  };
+
+  std::unique_ptr<JobHandle> handle = platform.PostJob(
+      TaskPriority::kUserBlocking, std::make_unique<JobTest>());
+  handle->Join();
+  EXPECT_FALSE(handle->IsRunning());
+}
+
+}  // namespace default_job_unittest
+}  // namespace platform
+}  // namespace v8
@@ -0,0 +1,150 @@
+// Copyright 2020 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Micro-benchmarks for the DefaultWorkerThreadsTaskRunner. They are disabled
+// by default; run them with
+//   unittests --gtest_also_run_disabled_tests \
+//             --gtest_filter=*WorkerThreadsTaskRunnerBenchmark*
+
+#include <algorithm>
+#include <atomic>
+#include <cstdio>
+#include <functional>
+#include <memory>
+#include <vector>
+
+#include "include/v8-platform.h"
+#include "src/base/platform/platform.h"
+#include "src/base/platform/semaphore.h"
+#include "src/base/platform/time.h"
+#include "src/base/sys-info.h"
+#include "src/libplatform/default-worker-threads-task-runner.h"
+#include "testing/gtest-support.h"
+
+namespace v8 {
+namespace platform {
+
+namespace {
+
+using Priority = DefaultWorkerThreadsTaskRunner::Priority;
+
+double RealTime() {
+  return base::TimeTicks::HighResolutionNow().ToInternalValue() /
+         static_cast<double>(base::Time::kMicrosecondsPerSecond);
+}
+
+uint32_t NumberOfWorkers() {
+  return static_cast<uint32_t>(
+      std::max(2, std::min(base::SysInfo::NumberOfProcessors(), 16)));
+}
+
+class FunctionTask : public v8::Task {
+ public:
+  explicit FunctionTask(std::function<void()> f) : f_(std::move(f)) {}
+
+  void Run() override { f_(); }
+
+ private:
+  std::function<void()> f_;
+};
+
+// Posts |tasks_per_thread| empty tasks from its own thread.
+class PostingThread final : public base::Thread {
+ public:
+  PostingThread(DefaultWorkerThreadsTaskRunner* runner, int tasks_per_thread,
+                Priority priority, std::atomic<int>* remaining,
+                base::Semaphore* done)
+      : Thread(Options("PostingThread")),
+        runner_(runner),
+        tasks_per_thread_(tasks_per_thread),
+        priority_(priority),
+        remaining_(remaining),
+        done_(done) {}
+
+  void Run() override {
+    for (int i = 0; i < tasks_per_thread_; ++i) {
+      runner_->PostTaskWithPriority(
+          std::make_unique<FunctionTask>([this] {
+            if (remaining_->fetch_sub(1) == 1) done_->Signal();
+          }),
+          priority_);
+    }
+  }
+
+ private:
+  DefaultWorkerThreadsTaskRunner* runner_;
+  const int tasks_per_thread_;
+  const Priority priority_;
+  std::atomic<int>* remaining_;
+  base::Semaphore* done_;
+};
+
+double Percentile(std::vector<double>* samples, double percentile) {
+  std::sort(samples->begin(), samples->end());
+  size_t index = static_cast<size_t>(percentile * (samples->size() - 1));
+  return (*samples)[index];
+}
+
+}  // namespace
+
+// Measures the time from posting a task to an idle pool until a worker starts
+// running it.
+TEST(WorkerThreadsTaskRunnerBenchmark, DISABLED_DispatchLatency) {
+  constexpr int kSamples = 10000;
+  DefaultWorkerThreadsTaskRunner runner(NumberOfWorkers(), RealTime);
+
+  std::vector<double> latencies_us;
+  latencies_us.reserve(kSamples);
+  base::Semaphore ran(0);
+  for (int i = 0; i < kSamples; ++i) {
+    base::TimeTicks posted = base::TimeTicks::HighResolutionNow();
+    runner.PostTask(std::make_unique<FunctionTask>([&] {
+      base::TimeDelta latency = base::TimeTicks::HighResolutionNow() - posted;
+      latencies_us.push_back(static_cast<double>(latency.InMicroseconds()));
+      ran.Signal();
+    }));
+    ran.Wait();
+  }
+  runner.Terminate();
+
+  printf("DispatchLatency(workers=%u): p50=%.1fus p90=%.1fus p99=%.1fus\n",
+         NumberOfWorkers(), Percentile(&latencies_us, 0.5),
+         Percentile(&latencies_us, 0.9), Percentile(&latencies_us, 0.99));
+}
+
+// Measures how many tasks per second the pool runs while several threads post
+// concurrently, once for each priority lane.
+TEST(WorkerThreadsTaskRunnerBenchmark, DISABLED_ThroughputUnderContention) {
+  constexpr int kTasksPerThread = 100000;
+  const int kPostingThreads = static_cast<int>(NumberOfWorkers());
+  const Priority kPriorities[] = {Priority::kUserBlocking,
+                                  Priority::kUserVisible, Priority::kBestEffort};
+
+  for (Priority priority : kPriorities) {
+    DefaultWorkerThreadsTaskRunner runner(NumberOfWorkers(), RealTime);
+    std::atomic<int> remaining{kPostingThreads * kTasksPerThread};
+    base::Semaphore done(0);
+
+    std::vector<std::unique_ptr<PostingThread>> threads;
+    for (int i = 0; i < kPostingThreads; ++i) {
+      threads.push_back(std::make_unique<PostingThread>(
+          &runner, kTasksPerThread, priority, &remaining, &done));
+    }
+    base::TimeTicks start = base::TimeTicks::HighResolutionNow();
+    for (auto& thread : threads) CHECK(thread->Start());
+    done.Wait();
+    base::TimeDelta elapsed = base::TimeTicks::HighResolutionNow() - start;
+    for (auto& thread : threads) thread->Join();
+    runner.Terminate();
+
+    printf(
+        "ThroughputUnderContention(priority=%d, workers=%u, posters=%d): "
+        "%.0f tasks/s\n",
+        static_cast<int>(priority), NumberOfWorkers(), kPostingThreads,
+        kPostingThreads * kTasksPerThread / elapsed.InSecondsF());
+  }
+}
+
+}  // namespace platform
+}  // namespace v8
@@ -268,6 +268,135 @@ TEST(DefaultWorkerThreadsTaskRunnerUnittest, PostAfterTerminate) {
   ASSERT_EQ(1, order[0]);
 }
 
+TEST(DefaultWorkerThreadsTaskRunnerUnittest, TerminateRunsPostedTasks) {
+  FakeClock::set_time(0.0);
+  DefaultWorkerThreadsTaskRunner runner(2, FakeClock::time);
+
+  std::atomic_int count{0};
+  base::Semaphore started_semaphore(0);
+  base::Semaphore blocker_semaphore(0);
+  bool delayed_task_ran = false;
+
+  // Keep both workers busy so that the following tasks are still queued when
+  // the runner is terminated.
+  for (int i = 0; i < 2; ++i) {
+    runner.PostTask(std::make_unique<TestTask>([&] {
+      started_semaphore.Signal();
+      blocker_semaphore.Wait();
+    }));
+  }
+  started_semaphore.Wait();
+  started_semaphore.Wait();
+
+  for (int i = 0; i < 8; ++i) {
+    runner.PostTask(std::make_unique<TestTask>([&] { count++; }));
+  }
+  runner.PostDelayedTask(
+      std::make_unique<TestTask>([&] { delayed_task_ran = true; }), 100);
+
+  // Terminate() joins the workers, so release them from another thread once
+  // the main thread is about to terminate the runner. If they happen to be
+  // released before Terminate() marks the runner as terminated, the tasks just
+  // run a little earlier; either way all of them have to run.
+  base::Semaphore terminating_semaphore(0);
+  class ReleaseThread final : public base::Thread {
+   public:
+    ReleaseThread(base::Semaphore* terminating_semaphore,
+                  base::Semaphore* blocker_semaphore)
+        : Thread(Options("ReleaseThread")),
+          terminating_semaphore_(terminating_semaphore),
+          blocker_semaphore_(blocker_semaphore) {}
+    void Run() override {
+      terminating_semaphore_->Wait();
+      blocker_semaphore_->Signal();
+      blocker_semaphore_->Signal();
+    }
+
+   private:
+    base::Semaphore* terminating_semaphore_;
+    base::Semaphore* blocker_semaphore_;
+  } release_thread(&terminating_semaphore, &blocker_semaphore);
+  CHECK(release_thread.Start());
+
+  terminating_semaphore.Signal();
+  runner.Terminate();
+  release_thread.Join();
+  ASSERT_EQ(8, count.load());
+  ASSERT_FALSE(delayed_task_ran);
+}
+
+TEST(DefaultWorkerThreadsTaskRunnerUnittest, PostTaskWithPriorityOrder) {
+  using Priority = DefaultWorkerThreadsTaskRunner::Priority;
+  DefaultWorkerThreadsTaskRunner runner(1, RealTime);
+
+  std::vector<int> order;
+  base::Semaphore started_semaphore(0);
+  base::Semaphore blocker_semaphore(0);
+  base::Semaphore done_semaphore(0);
+
+  // Keep the only worker busy until all tasks are posted.
+  runner.PostTask(std::make_unique<TestTask>([&] {
+    started_semaphore.Signal();
+    blocker_semaphore.Wait();
+  }));
+  started_semaphore.Wait();
+
+  runner.PostTaskWithPriority(
+      std::make_unique<TestTask>([&] {
+        order.push_back(5);
+        done_semaphore.Signal();
+      }),
+      Priority::kBestEffort);
+  runner.PostTaskWithPriority(
+      std::make_unique<TestTask>([&] { order.push_back(3); }),
+      Priority::kUserVisible);
+  runner.PostTaskWithPriority(
+      std::make_unique<TestTask>([&] { order.push_back(1); }),
+      Priority::kUserBlocking);
+  runner.PostTaskWithPriority(
+      std::make_unique<TestTask>([&] { order.push_back(4); }),
+      Priority::kUserVisible);
+  runner.PostTaskWithPriority(
+      std::make_unique<TestTask>([&] { order.push_back(2); }),
+      Priority::kUserBlocking);
+
+  blocker_semaphore.Signal();
+  done_semaphore.Wait();
+
+  runner.Terminate();
+  ASSERT_EQ(5UL, order.size());
+  for (int i = 0; i < 5; ++i) ASSERT_EQ(i + 1, order[i]);
+}
+
+TEST(DefaultWorkerThreadsTaskRunnerUnittest, StealFromBusyWorker) {
+  DefaultWorkerThreadsTaskRunner runner(2, RealTime);
+
+  std::atomic_int count{0};
+  base::Semaphore started_semaphore(0);
+  base::Semaphore blocker_semaphore(0);
+  base::Semaphore done_semaphore(0);
+
+  runner.PostTask(std::make_unique<TestTask>([&] {
+    started_semaphore.Signal();
+    blocker_semaphore.Wait();
+  }));
+  started_semaphore.Wait();
+
+  // Tasks are spread over both queues, so half of them end up in the queue of
+  // the blocked worker and have to be stolen by the other one.
+  for (int i = 0; i < 8; ++i) {
+    runner.PostTask(std::make_unique<TestTask>([&] {
+      count++;
+      done_semaphore.Signal();
+    }));
+  }
+  for (int i = 0; i < 8; ++i) done_semaphore.Wait();
+
+  blocker_semaphore.Signal();
+  runner.Terminate();
+  ASSERT_EQ(8, count.load());
+}
+
 TEST(DefaultWorkerThreadsTaskRunnerUnittest, NoIdleTasks) {
   DefaultWorkerThreadsTaskRunner runner(1, FakeClock::time);
 
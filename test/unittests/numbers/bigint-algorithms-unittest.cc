@@ -0,0 +1,226 @@
+// Copyright 2020 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include <string>
+#include <vector>
+
+#include "src/base/utils/random-number-generator.h"
+#include "src/numbers/bigint-algorithms-inl.h"
+#include "src/numbers/bigint-algorithms.h"
+
+#include "testing/gtest/include/gtest/gtest.h"
+
+namespace v8 {
+namespace internal {
+namespace bigint {
+
+namespace {
+
+using DigitVector = std::vector<digit_t>;
+
+class BigIntAlgorithmsTest : public ::testing::Test {
+ public:
+  BigIntAlgorithmsTest() : rng_(1234) {}
+
+ protected:
+  // Returns {length} random digits without leading zeros. Every other call
+  // produces digits with long runs of set and cleared bits, which exercise
+  // the carry handling more thoroughly than uniformly random digits.
+  DigitVector RandomDigits(int length) {
+    DigitVector result(length);
+    bool sparse = (++calls_ & 1) == 0;
+    for (digit_t& d : result) {
+      d = static_cast<digit_t>(rng_.NextInt64());
+      if (sparse) d = (d & 1) ? ~digit_t{0} : (d & 2) ? 0 : d;
+    }
+    if (length > 0) {
+      while (result[length - 1] == 0) {
+        result[length - 1] = static_cast<digit_t>(rng_.NextInt64());
+      }
+    }
+    return result;
+  }
+
+  Processor* processor() { return &processor_; }
+
+ private:
+  base::RandomNumberGenerator rng_;
+  Processor processor_;
+  int calls_ = 0;
+};
+
+void Trim(DigitVector* digits) {
+  while (!digits->empty() && digits->back() == 0) digits->pop_back();
+}
+
+DigitVector TrimmedCopy(DigitVector digits) {
+  Trim(&digits);
+  return digits;
+}
+
+// Straightforward reference implementations.
+
+DigitVector ReferenceMultiply(const DigitVector& x, const DigitVector& y) {
+  DigitVector z(x.size() + y.size());
+  for (size_t i = 0; i < x.size(); i++) {
+    digit_t carry = 0;
+    for (size_t j = 0; j < y.size(); j++) {
+      digit_t high;
+      digit_t low = digit_mul(x[i], y[j], &high);
+      digit_t new_carry = 0;
+      z[i + j] = digit_add(z[i + j], low, &new_carry);
+      z[i + j] = digit_add(z[i + j], carry, &new_carry);
+      carry = high + new_carry;
+    }
+    z[i + y.size()] = carry;
+  }
+  Trim(&z);
+  return z;
+}
+
+DigitVector ReferenceAdd(DigitVector x, const DigitVector& y) {
+  x.resize(std::max(x.size(), y.size()) + 1);
+  digit_t carry = 0;
+  for (size_t i = 0; i < x.size(); i++) {
+    digit_t new_carry = 0;
+    x[i] = digit_add(x[i], i < y.size() ? y[i] : 0, &new_carry);
+    x[i] = digit_add(x[i], carry, &new_carry);
+    carry = new_carry;
+  }
+  Trim(&x);
+  return x;
+}
+
+std::string ReferenceToString(DigitVector x, int radix) {
+  std::string result;
+  Trim(&x);
+  while (!x.empty()) {
+    digit_t remainder = 0;
+    for (size_t i = x.size(); i-- > 0;) {
+      x[i] = digit_div(remainder, x[i], radix, &remainder);
+    }
+    result.insert(result.begin(),
+                  "0123456789abcdefghijklmnopqrstuvwxyz"[remainder]);
+    Trim(&x);
+  }
+  return result;
+}
+
+// Parses {string} the way StringToBigIntHelper does: in parts of as many
+// characters as fit into 32 bits.
+DigitVector Parse(Processor* processor, const std::string& string, int radix) {
+  FromStringAccumulator accumulator;
+  size_t i = 0;
+  while (i < string.size()) {
+    uint32_t part = 0, multiplier = 1;
+    for (; i < string.size(); i++) {
+      uint32_t m = multiplier * radix;
+      if (m > 0xFFFFFFFFu / 36) break;
+      char c = string[i];
+      part = part * radix + (c <= '9' ? c - '0' : c - 'a' + 10);
+      multiplier = m;
+    }
+    accumulator.Add(multiplier, part);
+  }
+  DigitVector result(accumulator.ResultLength());
+  accumulator.Finish(processor, RWDigits(&result));
+  Trim(&result);
+  return result;
+}
+
+// Lengths around the algorithm thresholds.
+const int kLengths[] = {1,   2,   5,   33,  34,  35,  56,  57,  58,  100,
+                        192, 193, 194, 250, 400, 577, 1000};
+
+}  // namespace
+
+TEST_F(BigIntAlgorithmsTest, Multiply) {
+  for (int x_length : kLengths) {
+    for (int y_length : kLengths) {
+      DigitVector x = RandomDigits(x_length);
+      DigitVector y = RandomDigits(y_length);
+      // Extra digits in the result must be cleared.
+      DigitVector z(x_length + y_length + 2, 0x5555);
+      Multiply(processor(), RWDigits(&z), Digits(x), Digits(y));
+      EXPECT_EQ(ReferenceMultiply(x, y), TrimmedCopy(z))
+          << x_length << " * " << y_length;
+    }
+  }
+}
+
+TEST_F(BigIntAlgorithmsTest, Divide) {
+  for (int q_length : kLengths) {
+    for (int b_length : kLengths) {
+      if (b_length < 2) continue;
+      DigitVector q = RandomDigits(q_length);
+      DigitVector b = RandomDigits(b_length);
+      DigitVector r = RandomDigits(b_length);
+      r.back() = b.back() - 1;
+      Trim(&r);
+      DigitVector a = ReferenceAdd(ReferenceMultiply(q, b), r);
+
+      DigitVector quotient(a.size() - b.size() + 1);
+      DigitVector remainder(b.size());
+      Divide(processor(), RWDigits(&quotient), RWDigits(&remainder),
+             Digits(a), Digits(b));
+      EXPECT_EQ(q, TrimmedCopy(quotient)) << q_length << " / " << b_length;
+      EXPECT_EQ(r, TrimmedCopy(remainder)) << q_length << " % " << b_length;
+
+      // Either result is optional.
+      DigitVector quotient_only(a.size() - b.size() + 1);
+      Divide(processor(), RWDigits(&quotient_only), RWDigits(nullptr, 0),
+             Digits(a), Digits(b));
+      EXPECT_EQ(q, TrimmedCopy(quotient_only));
+      DigitVector remainder_only(b.size());
+      Divide(processor(), RWDigits(nullptr, 0), RWDigits(&remainder_only),
+             Digits(a), Digits(b));
+      EXPECT_EQ(r, TrimmedCopy(remainder_only));
+    }
+  }
+}
+
+TEST_F(BigIntAlgorithmsTest, ToStringAndParse) {
+  for (int radix : {2, 3, 7, 10, 16, 36}) {
+    for (int length : kLengths) {
+      DigitVector x = RandomDigits(length);
+      std::string expected = ReferenceToString(x, radix);
+      // The result is written to the end of the buffer, which may be exactly
+      // as long as the result.
+      std::vector<char> chars(expected.size());
+      int count = ToString(processor(), chars.data(),
+                           static_cast<int>(chars.size()), Digits(x), radix);
+      ASSERT_EQ(static_cast<int>(expected.size()), count);
+      EXPECT_EQ(expected, std::string(chars.begin(), chars.end()))
+          << "radix " << radix << ", length " << length;
+      EXPECT_EQ(x, Parse(processor(), expected, radix));
+    }
+  }
+}
+
+TEST_F(BigIntAlgorithmsTest, ToStringPowersOfRadix) {
+  // Powers of the radix produce long runs of zeros in the middle of the
+  // result, which must not get lost when splitting the number.
+  for (int zeros : {1, 100, 1000, 5000}) {
+    std::string string = "1" + std::string(zeros, '0') + "1";
+    DigitVector x = Parse(processor(), string, 10);
+    std::vector<char> chars(string.size());
+    int count = ToString(processor(), chars.data(),
+                         static_cast<int>(chars.size()), Digits(x), 10);
+    ASSERT_EQ(static_cast<int>(string.size()), count);
+    EXPECT_EQ(string, std::string(chars.begin(), chars.end()));
+  }
+}
+
+TEST_F(BigIntAlgorithmsTest, Terminate) {
+  Processor processor([]() { return true; });
+  DigitVector x = RandomDigits(30000);
+  DigitVector y = RandomDigits(30000);
+  DigitVector z(60000);
+  Multiply(&processor, RWDigits(&z), Digits(x), Digits(y));
+  EXPECT_TRUE(processor.terminated());
+}
+
+}  // namespace bigint
+}  // namespace internal
+}  // namespace v8
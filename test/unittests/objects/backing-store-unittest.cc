@@ -3,7 +3,12 @@
 // found in the LICENSE file.
 
 #include "src/objects/backing-store.h"
+
+#include <cstring>
+#include <vector>
+
 #include "src/base/platform/platform.h"
+#include "src/heap/heap.h"
 #include "test/unittests/test-utils.h"
 
 #include "testing/gtest/include/gtest/gtest.h"
@@ -124,5 +129,84 @@ TEST_F(BackingStoreTest, RacyGrowWasmMemoryInPlace) {
   }
 }
 
+TEST_F(BackingStoreTest, PooledAllocationIsRecycled) {
+  const std::shared_ptr<BackingStorePool>& pool =
+      isolate()->heap()->backing_store_pool();
+  if (!pool) return;
+  pool->SetMaxSize(1 * MB);
+  const size_t initial_size = pool->size();
+
+  auto bs1 = BackingStore::Allocate(isolate(), 10000, SharedFlag::kNotShared,
+                                    InitializedFlag::kZeroInitialized);
+  CHECK(bs1);
+  EXPECT_TRUE(bs1->is_pooled());
+  EXPECT_EQ(10000u, bs1->byte_length());
+  EXPECT_EQ(12u * KB, bs1->byte_capacity());
+  void* buffer_start = bs1->buffer_start();
+  memset(buffer_start, 0xAB, bs1->byte_capacity());
+  bs1.reset();
+  EXPECT_EQ(initial_size + 12u * KB, pool->size());
+
+  // A buffer of the same size class is reused and zeroed.
+  auto bs2 = BackingStore::Allocate(isolate(), 9000, SharedFlag::kNotShared,
+                                    InitializedFlag::kZeroInitialized);
+  CHECK(bs2);
+  EXPECT_EQ(buffer_start, bs2->buffer_start());
+  EXPECT_EQ(initial_size, pool->size());
+  const uint8_t* bytes = static_cast<const uint8_t*>(bs2->buffer_start());
+  for (size_t i = 0; i < bs2->byte_length(); i++) {
+    EXPECT_EQ(0, bytes[i]);
+  }
+
+  // Reallocation moves the memory out of the pool and zeroes the tail.
+  EXPECT_TRUE(bs2->Reallocate(isolate(), 16 * KB));
+  EXPECT_FALSE(bs2->is_pooled());
+  bytes = static_cast<const uint8_t*>(bs2->buffer_start());
+  for (size_t i = 0; i < bs2->byte_length(); i++) {
+    EXPECT_EQ(0, bytes[i]);
+  }
+  bs2.reset();
+  EXPECT_EQ(initial_size, pool->size());
+}
+
+TEST_F(BackingStoreTest, PoolOnlyTakesSmallNonSharedBackingStores) {
+  const std::shared_ptr<BackingStorePool>& pool =
+      isolate()->heap()->backing_store_pool();
+  if (!pool) return;
+  pool->SetMaxSize(1 * MB);
+
+  auto small = BackingStore::Allocate(isolate(), 100, SharedFlag::kNotShared,
+                                      InitializedFlag::kZeroInitialized);
+  EXPECT_FALSE(small->is_pooled());
+  auto large = BackingStore::Allocate(isolate(), 1 * MB, SharedFlag::kNotShared,
+                                      InitializedFlag::kZeroInitialized);
+  EXPECT_FALSE(large->is_pooled());
+  auto shared = BackingStore::Allocate(isolate(), 8 * KB, SharedFlag::kShared,
+                                       InitializedFlag::kZeroInitialized);
+  EXPECT_FALSE(shared->is_pooled());
+}
+
+TEST_F(BackingStoreTest, PoolRespectsMaxSize) {
+  const std::shared_ptr<BackingStorePool>& pool =
+      isolate()->heap()->backing_store_pool();
+  if (!pool) return;
+  pool->SetMaxSize(1 * MB);
+
+  std::vector<std::unique_ptr<BackingStore>> backing_stores;
+  for (int i = 0; i < 8; i++) {
+    backing_stores.push_back(BackingStore::Allocate(
+        isolate(), 64 * KB, SharedFlag::kNotShared,
+        InitializedFlag::kUninitialized));
+  }
+  pool->SetMaxSize(pool->size() + 3 * 64 * KB);
+  const size_t max_size = pool->max_size();
+  backing_stores.clear();
+  EXPECT_EQ(max_size, pool->size());
+
+  // Lowering the maximum frees cached memory right away.
+  pool->SetMaxSize(0);
+  EXPECT_EQ(0u, pool->size());
+}
+
 }  // namespace internal
 }  // namespace v8
@@ -0,0 +1,154 @@
+// Copyright 2020 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Micro-benchmarks for passing large values through ValueSerializer and
+// ValueDeserializer, with and without out-of-band backing stores and parallel
+// deserialization. They are disabled by default; run them with
+//   unittests --gtest_also_run_disabled_tests \
+//             --gtest_filter=*ValueSerializerBenchmark*
+
+#include <cstdio>
+#include <cstdlib>
+#include <memory>
+#include <vector>
+
+#include "include/v8.h"
+#include "src/base/platform/time.h"
+#include "src/flags/flags.h"
+#include "test/unittests/test-utils.h"
+#include "testing/gtest/include/gtest/gtest.h"
+
+namespace v8 {
+namespace {
+
+// Keeps the out-of-band backing stores of one message, like an embedder's
+// postMessage implementation would.
+class MessageDelegate : public ValueSerializer::Delegate,
+                        public ValueDeserializer::Delegate {
+ public:
+  explicit MessageDelegate(Isolate* isolate) : isolate_(isolate) {}
+
+  void ThrowDataCloneError(Local<String> message) override {
+    isolate_->ThrowException(Exception::Error(message));
+  }
+
+  Maybe<uint32_t> GetOutOfBandBackingStoreId(
+      Isolate* isolate, std::shared_ptr<BackingStore> backing_store) override {
+    out_of_band_bytes_ += backing_store->ByteLength();
+    backing_stores_.push_back(std::move(backing_store));
+    return Just(static_cast<uint32_t>(backing_stores_.size() - 1));
+  }
+
+  std::shared_ptr<BackingStore> GetOutOfBandBackingStoreFromId(
+      Isolate* isolate, uint32_t id) override {
+    if (id >= backing_stores_.size()) return nullptr;
+    return backing_stores_[id];
+  }
+
+  size_t out_of_band_bytes() const { return out_of_band_bytes_; }
+
+ private:
+  Isolate* isolate_;
+  std::vector<std::shared_ptr<BackingStore>> backing_stores_;
+  size_t out_of_band_bytes_ = 0;
+};
+
+class ValueSerializerBenchmark : public TestWithContext {
+ protected:
+  struct Result {
+    double latency_us;
+    size_t message_bytes;
+    size_t out_of_band_bytes;
+  };
+
+  // Serializes |value| into one context and deserializes it into another,
+  // |kIterations| times, and reports the averages per message.
+  Result Measure(Local<Value> value, size_t out_of_band_threshold) {
+    constexpr int kIterations = 20;
+    Local<Context> receiving_context = Context::New(isolate());
+    Result result = {0, 0, 0};
+    base::TimeDelta total;
+    for (int i = 0; i < kIterations; i++) {
+      HandleScope handle_scope(isolate());
+      MessageDelegate delegate(isolate());
+      base::TimeTicks start = base::TimeTicks::HighResolutionNow();
+
+      ValueSerializer serializer(isolate(), &delegate);
+      serializer.SetOutOfBandThreshold(out_of_band_threshold);
+      serializer.WriteHeader();
+      CHECK(serializer.WriteValue(context(), value).FromJust());
+      std::pair<uint8_t*, size_t> buffer = serializer.Release();
+
+      {
+        Context::Scope scope(receiving_context);
+        ValueDeserializer deserializer(isolate(), buffer.first, buffer.second,
+                                       &delegate);
+        CHECK(deserializer.ReadHeader(receiving_context).FromJust());
+        CHECK(!deserializer.ReadValue(receiving_context).IsEmpty());
+      }
+
+      total += base::TimeTicks::HighResolutionNow() - start;
+      result.message_bytes = buffer.second;
+      result.out_of_band_bytes = delegate.out_of_band_bytes();
+      free(buffer.first);
+    }
+    result.latency_us =
+        static_cast<double>(total.InMicroseconds()) / kIterations;
+    return result;
+  }
+
+  void Report(const char* name, Local<Value> value) {
+    const size_t kThresholds[] = {0, 64 * 1024};
+    for (size_t threshold : kThresholds) {
+      Result result = Measure(value, threshold);
+      // Message bytes are copied twice (into the buffer and out of it again),
+      // out-of-band bytes once (into the backing store).
+      size_t bytes_copied = 2 * result.message_bytes + result.out_of_band_bytes;
+      printf(
+          "%s(out_of_band_threshold=%zu): %.1fus/message, %zu bytes copied "
+          "(%zu in message, %zu out of band)\n",
+          name, threshold, result.latency_us, bytes_copied,
+          result.message_bytes, result.out_of_band_bytes);
+    }
+  }
+};
+
+TEST_F(ValueSerializerBenchmark, DISABLED_LargeTypedArray) {
+  Report("LargeTypedArray(8MB)",
+         RunJS("new Float64Array(1024 * 1024).map((_, i) => i)"));
+}
+
+TEST_F(ValueSerializerBenchmark, DISABLED_LargeOneByteString) {
+  Report("LargeOneByteString(8MB)", RunJS("'abcdefgh'.repeat(1024 * 1024)"));
+}
+
+TEST_F(ValueSerializerBenchmark, DISABLED_LargeTwoByteString) {
+  Report("LargeTwoByteString(8MB)",
+         RunJS("'\\u2603\\u2604'.repeat(2 * 1024 * 1024)"));
+}
+
+TEST_F(ValueSerializerBenchmark, DISABLED_MixedMessage) {
+  Report("MixedMessage",
+         RunJS("({ id: 42, name: 'job', samples: new Int32Array(1 << 18),"
+               "   log: 'x'.repeat(1 << 20), small: [1, 2, 3] })"));
+}
+
+TEST_F(ValueSerializerBenchmark, DISABLED_ManySmallObjects) {
+  Local<Value> value =
+      RunJS("Array.from({length: 100000}, (_, i) => ({ id: i, x: i / 2,"
+            "  name: 'item' + i, tags: ['a', 'b'], parent: { id: i >> 4 } }))");
+  const bool saved_flag = i::FLAG_parallel_value_deserialization;
+  for (bool parallel : {false, true}) {
+    i::FLAG_parallel_value_deserialization = parallel;
+    Result result = Measure(value, 0);
+    printf(
+        "ManySmallObjects(parallel_value_deserialization=%d): "
+        "%.1fus/message\n",
+        parallel, result.latency_us);
+  }
+  i::FLAG_parallel_value_deserialization = saved_flag;
+}
+
+}  // namespace
+}  // namespace v8
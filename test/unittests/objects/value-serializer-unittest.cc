@@ -2166,6 +2166,236 @@ TEST_F(ValueSerializerTestWithSharedArrayBufferClone,
   i::FLAG_experimental_wasm_threads = flag_was_enabled;
 }
 
+class ValueSerializerTestWithOutOfBandData : public ValueSerializerTest {
+ protected:
+  static const size_t kThreshold = 64;
+
+  ValueSerializerTestWithOutOfBandData()
+      : serializer_delegate_(this), deserializer_delegate_(this) {}
+
+  class SerializerDelegate : public ValueSerializer::Delegate {
+   public:
+    explicit SerializerDelegate(ValueSerializerTestWithOutOfBandData* test)
+        : test_(test) {}
+    Maybe<uint32_t> GetOutOfBandBackingStoreId(
+        Isolate* isolate,
+        std::shared_ptr<BackingStore> backing_store) override {
+      if (!test_->accept_out_of_band_) return Nothing<uint32_t>();
+      test_->backing_stores_.push_back(std::move(backing_store));
+      return Just(static_cast<uint32_t>(test_->backing_stores_.size() - 1));
+    }
+    void ThrowDataCloneError(Local<String> message) override {
+      test_->isolate()->ThrowException(Exception::Error(message));
+    }
+
+   private:
+    ValueSerializerTestWithOutOfBandData* test_;
+  };
+
+  class DeserializerDelegate : public ValueDeserializer::Delegate {
+   public:
+    explicit DeserializerDelegate(ValueSerializerTestWithOutOfBandData* test)
+        : test_(test) {}
+    std::shared_ptr<BackingStore> GetOutOfBandBackingStoreFromId(
+        Isolate* isolate, uint32_t id) override {
+      if (id >= test_->backing_stores_.size()) return nullptr;
+      return test_->backing_stores_[id];
+    }
+
+   private:
+    ValueSerializerTestWithOutOfBandData* test_;
+  };
+
+  ValueSerializer::Delegate* GetSerializerDelegate() override {
+    return &serializer_delegate_;
+  }
+  void BeforeEncode(ValueSerializer* serializer) override {
+    serializer->SetOutOfBandThreshold(kThreshold);
+  }
+  ValueDeserializer::Delegate* GetDeserializerDelegate() override {
+    return &deserializer_delegate_;
+  }
+
+  std::vector<std::shared_ptr<BackingStore>> backing_stores_;
+  bool accept_out_of_band_ = true;
+
+ private:
+  SerializerDelegate serializer_delegate_;
+  DeserializerDelegate deserializer_delegate_;
+};
+
+TEST_F(ValueSerializerTestWithOutOfBandData, RoundTripArrayBuffer) {
+  std::vector<uint8_t> encoded = EncodeTest(
+      "globalThis.source = new Uint8Array(1000).map((_, i) => i & 0xFF);"
+      "source.buffer");
+  // Only the ID of the contents is written to the buffer.
+  ASSERT_EQ(1u, backing_stores_.size());
+  EXPECT_EQ(1000u, backing_stores_[0]->ByteLength());
+  EXPECT_LT(encoded.size(), 16u);
+
+  // The contents were copied when serializing, so later writes to the source
+  // are not visible in the result.
+  EvaluateScriptForInput("source[1] = 0");
+  Local<Value> value = DecodeTest(encoded);
+  ASSERT_TRUE(value->IsArrayBuffer());
+  EXPECT_EQ(backing_stores_[0]->Data(),
+            value.As<ArrayBuffer>()->GetBackingStore()->Data());
+  ExpectScriptTrue("result.byteLength === 1000");
+  ExpectScriptTrue("new Uint8Array(result).every((x, i) => x === (i & 0xFF))");
+}
+
+TEST_F(ValueSerializerTestWithOutOfBandData, RoundTripTypedArray) {
+  Local<Value> value = RoundTripTest(
+      "({ a: new Uint16Array(100).fill(7), b: new Uint8Array(10) })");
+  ASSERT_TRUE(value->IsObject());
+  // The small buffer stays in the serialized data.
+  EXPECT_EQ(1u, backing_stores_.size());
+  ExpectScriptTrue("result.a instanceof Uint16Array");
+  ExpectScriptTrue("result.a.length === 100");
+  ExpectScriptTrue("result.a.every(x => x === 7)");
+  ExpectScriptTrue("result.b instanceof Uint8Array");
+  ExpectScriptTrue("result.b.length === 10");
+}
+
+TEST_F(ValueSerializerTestWithOutOfBandData, RoundTripStrings) {
+  Local<Value> value = RoundTripTest(
+      "({ small: 'abc', one_byte: 'a'.repeat(100) + '\\xFF',"
+      "   two_byte: '\\u2603'.repeat(100) })");
+  ASSERT_TRUE(value->IsObject());
+  EXPECT_EQ(2u, backing_stores_.size());
+  ExpectScriptTrue("result.small === 'abc'");
+  ExpectScriptTrue("result.one_byte === 'a'.repeat(100) + '\\xFF'");
+  ExpectScriptTrue("result.two_byte === '\\u2603'.repeat(100)");
+
+  Local<Context> context = deserialization_context();
+  Local<Object> result = value.As<Object>();
+  Local<Value> one_byte =
+      result->Get(context, StringFromUtf8("one_byte")).ToLocalChecked();
+  Local<Value> two_byte =
+      result->Get(context, StringFromUtf8("two_byte")).ToLocalChecked();
+  EXPECT_TRUE(one_byte.As<String>()->IsExternalOneByte());
+  EXPECT_TRUE(two_byte.As<String>()->IsExternal());
+}
+
+TEST_F(ValueSerializerTestWithOutOfBandData, DelegateDeclines) {
+  accept_out_of_band_ = false;
+  RoundTripTest("({ a: new Uint8Array(1000).fill(1), b: 'b'.repeat(1000) })");
+  EXPECT_TRUE(backing_stores_.empty());
+  ExpectScriptTrue("result.a.length === 1000 && result.a.every(x => x === 1)");
+  ExpectScriptTrue("result.b === 'b'.repeat(1000)");
+}
+
+TEST_F(ValueSerializerTestWithOutOfBandData, DecodeInvalidId) {
+  // Out-of-band ArrayBuffer and strings whose backing store does not exist.
+  InvalidDecodeTest({0xFF, 0x0D, 0x58, 0x00});
+  InvalidDecodeTest({0xFF, 0x0D, 0x4F, 0x00});
+  InvalidDecodeTest({0xFF, 0x0D, 0x57, 0x00});
+}
+
+class ValueSerializerTestWithParallelDeserialization
+    : public ValueSerializerTest {
+ protected:
+  ValueSerializerTestWithParallelDeserialization()
+      : saved_enabled_(i::FLAG_parallel_value_deserialization),
+        saved_min_size_(i::FLAG_parallel_value_deserialization_min_size) {
+    // Index every payload, however small.
+    i::FLAG_parallel_value_deserialization = true;
+    i::FLAG_parallel_value_deserialization_min_size = 0;
+  }
+
+  ~ValueSerializerTestWithParallelDeserialization() override {
+    i::FLAG_parallel_value_deserialization = saved_enabled_;
+    i::FLAG_parallel_value_deserialization_min_size = saved_min_size_;
+  }
+
+ private:
+  bool saved_enabled_;
+  size_t saved_min_size_;
+};
+
+TEST_F(ValueSerializerTestWithParallelDeserialization, RoundTripManyObjects) {
+  RoundTripTest(
+      "Array.from({length: 10000}, (_, i) => {"
+      "  const o = {id: i};"
+      "  for (let j = 0; j < i % 8; j++) o['p' + j] = {x: j, y: [j]};"
+      "  return o;"
+      "})");
+  ExpectScriptTrue("result.length === 10000");
+  ExpectScriptTrue(
+      "result.every((o, i) => o.id === i &&"
+      "    Object.keys(o).length === 1 + i % 8 &&"
+      "    Object.keys(o).slice(1).every((k, j) => k === 'p' + j &&"
+      "        o[k].x === j && o[k].y[0] === j))");
+}
+
+TEST_F(ValueSerializerTestWithParallelDeserialization, RoundTripMixedValues) {
+  RoundTripTest(
+      "(() => {"
+      "  const shared = {s: 'shared'};"
+      "  const buffer = new ArrayBuffer(16);"
+      "  return {"
+      "    a: shared, b: shared, c: new Map([[1, {m: 1}]]), d: new Set([{}]),"
+      "    e: new Date(1), f: /ab+c/gi, g: new Error('boom'), h: 1n << 100n,"
+      "    i: new Number(1.5), j: new String('s'), k: [1, , {k: 3}],"
+      "    l: new Uint8Array(buffer, 4, 8), m: new Uint16Array(buffer),"
+      "    n: Object.assign([], {1000: {n: 1}}), o: '\u2603', 2: {q: -1},"
+      "    p: {p: {p: {p: {}}}},"
+      "  };"
+      "})()");
+  ExpectScriptTrue("result.a === result.b && result.a.s === 'shared'");
+  ExpectScriptTrue("result.c.get(1).m === 1");
+  ExpectScriptTrue("[...result.d][0].constructor === Object");
+  ExpectScriptTrue("result.e.getTime() === 1");
+  ExpectScriptTrue("result.f.source === 'ab+c' && result.f.flags === 'gi'");
+  ExpectScriptTrue("result.g.message === 'boom'");
+  ExpectScriptTrue("result.h === 1n << 100n");
+  ExpectScriptTrue("result.i.valueOf() === 1.5");
+  ExpectScriptTrue("result.j.valueOf() === 's'");
+  ExpectScriptTrue("!(1 in result.k) && result.k[2].k === 3");
+  ExpectScriptTrue("result.l.buffer === result.m.buffer");
+  ExpectScriptTrue("result.l.byteOffset === 4 && result.l.length === 8");
+  ExpectScriptTrue("result.n.length === 1001 && result.n[1000].n === 1");
+  ExpectScriptTrue("result.o === '\u2603' && result[2].q === -1");
+  ExpectScriptTrue("Object.keys(result.p.p.p.p).length === 0");
+}
+
+TEST_F(ValueSerializerTestWithParallelDeserialization, RoundTripLargeObjects) {
+  // More properties than maps are preallocated for, or than the index
+  // records.
+  RoundTripTest(
+      "[100, 200, 300].map(n => {"
+      "  const o = {};"
+      "  for (let i = 0; i < n; i++) o['p' + i] = i;"
+      "  return o;"
+      "})");
+  ExpectScriptTrue(
+      "result.every((o, i) => Object.keys(o).length === 100 * (i + 1) &&"
+      "    Object.entries(o).every(([k, v]) => k === 'p' + v))");
+}
+
+TEST_F(ValueSerializerTestWithParallelDeserialization, RoundTripDeeplyNested) {
+  // Deeper than the index scans.
+  RoundTripTest(
+      "(() => {"
+      "  let o = {};"
+      "  for (let i = 0; i < 2000; i++) o = {o, i};"
+      "  return o;"
+      "})()");
+  ExpectScriptTrue(
+      "(() => {"
+      "  let i = 1999;"
+      "  for (let o = result; o.o; o = o.o, i--) if (o.i !== i) return false;"
+      "  return i === -1;"
+      "})()");
+}
+
+TEST_F(ValueSerializerTestWithParallelDeserialization, DecodeInvalid) {
+  // Truncated object, and an object count that does not match.
+  InvalidDecodeTest({0xFF, 0x0D, 0x6F, 0x22, 0x01, 0x61});
+  InvalidDecodeTest(
+      {0xFF, 0x0D, 0x6F, 0x22, 0x01, 0x61, 0x49, 0x02, 0x7B, 0x02});
+}
+
 TEST_F(ValueSerializerTest, UnsupportedHostObject) {
   InvalidEncodeTest("new ExampleHostObject()");
   InvalidEncodeTest("({ a: new ExampleHostObject() })");